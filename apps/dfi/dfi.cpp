@@ -60,6 +60,7 @@ typedef double TFloat;
         double      entropy;
         bool        maximal;
         CharString  output;
+        unsigned    threads;
 
         DFIOptions()
         {
@@ -69,6 +70,7 @@ typedef double TFloat;
             growthRate = 0;
             entropy = 0;
             maximal = false;
+            threads = 1;
         }
     };
 
@@ -527,6 +529,10 @@ int runDFI(
 	unsigned			freqSumLast = ~0;
 #endif
 
+	// with several threads, the hull is built before the traversal
+	if (options.threads > 1)
+		indexCreate(index, WotdDir(), Parallel());
+
 	TIter it(index);
 	goBegin(it);
 
@@ -711,6 +717,12 @@ void setUpArgumentParser(ArgumentParser & parser, DFIOptions const &)
     setValidValues(parser, "alphabet", "dna protein char");
     setDefaultValue(parser, "alphabet", "char");
 	addOption(parser, ArgParseOption("m", "maximal", "Output only left and right maximal substrings."));
+#ifdef _OPENMP
+    addOption(parser, ArgParseOption("t", "threads", "Number of threads used to build the index.",
+                                     ArgParseOption::INTEGER));
+    setMinValue(parser, "threads", "1");
+    setDefaultValue(parser, "threads", "1");
+#endif
 
 
 /*
@@ -752,6 +764,9 @@ extractOptions(
     if (alphabetString == "protein") options.alphabet = 1;
     if (alphabetString == "dna") options.alphabet = 2;
 	getOptionValue(options.maximal, parser, "maximal");
+#ifdef _OPENMP
+	getOptionValue(options.threads, parser, "threads");
+#endif
 
     unsigned numDatabases = getArgumentValueCount(parser, 0);
 
@@ -826,6 +841,7 @@ int main(int argc, const char *argv[])
         cerr << "Exiting ..." << endl;
         return 1;
     }
+    omp_set_num_threads(options.threads);
 
 	switch (options.predicate)
 	{
@@ -312,6 +312,9 @@ struct FionaOptions
     bool limitCorrPerRound;
     bool trimNsOnOutput;
     unsigned numSuperPackages;
+    // Upper bound for the memory of the reads, the q-gram directory and the partial q-gram index in MiB.  If non-zero,
+    // the number of super packages is chosen such that each partial q-gram index fits into the remaining memory.
+    uint64_t memoryLimit;
 
     FionaOptions()
     {
@@ -349,6 +352,7 @@ struct FionaOptions
         loopLevel = -1;
         appendCorrectionInfo = false;
         numSuperPackages = 10;
+        memoryLimit = 0;
     }
 };
 
@@ -422,10 +426,26 @@ void printOptions(std::ostream & out, FionaOptions const & options)
         out << "  LOOP LEVEL               " << options.loopLevel << "\n";
     out << "  APPEND CORRECTION INFO   " << yesNo(options.appendCorrectionInfo) << "\n"
         << "  NUM THREADS              " << options.numThreads << "\n"
-        << "\n";
+        << "  SUPER PACKAGES           " << options.numSuperPackages << "\n";
+    if (options.memoryLimit != 0)
+        out << "  MEMORY LIMIT             " << options.memoryLimit << " MiB\n";
+    out << "\n";
 }
 
-// used for profiling
+// a correction found while traversing a work package, it is added to the correction list when the package is done
+struct FionaPendingCorrection
+{
+    unsigned        errorReadId;
+    unsigned        correctReadId;
+    unsigned short  correctPos;
+    unsigned        errorPos;
+    unsigned        overlap;
+    bool            strand;
+    signed char     indelLength;
+    Dna5            correctSeq[MAX_INDEL_LENGTH];
+};
+
+// used for profiling and to collect the corrections of a work package
 struct FionaResources
 {
     unsigned long   bucketBegin;
@@ -433,6 +453,7 @@ struct FionaResources
     double          cpuTime;
     unsigned        investigatedNodes;
     unsigned        putCorrections;
+    String<FionaPendingCorrection> pendingCorrections;
 
     FionaResources():
         bucketBegin(0),
@@ -619,10 +640,11 @@ namespace seqan2
 
         GreaterBucketSize(TDir const &dir_): dir(dir_) {}
 
+        // buckets of equal size are ordered by their hash, the masked buckets must not depend on the sort algorithm
         inline bool
         operator () (unsigned a, unsigned b)
         {
-            return dir[a] > dir[b];
+            return dir[a] > dir[b] || (dir[a] == dir[b] && a < b);
         }
     };
 
@@ -1419,6 +1441,54 @@ inline void addCorrectionEntry(String<TCorrection> &correctionList,
     return;
 }
 
+/*
+append a correction found in a work package to the package's pending corrections,
+the correction list is only touched when the package is done
+*/
+template <typename TPos1, typename TPos2, typename TOverlap>
+inline void addPendingCorrection(FionaResources &resources,
+                                 unsigned erroneousReadId,
+                                 unsigned correctReadId,
+                                 TPos1 correctPos,
+                                 TPos2 errorPos,
+                                 TOverlap overlap,
+                                 bool strand,
+                                 signed char indelLength,
+                                 Dna5 const correctSeq[])
+{
+    FionaPendingCorrection pending;
+    pending.errorReadId = erroneousReadId;
+    pending.correctReadId = correctReadId;
+    pending.correctPos = correctPos;
+    pending.errorPos = errorPos;
+    pending.overlap = overlap;
+    pending.strand = strand;
+    pending.indelLength = indelLength;
+    for (unsigned i = 0; i < MAX_INDEL_LENGTH; ++i)
+        pending.correctSeq[i] = correctSeq[i];
+    appendValue(resources.pendingCorrections, pending);
+}
+
+/*
+add the pending corrections of a work package to the correction list
+*/
+template <typename TCorrection, typename TValue, typename TReadStore>
+inline void flushPendingCorrections(String<TCorrection> &correctionList,
+                                    String<TValue> &firstCorrectionForRead,
+                                    FionaResources &resources,
+                                    TReadStore & store)
+{
+    typedef Iterator<String<FionaPendingCorrection>, Standard>::Type TIter;
+
+    TIter itEnd = end(resources.pendingCorrections, Standard());
+    for (TIter it = begin(resources.pendingCorrections, Standard()); it != itEnd; ++it)
+        addCorrectionEntry(correctionList, firstCorrectionForRead, it->errorReadId, it->correctReadId,
+                           it->correctPos, it->errorPos, it->overlap, it->strand, it->indelLength, store,
+                           it->correctSeq);
+    clear(resources.pendingCorrections);
+    shrinkToFit(resources.pendingCorrections);
+}
+
    template <typename TCorrection,typename TValue,typename TReadStore>
         inline void  _testCorrectionStruct(String<TCorrection> &correctionList, String<TValue> &firstCorrectionForRead,TReadStore &store)
     {
@@ -3999,22 +4069,17 @@ if (LOOP_LEVEL != 0)
                                     } */
 
                         // 1. add major mismatch/indel correction
-                        SEQAN_OMP_PRAGMA(critical(addCorrection))
-                        {
-                            ++resources.putCorrections;
-                            addCorrectionEntry(
-                                correctionList,
-                                firstCorrectionForRead,
-                                errorReadId,
-                                bestCorrection[i].readId,
-                                bestCorrection[i].correctPos,
-                                positionError,
-                                overlapSum,
-                                strand,
-                                indel,
-                                store,
-                                correctSeq);
-                        }
+                        ++resources.putCorrections;
+                        addPendingCorrection(
+                            resources,
+                            errorReadId,
+                            bestCorrection[i].readId,
+                            bestCorrection[i].correctPos,
+                            positionError,
+                            overlapSum,
+                            strand,
+                            indel,
+                            correctSeq);
 
                         if (indel == 0)
                         {
@@ -4046,11 +4111,8 @@ if (LOOP_LEVEL != 0)
                                     correctSeq[0] = (Dna5)maxBase;
                                     if (strand)
                                         correctSeq[0] = FunctorComplement<Dna5>()(correctSeq[0]);
-                                    SEQAN_OMP_PRAGMA(critical(addCorrection))
-                                    {
-                                        ++resources.putCorrections;
-                                        addCorrectionEntry(correctionList,firstCorrectionForRead,errorReadId,bestCorrection[i].readId,bestCorrection[i].correctPos,itE-itEBegin,consOverlapSum,strand,indel,store,correctSeq);
-                                    }
+                                    ++resources.putCorrections;
+                                    addPendingCorrection(resources,errorReadId,bestCorrection[i].readId,bestCorrection[i].correctPos,itE-itEBegin,consOverlapSum,strand,indel,correctSeq);
 
                                     //std::cout << "replace " << *itE << " at position " << (itE - itEBegin) << " in read " << errorReadId;
                                     //std::cout << " by " << (Dna5)maxBase << " (support=" << (*itCons).count[maxBase] << ")" << std::endl;
@@ -4094,15 +4156,8 @@ if (LOOP_LEVEL != 0)
 #else // FIONA_CONSENSUS
                         if (indel <= 0) //only get string if insertion in read or mismatch
                             getCorrectionString(correctSeq,indel,bestCorrection[i].readId,bestCorrection[i].correctPos,strand,store);
-                        SEQAN_OMP_PRAGMA(critical(addCorrection))
-                        {
-             /*std::ofstream myfile;
-myfile.open ("EntryOutput.txt",std::ios::app);
-myfile << "beforeEntry " << " "<< errorReadId<< " "<<bestCorrection[i].readId<< " "<<bestCorrection[i].correctPos<< " "<<positionError<< " "<<(int)indel << " " << overlapSum << " " <<representative(iter) <<"endEntry" << std::endl;
-myfile.close();*/
-                            ++resources.putCorrections;
-                            addCorrectionEntry(correctionList,firstCorrectionForRead,errorReadId,bestCorrection[i].readId,bestCorrection[i].correctPos,positionError,overlapSum,strand,indel,store,correctSeq);
-                        }
+                        ++resources.putCorrections;
+                        addPendingCorrection(resources,errorReadId,bestCorrection[i].readId,bestCorrection[i].correctPos,positionError,overlapSum,strand,indel,correctSeq);
 #endif // FIONA_CONSENSUS
                     }
 
@@ -4150,6 +4205,48 @@ determineFrequency(Iter< TFionaIndex, VSTree<TSpec> > iter)
     return frequency;
 }
 
+// Partition the q-gram buckets into super packages of consecutive buckets, each one is processed with its own partial
+// q-gram index.  Without a limit (maxSuffixes == 0) the suffixes are distributed evenly over numPackages super packages,
+// otherwise a super package takes buckets as long as it has at most maxSuffixes suffixes (single buckets may exceed it).
+// superPackages receives the first bucket of each super package followed by the end bucket.
+template <typename TDir>
+void computeSuperPackages(String<uint64_t> & superPackages,
+                          TDir const & dir,
+                          uint64_t numSuffixes,
+                          unsigned numPackages,
+                          uint64_t maxSuffixes)
+{
+    typedef typename Value<TDir>::Type TDirValue;
+
+    unsigned dirLen = length(dir);
+    uint64_t sumSuffixes = 0;
+    uint64_t packageSuffixes = 0;
+
+    clear(superPackages);
+    appendValue(superPackages, 0);
+    for (unsigned i = 0; i + 1 < dirLen; ++i)
+    {
+        if (dir[i] == (TDirValue)-1)
+            continue;
+
+        bool full;
+        if (maxSuffixes != 0)
+            full = packageSuffixes + dir[i] > maxSuffixes;
+        else
+            full = length(superPackages) < numPackages &&
+                   sumSuffixes >= (length(superPackages) * numSuffixes) / numPackages;
+
+        if (full && packageSuffixes != 0)
+        {
+            appendValue(superPackages, i);
+            packageSuffixes = 0;
+        }
+        sumSuffixes += dir[i];
+        packageSuffixes += dir[i];
+    }
+    appendValue(superPackages, dirLen - 1);
+}
+
 /*construction Suffix Array */
 template <typename TFragmentStore, typename TAlgorithm>
 unsigned correctReads(
@@ -4622,6 +4719,7 @@ unsigned correctReads(
     /*the core of the correction method*/
     FionaResources resources;
     traverseAndSearchCorrections<-1>(myConstrainedIterator, store, correctionList, firstCorrectionForRead, options, alg,maxReadLength, resources);
+    flushPendingCorrections(correctionList, firstCorrectionForRead, resources, store);
 
     if (options.verbosity >= 2)
         std::cerr << "Time for searching between given levels: "<< SEQAN_PROTIMEDIFF(search) << " seconds." << std::endl
@@ -4672,30 +4770,39 @@ unsigned correctReads(
         if (origDir[i] != (TQGramDirValue)-1)
             numSuffixes += origDir[i];
 
-    String<uint64_t> superPackages;
-    uint64_t sumSuffixes = 0;
-    uint64_t nextThresh = 0;
-    for (unsigned i = 0; i < dirLen; ++i)
+    // with a memory limit, the partial suffix arrays get what remains after the reads, both q-gram directories and the
+    // correction bookkeeping
+    uint64_t maxSuffixes = 0;
+    if (options.memoryLimit != 0)
     {
-        if (nextThresh <= sumSuffixes)
-        {
-            appendValue(superPackages, i);
-            nextThresh = (length(superPackages) * numSuffixes) / (uint64_t)options.numSuperPackages;
-        }
-        if (origDir[i] != (TQGramDirValue)-1)
-            sumSuffixes += origDir[i];
+        uint64_t fixedMemory = lengthSum(store.readSeqStore) * sizeof(Dna5)
+                             + length(store.readSeqStore) * sizeof(TRead)
+                             + length(prefixes) * sizeof(TReadPrefix)
+                             + 2 * (uint64_t)dirLen * sizeof(TQGramDirValue)
+                             + length(firstCorrectionForRead) * sizeof(unsigned)
+                             + capacity(correctionList) * sizeof(CorrectionIndelPos);
+        uint64_t limit = options.memoryLimit << 20;
+        if (fixedMemory < limit)
+            maxSuffixes = _max((uint64_t)1, (limit - fixedMemory) / sizeof(TSAValue));
+        else if (options.verbosity >= 1)
+            std::cerr << "warning: memory limit is below the " << (fixedMemory >> 20) << " MiB needed for reads and "
+                      << "q-gram directory, using " << options.numSuperPackages << " super packages" << std::endl;
     }
 
+    String<uint64_t> superPackages;
+    computeSuperPackages(superPackages, origDir, numSuffixes, options.numSuperPackages, maxSuffixes);
+    unsigned numSuperPackages = length(superPackages) - 1;
+
     if (options.verbosity >= 1)
-        std::cerr << "done. (" << SEQAN_PROTIMEDIFF(countQgramInt) << " seconds, " << sumSuffixes << " kmers)" << std::endl;
+        std::cerr << "done. (" << SEQAN_PROTIMEDIFF(countQgramInt) << " seconds, " << numSuffixes << " kmers)" << std::endl;
 
     // 3. create partial q-gram index and iterate over its packages
-    for (unsigned superPackage = 0; superPackage < options.numSuperPackages; ++superPackage)
+    for (unsigned superPackage = 0; superPackage < numSuperPackages; ++superPackage)
     {
         SEQAN_PROTIMESTART(fillQgramSAInt);
         if (options.verbosity >= 1)
         {
-            std::cerr << "Create partial internal q-gram index (" << superPackage + 1 << " of " << options.numSuperPackages << ", ";
+            std::cerr << "Create partial internal q-gram index (" << superPackage + 1 << " of " << numSuperPackages << ", ";
             std::cerr << "buckets " << superPackages[superPackage] << '-' << superPackages[superPackage+1] <<") ... " << std::flush;
         }
 
@@ -4928,6 +5035,10 @@ unsigned correctReads(
 
         done[omp_get_thread_num()] = sysTime() - startTime;
     }
+
+    // add the corrections in package order, this makes the result independent of the number of threads
+    for (unsigned i = 0; i < length(resourcesPerPackage); ++i)
+        flushPendingCorrections(correctionList, firstCorrectionForRead, resourcesPerPackage[i], store);
     if (options.verbosity >= 1)
     {
         for (unsigned i = 0; i < length(done); ++i)
@@ -5274,6 +5385,14 @@ parseCommandLine(FionaOptions & options, int argc, char const ** argv)
                                             seqan2::ArgParseArgument::INTEGER, "INT"));
     setMinValue(parser, "super-packages", "1");
     setDefaultValue(parser, "super-packages", options.numSuperPackages);
+
+    addOption(parser, seqan2::ArgParseOption("", "memory-limit",
+                                            "Memory in MiB for the reads, the q-gram directory and a partial q-gram "
+                                            "index.  If set, the q-gram buckets are split into as many super packages "
+                                            "as needed to stay below the limit and \\fB--super-packages\\fP is ignored.",
+                                            seqan2::ArgParseArgument::INT64, "MB"));
+    setMinValue(parser, "memory-limit", "0");
+    setDefaultValue(parser, "memory-limit", options.memoryLimit);
 #endif
 
 
@@ -5390,6 +5509,7 @@ parseCommandLine(FionaOptions & options, int argc, char const ** argv)
     getOptionValue(options.numThreads, parser, "num-threads");
 #ifdef FIONA_INTERNAL_MEMORY
     getOptionValue(options.numSuperPackages, parser, "super-packages");
+    getOptionValue(options.memoryLimit, parser, "memory-limit");
 #endif
     getOptionValue(options.debugRead, parser, "debug-read");
     getOptionValue(options.corrRead, parser, "corr-read");
@@ -97,6 +97,9 @@ public:
                               std::vector<std::pair<int, int> > const & gapIntervals,
                               unsigned count) = 0;
 
+    // Reset the state of the distribution such that the next fragments only depend on the state of the RNG.
+    virtual void reset() = 0;
+
     virtual ~FragmentSamplerImpl() = default;
 };
 
@@ -133,6 +136,11 @@ public:
                               std::vector<std::pair<int, int> > const & gapIntervals,
                               unsigned count);
 
+    virtual void reset()
+    {
+        dist.reset();
+    }
+
     void _generate(Fragment & frag, int rId, unsigned contigLength,
                    std::vector<std::pair<int, int> > const & gapIntervals);
 };
@@ -168,6 +176,11 @@ public:
     virtual void generateMany(std::vector<Fragment> & frags, int rId, unsigned contigLength,
                               std::vector<std::pair<int, int> > const & gapIntervals, unsigned count);
 
+    virtual void reset()
+    {
+        dist.reset();
+    }
+
     void _generate(Fragment & frag, int rId, unsigned contigLength,
                    std::vector<std::pair<int, int> > const & gapIntervals);
 };
@@ -212,6 +225,12 @@ public:
     {
         impl->generateMany(frags, rId, contigLength, gapIntervals, count);
     }
+
+    // Reset the state of the distribution, e.g. after reseeding the RNG.
+    void reset()
+    {
+        impl->reset();
+    }
 };
 
 // ============================================================================
@@ -545,7 +545,9 @@ void SequencingOptions::addTextSections(seqan2::ArgumentParser & parser) const
         "While we set a sensible default, perfomance gains may be achieved by trying different chunk-sizes.");
     addListItem(parser, "\\fBRandomization\\fP",
         "Both `--chunk-size` and `--num-threads` affect randomization. Different values for these parameters yield "
-        "different results.");
+        "different results. With `--seed-per-chunk`, the random number generators are seeded for each chunk from "
+        "`--seed`, `--meth-seed`, and the number of the chunk times `--seed-spacing`. Then, only `--chunk-size` "
+        "affects randomization and the results are the same for any number of threads.");
 
     // Add text sections for nested options structs.
     bsSeqOptions.addTextSections(parser);
@@ -1129,6 +1131,9 @@ void MasonSimulatorOptions::addOptions(seqan2::ArgumentParser & parser) const
     setMinValue(parser, "chunk-size", "1");
     setDefaultValue(parser, "chunk-size", "900");
 
+    addOption(parser, seqan2::ArgParseOption("", "seed-per-chunk", "Seed the random number generators for each chunk "
+        "instead of once for each thread.  \\fBSee note about Parallelism at the end of the help page.\\fP"));
+
     addOption(parser, seqan2::ArgParseOption("n", "num-fragments", "Number of reads/pairs to simulate.",
                                             seqan2::ArgParseOption::INTEGER, "NUM"));
     setRequired(parser, "num-fragments");
@@ -1243,6 +1248,7 @@ void MasonSimulatorOptions::getOptionValues(seqan2::ArgumentParser const & parse
     numThreads = 1;
 #endif  // #if SEQAN_HAS_OPENMP
     getOptionValue(chunkSize, parser, "chunk-size");
+    getOptionValue(seedPerChunk, parser, "seed-per-chunk");
     getOptionValue(numFragments, parser, "num-fragments");
     getOptionValue(forceSingleEnd, parser, "force-single-end");
     getOptionValue(methFastaInFile, parser, "meth-fasta-in");
@@ -1294,6 +1300,7 @@ void MasonSimulatorOptions::print(std::ostream & out) const
         << "\n"
         << "NUM THREADS\t" << numThreads << "\n"
         << "CHUNK SIZE\t" << chunkSize << "\n"
+        << "SEED PER CHUNK\t" << getYesNoStr(seedPerChunk) << "\n"
         << "\n"
         << "METHYLATION FASTA IN\t" << methFastaInFile << "\n"
         << "OUTPUT FILE LEFT\t" << outFileNameLeft << "\n"
@@ -659,6 +659,9 @@ struct MasonSimulatorOptions
     int numThreads;
     // Number of reads/pairs to simulate in one chunk
     int chunkSize;
+    // Whether to seed the random number generators for each chunk instead of once for each thread.  Chunk i
+    // (beginning with 0) then gets (seed + i * seedSpacing) as its seed and the results do not depend on numThreads.
+    bool seedPerChunk;
 
     // Number of reads/pairs to simulate.
     int numFragments;
@@ -691,8 +694,8 @@ struct MasonSimulatorOptions
     Roche454SequencingOptions rocheOptions;
 
     MasonSimulatorOptions() :
-            verbosity(1), seed(0), methSeed(0), seedSpacing(2048), numThreads(1), chunkSize(64*1024), numFragments(0),
-            forceSingleEnd(false)
+            verbosity(1), seed(0), methSeed(0), seedSpacing(2048), numThreads(1), chunkSize(64*1024), seedPerChunk(false),
+            numFragments(0), forceSingleEnd(false)
     {}
 
     // Add options to the argument parser.  Calls addOptions() on the nested *Options objects.
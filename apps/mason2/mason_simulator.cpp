@@ -605,8 +605,9 @@ public:
     // The random number generator to use for this thread; we keep a separate one around for methylation simulation.
     TRng rng, methRng;
 
-    // The ids of the fragments.
+    // The ids of the fragments and the number of their chunk.
     std::vector<int> fragmentIds;
+    uint64_t chunkNo;
 
     // The fragment generator and fragment buffer.
     std::vector<Fragment> fragments;
@@ -627,7 +628,11 @@ public:
     bool buildAlignments;  // Whether or not compute the BAM alignment records.
     std::vector<seqan2::BamAlignmentRecord> alignmentRecords;
 
-    ReadSimulatorThread() : options(), fragSampler(), methLevels(), seqSimulator(), buildAlignments(false)
+    // Buffers with the formatted reads and alignments, written to the output files as a whole.
+    seqan2::CharString leftBuffer, rightBuffer, alignmentBuffer;
+
+    ReadSimulatorThread() :
+            options(), chunkNo(0), fragSampler(), methLevels(), seqSimulator(), buildAlignments(false)
     {}
 
     ~ReadSimulatorThread()
@@ -781,6 +786,15 @@ public:
              seqan2::Dna5String /*const*/ & refSeq,
              int rID, int hID)
     {
+        // With --seed-per-chunk, seed the RNGs from the chunk number such that the reads do not depend on the number
+        // of threads.
+        if (options->seedPerChunk)
+        {
+            rng.seed(options->seed + chunkNo * options->seedSpacing);
+            methRng.seed(options->methSeed + chunkNo * options->seedSpacing);
+            fragSampler->reset();
+        }
+
         // Sample fragments.
         fragSampler->generateMany(fragments, rID, length(seq), gapIntervals, fragmentIds.size());
 
@@ -800,6 +814,31 @@ public:
         else
             _simulateSingleEnd(seq, varInfos, posMap, refName, refSeq, rID, hID);
     }
+
+    // Format the simulated reads and alignments into the buffers of the files that are given.
+    void formatOutput(seqan2::SeqFileOut * outLeft, seqan2::SeqFileOut * outRight, seqan2::BamFileOut * outBam)
+    {
+        clear(leftBuffer);
+        clear(rightBuffer);
+        clear(alignmentBuffer);
+
+        unsigned step = options->seqOptions.simulateMatePairs ? 2 : 1;
+        for (unsigned i = 0; outLeft && i < length(ids); i += step)
+            _formatRecord(leftBuffer, *outLeft, ids[i], seqs[i], quals[i]);
+        for (unsigned i = 1; outRight && i < length(ids); i += 2)
+            _formatRecord(rightBuffer, *outRight, ids[i], seqs[i], quals[i]);
+        for (unsigned i = 0; outBam && i < alignmentRecords.size(); ++i)
+            write(alignmentBuffer, alignmentRecords[i], context(*outBam), outBam->format);
+    }
+
+    void _formatRecord(seqan2::CharString & buffer, seqan2::SeqFileOut & file,
+                       seqan2::CharString const & id, seqan2::Dna5String const & seq, seqan2::CharString const & qual)
+    {
+        if (isEqual(file.format, seqan2::Fastq()))
+            writeRecord(buffer, id, seq, qual, seqan2::Fastq(), context(file).options);
+        else
+            writeRecord(buffer, id, seq, qual, seqan2::Fasta(), context(file).options);
+    }
 };
 
 // --------------------------------------------------------------------------
@@ -818,6 +857,8 @@ public:
 
     // Threads used for simulation.
     std::vector<ReadSimulatorThread> threads;
+    // The number of the next chunk to simulate.
+    uint64_t chunkNo;
 
     // ----------------------------------------------------------------------
     // VCF Materialization
@@ -848,9 +889,12 @@ public:
     seqan2::SeqFileOut outSeqsLeft, outSeqsRight;
     // For writing the final SAM/BAM file.
     std::unique_ptr<seqan2::BamFileOut> outBamStream;
+    // Whether the records are formatted by the simulation threads, i.e. for FASTA, FASTQ, SAM, and BAM output.
+    bool formatLeft, formatRight, formatAlignments;
 
     MasonSimulatorApp(MasonSimulatorOptions const & options) :
-            options(options), rng(options.seed), methRng(options.methSeed),
+            options(options), rng(options.seed), methRng(options.methSeed), chunkNo(0),
+            formatLeft(false), formatRight(false), formatAlignments(false),
             vcfMat(methRng,
                    toCString(options.matOptions.fastaFileName),
                    toCString(options.matOptions.vcfFileName),
@@ -958,17 +1002,22 @@ public:
 
                     thread.fragmentIds.resize(numRead);
                     std::iota(thread.fragmentIds.begin(), thread.fragmentIds.end(), firstReadID);
+                    thread.chunkNo = chunkNo++;
                 }
 
                 // Build gap intervals.
                 buildGapIntervals(gapIntervals, contigSeq);
 
-                // Perform the simulation.
-                SEQAN_OMP_PRAGMA(parallel num_threads(options.numThreads))
+                // Perform the simulation and format the output of FASTA, FASTQ, SAM and BAM files.
+                SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 1) num_threads(options.numThreads))
+                for (int tID = 0; tID < options.numThreads; ++tID)
                 {
-                    threads[omp_get_thread_num()].run(contigSeq, gapIntervals, varInfos, vcfMat.posMap,
-                                                      sequenceName(vcfMat.faiIndex, rID),
-                                                      refSeq, rID, hID);
+                    threads[tID].run(contigSeq, gapIntervals, varInfos, vcfMat.posMap,
+                                     sequenceName(vcfMat.faiIndex, rID),
+                                     refSeq, rID, hID);
+                    threads[tID].formatOutput(formatLeft ? &outSeqsLeft : nullptr,
+                                              formatRight ? &outSeqsRight : nullptr,
+                                              formatAlignments ? outBamStream.get() : nullptr);
                 }
 
                 // Write out the sequence.
@@ -982,7 +1031,11 @@ public:
                         //       I.e. the `if`-block must be the inner block.
                         SEQAN_OMP_PRAGMA(section)
                         {
-                            if (options.seqOptions.simulateMatePairs)
+                            if (formatLeft)
+                            {
+                                write(outSeqsLeft.iter, thread.leftBuffer);
+                            }
+                            else if (options.seqOptions.simulateMatePairs)
                             {
                                 for (size_t i = 0; i < length(thread.ids); i+=2)
                                 {
@@ -997,7 +1050,11 @@ public:
 
                         SEQAN_OMP_PRAGMA(section)
                         {
-                            if (options.seqOptions.simulateMatePairs)
+                            if (formatRight)
+                            {
+                                write(outSeqsRight.iter, thread.rightBuffer);
+                            }
+                            else if (options.seqOptions.simulateMatePairs)
                             {
                                 for (size_t i = 0; i < length(thread.ids); i+=2)
                                 {
@@ -1008,7 +1065,11 @@ public:
 
                         SEQAN_OMP_PRAGMA(section)
                         {
-                            if (!empty(options.outFileNameSam))
+                            if (formatAlignments)
+                            {
+                                write(outBamStream->iter, thread.alignmentBuffer);
+                            }
+                            else if (!empty(options.outFileNameSam))
                             {
                                 writeRecords(*outBamStream, thread.alignmentRecords);
                             }
@@ -1126,6 +1187,16 @@ public:
                 throw MasonIOException("Could not open SAM/BAM output file.");
             std::cerr << " OK\n";
         }
+
+        formatLeft = _isFormattable(outSeqsLeft);
+        formatRight = options.seqOptions.simulateMatePairs && _isFormattable(outSeqsRight);
+        formatAlignments = outBamStream && (isEqual(outBamStream->format, seqan2::Sam()) ||
+                                            isEqual(outBamStream->format, seqan2::Bam()));
+    }
+
+    bool _isFormattable(seqan2::SeqFileOut & file)
+    {
+        return isEqual(file.format, seqan2::Fasta()) || isEqual(file.format, seqan2::Fastq());
     }
 
     void _init()
@@ -431,6 +431,11 @@ public:
     // Storage for the Illumina simulation.
     std::unique_ptr<IlluminaModel> model;
 
+    // Buffers for the quality simulation: mean, standard deviation and standard normal sample for each base.
+    seqan2::String<double> qualityMeanBuffer;
+    seqan2::String<double> qualityStdDevBuffer;
+    seqan2::String<double> normalBuffer;
+
     IlluminaSequencingSimulator(TRng & rng, TRng & methRng, SequencingOptions const & seqOptions,
                                 IlluminaSequencingOptions const & illuminaOptions);
 
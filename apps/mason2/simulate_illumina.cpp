@@ -227,26 +227,32 @@ void IlluminaSequencingSimulator::simulateRead(TRead & seq, TQualities & quals,
 // ---------------------------------------------------------------------------
 
 // Simulate PHRED qualities from the CIGAR string.
+//
+// The samples are drawn in a first pass over the CIGAR string and transformed into qualities in a second pass that
+// has no dependencies between the bases and is vectorized by the compiler.  The distribution is reset before each
+// sample, so the random stream is the same as with one distribution object per base.
 void IlluminaSequencingSimulator::_simulateQualities(TQualities & quals, TCigarString const & cigar)
 {
-    clear(quals);
+    clear(qualityMeanBuffer);
+    clear(qualityStdDevBuffer);
+    clear(normalBuffer);
 
+    std::normal_distribution<double> dist;
     unsigned pos = 0;
     for (unsigned i = 0; i < length(cigar); ++i)
     {
         for (unsigned j = 0; j < cigar[i].count; ++j)
         {
-            int q = 0;
             if (cigar[i].operation == 'M')
             {
-                std::normal_distribution<double> dist(model->qualityMeans[pos], model->qualityStdDevs[pos]);
-                q = static_cast<int>(dist(rng));
+                appendValue(qualityMeanBuffer, model->qualityMeans[pos]);
+                appendValue(qualityStdDevBuffer, model->qualityStdDevs[pos]);
                 ++pos;
             }
             else if (cigar[i].operation == 'I' || cigar[i].operation == 'X')
             {
-                std::normal_distribution<double> dist(model->mismatchQualityMeans[pos], model->mismatchQualityStdDevs[pos]);
-                q = static_cast<int>(dist(rng));
+                appendValue(qualityMeanBuffer, model->mismatchQualityMeans[pos]);
+                appendValue(qualityStdDevBuffer, model->mismatchQualityStdDevs[pos]);
                 ++pos;
             }
             else
@@ -254,10 +260,22 @@ void IlluminaSequencingSimulator::_simulateQualities(TQualities & quals, TCigarS
                 // Deletion/padding, no quality required.
                 continue;
             }
-            q = std::max(0, std::min(q, 40));  // limit quality to 0..40
-            appendValue(quals, (char)('!' + q));
+            dist.reset();
+            appendValue(normalBuffer, dist(rng));
         }
     }
+
+    unsigned len = length(normalBuffer);
+    resize(quals, len);
+    double const * SEQAN_RESTRICT means = begin(qualityMeanBuffer, seqan2::Standard());
+    double const * SEQAN_RESTRICT stdDevs = begin(qualityStdDevBuffer, seqan2::Standard());
+    double const * SEQAN_RESTRICT samples = begin(normalBuffer, seqan2::Standard());
+    char * SEQAN_RESTRICT out = begin(quals, seqan2::Standard());
+    for (unsigned i = 0; i < len; ++i)
+    {
+        int q = static_cast<int>(samples[i] * stdDevs[i] + means[i]);
+        out[i] = (char)('!' + std::max(0, std::min(q, 40)));  // limit quality to 0..40
+    }
 }
 
 // ---------------------------------------------------------------------------
@@ -59,4 +59,14 @@ inline bool setEndPosition(seqan2::Finder<THaystack, void> & finder,
     return result;
 }
 
+// Bring the pattern into the state it has after construction with the given needle and score limit.
+template <typename TNeedle, typename TNeedle2>
+inline void resetPattern(seqan2::Pattern<TNeedle, seqan2::HammingSimple> & pattern, TNeedle2 & needle, int score)
+{
+    setHost(pattern, needle);
+    setScoreLimit(pattern, score);
+    pattern.distance = 0;
+    pattern.matchNFlags = 0;
+}
+
 #endif  // SEQAN_APPS_RABEMA_FIND_HAMMING_SIMPLE_EXT_H_
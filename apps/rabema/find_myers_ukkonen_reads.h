@@ -97,6 +97,12 @@ public:
         _scoreLimit(score),
         data_host(ndl),
         _firstFind(true)
+    {
+        _initMatchNMask();
+    }
+
+    // Reset the mask such that N matches neither in the pattern nor in the finder.
+    void _initMatchNMask()
     {
         typedef typename Value<TNeedle>::Type TAlphabet;
         resize(_matchNMask, ValueSize<TAlphabet>::VALUE * ValueSize<TAlphabet>::VALUE);
@@ -177,6 +183,21 @@ inline void setHost(Pattern<TNeedle, MyersUkkonenReads> & me, TNeedle2 & needle)
     setHost(me, const_cast<TNeedle2 const &>(needle));
 }
 
+// Bring the pattern into the state it has after construction with the given needle and score limit.  The bit vectors of
+// the wrapped pattern stay allocated, so one pattern can be reused for all reads searched by a thread.
+template <typename TNeedle, typename TNeedle2>
+inline void resetPattern(Pattern<TNeedle, MyersUkkonenReads> & me, TNeedle2 & needle, int score)
+{
+    setScoreLimit(me._wrappedPattern, score);
+    setHost(me._wrappedPattern, infix(needle, 0, length(needle) - 1));
+    me._lastCharacter = back(needle);
+    me._score = score;
+    me._scoreLimit = score;
+    setValue(me.data_host, needle);
+    me._firstFind = true;
+    me._initMatchNMask();
+}
+
 template <typename TNeedle>
 inline void _patternInit(Pattern<TNeedle, MyersUkkonenReads> & me)
 {
@@ -35,6 +35,7 @@
 #include <seqan/arg_parse.h>
 #include <seqan/bam_io.h>
 #include <seqan/basic.h>
+#include <seqan/parallel.h>
 #include <seqan/sequence.h>
 #include <seqan/store.h>
 #include <seqan/seq_io.h>
@@ -101,6 +102,35 @@ struct ContigInterval
     {}
 };
 
+// ----------------------------------------------------------------------------
+// Class ErrorCurveTask
+// ----------------------------------------------------------------------------
+
+// An alignment from the perfect SAM/BAM file and the error curve points built around it.
+struct ErrorCurveTask
+{
+    // Id of the aligned read.
+    unsigned readId;
+
+    // true iff the alignment is on the forward strand.
+    bool isForward;
+
+    // End position of the alignment in the forward or the reverse-complemented contig.
+    size_t endPos;
+
+    // Maximal error count, in oracle mode the error at the alignment position is written back here.
+    int maxError;
+
+    // Read sequence, reverse-complemented for alignments on the reverse strand.
+    Dna5String readSeq;
+
+    // The error curve points for this alignment.
+    String<WeightedMatch> points;
+
+    ErrorCurveTask() : readId(0), isForward(true), endPos(0), maxError(0)
+    {}
+};
+
 // ---------------------------------------------------------------------------
 // Enum DistanceMetric
 // ---------------------------------------------------------------------------
@@ -148,13 +178,17 @@ struct BuildGoldStandardOptions
     // Path to the perfect input SAM/BAM file.
     seqan2::CharString inBamPath;
 
+    // Number of threads to use for building the error curves.
+    int numThreads;
+
     BuildGoldStandardOptions() :
         verbosity(1),
         matchN(false),
         oracleMode(false),
         maxError(0),
         maxErrorSet(false),
-        distanceMetric(EDIT_DISTANCE)
+        distanceMetric(EDIT_DISTANCE),
+        numThreads(1)
     {}
 };
 
@@ -376,7 +410,8 @@ inline T ceilAwayFromZero(T x)
 
 // Build the error curve points around the end position of the given contig.
 //
-// This is pretty involved and this function easily is the most complex one.
+// This is pretty involved and this function easily is the most complex one.  The pattern is reset to the read here,
+// so the caller can pass the same pattern for all reads.
 //
 // Returns rightmost border of the added points.
 template <typename TContigSeq, typename TReadSeq, typename TPatternSpec, typename TReadNames>
@@ -390,7 +425,7 @@ void buildErrorCurvePoints(String<WeightedMatch> & errorCurve,
                            size_t endPos,
                            TReadNames const & readNames,
                            bool matchN,
-                           TPatternSpec const &)
+                           Pattern<TReadSeq, TPatternSpec> & pattern)
 {
     typedef typename Position<TContigSeq>::Type TPosition;
 
@@ -400,7 +435,7 @@ void buildErrorCurvePoints(String<WeightedMatch> & errorCurve,
     {
         oracleMode = true;
         Finder<TContigSeq> finder(contig);
-        Pattern<TReadSeq, TPatternSpec> pattern(read, -(int)length(read) * 40);
+        resetPattern(pattern, read, -(int)length(read) * 40);
         bool ret = setEndPosition(finder, pattern, endPos);
         (void) ret; // If compiled without assertions.
         SEQAN_ASSERT(ret);
@@ -434,7 +469,7 @@ void buildErrorCurvePoints(String<WeightedMatch> & errorCurve,
 
     // Setup the finder and pattern.
     Finder<TContigSeq> finder(contig);
-    Pattern<TReadSeq, TPatternSpec> pattern(read, -(int)length(read) * 40);
+    resetPattern(pattern, read, -(int)length(read) * 40);
     // If configured so, match N against all other values, otherwise match
     // against none.
     _patternMatchNOfPattern(pattern, matchN);
@@ -740,6 +775,82 @@ void buildErrorCurvePoints(String<WeightedMatch> & errorCurve,
 //     std::cerr << __FILE__ << ":" << __LINE__ << " return " << right << std::endl;
 }
 
+// ----------------------------------------------------------------------------
+// Function smoothAndFilterErrorCurve()
+// ----------------------------------------------------------------------------
+
+// Sort the points of the error curve of one read, fill gaps, smooth them and filter out low scoring ones.
+
+void smoothAndFilterErrorCurve(TWeightedMatches & errorCurve,
+                               String<int> const & readAlignmentDistances,  // only used in case of oracle mode
+                               unsigned readLength,
+                               unsigned readId,
+                               BuildGoldStandardOptions const & options)
+{
+    std::sort(begin(errorCurve, Standard()), end(errorCurve, Standard()));
+    fillGaps(errorCurve);
+    smoothErrorCurve(errorCurve);
+
+    // Compute relative min score for the read.
+    String<WeightedMatch> filtered;
+    int maxError = (int)floor(options.maxError / 100.0 * readLength);
+    if (options.oracleMode)
+    {
+        SEQAN_ASSERT_NEQ(readAlignmentDistances[readId], -1);
+        maxError = readAlignmentDistances[readId];
+        if (options.maxErrorSet && maxError > options.maxError)
+            maxError = options.maxError;
+    }
+    int relativeMinScore = (int)ceilAwayFromZero(100.0 * -maxError / readLength);
+
+    // Filter out low scoring ones.
+    typedef Iterator<String<WeightedMatch> >::Type TIterator;
+    for (TIterator it = begin(errorCurve); it != end(errorCurve); ++it)
+    {
+        if (value(it).distance >= relativeMinScore)
+            appendValue(filtered, value(it));
+    }
+    move(errorCurve, filtered);
+}
+
+// ----------------------------------------------------------------------------
+// Function processErrorCurveTasks()
+// ----------------------------------------------------------------------------
+
+// Build the error curve points for a batch of alignments on the same contig in parallel.  Each thread searches with its
+// own pattern.  The points are then appended to the error curves in the order of the alignments, so the result does not
+// depend on the number of threads.
+
+template <typename TPatternSpec>
+void processErrorCurveTasks(TErrorCurves & errorCurves,
+                            String<int> & readAlignmentDistances,  // only used in case of oracle mode
+                            String<ErrorCurveTask> & tasks,
+                            String<Pattern<Dna5String, TPatternSpec> > & patterns,
+                            Dna5String & contig,
+                            Dna5String & rcContig,
+                            int contigId,
+                            StringSet<CharString> const & readNameStore,
+                            BuildGoldStandardOptions const & options)
+{
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int i = 0; i < (int)length(tasks); ++i)
+    {
+        ErrorCurveTask & task = tasks[i];
+        Pattern<Dna5String, TPatternSpec> & pattern = patterns[omp_get_thread_num()];
+        buildErrorCurvePoints(task.points, task.maxError, task.isForward ? contig : rcContig, contigId,
+                              task.isForward, task.readSeq, task.readId, task.endPos, readNameStore,
+                              options.matchN, pattern);
+    }
+
+    for (unsigned i = 0; i < length(tasks); ++i)
+    {
+        append(errorCurves[tasks[i].readId], tasks[i].points);
+        if (options.oracleMode)
+            readAlignmentDistances[tasks[i].readId] = tasks[i].maxError;
+    }
+    clear(tasks);
+}
+
 // ----------------------------------------------------------------------------
 // Function matchesToErrorFunction()
 // ----------------------------------------------------------------------------
@@ -777,6 +888,9 @@ int matchesToErrorFunction(TErrorCurves & errorCurves,
     //     Build error curve for this read alignment on forward strand.
     //   Else:
     //     Build error curve for this read alignment on backward strand.
+    //
+    // The alignments are collected in batches that do not span contigs and the error curves of a batch are built in
+    // parallel, reusing one pattern per thread.
 
     startTime = sysTime();      // Time at beginning for total time display at end.
     int prevRefId = -1;      // Previous contig id.
@@ -785,8 +899,11 @@ int matchesToErrorFunction(TErrorCurves & errorCurves,
     BamAlignmentRecord record;  // Current read record.
     Dna5String contig;
     Dna5String rcContig;
-    Dna5String readSeq;
     CharString readName;
+    String<Pattern<Dna5String, TPatternSpec> > patterns;
+    resize(patterns, omp_get_max_threads());
+    String<ErrorCurveTask> tasks;
+    unsigned const batchSize = 1024 * omp_get_max_threads();
     while (!atEnd(inBam))
     {
         // -------------------------------------------------------------------
@@ -812,12 +929,7 @@ int matchesToErrorFunction(TErrorCurves & errorCurves,
             std::cerr << "ERROR: File was not sorted by coordinate!\n";
             return 1;
         }
-        // Get read name and sequence from record.
-        readSeq = record.seq;  // Convert read sequence to Dna5.
-        // Compute reverse complement since we align against reverse strand, SAM has aligned sequence against forward
-        // strand.
-        if (hasFlagRC(record))
-            reverseComplement(readSeq);
+        // Get read name from record.
         trimSeqHeaderToId(record.qName);  // Remove everything after the first whitespace.
         if (!hasFlagMultiple(record))
             append(record.qName, "/S");
@@ -844,6 +956,10 @@ int matchesToErrorFunction(TErrorCurves & errorCurves,
         SEQAN_ASSERT_LEQ(prevRefId, record.rID);
         if (prevRefId != record.rID)
         {
+            // The pending alignments refer to the previous contig.
+            processErrorCurveTasks(errorCurves, readAlignmentDistances, tasks, patterns, contig, rcContig, prevRefId,
+                                   readNameStore, options);
+
             for (int i = prevRefId + 1; i <= record.rID; ++i)
             {
                 if (i != prevRefId)
@@ -895,23 +1011,28 @@ int matchesToErrorFunction(TErrorCurves & errorCurves,
         // Compute end position of alignment.
         int endPos = record.beginPos + getAlignmentLengthInRef(record) - countPaddings(record.cigar);
 
-        if (!hasFlagRC(record))
-            buildErrorCurvePoints(errorCurves[readId], maxError, contig, record.rID, !hasFlagRC(record),
-                                  readSeq, readId, endPos, readNameStore, options.matchN, TPatternSpec());
-        else
-            buildErrorCurvePoints(errorCurves[readId], maxError, rcContig, record.rID, !hasFlagRC(record),
-                                  readSeq, readId, length(rcContig) - record.beginPos, readNameStore, options.matchN,
-                                  TPatternSpec());
-#if ENABLE
-        std::cerr << "AFTER BUILD, readId == " << readId << ", read name == " << readNameStore[readId] << ", maxError == " << maxError << "\n";
-#endif  // #if ENABLE
-        if (options.oracleMode)
-            readAlignmentDistances[readId] = maxError;
+        appendValue(tasks, ErrorCurveTask());
+        ErrorCurveTask & task = back(tasks);
+        task.readId = readId;
+        task.isForward = !hasFlagRC(record);
+        task.endPos = task.isForward ? endPos : length(rcContig) - record.beginPos;
+        task.maxError = maxError;
+        task.readSeq = record.seq;  // Convert read sequence to Dna5.
+        // Compute reverse complement since we align against reverse strand, SAM has aligned sequence against forward
+        // strand.
+        if (!task.isForward)
+            reverseComplement(task.readSeq);
+
+        if (length(tasks) >= batchSize)
+            processErrorCurveTasks(errorCurves, readAlignmentDistances, tasks, patterns, contig, rcContig, record.rID,
+                                   readNameStore, options);
 
         // Update variables storing the previous read/contig id and position.
         prevRefId = record.rID;
         prevPos = record.beginPos;
     }
+    processErrorCurveTasks(errorCurves, readAlignmentDistances, tasks, patterns, contig, rcContig, prevRefId,
+                           readNameStore, options);
     std::cerr << "\n\nTook " << sysTime() - startTime << " s\n";
 
     // For all reads:
@@ -922,42 +1043,23 @@ int matchesToErrorFunction(TErrorCurves & errorCurves,
 
     std::cerr << "\n____SMOOTHING ERROR CURVES____________________________________________________\n\n";
     startTime = sysTime();
-    unsigned tenPercent = length(readLengthStore) / 10 + 1;
-    std::cerr << "Progress: ";
+    // The error curves of different reads are independent, look them up once so they can be processed in parallel.
+    String<TWeightedMatches *> readErrorCurves;
+    resize(readErrorCurves, length(readLengthStore));
     for (unsigned readId = 0; readId < length(readLengthStore); ++readId)
+        readErrorCurves[readId] = &errorCurves[readId];
+    int numReads = length(readLengthStore);
+    int tenPercent = numReads / 10 + 1;
+    std::cerr << "Progress: ";
+    for (int chunkBegin = 0; chunkBegin < numReads; chunkBegin += tenPercent)
     {
-        if (tenPercent > 0u && readId % tenPercent == 0u)
-            std::cerr << readId / tenPercent * 10 << '%';
-        else if (tenPercent > 5u && readId % (tenPercent / 5) == 0u)
-            std::cerr << '.';
-
-        std::sort(begin(errorCurves[readId], Standard()), end(errorCurves[readId], Standard()));
-        fillGaps(errorCurves[readId]);
-        smoothErrorCurve(errorCurves[readId]);
-
-        // Compute relative min score for the read.
-        String<WeightedMatch> filtered;
-        int maxError = (int)floor(options.maxError / 100.0 * readLengthStore[readId]);
-        if (options.oracleMode)
-        {
-            SEQAN_ASSERT_NEQ(readAlignmentDistances[readId], -1);
-            maxError = readAlignmentDistances[readId];
-            if (options.maxErrorSet && maxError > options.maxError)
-                maxError = options.maxError;
-        }
-        int relativeMinScore = (int)ceilAwayFromZero(100.0 * -maxError / readLengthStore[readId]);
-#if ENABLE
-        std::cerr << "AFTER SMOOTHING, readId == " << readId << ", read name == " << readNameStore[readId] << ", maxError == " << maxError << "\n";
-#endif  // #if ENABLE
-
-        // Filter out low scoring ones.
-        typedef typename Iterator<String<WeightedMatch> >::Type TIterator;
-        for (TIterator it = begin(errorCurves[readId]); it != end(errorCurves[readId]); ++it)
-        {
-            if (value(it).distance >= relativeMinScore)
-                appendValue(filtered, value(it));
-        }
-        move(errorCurves[readId], filtered);
+        std::cerr << chunkBegin / tenPercent * 10 << '%';
+        int chunkEnd = std::min(chunkBegin + tenPercent, numReads);
+
+        SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 64))
+        for (int readId = chunkBegin; readId < chunkEnd; ++readId)
+            smoothAndFilterErrorCurve(*readErrorCurves[readId], readAlignmentDistances, readLengthStore[readId],
+                                      readId, options);
     }
     std::cerr << "100% DONE\n"
               << "\nTook: " << sysTime() - startTime << " s\n";
@@ -1029,6 +1131,15 @@ parseCommandLine(BuildGoldStandardOptions & options, int argc, char const ** arg
                                             seqan2::ArgParseArgument::INTEGER, "RATE"));
     setDefaultValue(parser, "max-error", 0);
 
+    addSection(parser, "Performance Options");
+    addOption(parser, seqan2::ArgParseOption("t", "num-threads",
+                                            "Number of threads to use.  The alignments are read in batches and the "
+                                            "error curves of a batch are built in parallel.  The result does not "
+                                            "depend on the number of threads.",
+                                            seqan2::ArgParseArgument::INTEGER, "NUM"));
+    setMinValue(parser, "num-threads", "1");
+    setDefaultValue(parser, "num-threads", 1);
+
     addTextSection(parser, "Return Values");
     addText(parser, "A return value of 0 indicates success, any other value indicates an error.");
 
@@ -1088,6 +1199,7 @@ parseCommandLine(BuildGoldStandardOptions & options, int argc, char const ** arg
         getOptionValue(options.maxError, parser, "max-error");
         options.maxErrorSet = true;
     }
+    getOptionValue(options.numThreads, parser, "num-threads");
     CharString distanceMetric;
     getOptionValue(distanceMetric, parser, "distance-metric");
     if (distanceMetric == "hamming")
@@ -1132,8 +1244,11 @@ int main(int argc, char const ** argv)
               << "GSI Output File       " << options.outGsiPath << '\n'
               << "SAM/BAM Input File    " << options.inBamPath << '\n'
               << "Reference File        " << options.referencePath << '\n'
+              << "Threads               " << options.numThreads << '\n'
               << "Verbosity             " << options.verbosity << "\n\n";
 
+    omp_set_num_threads(options.numThreads);
+
     std::cerr << "____LOADING FILES_____________________________________________________________\n\n";
 
     // =================================================================
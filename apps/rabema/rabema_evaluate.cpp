@@ -25,11 +25,16 @@
 // Gold Standard Intervals (GSI) file.
 // ==========================================================================
 
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include <seqan/arg_parse.h>
 #include <seqan/bam_io.h>
 #include <seqan/basic.h>
 #include <seqan/find.h>
 #include <seqan/misc/interval_tree.h>
+#include <seqan/parallel.h>
 #include <seqan/store.h>
 #include <seqan/seq_io.h>
 
@@ -135,6 +140,9 @@ public:
     // Whether to check sorting or not.
     bool checkSorting;
 
+    // Number of threads to use for comparing the alignments against the intervals.
+    int numThreads;
+
     // ------------------------------------------------------------------------
     // Logging configuration.
     // ------------------------------------------------------------------------
@@ -166,6 +174,7 @@ public:
         ignorePairedFlags(false),
         dontPanic(false),
         checkSorting(true),
+        numThreads(1),
         // outPath("-"),
         showMissedIntervals(false),
         showSuperflousIntervals(false),
@@ -195,6 +204,31 @@ struct CmpGsiRecordLowering
 
 };
 
+// ----------------------------------------------------------------------------
+// Class QueryRecords
+// ----------------------------------------------------------------------------
+
+// The SAM/BAM records and GSI records of one query.  Queries are evaluated independently of each other.
+
+struct QueryRecords
+{
+    // The aligned SAM/BAM records of the query.
+    String<BamAlignmentRecord> samRecords;
+
+    // The GSI records of the query.
+    String<GsiRecord> gsiRecords;
+
+    // Whether the query has single-end and/or paired-end records.
+    bool seenSingleEnd;
+    bool seenPairedEnd;
+
+    // Marker for the contig id of GSI records whose contig is not in the reference.
+    static size_t const UNKNOWN_CONTIG = static_cast<size_t>(-1);
+
+    QueryRecords() : seenSingleEnd(false), seenPairedEnd(false)
+    {}
+};
+
 // ============================================================================
 // Metafunctions
 // ============================================================================
@@ -352,8 +386,12 @@ void performIntervalLowering(String<GsiRecord> & gsiRecords, int maxError)
 // Function benchmarkReadResult()
 // ----------------------------------------------------------------------------
 
+// Compare the SAM/BAM records of one read against its GSI records and add the outcome to result.  Messages are written
+// to errStream, the pattern is reset to the read for each realignment.
+
 template <typename TPatternSpec>
 int benchmarkReadResult(RabemaStats & result,
+                        std::ostream & errStream,
                         String<BamAlignmentRecord> const & samRecords,
                         BamFileIn const & bamFileIn,
                         String<GsiRecord> const & gsiRecords,
@@ -361,7 +399,7 @@ int benchmarkReadResult(RabemaStats & result,
                         StringSet<Dna5String> const & refSeqs,
                         RefIdMapping const & refIdMapping,
                         RabemaEvaluationOptions const & options,
-                        TPatternSpec const & /*tagPattern*/,
+                        Pattern<Dna5String, TPatternSpec> & pattern,
                         bool pairedEnd = false,
                         bool second = false)
 {
@@ -441,10 +479,10 @@ int benchmarkReadResult(RabemaStats & result,
         std::cerr << "PICKED\t" << gsiRecords[i] << "\t" << gsiRecords[i].originalDistance << "\n";
 #endif  // DEBUG_RABEMA
 
-        // Get index of the sequence from GSI record contig name.
-        if (!getIdByName(back(pickedGsiRecords).contigId, faiIndex, back(pickedGsiRecords).contigName))
+        // The index of the sequence was resolved from the GSI record contig name when reading the record.
+        if (back(pickedGsiRecords).contigId == QueryRecords::UNKNOWN_CONTIG)
         {
-            std::cerr << "ERROR: Could not find reference sequence for name "
+            errStream << "ERROR: Could not find reference sequence for name "
                       << back(pickedGsiRecords).contigName << '\n';
             return 1;
         }
@@ -542,12 +580,12 @@ int benchmarkReadResult(RabemaStats & result,
     }
     if (seenL && empty(readSeqL))
     {
-        std::cerr << "ERROR: No alignment for query " << front(samRecords).qName << " (left-end)\n";
+        errStream << "ERROR: No alignment for query " << front(samRecords).qName << " (left-end)\n";
         return 1;
     }
     if (seenR && empty(readSeqR))
     {
-        std::cerr << "ERROR: No alignment for query " << front(samRecords).qName << " (right-end)\n";
+        errStream << "ERROR: No alignment for query " << front(samRecords).qName << " (right-end)\n";
         return 1;
     }
 
@@ -585,7 +623,7 @@ int benchmarkReadResult(RabemaStats & result,
             {
                 // Simply try to guess the end position.
                 endPos = samRecord.beginPos + length(readSeq) + 1;
-                std::cerr << "WARNING: Unknown alignment end position for read " << samRecord.qName << ".\n";
+                errStream << "WARNING: Unknown alignment end position for read " << samRecord.qName << ".\n";
             }
             // The extra position tag must be 1-based.
             SEQAN_ASSERT_GT(endPos, 0u);
@@ -620,7 +658,7 @@ int benchmarkReadResult(RabemaStats & result,
                 if (hasFlagRC(samRecord))
                     reverseComplement(contigSeq);
                 Finder<Dna5String> finder(contigSeq);
-                Pattern<Dna5String, TPatternSpec> pattern(readSeq, -static_cast<int>(length(readSeq)) * 1000);
+                resetPattern(pattern, readSeq, -static_cast<int>(length(readSeq)) * 1000);
                 _patternMatchNOfPattern(pattern, options.matchN);
                 _patternMatchNOfFinder(pattern, options.matchN);
                 bool ret = setEndPosition(finder, pattern, length(contigSeq) - bandwidth);
@@ -636,7 +674,7 @@ int benchmarkReadResult(RabemaStats & result,
         unsigned lastPos = hasFlagRC(samRecord) ? length(refSeqs[seqId]) - samRecord.beginPos - 1 : endPos - 1;
 
         if (options.showTryHitIntervals)
-            std::cerr << "TRY HIT\tchr=" << sequenceName(faiIndex, seqId) << "\tlastPos=" << lastPos << "\tqName="
+            errStream << "TRY HIT\tchr=" << sequenceName(faiIndex, seqId) << "\tlastPos=" << lastPos << "\tqName="
                       << samRecord.qName << "\n";
 
         // Try to hit any interval.
@@ -670,10 +708,10 @@ int benchmarkReadResult(RabemaStats & result,
             {
                 if (options.showSuperflousIntervals)
                 {
-                    std::cerr << "SUPERFLOUS/INVALID\t";
-                    DirectionIterator<std::ostream, Output>::Type cerrIt = directionIterator(std::cerr, Output());
+                    errStream << "SUPERFLOUS/INVALID\t";
+                    DirectionIterator<std::ostream, Output>::Type cerrIt = directionIterator(errStream, Output());
                     write(cerrIt, samRecord, context(bamFileIn), Sam());
-                    std::cerr << "  DISTANCE:        \t" << bestDistance << '\n'
+                    errStream << "  DISTANCE:        \t" << bestDistance << '\n'
                               << "  ALLOWED DISTANCE:\t" << options.maxError << '\n';
                 }
                 result.invalidAlignments += 1;
@@ -683,21 +721,21 @@ int benchmarkReadResult(RabemaStats & result,
             // We found an additional hit.
             if (options.showAdditionalIntervals || !options.dontPanic)
             {
-                std::cerr << "ADDITIONAL HIT\t";
-                DirectionIterator<std::ostream, Output>::Type cerrIt = directionIterator(std::cerr, Output());
+                errStream << "ADDITIONAL HIT\t";
+                DirectionIterator<std::ostream, Output>::Type cerrIt = directionIterator(errStream, Output());
                 write(cerrIt, samRecord, context(bamFileIn), Sam());
-                std::cerr << '\n';
+                errStream << '\n';
 
                 for (unsigned i = 0; i < length(filteredGsiRecords); ++i)
-                    std::cerr << "FILTERED GSI RECORD\t" << filteredGsiRecords[i] << "\n";
+                    errStream << "FILTERED GSI RECORD\t" << filteredGsiRecords[i] << "\n";
             }
 
             if (!options.dontPanic)
             {
-                std::cerr << "ERROR: Found an additional hit for read " << samRecord.qName << "!\n";
+                errStream << "ERROR: Found an additional hit for read " << samRecord.qName << "!\n";
                 return 1;
             }
-            std::cerr << "WARNING: Found an additional hit for read " << samRecord.qName << ".\n";
+            errStream << "WARNING: Found an additional hit for read " << samRecord.qName << ".\n";
         }
     }
 
@@ -714,7 +752,7 @@ int benchmarkReadResult(RabemaStats & result,
             if (intervalHit[i])
             {
                 if (options.showHitIntervals)
-                    std::cerr << "HIT\t" << filteredGsiRecords[i] << "\t" << filteredGsiRecords[i].originalDistance << "\n";
+                    errStream << "HIT\t" << filteredGsiRecords[i] << "\t" << filteredGsiRecords[i].originalDistance << "\n";
                 if (bestDistance > intervalDistances[i])
                     bestIdx = i;
                 bestDistance = std::min(bestDistance, intervalDistances[i]);
@@ -722,14 +760,14 @@ int benchmarkReadResult(RabemaStats & result,
         if (bestDistance != std::numeric_limits<int>::max())
         {
             if (options.showHitIntervals)
-                std::cerr << "HIT_BEST\t" << filteredGsiRecords[bestIdx] << "\t" << filteredGsiRecords[bestIdx].originalDistance << "\n";
+                errStream << "HIT_BEST\t" << filteredGsiRecords[bestIdx] << "\t" << filteredGsiRecords[bestIdx].originalDistance << "\n";
             numFound += 1;
             foundIntervalsForErrorRate[bestDistance] += 1;
         }
         if (!mappedAny && options.showMissedIntervals)
         {
             for (unsigned i = 0; i < length(filteredGsiRecords); ++i)
-                std::cerr << "MISSED\t" << filteredGsiRecords[i] << "\t" << filteredGsiRecords[i].originalDistance << "\n";
+                errStream << "MISSED\t" << filteredGsiRecords[i] << "\t" << filteredGsiRecords[i].originalDistance << "\n";
         }
     }
     else  // !options.oracleMode && options.benchmarkCategory in ["all-best", "all"]
@@ -741,14 +779,14 @@ int benchmarkReadResult(RabemaStats & result,
             if (intervalHit[i])
             {
                 if (options.showHitIntervals)
-                    std::cerr << "HIT\t" << filteredGsiRecords[i] << "\t" << filteredGsiRecords[i].originalDistance << "\n";
+                    errStream << "HIT\t" << filteredGsiRecords[i] << "\t" << filteredGsiRecords[i].originalDistance << "\n";
                 numFound += 1;
                 foundIntervalsForErrorRate[intervalDistances[i]] += 1;
             }
             else
             {
                 if (options.showMissedIntervals)  // inside braces for consistency with above
-                    std::cerr << "MISSED\t" << filteredGsiRecords[i] << "\n";
+                    errStream << "MISSED\t" << filteredGsiRecords[i] << "\n";
             }
         }
         SEQAN_ASSERT_LEQ(numFound, length(intervalDistances));
@@ -839,6 +877,99 @@ void clearPairedFlags(seqan2::BamAlignmentRecord & record)
         record.flag = record.flag ^ seqan2::BAM_FLAG_NEXT_UNMAPPED;
 }
 
+// ----------------------------------------------------------------------------
+// Function benchmarkQuery()
+// ----------------------------------------------------------------------------
+
+// Evaluate the single-end and/or paired-end records of a query.
+
+template <typename TPatternSpec>
+int benchmarkQuery(RabemaStats & result,
+                   std::ostream & errStream,
+                   QueryRecords const & query,
+                   BamFileIn const & bamFileIn,
+                   FaiIndex const & faiIndex,
+                   StringSet<Dna5String> const & refSeqs,
+                   RefIdMapping const & refIdMapping,
+                   RabemaEvaluationOptions const & options,
+                   Pattern<Dna5String, TPatternSpec> & pattern)
+{
+    // We collected the records for all queries.  Here, we differentiate between the different cases.
+    if (query.seenSingleEnd)
+    {
+        int res = benchmarkReadResult(result, errStream, query.samRecords, bamFileIn, query.gsiRecords,
+                                      faiIndex, refSeqs, refIdMapping, options, pattern,
+                                      /*pairedEnd=*/ false);
+        if (res != 0)
+            return 1;
+    }
+    if (query.seenPairedEnd)
+    {
+        int res = benchmarkReadResult(result, errStream, query.samRecords, bamFileIn, query.gsiRecords,
+                                      faiIndex, refSeqs, refIdMapping, options, pattern,
+                                      /*pairedEnd=*/ true, /*second=*/ false);
+        if (res != 0)
+            return 1;
+
+        res = benchmarkReadResult(result, errStream, query.samRecords, bamFileIn, query.gsiRecords,
+                                  faiIndex, refSeqs, refIdMapping, options, pattern,
+                                  /*pairedEnd=*/ true, /*second=*/ true);
+        if (res != 0)
+            return 1;
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function benchmarkQueries()
+// ----------------------------------------------------------------------------
+
+// Evaluate the first numQueries queries in parallel.  The queries are split into blocks of a fixed size and each block
+// collects its own statistics and messages, using the pattern of the thread evaluating it.  The blocks are then merged
+// in order, so neither the statistics nor the messages depend on the number of threads.
+
+template <typename TPatternSpec>
+int benchmarkQueries(RabemaStats & result,
+                     String<QueryRecords> const & queries,
+                     unsigned numQueries,
+                     String<Pattern<Dna5String, TPatternSpec> > & patterns,
+                     BamFileIn const & bamFileIn,
+                     FaiIndex const & faiIndex,
+                     StringSet<Dna5String> const & refSeqs,
+                     RefIdMapping const & refIdMapping,
+                     RabemaEvaluationOptions const & options)
+{
+    unsigned const BLOCK_SIZE = 256;
+    int numBlocks = (numQueries + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    String<RabemaStats> blockStats;
+    resize(blockStats, numBlocks, RabemaStats(options.maxError));
+    String<int> blockRes;
+    resize(blockRes, numBlocks, 0);
+    std::vector<std::string> blockMessages(numBlocks);
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int block = 0; block < numBlocks; ++block)
+    {
+        Pattern<Dna5String, TPatternSpec> & pattern = patterns[omp_get_thread_num()];
+        std::ostringstream errStream;
+        unsigned blockEnd = std::min((block + 1) * BLOCK_SIZE, numQueries);
+        for (unsigned i = block * BLOCK_SIZE; i < blockEnd && blockRes[block] == 0; ++i)
+            blockRes[block] = benchmarkQuery(blockStats[block], errStream, queries[i], bamFileIn, faiIndex, refSeqs,
+                                             refIdMapping, options, pattern);
+        blockMessages[block] = errStream.str();
+    }
+
+    for (int block = 0; block < numBlocks; ++block)
+    {
+        std::cerr << blockMessages[block];
+        if (blockRes[block] != 0)
+            return 1;
+        mergeStats(result, blockStats[block]);
+    }
+    return 0;
+}
+
 // ----------------------------------------------------------------------------
 // Function compareAlignedReadsToReference()
 // ----------------------------------------------------------------------------
@@ -847,6 +978,8 @@ void clearPairedFlags(seqan2::BamAlignmentRecord & record)
 // file.
 //
 // Both the SAM/BAM file and the GSI file have to be sorted by queryname for this to work.
+//
+// The records are read in batches of queries, the queries of a batch are then evaluated in parallel.
 
 template <typename TForwardIter, typename TPatternSpec>
 int
@@ -856,7 +989,7 @@ compareAlignedReadsToReference(RabemaStats & result,
                                StringSet<Dna5String> const & refSeqs,
                                TForwardIter & gsiIter,
                                RabemaEvaluationOptions const & options,
-                               TPatternSpec const & tagPattern)
+                               TPatternSpec const & /*tagPattern*/)
 {
     // Mapping between ref IDs from SAM/BAM file and reference sequence (from SAM/BAM file to reference sequences).
     RefIdMapping refIdMapping;
@@ -889,9 +1022,15 @@ compareAlignedReadsToReference(RabemaStats & result,
             return 1;
         }
 
-    // Current SAM/BAM and GSI records are stored in these arrays.
-    String<BamAlignmentRecord> currentSamRecords;
-    String<GsiRecord> currentGsiRecords;
+    // The SAM/BAM and GSI records of the current batch of queries.  The entries are reused between batches.
+    String<QueryRecords> queries;
+    unsigned numQueries = 0;
+    unsigned const batchSize = 4096 * omp_get_max_threads();
+    reserve(queries, batchSize, Exact());
+
+    // One pattern per thread for realigning reads.
+    String<Pattern<Dna5String, TPatternSpec> > patterns;
+    resize(patterns, omp_get_max_threads());
 
     // These flags store whether we processed the last SAM/BAM and GSI record.
     bool samDone = false, gsiDone = false;
@@ -921,18 +1060,23 @@ compareAlignedReadsToReference(RabemaStats & result,
             currentReadName = lessThanSamtoolsQueryName(gsiRecord.readName, samRecord.qName) ?
                               gsiRecord.readName : samRecord.qName;
 
+        if (numQueries == length(queries))
+            resize(queries, numQueries + 1);
+        QueryRecords & query = queries[numQueries++];
+
         // These flags determine whether evaluation is run for single-end and/or paired-end reads.
-        bool seenSingleEnd = false, seenPairedEnd = false;
+        query.seenSingleEnd = false;
+        query.seenPairedEnd = false;
 
         // Read all SAM/BAM records with the same query name.
-        clear(currentSamRecords);
+        clear(query.samRecords);
         while (!samDone && samRecord.qName == currentReadName)
         {
             if (!hasFlagUnmapped(samRecord))  // Ignore records with non-aligned reads.
             {
-                seenSingleEnd |= !hasFlagMultiple(samRecord);
-                seenPairedEnd |= hasFlagMultiple(samRecord);
-                appendValue(currentSamRecords, samRecord);
+                query.seenSingleEnd |= !hasFlagMultiple(samRecord);
+                query.seenPairedEnd |= hasFlagMultiple(samRecord);
+                appendValue(query.samRecords, samRecord);
             }
             if (atEnd(bamFileIn))
             {
@@ -965,12 +1109,16 @@ compareAlignedReadsToReference(RabemaStats & result,
         }
 
         // Read in the next block of GSI records.
-        clear(currentGsiRecords);
+        clear(query.gsiRecords);
         while (!gsiDone && gsiRecord.readName == currentReadName)
         {
-            seenSingleEnd |= !(gsiRecord.flags & GsiRecord::FLAG_PAIRED);
-            seenPairedEnd |= (gsiRecord.flags & GsiRecord::FLAG_PAIRED);
-            appendValue(currentGsiRecords, gsiRecord);
+            query.seenSingleEnd |= !(gsiRecord.flags & GsiRecord::FLAG_PAIRED);
+            query.seenPairedEnd |= (gsiRecord.flags & GsiRecord::FLAG_PAIRED);
+            appendValue(query.gsiRecords, gsiRecord);
+            // Get index of the sequence from GSI record contig name.  This is done here and not when evaluating the
+            // query since lookups in the name store cache of the FAI index are not thread-safe.
+            if (!getIdByName(back(query.gsiRecords).contigId, faiIndex, gsiRecord.contigName))
+                back(query.gsiRecords).contigId = QueryRecords::UNKNOWN_CONTIG;
             if (atEnd(gsiIter))
             {
                 // At end of GSI File, do not read next one.
@@ -995,32 +1143,18 @@ compareAlignedReadsToReference(RabemaStats & result,
             }
         }
 
-        // Now, compare the SAM/BAM records against the intervals stored in the GSI records.
-        //
-        // We collected the records for all queries.  Here, we differentiate between the different cases.
-        if (seenSingleEnd)
+        // Now, compare the SAM/BAM records against the intervals stored in the GSI records once the batch is full.
+        if (numQueries == batchSize)
         {
-            int res = benchmarkReadResult(result, currentSamRecords, bamFileIn, currentGsiRecords,
-                                          faiIndex, refSeqs, refIdMapping, options, tagPattern,
-                                          /*pairedEnd=*/ false);
-            if (res != 0)
-                return 1;
-        }
-        if (seenPairedEnd)
-        {
-            int res = benchmarkReadResult(result, currentSamRecords, bamFileIn, currentGsiRecords,
-                                          faiIndex, refSeqs, refIdMapping, options, tagPattern,
-                                          /*pairedEnd=*/ true, /*second=*/ false);
-            if (res != 0)
-                return 1;
-
-            res = benchmarkReadResult(result, currentSamRecords, bamFileIn, currentGsiRecords,
-                                      faiIndex, refSeqs, refIdMapping, options, tagPattern,
-                                      /*pairedEnd=*/ true, /*second=*/ true);
-            if (res != 0)
+            if (benchmarkQueries(result, queries, numQueries, patterns, bamFileIn, faiIndex, refSeqs, refIdMapping,
+                                 options) != 0)
                 return 1;
+            numQueries = 0;
         }
     }
+    if (benchmarkQueries(result, queries, numQueries, patterns, bamFileIn, faiIndex, refSeqs, refIdMapping,
+                         options) != 0)
+        return 1;
     std::cerr << " DONE\n";
 
     return 0;
@@ -1146,6 +1280,15 @@ parseCommandLine(RabemaEvaluationOptions & options, int argc, char const ** argv
     addOption(parser, seqan2::ArgParseOption("", "show-hits", "Show details for hit intervals."));
     addOption(parser, seqan2::ArgParseOption("", "show-try-hit", "Show details for each alignment in SAM/BAM input."));
 
+    addSection(parser, "Performance Options");
+    addOption(parser, seqan2::ArgParseOption("t", "num-threads",
+                                            "Number of threads to use.  The records are read in batches of reads "
+                                            "and the reads of a batch are compared in parallel.  The result does not "
+                                            "depend on the number of threads.",
+                                            seqan2::ArgParseArgument::INTEGER, "NUM"));
+    setMinValue(parser, "num-threads", "1");
+    setDefaultValue(parser, "num-threads", 1);
+
     addTextSection(parser, "Return Values");
     addText(parser, "A return value of 0 indicates success, any other value indicates an error.");
 
@@ -1230,6 +1373,8 @@ parseCommandLine(RabemaEvaluationOptions & options, int argc, char const ** argv
     getOptionValue(options.checkSorting, parser, "dont-check-sorting");
     options.checkSorting = !options.checkSorting;
 
+    getOptionValue(options.numThreads, parser, "num-threads");
+
     options.showMissedIntervals = isSet(parser, "show-missed-intervals");
     options.showSuperflousIntervals = isSet(parser, "show-invalid-hits");
     options.showAdditionalIntervals = isSet(parser, "show-additional-hits");
@@ -1274,6 +1419,7 @@ int main(int argc, char const ** argv)
               << "Reference File        " << options.referencePath << '\n'
               << "TSV Output File       " << options.outTsvPath << '\n'
               << "Check Sorting         " << yesNo(options.checkSorting) << '\n'
+              << "Threads               " << options.numThreads << '\n'
               << "Show\n"
               << "    additional        " << yesNo(options.showAdditionalIntervals) << '\n'
               << "    hit               " << yesNo(options.showHitIntervals) << '\n'
@@ -1282,6 +1428,8 @@ int main(int argc, char const ** argv)
               << "    try hit           " << yesNo(options.showTryHitIntervals) << '\n'
               << "\n";
 
+    omp_set_num_threads(options.numThreads);
+
     std::cerr << "____LOADING FILES_____________________________________________________________\n\n";
 
     // =================================================================
@@ -120,6 +120,35 @@ void updateMaximalErrorRate(RabemaStats & stats, unsigned maxErrorRate)
         resize(stats.normalizedIntervalsFoundForErrorRate, maxErrorRate + 1, 0.0);
 }
 
+// ----------------------------------------------------------------------------
+// Function mergeStats()
+// ----------------------------------------------------------------------------
+
+// Add the counts from other to stats, e.g. to combine statistics that were collected for separate blocks of reads.
+
+void mergeStats(RabemaStats & stats, RabemaStats const & other)
+{
+    stats.intervalsToFind += other.intervalsToFind;
+    stats.intervalsFound += other.intervalsFound;
+    stats.invalidAlignments += other.invalidAlignments;
+    stats.totalReads += other.totalReads;
+    stats.mappedReads += other.mappedReads;
+    stats.readsInGsi += other.readsInGsi;
+    stats.normalizedIntervals += other.normalizedIntervals;
+    stats.additionalHits += other.additionalHits;
+
+    if (!empty(other.intervalsToFindForErrorRate))
+        updateMaximalErrorRate(stats, length(other.intervalsToFindForErrorRate) - 1);
+    for (unsigned i = 0; i < length(other.intervalsToFindForErrorRate); ++i)
+        stats.intervalsToFindForErrorRate[i] += other.intervalsToFindForErrorRate[i];
+    for (unsigned i = 0; i < length(other.intervalsFoundForErrorRate); ++i)
+        stats.intervalsFoundForErrorRate[i] += other.intervalsFoundForErrorRate[i];
+    for (unsigned i = 0; i < length(other.normalizedIntervalsToFindForErrorRate); ++i)
+        stats.normalizedIntervalsToFindForErrorRate[i] += other.normalizedIntervalsToFindForErrorRate[i];
+    for (unsigned i = 0; i < length(other.normalizedIntervalsFoundForErrorRate); ++i)
+        stats.normalizedIntervalsFoundForErrorRate[i] += other.normalizedIntervalsFoundForErrorRate[i];
+}
+
 // ----------------------------------------------------------------------------
 // Function write()                                                       [Raw]
 // ----------------------------------------------------------------------------
@@ -108,6 +108,20 @@ def main(source_base, binary_base):
                   ph.outFile('gold-adeno-edit-08.gsi'))])
     conf_list.append(conf)
 
+    # The gold standard built with multiple threads must match the single-threaded one.
+    conf = app_tests.TestConf(
+        program=path_to_build,
+        redir_stdout=ph.outFile('gold-adeno-edit-08.t4.stdout'),
+        args=['--distance-metric', 'edit', '-e', '8', '--num-threads', '4',
+              '-o', ph.outFile('gold-adeno-edit-08.t4.gsi'),
+              '--reference', ph.outFile('adeno-genome.fa'),
+              '--in-bam', ph.inFile('gold-adeno-edit-08.by_coordinate.sam')],
+        to_diff=[(ph.inFile('gold-adeno-edit-08.stdout'),
+                  ph.outFile('gold-adeno-edit-08.t4.stdout')),
+                 (ph.inFile('gold-adeno-edit-08.gsi'),
+                  ph.outFile('gold-adeno-edit-08.t4.gsi'))])
+    conf_list.append(conf)
+
     # ============================================================
     # Compare.
     # ============================================================
@@ -157,6 +171,29 @@ def main(source_base, binary_base):
 
     conf_list.append(conf)
 
+    # The evaluation with multiple threads must match the single-threaded one.
+    conf = app_tests.TestConf(
+        program=path_to_evaluate,
+        redir_stdout=ph.outFile('razers2-adeno-hamming-08.t4.stdout'),
+        args=['--distance-metric', 'hamming', '-e', '8', '--num-threads', '4',
+              '--reference', ph.outFile('adeno-genome.fa'),
+              '--in-bam', ph.inFile('razers2-adeno-hamming-08.sam'),
+              '--in-gsi', ph.inFile('gold-adeno-hamming-08.gsi')],
+        to_diff=[(ph.inFile('razers2-adeno-hamming-08.stdout'),
+                  ph.outFile('razers2-adeno-hamming-08.t4.stdout'))])
+    conf_list.append(conf)
+
+    conf = app_tests.TestConf(
+        program=path_to_evaluate,
+        redir_stdout=ph.outFile('razers2-adeno-edit-08.t4.stdout'),
+        args=['--distance-metric', 'edit', '-e', '8', '--num-threads', '4',
+              '--reference', ph.outFile('adeno-genome.fa'),
+              '--in-bam', ph.inFile('razers2-adeno-edit-08.sam'),
+              '--in-gsi', ph.inFile('gold-adeno-edit-08.gsi')],
+        to_diff=[(ph.inFile('razers2-adeno-edit-08.stdout'),
+                  ph.outFile('razers2-adeno-edit-08.t4.stdout'))])
+    conf_list.append(conf)
+
     # Execute the tests.
     failures = 0
     for conf in conf_list:
@@ -6,23 +6,13 @@
 #include <seqan/arg_parse.h>
 #include <seqan/store.h>
 #include <seqan/parallel.h>
-
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+#include <seqan/random.h>
 
 using namespace seqan2;
 
 template <typename TReads, typename TErrorDist, typename TStore>
 void simulateReads(TReads & reads, TErrorDist const & errorDist, TStore const & store)
 {
-    String<std::mt19937 > rng;
-#ifdef _OPENMP
-    resize(rng, omp_get_max_threads());
-#else
-    resize(rng, 1);
-#endif
-
     std::uniform_int_distribution<unsigned> distContig(0, length(store.contigStore) - 1);
     std::uniform_int_distribution<unsigned> distOrientation(0, 1);
     std::uniform_real_distribution<double> distFrac(0.0, 1.0);
@@ -32,18 +22,16 @@ void simulateReads(TReads & reads, TErrorDist const & errorDist, TStore const &
     SEQAN_OMP_PRAGMA(parallel for)
     for (int i = 0; i < (int)length(reads); ++i)
     {
-        unsigned id = 0;
-#ifdef _OPENMP
-        id = omp_get_thread_num();
-#endif
-        unsigned contigId = distContig(rng[id]);
+        // Each read draws from its own stream, so the reads do not depend on the number of threads.
+        CounterBasedRng<> rng(0, i);
+        unsigned contigId = distContig(rng);
         unsigned pos;
         bool ok;
 
         do
         {
             std::uniform_int_distribution<unsigned> distPos(0, length(store.contigStore[contigId].seq) - readLen);
-            pos = distPos(rng[id]);
+            pos = distPos(rng);
             reads[i] = infix(store.contigStore[contigId].seq, pos, pos + readLen);
 
             ok = true;
@@ -56,14 +44,14 @@ void simulateReads(TReads & reads, TErrorDist const & errorDist, TStore const &
         }
         while (!ok);
 
-        if (distOrientation(rng[id]) == 1)
+        if (distOrientation(rng) == 1)
             reverseComplement(reads[i]);
 
         for (unsigned j = 0; j < readLen; ++j)
         {
-            if (distFrac(rng[id]) < errorDist[j])
+            if (distFrac(rng) < errorDist[j])
             {
-                reads[i][j] = (Dna5)((ordValue(reads[i][j]) + distSubstitute(rng[id])) & 3);
+                reads[i][j] = (Dna5)((ordValue(reads[i][j]) + distSubstitute(rng)) & 3);
                 assignQualityValue(reads[i][j], 0);
             }
             else
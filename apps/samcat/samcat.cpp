@@ -62,6 +62,18 @@ struct AppOptions
     CharString outFile;
     bool bamFormat;
     bool verbose;
+    bool sort;
+    bool merge;
+    BamSortOptions sortOptions;
+    unsigned threads;
+
+    AppOptions() :
+        bamFormat(false),
+        verbose(false),
+        sort(false),
+        merge(false),
+        threads(1)
+    {}
 };
 
 // ==========================================================================
@@ -69,20 +81,23 @@ struct AppOptions
 // ==========================================================================
 
 // --------------------------------------------------------------------------
-// Function mergeBamFiles()
+// Function openInputFiles()
 // --------------------------------------------------------------------------
 
+// Opens the input files and reads their headers.  The readers share the context of the writer, unless they are
+// merged, then each input needs its own context.
+
 template <typename TWriter>
-void catBamFiles(TWriter &writer, StringSet<CharString> &inFiles, AppOptions const &options)
+void openInputFiles(String<BamFileIn *> &readerPtr, BamHeader &header, TWriter &writer,
+                    StringSet<CharString> &inFiles, bool sharedContext)
 {
-    String<BamFileIn *> readerPtr;
     resize(readerPtr, length(inFiles));
-
-    // Step 1: Merge all headers (if available)
-    BamHeader header;
     for (unsigned i = 0; i < length(inFiles); ++i)
     {
-        readerPtr[i] = new BamFileIn(writer);
+        if (sharedContext)
+            readerPtr[i] = new BamFileIn(writer);
+        else
+            readerPtr[i] = new BamFileIn();
 
         bool success;
         if (inFiles[i] != "-")
@@ -102,9 +117,62 @@ void catBamFiles(TWriter &writer, StringSet<CharString> &inFiles, AppOptions con
         readHeader(header, *(readerPtr[i]));
     }
 
-    // Step 2: Remove duplicate header entries and write merged header
+    // remove duplicate header entries and the files that couldn't be opened
     if (length(inFiles) > 1)
         removeDuplicates(header);
+
+    unsigned numReaders = 0;
+    for (unsigned i = 0; i < length(readerPtr); ++i)
+        if (readerPtr[i] != NULL)
+            readerPtr[numReaders++] = readerPtr[i];
+    resize(readerPtr, numReaders);
+}
+
+// --------------------------------------------------------------------------
+// Function sortInputFiles()
+// --------------------------------------------------------------------------
+
+template <typename TWriter>
+void sortInputFiles(TWriter &writer, StringSet<CharString> &inFiles, AppOptions const &options)
+{
+    String<BamFileIn *> readerPtr;
+    BamHeader header;
+    double start = sysTime();
+
+    if (options.merge)
+    {
+        openInputFiles(readerPtr, header, writer, inFiles, false);
+        mergeSortedBamFiles(writer, header, readerPtr, options.sortOptions.sortOrder);
+    }
+    else
+    {
+        openInputFiles(readerPtr, header, writer, inFiles, true);
+        sortBamFiles(writer, header, readerPtr, options.sortOptions);
+    }
+
+    for (unsigned i = 0; i < length(readerPtr); ++i)
+    {
+        close(*readerPtr[i]);
+        delete readerPtr[i];
+    }
+    double stop = sysTime();
+    if (options.verbose)
+        std::cerr << "Elapsed time:         " << stop - start << " seconds" << std::endl;
+}
+
+// --------------------------------------------------------------------------
+// Function catBamFiles()
+// --------------------------------------------------------------------------
+
+template <typename TWriter>
+void catBamFiles(TWriter &writer, StringSet<CharString> &inFiles, AppOptions const &options)
+{
+    // Step 1: Merge all headers (if available)
+    String<BamFileIn *> readerPtr;
+    BamHeader header;
+    openInputFiles(readerPtr, header, writer, inFiles, true);
+
+    // Step 2: Write merged header
     writeHeader(writer, header);
 
     // Step 3: Read and output alignment records
@@ -112,11 +180,8 @@ void catBamFiles(TWriter &writer, StringSet<CharString> &inFiles, AppOptions con
     String<BamAlignmentRecord> records;
     uint64_t numRecords = 0;
     double start = sysTime();
-    for (unsigned i = 0; i != length(inFiles); ++i)
+    for (unsigned i = 0; i != length(readerPtr); ++i)
     {
-        if (readerPtr[i] == NULL)
-            continue;
-
         BamFileIn &reader = *readerPtr[i];
 
         // copy all alignment records
@@ -175,6 +240,10 @@ parseCommandLine(AppOptions & options, int argc, char const ** argv)
 #endif
                            "and outputs the concatenation of them. "
                            "If the output file name is omitted the result is written to stdout.");
+    addDescription(parser, "With \\fB-s\\fP the records are sorted by coordinate or query name. Inputs that do not "
+                           "fit into the memory given by \\fB-M\\fP are sorted in runs that are written to "
+                           "temporary files and merged afterwards. With \\fB-m\\fP the inputs must already be sorted "
+                           "and are merged while streaming them.");
 
     addDescription(parser, "(c) Copyright in 2014 by David Weese.");
 
@@ -192,6 +261,26 @@ parseCommandLine(AppOptions & options, int argc, char const ** argv)
 #endif
     addOption(parser, ArgParseOption("v", "verbose", "Print some stats."));
 
+    addSection(parser, "Sort Options");
+    addOption(parser, ArgParseOption("s", "sort", "Sort the records by coordinate or query name.",
+                                     ArgParseOption::STRING, "ORDER"));
+    setValidValues(parser, "sort", "coordinate queryname");
+    addOption(parser, ArgParseOption("m", "merge", "Merge inputs that are already sorted in the order given by "
+                                     "\\fB-s\\fP instead of sorting them."));
+    addOption(parser, ArgParseOption("M", "memory", "Approximate memory used for sorting in MiB.",
+                                     ArgParseOption::INTEGER, "NUM"));
+    setMinValue(parser, "memory", "1");
+    setDefaultValue(parser, "memory", options.sortOptions.maxMemory >> 20);
+    addOption(parser, ArgParseOption("T", "tmp-dir", "Directory of the temporary files. Default: \\fITMPDIR\\fP "
+                                     "if set, otherwise the system's temporary directory.",
+                                     ArgParseOption::STRING, "DIR"));
+#ifdef _OPENMP
+    addOption(parser, ArgParseOption("t", "threads", "Number of threads used for sorting.",
+                                     ArgParseOption::INTEGER, "NUM"));
+    setMinValue(parser, "threads", "1");
+    setDefaultValue(parser, "threads", options.threads);
+#endif
+
     // Add Examples Section.
     addTextSection(parser, "Examples");
     addListItem(parser, "\\fBsamcat\\fP \\fBmapped1.sam\\fP \\fBmapped2.sam\\fP \\fB-o\\fP \\fBmerged.sam\\fP",
@@ -199,6 +288,12 @@ parseCommandLine(AppOptions & options, int argc, char const ** argv)
 #if SEQAN_HAS_ZLIB
     addListItem(parser, "\\fBsamcat\\fP \\fBinput.sam\\fP \\fB-o\\fP \\fBoutput.bam\\fP",
                 "Convert a SAM file into BAM format.");
+    addListItem(parser, "\\fBsamcat\\fP \\fB-s\\fP \\fBcoordinate\\fP \\fB-M\\fP \\fB2048\\fP \\fBinput.bam\\fP "
+                "\\fB-o\\fP \\fBsorted.bam\\fP",
+                "Sort a BAM file by coordinate using about 2 GiB of memory.");
+    addListItem(parser, "\\fBsamcat\\fP \\fB-s\\fP \\fBcoordinate\\fP \\fB-m\\fP \\fBsorted1.bam\\fP "
+                "\\fBsorted2.bam\\fP \\fB-o\\fP \\fBmerged.bam\\fP",
+                "Merge two BAM files sorted by coordinate.");
 #endif
 
     // Parse command line.
@@ -215,6 +310,24 @@ parseCommandLine(AppOptions & options, int argc, char const ** argv)
 #endif
     getOptionValue(options.verbose, parser, "verbose");
 
+    CharString sortOrder;
+    options.sort = getOptionValue(sortOrder, parser, "sort");
+    if (sortOrder == "queryname")
+        options.sortOptions.sortOrder = BAM_SORT_QUERYNAME;
+    getOptionValue(options.merge, parser, "merge");
+    if (options.merge && !options.sort)
+    {
+        std::cerr << "ERROR: Option -m requires the sort order -s.\n";
+        return ArgumentParser::PARSE_ERROR;
+    }
+    uint64_t memory = 0;
+    getOptionValue(memory, parser, "memory");
+    options.sortOptions.maxMemory = memory << 20;
+    getOptionValue(options.sortOptions.tmpDir, parser, "tmp-dir");
+#ifdef _OPENMP
+    getOptionValue(options.threads, parser, "threads");
+#endif
+
     return ArgumentParser::PARSE_OK;
 }
 
@@ -255,6 +368,10 @@ int main(int argc, char const ** argv)
         return 1;
     }
 
-    catBamFiles(writer, options.inFiles, options);
+    omp_set_num_threads(options.threads);
+    if (options.sort)
+        sortInputFiles(writer, options.inFiles, options);
+    else
+        catBamFiles(writer, options.inFiles, options);
     return 0;
 }
@@ -12,3 +12,12 @@ ${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -o ex1_merged.sam
 echo ${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -o ex1_merged.bam
 ${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -o ex1_merged.bam
 
+
+echo ${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -s coordinate -o ex1_sorted_coordinate.sam
+${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -s coordinate -o ex1_sorted_coordinate.sam
+
+echo ${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -s queryname -o ex1_sorted_queryname.sam
+${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -s queryname -o ex1_sorted_queryname.sam
+
+echo ${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -s coordinate -m -o ex1_merged_coordinate.sam
+${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -s coordinate -m -o ex1_merged_coordinate.sam
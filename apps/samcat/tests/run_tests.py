@@ -70,6 +70,43 @@ def main(source_base, binary_base):
                   ph.outFile('ex1_merged.bam'), "gunzip")])
     conf_list.append(conf)
 
+    # ============================================================
+    # Sort and merge.
+    # ============================================================
+
+    conf = app_tests.TestConf(
+        program=path_to_program,
+        args=[ph.inFile('ex1_a1.sam'),
+              ph.inFile('ex1_a2.sam'),
+              ph.inFile('ex1_a3.sam'),
+              '-s', 'coordinate',
+              '-o', ph.outFile('ex1_sorted_coordinate.sam')],
+        to_diff=[(ph.inFile('ex1_sorted_coordinate.sam'),
+                  ph.outFile('ex1_sorted_coordinate.sam'))])
+    conf_list.append(conf)
+
+    conf = app_tests.TestConf(
+        program=path_to_program,
+        args=[ph.inFile('ex1_a1.sam'),
+              ph.inFile('ex1_a2.sam'),
+              ph.inFile('ex1_a3.sam'),
+              '-s', 'queryname',
+              '-o', ph.outFile('ex1_sorted_queryname.sam')],
+        to_diff=[(ph.inFile('ex1_sorted_queryname.sam'),
+                  ph.outFile('ex1_sorted_queryname.sam'))])
+    conf_list.append(conf)
+
+    conf = app_tests.TestConf(
+        program=path_to_program,
+        args=[ph.inFile('ex1_a1.sam'),
+              ph.inFile('ex1_a2.sam'),
+              ph.inFile('ex1_a3.sam'),
+              '-s', 'coordinate', '-m',
+              '-o', ph.outFile('ex1_merged_coordinate.sam')],
+        to_diff=[(ph.inFile('ex1_merged_coordinate.sam'),
+                  ph.outFile('ex1_merged_coordinate.sam'))])
+    conf_list.append(conf)
+
     # Execute the tests.
     failures = 0
     for conf in conf_list:
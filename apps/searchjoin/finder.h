@@ -108,6 +108,45 @@ struct DbFinder
     }
 };
 
+// ----------------------------------------------------------------------------
+// Class DbFinderWorker_
+// ----------------------------------------------------------------------------
+// The subtrees left to search by one thread; other threads steal from the front.
+
+template <typename TFinder>
+struct DbFinderWorker_
+{
+    typedef String<TFinder>                                     TFinders;
+    typedef typename Size<TFinders>::Type                       TSize;
+
+    TFinders            finders;
+    TSize               stolen;
+    ReadWriteLock       lock;
+    char                pad[SEQAN_CACHE_LINE_SIZE];
+
+    DbFinderWorker_() :
+        stolen(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class DbFinderHits_
+// ----------------------------------------------------------------------------
+// The verified pairs of one thread, passed to the delegate after the search.
+
+template <typename TSize>
+struct DbFinderHits_
+{
+    String<Pair<TSize> >    hits;
+    char                    pad[SEQAN_CACHE_LINE_SIZE];
+
+    inline void
+    operator() (TSize dbId, TSize queryId)
+    {
+        appendValue(hits, Pair<TSize>(dbId, queryId));
+    }
+};
+
 template <typename TText, typename TIndex, typename TDbQuerySpec, typename TDelegate>
 struct DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel>
 {
@@ -123,8 +162,9 @@ struct DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel>
     typedef Backtracking<EditDistance, Bottom>                  TBacktrackingApx;
     typedef Finder_<TIndex, TIndex, TBacktrackingExt>           TFinderExt;
     typedef Finder_<TIndex, TIndex, TBacktrackingApx>           TFinderApx;
-    typedef String<TFinderApx>                                  TFindersApx;
-    typedef String<TFinderExt>                                  TFindersExt;
+    typedef std::vector<DbFinderWorker_<TFinderExt> >           TWorkersExt;
+    typedef std::vector<DbFinderWorker_<TFinderApx> >           TWorkersApx;
+    typedef String<DbFinderHits_<TDepth> >                      THits;
 
     TDb /* const */     & db;
     TDbIndex            dbIndex;
@@ -135,8 +175,13 @@ struct DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel>
     TTextSize           minSeedLength;
 
     TDepth              parallelDepth;
-    TFindersExt         findersExt;
-    TFindersApx         findersApx;
+    TWorkersExt         workersExt;
+    TWorkersApx         workersApx;
+    THits               hits;
+
+    Atomic<unsigned long>::Type pendingFinders;
+    Atomic<unsigned>::Type      idleThreads;
+    Atomic<unsigned long>::Type splitFinders;
 
     DbFinder(TDb /* const */ & db, TDelegate & delegate) :
         db(db),
@@ -144,7 +189,10 @@ struct DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel>
         delegate(delegate),
         verifier(db),
         minSeedLength(0),
-        parallelDepth(2)
+        parallelDepth(2),
+        pendingFinders(0),
+        idleThreads(0),
+        splitFinders(0)
     {}
 
     template <typename TFinder>
@@ -420,7 +468,7 @@ onFind(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, TSpec> & dbFinder,
             TSize pos2 = getSeqOffset(patternOccurrences[j]);
 
             if (_validHit(dbFinder, dbId1, dbId2, pos1, pos2))
-                dbFinder.verifier(dbId1, dbId2, dbFinder.delegate);
+                _verifyHit(dbFinder, dbId1, dbId2);
         }
 }
 
@@ -482,6 +530,99 @@ _validHit(DbFinder<TText, TIndex, Query, TDelegate, TSpec> const & dbFinder,
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// Function _verifyHit()                                             [DbFinder]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndex, typename TDbQuerySpec, typename TDelegate, typename TSpec>
+inline void
+_verifyHit(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, TSpec> & dbFinder,
+           typename Size<TIndex>::Type dbId1,
+           typename Size<TIndex>::Type dbId2)
+{
+    dbFinder.verifier(dbId1, dbId2, dbFinder.delegate);
+}
+
+// ----------------------------------------------------------------------------
+// Function _verifyHit()                                   [DbFinder<Parallel>]
+// ----------------------------------------------------------------------------
+// Verified pairs go to the buffer of the calling thread, so that no thread has
+// to wait for the delegate while searching.
+
+template <typename TText, typename TIndex, typename TDbQuerySpec, typename TDelegate>
+inline void
+_verifyHit(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel> & dbFinder,
+           typename Size<TIndex>::Type dbId1,
+           typename Size<TIndex>::Type dbId2)
+{
+    dbFinder.verifier(dbId1, dbId2, dbFinder.hits[omp_get_thread_num()]);
+}
+
+// ----------------------------------------------------------------------------
+// Function _pushFinder()                                     [DbFinderWorker_]
+// ----------------------------------------------------------------------------
+
+template <typename TFinder>
+inline void
+_pushFinder(DbFinderWorker_<TFinder> & worker, TFinder const & finder)
+{
+    ScopedWriteLock<> writeLock(worker.lock);
+    appendValue(worker.finders, finder);
+}
+
+// ----------------------------------------------------------------------------
+// Function _popFinder()                                      [DbFinderWorker_]
+// ----------------------------------------------------------------------------
+// The owner pops the subtree it found last, i.e. a deep and small one.
+
+template <typename TFinder>
+inline bool
+_popFinder(TFinder & finder, DbFinderWorker_<TFinder> & worker)
+{
+    ScopedWriteLock<> writeLock(worker.lock);
+
+    if (worker.stolen >= length(worker.finders))
+        return false;
+
+    finder = back(worker.finders);
+    eraseBack(worker.finders);
+
+    if (worker.stolen == length(worker.finders))
+    {
+        clear(worker.finders);
+        worker.stolen = 0;
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _stealFinder()                                    [DbFinderWorker_]
+// ----------------------------------------------------------------------------
+// Thieves take the subtree found first, i.e. a shallow and big one.
+
+template <typename TFinder>
+inline bool
+_stealFinder(TFinder & finder, DbFinderWorker_<TFinder> & worker)
+{
+    ScopedWriteLock<> writeLock(worker.lock);
+
+    if (worker.stolen >= length(worker.finders))
+        return false;
+
+    finder = worker.finders[worker.stolen];
+    clear(worker.finders[worker.stolen]);
+    worker.stolen++;
+
+    if (worker.stolen == length(worker.finders))
+    {
+        clear(worker.finders);
+        worker.stolen = 0;
+    }
+
+    return true;
+}
+
 // ----------------------------------------------------------------------------
 // Function onFind()                                       [DbFinder<Parallel>]
 // ----------------------------------------------------------------------------
@@ -501,7 +642,8 @@ onFind(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel> & dbFinder,
     appendValue(finderBottom.scoreStack, back(finder.scoreStack));
     back(finderBottom.patternStack).depth = dbFinder.queryIndex.seedLength;
 
-    appendValue(dbFinder.findersApx, finderBottom);
+    _pushFinder(dbFinder.workersApx[omp_get_thread_num()], finderBottom);
+    ++dbFinder.pendingFinders;
 }
 
 template <typename TText, typename TIndex, typename TDbQuerySpec, typename TDelegate>
@@ -519,7 +661,8 @@ onFind(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel> & dbFinder,
     appendValue(finderBottom.scoreStack, back(finder.scoreStack));
     back(finderBottom.patternStack).depth = dbFinder.queryIndex.seedLength;
 
-    appendValue(dbFinder.findersExt, finderBottom);
+    _pushFinder(dbFinder.workersExt[omp_get_thread_num()], finderBottom);
+    ++dbFinder.pendingFinders;
 }
 
 // ----------------------------------------------------------------------------
@@ -574,6 +717,118 @@ void execute(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, TSpec> & dbFinder)
     }
 }
 
+// ----------------------------------------------------------------------------
+// Function _splitFinder()                                 [DbFinder<Parallel>]
+// ----------------------------------------------------------------------------
+// Searches the top parallelDepth pattern levels of a subtree and pushes the
+// subtrees below them to the worker of the calling thread.
+
+template <typename TText, typename TIndex, typename TDbQuerySpec, typename TDelegate, typename TDistance>
+inline void
+_splitFinder(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel> & dbFinder,
+             Finder_<TIndex, TIndex, Backtracking<TDistance, Bottom> > const & finder)
+{
+    typedef Finder_<TIndex, TIndex, Backtracking<TDistance, Top> >      TFinderTop;
+
+    TFinderTop finderTop;
+    _setScoreThreshold(finderTop, finder.maxScore);
+    finderTop.textStack = finder.textStack;
+    finderTop.patternStack = finder.patternStack;
+    finderTop.scoreStack = finder.scoreStack;
+    back(finderTop.patternStack).depth = _min(dbFinder.queryIndex.seedLength,
+                                              repLength(back(finder.patternStack)) + dbFinder.parallelDepth);
+
+    _find(finderTop, dbFinder, StageInitial_());
+    ++dbFinder.splitFinders;
+}
+
+// ----------------------------------------------------------------------------
+// Function _findSubtrees()                                [DbFinder<Parallel>]
+// ----------------------------------------------------------------------------
+// Searches the subtrees collected by the top traversal.  Each thread searches
+// the subtrees of its own worker and steals from the other workers when it
+// runs dry.  While some thread is idle or few subtrees are left, the subtrees
+// about to be searched are split further, so that a thread never keeps a
+// large subtree to itself.
+
+template <typename TText, typename TIndex, typename TDbQuerySpec, typename TDelegate, typename TFinder>
+inline void
+_findSubtrees(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel> & dbFinder,
+              std::vector<DbFinderWorker_<TFinder> > & workers)
+{
+    typedef String<TFinder>                                             TFinders;
+    typedef typename Size<TFinders>::Type                               TSize;
+
+    unsigned threadsCount = workers.size();
+
+    // Deal the subtrees found by the top traversal to all workers.
+    TFinders finders;
+    swap(finders, workers[0].finders);
+    workers[0].stolen = 0;
+    for (TSize i = 0; i < length(finders); ++i)
+        appendValue(workers[i % threadsCount].finders, finders[i]);
+    dbFinder.pendingFinders = length(finders);
+    clear(finders);
+
+    SEQAN_OMP_PRAGMA(parallel num_threads(threadsCount))
+    {
+        unsigned threadId = omp_get_thread_num();
+        bool idle = false;
+        TFinder finder;
+
+        while (dbFinder.pendingFinders > 0)
+        {
+            bool found = _popFinder(finder, workers[threadId]);
+            for (unsigned i = 1; !found && i < threadsCount; ++i)
+                found = _stealFinder(finder, workers[(threadId + i) % threadsCount]);
+
+            if (!found)
+            {
+                if (!idle)
+                    ++dbFinder.idleThreads;
+                idle = true;
+                yieldProcessor();
+                continue;
+            }
+
+            if (idle)
+                --dbFinder.idleThreads;
+            idle = false;
+
+            if (repLength(back(finder.patternStack)) < dbFinder.queryIndex.seedLength &&
+                (dbFinder.idleThreads > 0 || dbFinder.pendingFinders < 4ul * threadsCount))
+                _splitFinder(dbFinder, finder);
+            else
+                _find(finder, dbFinder, StageInitial_());
+
+            clear(finder);
+            --dbFinder.pendingFinders;
+        }
+
+        if (idle)
+            --dbFinder.idleThreads;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _delegateHits()                                [DbFinder<Parallel>]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndex, typename TDbQuerySpec, typename TDelegate>
+inline void
+_delegateHits(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel> & dbFinder)
+{
+    typedef typename Size<TIndex>::Type                                 TSize;
+
+    for (TSize i = 0; i < length(dbFinder.hits); ++i)
+    {
+        for (TSize j = 0; j < length(dbFinder.hits[i].hits); ++j)
+            dbFinder.delegate(dbFinder.hits[i].hits[j].i1, dbFinder.hits[i].hits[j].i2);
+        clear(dbFinder.hits[i].hits);
+        shrinkToFit(dbFinder.hits[i].hits);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function execute()                                      [DbFinder<Parallel>]
 // ----------------------------------------------------------------------------
@@ -583,19 +838,26 @@ void execute(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel> & dbFind
 {
     typedef Backtracking<EditDistance, Top>                                     TBacktrackingApx;
     typedef Backtracking<HammingDistance, Top>                                  TBacktrackingExt;
-    typedef Backtracking<EditDistance, Bottom>                                  TBacktrackingApxBottom;
-    typedef Backtracking<HammingDistance, Bottom>                               TBacktrackingExtBottom;
     typedef Finder_<TIndex, TIndex, TBacktrackingApx>                           TFinderApx;
     typedef Finder_<TIndex, TIndex, TBacktrackingExt>                           TFinderExt;
-    typedef Finder_<TIndex, TIndex, TBacktrackingApxBottom>                     TFinderApxBottom;
-    typedef Finder_<TIndex, TIndex, TBacktrackingExtBottom>                     TFinderExtBottom;
     typedef typename TextIterator_<TIndex, TIndex, TBacktrackingApx>::Type      TTextIterator;
     typedef typename PatternIterator_<TIndex, TIndex, TBacktrackingApx>::Type   TPatternIterator;
 
+    typedef typename DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel>::TWorkersExt    TWorkersExt;
+    typedef typename DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel>::TWorkersApx    TWorkersApx;
+
     // Instantiate a finder.
     TFinderApx finderApx;
     TFinderExt finderExt;
 
+    // Instantiate one worker and one buffer of verified pairs per thread.
+    unsigned threadsCount = omp_get_max_threads();
+    TWorkersExt(threadsCount).swap(dbFinder.workersExt);
+    TWorkersApx(threadsCount).swap(dbFinder.workersApx);
+    resize(dbFinder.hits, threadsCount, Exact());
+    dbFinder.idleThreads = 0;
+    dbFinder.splitFinders = 0;
+
     unsigned seedSetsCount = length(dbFinder.queryIndex.errors);
     unsigned seedSet = 0;
 
@@ -629,27 +891,15 @@ void execute(DbFinder<TText, TIndex, TDbQuerySpec, TDelegate, Parallel> & dbFind
         clear(finderApx);
     }
 
-    unsigned findersExtCount = length(dbFinder.findersExt);
-    unsigned findersApxCount = length(dbFinder.findersApx);
+    std::cout << "Ext jobs count:\t\t\t\t" << length(dbFinder.workersExt[0].finders) << std::endl;
+    std::cout << "Apx jobs count:\t\t\t\t" << length(dbFinder.workersApx[0].finders) << std::endl;
 
-    std::cout << "Ext jobs count:\t\t\t\t" << findersExtCount << std::endl;
-    std::cout << "Apx jobs count:\t\t\t\t" << findersApxCount << std::endl;
+    _findSubtrees(dbFinder, dbFinder.workersExt);
+    _findSubtrees(dbFinder, dbFinder.workersApx);
 
-    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
-    for (int finderExt = 0; finderExt < (int)findersExtCount; ++finderExt)
-    {
-        TFinderExtBottom & finderBottom = dbFinder.findersExt[finderExt];
-        _find(finderBottom, dbFinder, StageInitial_());
-        clear(finderBottom);
-    }
+    std::cout << "Split jobs count:\t\t\t" << dbFinder.splitFinders << std::endl;
 
-    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
-    for (int finderApx = 0; finderApx < (int)findersApxCount; ++finderApx)
-    {
-        TFinderApxBottom & finderBottom = dbFinder.findersApx[finderApx];
-        _find(finderBottom, dbFinder, StageInitial_());
-        clear(finderBottom);
-    }
+    _delegateHits(dbFinder);
 }
 
 // ----------------------------------------------------------------------------
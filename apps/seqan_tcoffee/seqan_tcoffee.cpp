@@ -263,6 +263,8 @@ _initMsaParams(ArgumentParser& parser, TScore& scMat)
         msaOpt.build = 3;
     else if (optionVal == "wavg")
         msaOpt.build = 4;
+    else if (optionVal == "mbed")
+        msaOpt.build = 5;
 
     // Set alignment evaluation	options
     getOptionValue(msaOpt.infile, parser, "infile");
@@ -479,11 +481,12 @@ _setUpArgumentParser(ArgumentParser & parser)
                     "Method to build the tree. "
                     "Following methods are provided: \\fINeighbor-Joining\\fP (\\fBnj\\fP), \\fIUPGMA single linkage\\fP "
                     "(\\fBmin\\fP), \\fIUPGMA complete linkage\\fP (\\fBmax\\fP), \\fIUPGMA average linkage\\fP "
-                    "(\\fBavg\\fP), \\fIUPGMA weighted average linkage\\fP (\\fBwavg\\fP). "
+                    "(\\fBavg\\fP), \\fIUPGMA weighted average linkage\\fP (\\fBwavg\\fP), "
+                    "\\fIk-mer sketch embedding\\fP (\\fBmbed\\fP) for large sequence sets. "
                     "\\fINeighbor-Joining\\fP creates an unrooted tree, which we root at the last joined pair.",
                     ArgParseArgument::STRING));
     setDefaultValue(parser, "build", "nj");
-    setValidValues(parser, "build", "nj min max avg wavg");
+    setValidValues(parser, "build", "nj min max avg wavg mbed");
 
     addSection(parser, "Alignment Evaluation Options:");
     addOption(
@@ -54,6 +54,7 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <deque>
 #include <map>
 #include <seqan/arg_parse.h>
 
@@ -590,6 +591,136 @@ _dumpMatches(TTmpReads & reads, TTmpMatches & matches, TTmpQualities & qualities
 
 //////////////////////////////////////////////////////////////////////////////
 // Main read mapper function
+
+// output of a window, buffered until the preceding windows are written
+struct SnpStoreWindowStream : public ::std::ostringstream
+{
+    bool isOpen;
+
+    SnpStoreWindowStream() : isOpen(false)
+    {}
+
+    bool is_open() const
+    {
+        return isOpen;
+    }
+};
+
+namespace seqan2 {
+
+// the window buffers are written to like std::ostringstreams
+template <>
+SEQAN_CONCEPT_IMPL((SnpStoreWindowStream), (OutputStreamConcept));
+
+template <>
+struct Value<SnpStoreWindowStream> :
+    Value<::std::ostringstream>
+{};
+
+}
+
+// a window whose matches are parsed, the variants of several windows are called in parallel
+template<typename TFragmentStore, typename TPosIterator>
+struct SnpStoreWindow
+{
+    typedef typename TFragmentStore::TContigPos TContigPos;
+
+    TFragmentStore                          fragmentStore;
+    String<unsigned>                        readCounts;
+    String<Pair<int,int> >                  readClips;
+    StringSet<String<Pair<char,int> > >     readCigars;
+
+    unsigned        contigId;
+    TContigPos      startCoord;
+    TContigPos      windowBegin;
+    TContigPos      windowEnd;
+    bool            clip;           // clip reads before calling
+    TPosIterator    inspectPosIt;   // positions of interest inside the window
+    TPosIterator    inspectPosItEnd;
+
+    SnpStoreWindowStream snpOut;
+    SnpStoreWindowStream indelOut;
+    SnpStoreWindowStream posOut;
+};
+
+// call SNPs/indels of a single window, the output goes to the window's buffers
+template<typename TWindow, typename TGenomeName, typename TOptions>
+void
+callWindowVariants(TWindow &window, TGenomeName &genomeName, bool positionStatsOnly, TOptions &options)
+{
+    if(!empty(window.fragmentStore.alignedReadStore))
+    {
+        // clip Reads if clipping is switched on and there were clip tags in the gff file
+        if(window.clip)
+            clipReads(window.fragmentStore,window.readClips,(unsigned)0,(unsigned)length(window.fragmentStore.alignedReadStore),options);
+
+        // check for indels
+        if (options.outputIndel != "")
+        {
+            if(options._debugLevel > 1) ::std::cout << "Check for indels..." << std::endl;
+            if(!options.realign) dumpShortIndelPolymorphismsBatch(window.fragmentStore, window.readCigars, window.fragmentStore.contigStore[0].seq, genomeName, window.startCoord, window.windowBegin, window.windowEnd, window.indelOut, options);
+        }
+
+        if (options.outputSNP != "")
+        {
+            if(options._debugLevel > 1) ::std::cout << "Check for SNPs..." << std::endl;
+            if(options.realign)
+                dumpVariantsRealignBatchWrap(window.fragmentStore, window.readCigars, window.readCounts, genomeName, window.startCoord, window.windowBegin, window.windowEnd, window.snpOut, window.indelOut, options);
+            else
+                dumpSNPsBatch(window.fragmentStore, window.readCigars, window.readCounts, genomeName, window.startCoord, window.windowBegin, window.windowEnd, window.snpOut, options);
+        }
+        if(positionStatsOnly)
+        {
+            if(options._debugLevel > 1) ::std::cout << "Dumping info for query positions..." << std::endl;
+            if(options.realign)
+                dumpPositionsRealignBatchWrap(window.fragmentStore, window.inspectPosIt, window.inspectPosItEnd, window.readCigars, window.readCounts, genomeName, window.startCoord, window.windowBegin, window.windowEnd, window.posOut, options);
+            else dumpPosBatch(window.fragmentStore, window.inspectPosIt, window.inspectPosItEnd, window.readCigars, window.readCounts, genomeName, window.startCoord, window.windowBegin, window.windowEnd, window.posOut, options);
+        }
+    }
+    if(positionStatsOnly)
+    {
+        for(; window.inspectPosIt != window.inspectPosItEnd; ++window.inspectPosIt)
+        {
+            if(options.orientationAware)
+                window.posOut << genomeName << '\t' << *window.inspectPosIt + options.positionFormat << "\t0\t0\t0\t0\t0\t0\t0\t0\t0\t0\t0" << std::endl;
+            else
+                window.posOut << genomeName << '\t' << *window.inspectPosIt + options.positionFormat << "\t0\t0\t0\t0\t0\t0" << std::endl;
+        }
+    }
+}
+
+// call the variants of the first numWindows parsed windows in parallel and write their output in window order
+template<typename TWindows, typename TGenomeNames, typename TOptions>
+void
+callAndWriteWindows(TWindows &windows,
+                    unsigned numWindows,
+                    TGenomeNames &genomeNames,
+                    bool positionStatsOnly,
+                    ::std::ofstream &snpFileStream,
+                    ::std::ofstream &indelFileStream,
+                    ::std::ofstream &posFileStream,
+                    TOptions &options)
+{
+    // the calling functions append per-window statistics to the log file
+    bool parallel = options.outputLog == "" && numWindows > 1;
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 1) if(parallel))
+    for (int k = 0; k < (int)numWindows; ++k)
+        callWindowVariants(windows[k], genomeNames[windows[k].contigId], positionStatsOnly, options);
+
+    for (unsigned k = 0; k < numWindows; ++k)
+    {
+        if (snpFileStream.is_open())
+            snpFileStream << windows[k].snpOut.str();
+        if (indelFileStream.is_open())
+            indelFileStream << windows[k].indelOut.str();
+        if (posFileStream.is_open())
+            posFileStream << windows[k].posOut.str();
+    }
+    windows.erase(windows.begin(), windows.begin() + numWindows);
+}
+
+
 template <typename TSpec>
 int detectSNPs(SNPCallingOptions<TSpec> &options)
 {
@@ -793,6 +924,12 @@ int detectSNPs(SNPCallingOptions<TSpec> &options)
 
     bool firstCall = true;
 
+    // Windows are parsed one after another, as reads overlapping two windows are carried over.  The variants of
+    // up to windowBatchSize parsed windows are then called in parallel and written in window order.
+    typedef SnpStoreWindow<TFragmentStore, TPosIterator> TWindow;
+    ::std::deque<TWindow> windows;
+    unsigned windowBatchSize = (options.numThreads > 1) ? 2 * options.numThreads : 1;
+
     /////////////////////////////////////////////////////////////////////////////
     // Start scanning for SNPs/indels
     // for each chromosome
@@ -835,10 +972,27 @@ int detectSNPs(SNPCallingOptions<TSpec> &options)
             if(options._debugLevel > 0)
                 ::std::cout << "Sequence number " << i << " window " << currentWindowBegin << ".." << currentWindowEnd << "\n";
 
-            TFragmentStore fragmentStore;
-            TReadCounts readCounts;  // Count number of reads that are identical to the given one. Useful for micro RNA data where there were millions of identical reads. Must be in GFF input, not supported for SAM input.
-            TReadClips readClips;  // Soft clipping information and/or clipping information from GFF/SAM tag. Clipping is postponed after pileup correction.
-            TReadCigars readCigars; // Currently only stored for split-mapped reads. Split-mapped reads need special handling, especially for realignment.
+            windows.resize(windows.size() + 1);
+            TWindow &window = windows.back();
+            window.contigId = i;
+            window.startCoord = 0;
+            window.clip = false;
+            window.windowBegin = currentWindowBegin;
+            window.windowEnd = currentWindowEnd;
+            window.snpOut.isOpen = snpFileStream.is_open();
+            window.indelOut.isOpen = indelFileStream.is_open();
+            window.posOut.isOpen = posFileStream.is_open();
+
+            // positions of interest inside the window
+            window.inspectPosIt = inspectPosIt;
+            while(inspectPosIt != inspectPosItEnd && *inspectPosIt < currentWindowEnd)
+                ++inspectPosIt;
+            window.inspectPosItEnd = inspectPosIt;
+
+            TFragmentStore &fragmentStore = window.fragmentStore;
+            TReadCounts &readCounts = window.readCounts;  // Count number of reads that are identical to the given one. Useful for micro RNA data where there were millions of identical reads. Must be in GFF input, not supported for SAM input.
+            TReadClips &readClips = window.readClips;  // Soft clipping information and/or clipping information from GFF/SAM tag. Clipping is postponed after pileup correction.
+            TReadCigars &readCigars = window.readCigars; // Currently only stored for split-mapped reads. Split-mapped reads need special handling, especially for realignment.
 
             // add the matches that were overlapping with this and the last window (copied in order to avoid 2 x makeGlobal)
             if(!empty(tmpMatches))
@@ -951,63 +1105,26 @@ int detectSNPs(SNPCallingOptions<TSpec> &options)
                 conti.seq = infix(genomes[i],startCoord,endCoord);
                 appendValue(fragmentStore.contigStore, conti, Generous() );
                 appendValue(fragmentStore.contigNameStore, genomeNames[i], Generous() );// internal id is always 0
+                window.startCoord = startCoord;
 
                 // clip Reads if clipping is switched on and there were clip tags in the gff file
-                if((!options.dontClip && options.clipTagsInFile) || options.softClipTagsInFile)
+                window.clip = (!options.dontClip && options.clipTagsInFile) || options.softClipTagsInFile;
+                if(window.clip && options.useBaseQuality)
                 {
+                    // the windows parsed before are called with base qualities
+                    callAndWriteWindows(windows, windows.size() - 1, genomeNames, positionStatsOnly, snpFileStream, indelFileStream, posFileStream, options);
                     options.useBaseQuality = false; // activate "average read quality"-mode for snp calling, low quality bases should be clipped anyway
-                    clipReads(fragmentStore,readClips,(unsigned)0,(unsigned)length(fragmentStore.alignedReadStore),options);
-                }
-
-                // check for indels
-                if (options.outputIndel != "")
-                {
-                    if(options._debugLevel > 1) ::std::cout << "Check for indels..." << std::endl;
-                    if(!options.realign) dumpShortIndelPolymorphismsBatch(fragmentStore, readCigars, fragmentStore.contigStore[0].seq, genomeNames[i], startCoord, currentWindowBegin, currentWindowEnd, indelFileStream, options);
-                }
-
-                // // check for CNVs
-                //              if (*options.outputCNV != 0)
-                //                  dumpCopyNumberPolymorphismsBatch(fragmentStore, genomeNames[i], startCoord, currentWindowBegin, currentWindowEnd, cnvFileStream, options);
-
-#ifdef SNPSTORE_DEBUG
-                CharString strstr = "test";
-                //              _dumpMatches(fragmentStore, strstr );
-#endif
-                if (options.outputSNP != "")
-                {
-                    if(options._debugLevel > 1) ::std::cout << "Check for SNPs..." << std::endl;
-                    if(options.realign)
-                        dumpVariantsRealignBatchWrap(fragmentStore, readCigars, readCounts, genomeNames[i], startCoord, currentWindowBegin, currentWindowEnd, snpFileStream,indelFileStream,options);
-                    else
-                        dumpSNPsBatch(fragmentStore, readCigars, readCounts, genomeNames[i], startCoord, currentWindowBegin, currentWindowEnd, snpFileStream,options);
-                }
-                if(positionStatsOnly)
-                {
-                    if(options._debugLevel > 1) ::std::cout << "Dumping info for query positions..." << std::endl;
-                    if(options.realign)
-                        dumpPositionsRealignBatchWrap(fragmentStore, inspectPosIt, inspectPosItEnd, readCigars, readCounts, genomeNames[i], startCoord, currentWindowBegin, currentWindowEnd, posFileStream, options);
-                    else dumpPosBatch(fragmentStore, inspectPosIt, inspectPosItEnd, readCigars, readCounts, genomeNames[i], startCoord, currentWindowBegin, currentWindowEnd, posFileStream, options);
                 }
             }
-//            else
-//            {
-                if(positionStatsOnly && !empty(positions))
-                {
-                    while(inspectPosIt != inspectPosItEnd && *inspectPosIt < currentWindowEnd)
-                    {
-                        if(options.orientationAware)
-                            posFileStream << genomeNames[i] << '\t' << *inspectPosIt + options.positionFormat << "\t0\t0\t0\t0\t0\t0\t0\t0\t0\t0\t0" << std::endl;
-                        else
-                            posFileStream << genomeNames[i] << '\t' << *inspectPosIt + options.positionFormat << "\t0\t0\t0\t0\t0\t0" << std::endl;
-                        ++inspectPosIt;
-                    }
-                }
-//            }
             currentWindowBegin = currentWindowEnd;
+
+            if(windows.size() >= windowBatchSize)
+                callAndWriteWindows(windows, windows.size(), genomeNames, positionStatsOnly, snpFileStream, indelFileStream, posFileStream, options);
         }
 
     }
+    callAndWriteWindows(windows, windows.size(), genomeNames, positionStatsOnly, snpFileStream, indelFileStream, posFileStream, options);
+
     if (options.outputSNP != "")
         snpFileStream.close();
 
@@ -1233,6 +1350,9 @@ parseCommandLine(SNPCallingOptions<TSpec> & options, int argc, char const ** arg
 
     addSection(parser, "Other options");
     addOption(parser, ArgParseOption("lf", "log-file", "Write log to FILE.", ArgParseArgument::STRING));
+    addOption(parser, ArgParseOption("tc", "thread-count", "Number of threads calling variants of different parse windows in parallel (sequential if a log file is written).", ArgParseArgument::INTEGER));
+    setMinValue(parser, "thread-count", "1");
+    setDefaultValue(parser, "thread-count", options.numThreads);
     addOption(parser, ArgParseOption("v", "verbose", "Enable verbose output."));
     addOption(parser, ArgParseOption("vv", "very-verbose", "Enable very verbose output."));
     addOption(parser, ArgParseOption("q", "quiet", "Set verbosity to a minimum."));
@@ -1307,6 +1427,7 @@ parseCommandLine(SNPCallingOptions<TSpec> & options, int argc, char const ** arg
     getOptionValue(options.cnvWindowSize, parser, "cnv-window-size");
     // Other Options:
     getOptionValue(options.outputLog, parser, "log-file");
+    getOptionValue(options.numThreads, parser, "thread-count");
     if (isSet(parser, "verbose"))
         options._debugLevel = max(options._debugLevel, 1);
     if (isSet(parser, "very-verbose"))
@@ -1401,6 +1522,8 @@ int main(int argc, const char *argv[])
         options.programCall << argv[arg] << " ";
     }
 
+    omp_set_num_threads(options.numThreads);
+
     //////////////////////////////////////////////////////////////////////////////
     // check for variants
     int result = detectSNPs(options);
@@ -199,6 +199,7 @@ struct FragmentStoreConfig<SnpStoreGroupSpec_> :
 
         unsigned    windowSize;                 // genomic window size for read parsing
         unsigned    windowBuff;                 // reads within windowBuff base pairs of current window are also kept (-> overlapping windows)
+        unsigned    numThreads;                 // number of threads calling variants of different windows
 
         // cnv calling related // not in use
         unsigned    expectedReadsPerBin;
@@ -297,6 +298,7 @@ struct FragmentStoreConfig<SnpStoreGroupSpec_> :
 
             windowSize = 1000000;
             windowBuff = 70;
+            numThreads = 1;
             minCoord = std::numeric_limits<unsigned>::max();
             maxCoord = 0;
             maxHitLength = 1;
@@ -31,4 +31,6 @@ ${SNP_STORE} $genome $readsGff -it 2 -re -oa -mp 1 -hq -o snps_realign_m0mp1oa.v
 #echo "${SNP_STORE} $genome $readsSam -it 1 -ipt 0.1 -osc -re -oa -hq -o snps_realign_m0mp1oa_it1ipt01.vcf -id indels_realign_m0mp1oa_it1ipt01.gff > snp_store_realign_m0mp1oa_it1ipt01.stdout"
 ${SNP_STORE} $genome $readsSam -it 1 -ipt 0.1 -osc -re -oa -hq -o snps_realign_m0mp1oa_it1ipt01.vcf -id indels_realign_m0mp1oa_it1ipt01.gff > snp_store_realign_m0mp1oa_it1ipt01.stdout
 
-
+# realign with parse windows of 1000 bp, the windows are called by 4 threads
+#echo "${SNP_STORE} $genome $readsSam -re -pws 1000 -tc 4 -o snps_realign_pws1000.vcf -id indels_realign_pws1000.gff > snp_store_realign_pws1000.stdout"
+${SNP_STORE} $genome $readsSam -re -pws 1000 -tc 4 -o snps_realign_pws1000.vcf -id indels_realign_pws1000.gff > snp_store_realign_pws1000.stdout
@@ -152,6 +152,24 @@ def main(source_base, binary_base):
                   ph.outFile('indels_realign_m0mp1oa_it1ipt01.gff'))])
     conf_list.append(conf)
 
+    # test 6, several parse windows called in parallel
+    conf = app_tests.TestConf(
+        program=path_to_program,
+        redir_stdout=ph.outFile('snp_store_realign_pws1000.stdout'),
+        args=[ph.inFile('human-chr22-inf2.fa'),
+              ph.inFile('human-reads2.sam'),
+              '-re', '-pws', str(1000), '-tc', str(4),
+              '-o', ph.outFile('snps_realign_pws1000.vcf'),
+              '-id', ph.outFile('indels_realign_pws1000.gff')],
+        to_diff=[(ph.inFile('snp_store_realign_pws1000.stdout'),
+                  ph.outFile('snp_store_realign_pws1000.stdout')),
+                 (ph.inFile('snps_realign_pws1000.vcf'),
+                  ph.outFile('snps_realign_pws1000.vcf'),
+                  transforms),
+                 (ph.inFile('indels_realign_pws1000.gff'),
+                  ph.outFile('indels_realign_pws1000.gff'))])
+    conf_list.append(conf)
+
 
 
     # ============================================================
@@ -55,19 +55,19 @@ _stellarOnOne(TSequence & database,
     if (options.fastOption == CharString("exact"))
         stellar(swiftFinder, swiftPattern, options.epsilon, options.minLength, options.xDrop,
                 options.disableThresh, options.compactThresh, options.numMatches, options.verbose,
-                databaseID, databaseStrand, matches, AllLocal());
+                databaseID, databaseStrand, matches, AllLocal(), Parallel());
     else if (options.fastOption == "bestLocal")
         stellar(swiftFinder, swiftPattern, options.epsilon, options.minLength, options.xDrop,
                 options.disableThresh, options.compactThresh, options.numMatches, options.verbose,
-                databaseID, databaseStrand, matches, BestLocal());
+                databaseID, databaseStrand, matches, BestLocal(), Parallel());
     else if (options.fastOption == "bandedGlobal")
         stellar(swiftFinder, swiftPattern, options.epsilon, options.minLength, options.xDrop,
                 options.disableThresh, options.compactThresh, options.numMatches, options.verbose,
-                databaseID, databaseStrand, matches, BandedGlobal());
+                databaseID, databaseStrand, matches, BandedGlobal(), Parallel());
     else if (options.fastOption == "bandedGlobalExtend")
         stellar(swiftFinder, swiftPattern, options.epsilon, options.minLength, options.xDrop,
                 options.disableThresh, options.compactThresh, options.numMatches, options.verbose,
-                databaseID, databaseStrand, matches, BandedGlobalExtend());
+                databaseID, databaseStrand, matches, BandedGlobalExtend(), Parallel());
     else
     {
         std::cerr << "\nUnknown verification strategy: " << options.fastOption << std::endl;
@@ -397,6 +397,10 @@ _writeSpecifiedParams(TOptions & options)
     {
         std::cout << "  q-gram abundance cut ratio       : " << options.qgramAbundanceCut << std::endl;
     }
+    if (options.threads != 1)
+    {
+        std::cout << "  number of threads                : " << options.threads << std::endl;
+    }
     std::cout << std::endl;
 }
 
@@ -463,6 +467,9 @@ _parseOptions(ArgumentParser & parser, TOptions & options)
     getOptionValue(options.qgramAbundanceCut, parser, "abundanceCut");
 
     getOptionValue(options.verbose, parser, "verbose");
+#ifdef _OPENMP
+    getOptionValue(options.threads, parser, "threads");
+#endif
 
     if (isSet(parser, "kmer") && options.qGram >= 1 / options.epsilon)
     {
@@ -521,6 +528,12 @@ void _setParser(ArgumentParser & parser)
                                      ArgParseArgument::STRING));
     setValidValues(parser, "a", "dna dna5 rna rna5 protein char");
     addOption(parser, ArgParseOption("v", "verbose", "Set verbosity mode."));
+#ifdef _OPENMP
+    addOption(parser, ArgParseOption("th", "threads", "Number of threads for filtering and verification.",
+                                     ArgParseArgument::INTEGER));
+    setMinValue(parser, "th", "1");
+    setDefaultValue(parser, "th", "1");
+#endif
 
     addSection(parser, "Filtering Options");
 
@@ -649,6 +662,10 @@ int mainWithOptions(TOptions & options, String<TAlphabet>)
         daFile.close();
     }
 
+#ifdef _OPENMP
+    omp_set_num_threads(options.threads);
+#endif
+
     // stellar on all databases and queries writing results to file
 
     double startTime = sysTime();
@@ -722,6 +722,137 @@ void stellar(Finder<TText, Swift<SwiftLocal> > & finder,
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// A SWIFT hit waiting for verification: the database and query infixes of the hit
+//  within the infixes of the whole sequences, which are the hosts of the verified segments.
+template<typename TFinderInfix, typename TPatternInfix>
+struct StellarSwiftHit_ {
+	typedef typename Position<TFinderInfix>::Type TFinderPos;
+	typedef typename Position<TPatternInfix>::Type TPatternPos;
+
+	TFinderInfix finderInfixSeq;
+	Pair<TFinderPos> finderRange;
+	TPatternInfix patternInfixSeq;
+	Pair<TPatternPos> patternRange;
+	unsigned ndlSeqNo;
+
+	StellarSwiftHit_() : ndlSeqNo(0)
+	{}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Calls the parallel swift filter and verifies batches of swift hits in parallel.
+// Every hit is verified into a buffer of its own. The buffers are inserted into
+//  the matches in hit order and only there disabled queries are skipped, so the
+//  result does not depend on the number of threads.
+template<typename TText, typename TStringSetSpec, typename TIndexSpec, typename TSize, typename TDrop, typename TSize1,
+         typename TMode, typename TSource, typename TId, typename TTag>
+void stellar(Finder<TText, Swift<SwiftLocal> > & finder,
+             Pattern<Index<StringSet<TText, TStringSetSpec>, TIndexSpec>, Swift<SwiftLocal> > & pattern,
+             double epsilon,
+             TSize minLength,
+             TDrop xDrop,
+			 TSize1 disableThresh,
+			 TSize1 & compactThresh,
+			 TSize1 numMatches,
+			 TMode verbose,
+			 TId & databaseID,
+			 bool dbStrand,
+             StringSet<QueryMatches<StellarMatch<TSource, TId> > > & matches,
+			 TTag tag,
+			 Parallel) {
+	typedef StellarMatch<TSource, TId> TMatch;
+	typedef typename GetSequenceByNo<StringSet<TText, TStringSetSpec> >::Type TPatternSeq;
+	typedef typename Infix<TText>::Type TInfix;
+	typedef typename Infix<TPatternSeq>::Type TPatternInfix;
+	typedef Segment<TInfix, InfixSegment> TFinderSegment;
+	typedef Segment<TPatternInfix, InfixSegment> TPatternSegment;
+	typedef StellarSwiftHit_<TInfix, TPatternInfix> TSwiftHit;
+	typedef typename Iterator<String<TMatch>, Standard>::Type TMatchIterator;
+
+    TSize numSwiftHits = 0;
+
+    TSize maxLength = 0;
+    TSize totalLength = 0;
+
+	// a fixed batch size bounds the buffered matches independently of the number of threads
+	int64_t const batchSize = 4096;
+	String<TSwiftHit> hits;
+	StringSet<QueryMatches<TMatch> > hitMatches;
+	bool hitsLeft = true;
+
+	while (hitsLeft) {
+		clear(hits);
+		while ((int64_t)length(hits) < batchSize) {
+			if (!find(finder, pattern, epsilon, minLength, Parallel())) {
+				hitsLeft = false;
+				break;
+			}
+
+			TInfix finderInfix = infix(finder);
+
+			++numSwiftHits;
+			totalLength += length(finderInfix);
+			if ((TSize)length(finderInfix) > maxLength) maxLength = length(finderInfix);
+
+			TPatternSeq patternSeq = getSequenceByNo(pattern.curSeqNo, indexText(needle(pattern)));
+			TPatternInfix patternInfix = infix(pattern, patternSeq);
+
+			resize(hits, length(hits) + 1);
+			TSwiftHit & hit = back(hits);
+			hit.finderInfixSeq = infix(haystack(finder), 0, length(haystack(finder)));
+			hit.finderRange.i1 = beginPosition(finderInfix) - beginPosition(haystack(finder));
+			hit.finderRange.i2 = endPosition(finderInfix) - beginPosition(haystack(finder));
+			hit.patternInfixSeq = infix(patternSeq, 0, length(patternSeq));
+			hit.patternRange.i1 = beginPosition(patternInfix) - beginPosition(patternSeq);
+			hit.patternRange.i2 = endPosition(patternInfix) - beginPosition(patternSeq);
+			hit.ndlSeqNo = pattern.curSeqNo;
+		}
+
+		// verification, the buffers are neither compacted nor disabled
+		int64_t hitsCount = length(hits);
+		clear(hitMatches);
+		resize(hitMatches, hitsCount);
+		SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+		for (int64_t i = 0; i < hitsCount; ++i) {
+			TSize1 maxValue = std::numeric_limits<TSize1>::max();
+			TFinderSegment finderSegment(hits[i].finderInfixSeq, hits[i].finderRange.i1, hits[i].finderRange.i2);
+			TPatternSegment patternSegment(hits[i].patternInfixSeq, hits[i].patternRange.i1, hits[i].patternRange.i2);
+			verifySwiftHit(finderSegment, patternSegment, epsilon, minLength, xDrop,
+						   pattern.bucketParams[0].delta + pattern.bucketParams[0].overlap, maxValue, maxValue,
+						   maxValue, databaseID, dbStrand, hitMatches[i], tag);
+		}
+
+		// insert the eps-matches as the sequential verification would
+		for (int64_t i = 0; i < hitsCount; ++i) {
+			QueryMatches<TMatch> & queryMatches = value(matches, hits[i].ndlSeqNo);
+			if (queryMatches.disabled) continue;
+			TMatchIterator it = begin(hitMatches[i].matches, Standard());
+			TMatchIterator itEnd = end(hitMatches[i].matches, Standard());
+			for (; it != itEnd && !queryMatches.disabled; ++it)
+				_insertMatch(queryMatches, *it, minLength, disableThresh, compactThresh, numMatches);
+		}
+	}
+
+	if (verbose && numSwiftHits > 0) {
+		std::cout << std::endl << "    # SWIFT hits      : " << numSwiftHits;
+		std::cout << std::endl << "    Longest hit       : " << maxLength;
+		std::cout << std::endl << "    Avg hit length    : " << totalLength/numSwiftHits;
+	}
+
+	typedef typename Iterator<StringSet<QueryMatches<TMatch> >, Standard>::Type TIterator;
+	TIterator it = begin(matches, Standard());
+	TIterator itEnd = end(matches, Standard());
+
+	for(; it < itEnd; ++it) {
+		QueryMatches<TMatch> &qm = *it;
+		if (length(qm) > 0 && !qm.disabled) {
+			maskOverlaps(qm.matches, minLength);	// remove overlaps and duplicates
+			compactMatches(qm.matches, numMatches);	// keep only the <numMatches> longest matches
+		}
+	}
+}
+
 // Wrapper for stellar
 template<typename TText, typename TIndex, typename TSize, typename TDrop,
          typename TSource, typename TId, typename TTag>
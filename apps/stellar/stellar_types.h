@@ -57,7 +57,7 @@ struct StellarOptions {
 	unsigned minRepeatLength;	// minimal length of low complexity repeats to be filtered
 	double qgramAbundanceCut;
 	bool verbose;				// verbose mode
-
+	unsigned threads;			// number of threads for filtering and verification
 
 	StellarOptions() {
 		outputFile = "stellar.gff";
@@ -81,6 +81,7 @@ struct StellarOptions {
 		minRepeatLength = 1000;
 		qgramAbundanceCut = 1;
 		verbose = false;
+		threads = 1;
 	}
 };
 
@@ -47,3 +47,11 @@ ${STELLAR} -e 0.05 -l $minLen -x 10 -k 7 -n 5000 -s 10000 -f -v -t -o minLen$min
 eps="5e-2"
 errRate=0.05
 ${STELLAR} -e $errRate -l 50 -x 10 -k 7 -n 5000 -s 10000 -f -v -t -o $eps.txt 512_simSeq1_$eps.fa 512_simSeq2_$eps.fa > $eps"txt.stdout"  
+
+# ============================================================
+# Multiple threads
+# ============================================================
+
+eps="5e-2"
+errRate=0.05
+${STELLAR} -e $errRate -l 50 -x 10 -k 7 -n 5000 -s 10000 -f -v -t -th 4 -o $eps"threads.gff" 512_simSeq1_$eps.fa 512_simSeq2_$eps.fa > $eps"threads.stdout"
@@ -198,6 +198,23 @@ def main(source_base, binary_base):
                   transforms)])
     conf_list.append(conf)
 
+    # Multiple threads, the matches must equal the single-threaded ones:
+    conf = app_tests.TestConf(
+        program=path_to_program,
+        redir_stdout=ph.outFile('5e-2threads.stdout'),
+        args=['-e', '0.05', '-l', '50', '-x', '10', '-k', '7', '-n', '5000',
+              '-s', '10000', '-f', '-v', '-t', '-th', '4',
+              '-o', ph.outFile('5e-2threads.gff'),
+              ph.inFile('512_simSeq1_5e-2.fa'),
+              ph.inFile('512_simSeq2_5e-2.fa')],
+        to_diff=[(ph.inFile('5e-2threads.stdout'),
+                  ph.outFile('5e-2threads.stdout'),
+                  transforms),
+                 (ph.inFile('5e-2.gff'),
+                  ph.outFile('5e-2threads.gff'),
+                  transforms)])
+    conf_list.append(conf)
+
     # ============================================================
     # Execute the tests.
     # ============================================================
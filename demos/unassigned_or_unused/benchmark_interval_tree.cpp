@@ -0,0 +1,120 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Interval Tree Benchmark.  Builds an IntervalTree and an ImplicitIntervalTree
+// from n annotation-like intervals (10^6 by default) and overlaps them with
+// n read-like query intervals, one query at a time and as a parallel batch.
+// The times for building and querying and the number of hits are printed.
+//
+// Usage: benchmark_interval_tree [NUM_INTERVALS]
+// ==========================================================================
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+#include <seqan/misc/implicit_interval_tree.h>
+
+using namespace seqan2;
+
+int main(int argc, char const ** argv)
+{
+    typedef IntervalAndCargo<int, unsigned> TInterval;
+    typedef Pair<int> TQuery;
+
+    unsigned numIntervals = 1000000;
+    if (argc > 1)
+        numIntervals = std::strtoul(argv[1], NULL, 10);
+
+    // Exons of a few hundred bases, some long genes, and queries of read length.
+    std::mt19937 rng(42);
+    int contigLength = 100 * numIntervals;
+    std::uniform_int_distribution<int> position(0, contigLength);
+    std::uniform_int_distribution<int> exonLength(50, 500);
+    std::uniform_int_distribution<int> geneLength(10000, 100000);
+
+    String<TInterval> intervals;
+    reserve(intervals, numIntervals, Exact());
+    for (unsigned i = 0; i < numIntervals; ++i)
+    {
+        int begin = position(rng);
+        appendValue(intervals, TInterval(begin, begin + ((i % 20 == 0) ? geneLength(rng) : exonLength(rng)), i));
+    }
+    String<TQuery> queries;
+    reserve(queries, numIntervals, Exact());
+    for (unsigned i = 0; i < numIntervals; ++i)
+    {
+        int begin = position(rng);
+        appendValue(queries, TQuery(begin, begin + 150));
+    }
+
+    double before = sysTime();
+    IntervalTree<int, unsigned> tree(intervals);
+    double afterBuild = sysTime();
+    String<unsigned> result;
+    uint64_t hits = 0;
+    for (unsigned i = 0; i < length(queries); ++i)
+    {
+        findIntervals(result, tree, queries[i].i1, queries[i].i2);
+        hits += length(result);
+    }
+    double afterQuery = sysTime();
+    std::cout << "IntervalTree\n"
+              << "  build:          " << afterBuild - before << " s\n"
+              << "  query:          " << afterQuery - afterBuild << " s\n"
+              << "  hits:           " << hits << '\n';
+
+    before = sysTime();
+    ImplicitIntervalTree<int, unsigned> implicitTree(intervals, Parallel());
+    afterBuild = sysTime();
+    hits = 0;
+    for (unsigned i = 0; i < length(queries); ++i)
+    {
+        findIntervals(result, implicitTree, queries[i].i1, queries[i].i2);
+        hits += length(result);
+    }
+    afterQuery = sysTime();
+    String<String<unsigned> > results;
+    findIntervals(results, implicitTree, queries, Parallel());
+    double afterBatch = sysTime();
+    uint64_t batchHits = 0;
+    for (unsigned i = 0; i < length(results); ++i)
+        batchHits += length(results[i]);
+    std::cout << "ImplicitIntervalTree\n"
+              << "  build:          " << afterBuild - before << " s\n"
+              << "  query:          " << afterQuery - afterBuild << " s\n"
+              << "  batch query:    " << afterBatch - afterQuery << " s\n"
+              << "  hits:           " << hits << " / " << batchHits << '\n';
+
+    return 0;
+}
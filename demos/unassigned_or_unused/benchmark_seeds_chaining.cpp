@@ -0,0 +1,92 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Seed Chaining Benchmark.  Builds an Unordered SeedSet from n anchors
+// (10^6 by default) that resemble long read hits, i.e. a noisy diagonal
+// with random spurious anchors, and chains them globally.  The time for
+// both steps and the chaining throughput are printed.
+//
+// Usage: benchmark_seeds_chaining [NUM_ANCHORS]
+// ==========================================================================
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+#include <seqan/seeds.h>
+
+using namespace seqan2;
+
+int main(int argc, char const ** argv)
+{
+    typedef Seed<Simple> TSeed;
+
+    unsigned numAnchors = 1000000;
+    if (argc > 1)
+        numAnchors = std::strtoul(argv[1], NULL, 10);
+
+    // Every fourth anchor is spurious, the others follow the main diagonal with some jitter.
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<unsigned> jitter(0, 20);
+    std::uniform_int_distribution<unsigned> spurious(0, 16 * numAnchors);
+    std::uniform_int_distribution<unsigned> anchorLength(12, 28);
+
+    String<TSeed> anchors;
+    reserve(anchors, numAnchors, Exact());
+    for (unsigned i = 0; i < numAnchors; ++i)
+    {
+        unsigned len = anchorLength(rng);
+        unsigned posH = 16 * i + jitter(rng);
+        unsigned posV = (i % 4 == 3) ? spurious(rng) : 16 * i + jitter(rng);
+        appendValue(anchors, TSeed(posH, posV, len));
+    }
+
+    double before = sysTime();
+    SeedSet<TSeed, Unordered> seedSet;
+    for (unsigned i = 0; i < length(anchors); ++i)
+        addSeed(seedSet, anchors[i], Single());
+    front(seedSet);  // sorts the seed set
+    double afterAdd = sysTime();
+
+    String<TSeed> chain;
+    chainSeedsGlobally(chain, seedSet, SparseChaining());
+    double afterChain = sysTime();
+
+    std::cout << "anchors:        " << numAnchors << '\n'
+              << "chain length:   " << length(chain) << '\n'
+              << "add seeds:      " << afterAdd - before << " s\n"
+              << "chain seeds:    " << afterChain - afterAdd << " s\n"
+              << "throughput:     " << numAnchors / (afterChain - afterAdd) << " anchors/s\n";
+
+    return 0;
+}
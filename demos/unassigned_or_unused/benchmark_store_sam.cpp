@@ -0,0 +1,134 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// FragmentStore SAM Import Benchmark.  Writes a SAM file with n simulated
+// 100bp reads (10^6 by default) aligned to a random contig and loads it into
+// the default FragmentStore serially and in parallel and into a store with the
+// CompactStore configuration.  The load times and the number of bytes held by
+// the read sequence store are printed.
+//
+// Usage: benchmark_store_sam [NUM_READS]
+// ==========================================================================
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+#include <seqan/store.h>
+
+using namespace seqan2;
+
+template <typename TValue, typename TSpec>
+inline size_t bytes(String<TValue, TSpec> const & str)
+{
+    return capacity(str) * sizeof(TValue);
+}
+
+template <typename TValue, typename TSpec>
+inline size_t bytes(String<TValue, Packed<TSpec> > const & str)
+{
+    return bytes(host(str));
+}
+
+template <typename TStore, typename TTag>
+void load(TStore & store, char const * contigPath, char const * samPath, TTag const & tag, char const * label)
+{
+    loadContigs(store, contigPath);
+    double start = sysTime();
+    BamFileIn inFile(samPath);
+    readRecords(store, inFile, FragStoreImportFlags(), tag);
+    std::cout << label << "\t" << sysTime() - start << " s\t"
+              << length(store.alignedReadStore) << " alignments\t"
+              << bytes(store.readSeqStore.concat) << " bytes of read sequences" << std::endl;
+}
+
+int main(int argc, char const ** argv)
+{
+    unsigned numReads = 1000000;
+    if (argc > 1)
+        numReads = std::strtoul(argv[1], NULL, 10);
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> base(0, 3);
+    std::uniform_int_distribution<int> qual('#', 'I');
+    unsigned const readLength = 100;
+
+    // A random contig and reads sampled from it, every tenth with a 2bp insertion.
+    Dna5String contig;
+    resize(contig, 1000000);
+    for (unsigned i = 0; i < length(contig); ++i)
+        contig[i] = base(rng);
+    std::uniform_int_distribution<unsigned> position(0, length(contig) - readLength);
+
+    std::string contigPath = (std::string)SEQAN_TEMP_FILENAME() + ".fa";
+    std::string samPath = (std::string)SEQAN_TEMP_FILENAME() + ".sam";
+    {
+        SeqFileOut contigFile(contigPath.c_str());
+        writeRecord(contigFile, "chr", contig);
+
+        std::ofstream samFile(samPath.c_str());
+        samFile << "@HD\tVN:1.4\n@SQ\tSN:chr\tLN:" << length(contig) << "\n";
+        for (unsigned i = 0; i < numReads; ++i)
+        {
+            unsigned pos = position(rng);
+            Dna5String read = infix(contig, pos, pos + readLength);
+            bool insertion = (i % 10 == 0);
+            if (insertion)
+            {
+                erase(read, readLength - 2, readLength);
+                insert(read, readLength / 2, "AC");
+            }
+            std::string quals;
+            for (unsigned j = 0; j < readLength; ++j)
+                quals.push_back(qual(rng));
+            samFile << "read" << i << "\t0\tchr\t" << pos + 1 << "\t60\t"
+                    << (insertion ? "50M2I48M" : "100M") << "\t*\t0\t0\t" << read << "\t" << quals << "\n";
+        }
+    }
+
+    {
+        FragmentStore<> store;
+        load(store, contigPath.c_str(), samPath.c_str(), Serial(), "default, serial  ");
+    }
+    {
+        FragmentStore<> store;
+        load(store, contigPath.c_str(), samPath.c_str(), Parallel(), "default, parallel");
+    }
+    {
+        FragmentStore<void, FragmentStoreConfig<CompactStore> > store;
+        load(store, contigPath.c_str(), samPath.c_str(), Parallel(), "compact, parallel");
+    }
+
+    return 0;
+}
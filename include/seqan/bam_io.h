@@ -54,9 +54,10 @@
 // Data Structures & Conversion.
 // ===========================================================================
 
-#include <seqan/bam_io/bam_io_context.h>
 #include <seqan/bam_io/cigar.h>
 #include <seqan/bam_io/bam_alignment_record.h>
+#include <seqan/bam_io/cram_io_context.h>
+#include <seqan/bam_io/bam_io_context.h>
 #include <seqan/bam_io/bam_header_record.h>
 #include <seqan/bam_io/bam_sam_conversion.h>
 #include <seqan/bam_io/bam_tags_dict.h>
@@ -69,6 +70,11 @@
 #include <seqan/bam_io/write_sam.h>
 #include <seqan/bam_io/read_bam.h>
 #include <seqan/bam_io/write_bam.h>
+#if SEQAN_HAS_ZLIB
+#include <seqan/bam_io/cram_codecs.h>
+#include <seqan/bam_io/read_cram.h>
+#include <seqan/bam_io/write_cram.h>
+#endif  // #if SEQAN_HAS_ZLIB
 
 // ===========================================================================
 // Easy BAM / SAM I/O.
@@ -81,6 +87,7 @@
 // ===========================================================================
 
 #include <seqan/bam_io/bam_alignment_record_util.h>
+#include <seqan/bam_io/bam_sort.h>
 
 // Not included by default, requires C++11
 //#include <seqan/bam_io/bam_scanner_cache.h>
@@ -91,7 +98,16 @@
 
 // BAM indices are only available when ZLIB is available.
 #if SEQAN_HAS_ZLIB
+#include <seqan/tabix_io/binning_index.h>
 #include <seqan/bam_io/bam_index_bai.h>
+#include <seqan/bam_io/bam_index_csi.h>
+#include <seqan/bam_io/cram_index_crai.h>
 #endif  // #if SEQAN_HAS_ZLIB
 
+// ===========================================================================
+// Pileup.
+// ===========================================================================
+
+#include <seqan/bam_io/bam_pileup.h>
+
 #endif  // INCLUDE_SEQAN_BAM_IO_H_
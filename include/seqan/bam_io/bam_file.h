@@ -52,7 +52,7 @@ namespace seqan2 {
  * @signature typedef FormattedFile<Bam, Input> BamFileIn;
  * @extends FormattedFileIn
  * @headerfile <seqan/bam_io.h>
- * @brief Class for reading SAM and BAM files.
+ * @brief Class for reading SAM, BAM and CRAM files.
  *
  * @see BamHeader
  * @see BamAlignmentRecord
@@ -79,7 +79,7 @@ typedef FormattedFile<Bam, Input> BamFileIn;
  * @signature typedef FormattedFile<Bam, Output> BamFileOut;
  * @extends FormattedFileOut
  * @headerfile <seqan/bam_io.h>
- * @brief Class for writing SAM and BAM files.
+ * @brief Class for writing SAM, BAM and CRAM files.
  *
  * @see BamHeader
  * @see BamAlignmentRecord
@@ -123,8 +123,9 @@ struct FileFormat<FormattedFile<Bam, TDirection, TSpec> >
 #if SEQAN_HAS_ZLIB
     typedef TagSelector<
                 TagList<Bam,
+                TagList<Cram,
                 TagList<Sam
-                > >
+                > > >
             > Type;
 #else
     typedef Sam Type;
@@ -253,6 +254,15 @@ readRecords(TRecords & records, FormattedFile<Bam, Input, TSpec> & file, TSize m
         resize(records, maxRecords, Exact());
 
     TSize numRecords = 0;
+#if SEQAN_HAS_ZLIB
+    // CRAM records are decoded container-wise.
+    if (isEqual(file.format, Cram()))
+    {
+        for (; numRecords < maxRecords && !atEnd(file); ++numRecords)
+            readRecord(records[numRecords], context(file), file.iter, Cram());
+        return numRecords;
+    }
+#endif  // #if SEQAN_HAS_ZLIB
     for (; numRecords < maxRecords && !atEnd(file.iter); ++numRecords)
         _readBamRecord(buffers[numRecords], file.iter, file.format);
 
@@ -344,6 +354,16 @@ template <typename TSpec, typename TRecords>
 inline SEQAN_FUNC_ENABLE_IF(IsSameType<typename Value<TRecords>::Type, BamAlignmentRecord>, void)
 writeRecords(FormattedFile<Bam, Output, TSpec> & file, TRecords const & records)
 {
+#if SEQAN_HAS_ZLIB
+    // CRAM records are collected in the context until a container is full.
+    if (isEqual(file.format, Cram()))
+    {
+        for (unsigned i = 0; i < length(records); ++i)
+            write(file.iter, records[i], context(file), Cram());
+        return;
+    }
+#endif  // #if SEQAN_HAS_ZLIB
+
     String<CharString> & buffers = context(file).buffers;
     if (length(buffers) < length(records))
         resize(buffers, length(records));
@@ -358,6 +378,81 @@ writeRecords(FormattedFile<Bam, Output, TSpec> & file, TRecords const & records)
         write(file.iter, buffers[i]);
 }
 
+#if SEQAN_HAS_ZLIB
+
+// ----------------------------------------------------------------------------
+// Function atEnd()
+// ----------------------------------------------------------------------------
+
+// CRAM files end with an empty EOF container, so the reader has to look ahead.
+template <typename TSpec>
+inline bool
+atEnd(FormattedFile<Bam, Input, TSpec> const & file)
+{
+    if (!isEqual(file.format, Cram()))
+        return atEnd(file.iter);
+
+    // Decoding the next containers does not change the logical state of the file.
+    FormattedFile<Bam, Input, TSpec> & nonConstFile = const_cast<FormattedFile<Bam, Input, TSpec> &>(file);
+    CramIOContext_ & cram = context(nonConstFile).cram;
+    if (cram.recordPos == length(cram.records) && !atEnd(nonConstFile.iter))
+        _cramReadRecords(context(nonConstFile), nonConstFile.iter);
+    return cram.recordPos == length(cram.records);
+}
+
+// ----------------------------------------------------------------------------
+// Function close()
+// ----------------------------------------------------------------------------
+
+// Pending CRAM records and the EOF container are written on close.
+template <typename TSpec>
+inline bool
+close(FormattedFile<Bam, Output, TSpec> & file)
+{
+    if (isEqual(file.format, Cram()))
+        _cramFinish(file.iter, context(file));
+    setFormat(file, typename FileFormat<FormattedFile<Bam, Output, TSpec> >::Type());
+    file.iter = typename DirectionIterator<FormattedFile<Bam, Output, TSpec>, Output>::Type();
+    return close(file.stream);
+}
+
+// ----------------------------------------------------------------------------
+// Function setCramReference()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamFileIn#setCramReference
+ * @brief Set the reference sequences used for encoding and decoding CRAM files.
+ *
+ * @signature void setCramReference(file, faiIndex);
+ *
+ * @param[in,out] file     The BamFileIn or BamFileOut to set the reference for.
+ * @param[in]     faiIndex The @link FaiIndex @endlink of the reference FASTA file.  The index is
+ *                         accessed by reference and must outlive <tt>file</tt>.
+ *
+ * Contigs are looked up by the names in the SAM header.  Without a reference, CRAM files
+ * can only be read if they do not depend on it and are written with verbatim bases.
+ */
+
+template <typename TDirection, typename TSpec, typename TFaiIndex>
+inline void
+setCramReference(FormattedFile<Bam, TDirection, TSpec> & file, TFaiIndex const & faiIndex)
+{
+    TFaiIndex const * fai = &faiIndex;
+    context(file).cram.fetchReference = [fai](CharString & seq, CharString const & name,
+                                              int32_t beginPos, int32_t endPos)
+    {
+        unsigned rID = 0;
+        if (!getIdByName(rID, *fai, name))
+            return false;
+        readRegion(seq, *fai, rID, (unsigned)beginPos, (unsigned)endPos);
+        toUpper(seq);
+        return true;
+    };
+}
+
+#endif  // #if SEQAN_HAS_ZLIB
+
 }  // namespace seqan2
 
 #endif // SEQAN_BAM_IO_BAM_FILE_H_
@@ -730,198 +730,113 @@ inline bool save(BamIndex<Bai> const & index, char const * baiFilename)
 }
 
 
-inline void _baiAddAlignmentChunkToBin(BamIndex<Bai> & index,
-                                       uint32_t currBin,
-                                       uint32_t currOffset,
-                                       uint64_t prevOffset)
-{
-    // If this is not the first reference sequence then add previous reference data.
-    Pair<uint64_t> newChunk(currOffset, prevOffset);
+// ----------------------------------------------------------------------------
+// Function _bamIndexScan()
+// ----------------------------------------------------------------------------
 
-    // If no interest exists yet for this bin, create one and store alignment chunk.
-    BamIndex<Bai>::TBinIndex_::iterator binIter = back(index._binIndices).find(currBin);
-    if (binIter == back(index._binIndices).end())
-    {
-        BaiBamIndexBinData_ binData;
-        appendValue(binData.chunkBegEnds, newChunk);
-        back(index._binIndices).insert(std::make_pair(currBin, binData));
-    }
-    else
+// Scans a BAM file once and fills the builder.  Only the fixed-size part and
+// the CIGAR of each record are decoded, BGZF blocks are decompressed in
+// parallel by the stream.
+
+inline bool
+_bamIndexScan(BinningIndexBuilder_ & builder, BamFileIn & bamFile)
+{
+    CharString buffer;
+    BamAlignmentRecordCore core;
+    // Checking atEnd() may step into the EOF marker block, so the offset
+    // behind the last record is remembered instead.
+    uint64_t endOffset = position(bamFile);
+    while (!atEnd(bamFile.iter))
     {
-        // Otherwise, just append alignment chunk.
-        appendValue(binIter->second.chunkBegEnds, newChunk);
+        _readBamRecordWithoutSize(buffer, bamFile.iter);
+        if (length(buffer) < sizeof(BamAlignmentRecordCore))
+            return false;
+        std::memcpy(&core, begin(buffer, Standard()), sizeof(BamAlignmentRecordCore));
+        enforceLittleEndian(core);
+        if (length(buffer) < sizeof(BamAlignmentRecordCore) + core._l_qname + 4 * core._n_cigar)
+            return false;
+
+        // Length of the alignment in the reference.
+        int64_t refLen = 0;
+        char const * cigar = begin(buffer, Standard()) + sizeof(BamAlignmentRecordCore) + core._l_qname;
+        for (unsigned i = 0; i < core._n_cigar; ++i)
+        {
+            uint32_t op;
+            std::memcpy(&op, cigar + 4 * i, 4);
+            enforceLittleEndian(op);
+            switch (op & 15)
+            {
+                case 0: case 2: case 3: case 7: case 8:  // M, D, N, =, X
+                    refLen += op >> 4;
+                default:
+                    break;
+            }
+        }
+        bool isMapped = !(core.flag & BAM_FLAG_UNMAPPED);
+        int64_t endPos = core.beginPos + ((isMapped && refLen > 0) ? refLen : 1);
+
+        endOffset = position(bamFile);
+        if (!_binningIndexPush(builder, core.rID, core.beginPos, endPos, endOffset, isMapped))
+            return false;
     }
+    _binningIndexFinish(builder, endOffset);
+    return true;
 }
 
 // ---------------------------------------------------------------------------
 // Function build()
 // ---------------------------------------------------------------------------
-// TODO(dadi): uncomment when BamIndex.build index is fixed. DOX commented out
-/*
+
+/*!
  * @fn BamIndex#build
  * @brief Create a BamIndex from BAM file.
  *
  * @signature bool build(baiIndex, bamFileName);
+ * @signature bool build(csiIndex, bamFileName[, minShift[, depth]]);
  *
  * @param[out] baiIndex    The BamIndex to build into.
  * @param[in]  bamFileName Path to the BAM file to build an index for.  Type: <tt>char const *</tt>.
  *
+ * The BAM file is read once, the records must be sorted by coordinate.
+ *
  * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise.
  */
+
 inline bool build(BamIndex<Bai> & index, char const * bamFilename)
 {
-    // SEQAN_FAIL("This does not work yet!");
-
     index._unalignedCount = 0;
     clear(index._binIndices);
     clear(index._linearIndices);
 
-    // Open BAM file for reading.
     BamFileIn bamFile;
-    if (!open(bamFile, bamFilename))
-        return false;  // Could not open BAM file.
+    if (!open(bamFile, bamFilename) || !isEqual(format(bamFile), Bam()))
+        return false;
 
-    // Read BAM header.
     BamHeader header;
     readHeader(header, bamFile);
 
-    uint32_t numRefSeqs = length(contigNames(context(bamFile)));
-
-    // Scan over BAM file and create index.
-    BamAlignmentRecord record;
-    uint32_t currBin    = std::numeric_limits<uint32_t>::max();
-    uint32_t prevBin    = std::numeric_limits<uint32_t>::max();
-    int32_t currRefId   = BamAlignmentRecord::INVALID_REFID;
-    int32_t prevRefId   = BamAlignmentRecord::INVALID_REFID;
-    uint64_t currOffset = position(bamFile);
-    uint64_t prevOffset = currOffset;
-    int32_t prevPos     = std::numeric_limits<int32_t>::min();
-
-    while (!atEnd(bamFile))
-    {
-        // Load next record.
-        readRecord(record, bamFile);
-
-        // Check ordering.
-        if (prevRefId == record.rID && prevPos > record.beginPos)
+    // BAI cannot address positions beyond 2^29, use CSI for such references.
+    unsigned numRefs = length(contigNames(context(bamFile)));
+    for (unsigned i = 0; i < length(contigLengths(context(bamFile))); ++i)
+        if (contigLengths(context(bamFile))[i] >= (1 << 29))
             return false;
 
-        // The reference sequence changed, close bins for previous reference.
-        if (prevRefId != record.rID)
-        {
-            if (prevRefId != BamAlignmentRecord::INVALID_REFID)
-            {
-                _baiAddAlignmentChunkToBin(index, currBin, currOffset, prevOffset);
-
-                // Add an index for all empty references between prevRefId (excluded) and record.rID (included).
-                for (int i = prevRefId + 1; i < record.rID; ++i)
-                {
-                    BamIndex<Bai>::TBinIndex_ binIndex;
-                    appendValue(index._binIndices, binIndex);
-                    BamIndex<Bai>::TLinearIndex_ linearIndex;
-                    appendValue(index._linearIndices, linearIndex);
-                }
-
-                // Update bin book keeping.
-                currOffset = prevOffset;
-                currBin    = record.bin;
-                prevBin    = record.bin;
-                currRefId  = record.rID;
-            }
-            else
-            {
-                // Otherwise, this is the first pass.  Create an index for all empty references up to and including
-                // current refId.
-                for (int i = 0; i < record.rID; ++i)
-                {
-                    BamIndex<Bai>::TBinIndex_ binIndex;
-                    appendValue(index._binIndices, binIndex);
-                    BamIndex<Bai>::TLinearIndex_ linearIndex;
-                    appendValue(index._linearIndices, linearIndex);
-                }
-            }
-
-            // Update reference book keeping.
-            prevRefId = record.rID;
-            prevBin = std::numeric_limits<int32_t>::min();
-        }
-
-        // If the alignment's reference id is valid and its bin is not a leaf.
-        if (record.rID >= 0 && record.bin < 4681)
-        {
-            int32_t beginOffset = record.beginPos >> BamIndex<Bai>::BAM_LIDX_SHIFT;
-            int32_t endPos      = getAlignmentLengthInRef(record);
-            int32_t endOffset   = (endPos - 1) >> BamIndex<Bai>::BAM_LIDX_SHIFT;
-
-            // Resize linear index if necessary.
-            unsigned oldSize = length(index._linearIndices);
-            unsigned newSize = endOffset + 1;
-            if (oldSize < newSize)
-                resize(back(index._linearIndices), newSize, 0);
-
-            // Store offset.
-            for (int i = beginOffset + 1; i <= endOffset; ++i)
-                if (back(index._linearIndices)[i] == 0u)
-                    back(index._linearIndices)[i] = prevOffset;
-        }
-
-        // Handle the case if we changed to a new BAI bin.
-        if (record.bin != prevBin)
-        {
-            // If not first bin of reference, save previous bin data.
-            if (currBin != std::numeric_limits<uint32_t>::max())
-                _baiAddAlignmentChunkToBin(index, currBin, currOffset, prevOffset);
-
-            // Update markers.
-            currOffset = prevOffset;
-            currBin    = record.bin;
-            prevBin    = record.bin;
-            currRefId  = record.rID;
-
-            // If the reference id is invalid then break out.
-            if (currRefId < 0)
-                break;
-        }
-
-        // Make sure that the current file pointer is beyond prevOffset.
-        if (position(bamFile) <= static_cast<int64_t>(prevOffset))
-            return false;  // Calculating offsets failed.
-
-        // Update prevOffset and prevPos.
-        prevOffset = position(bamFile);
-        prevPos    = record.beginPos;
-    }
-
-    // Count remaining unaligned records.
-    while (!atEnd(bamFile))
-    {
-        SEQAN_ASSERT_GT(index._unalignedCount, 0u);
-
-        readRecord(record, bamFile);
-        if (record.rID >= 0)
-            return false;  // Could not read record.
-
-        index._unalignedCount += 1;
-    }
+    BinningIndexBuilder_ builder(numRefs, position(bamFile));
+    if (!_bamIndexScan(builder, bamFile))
+        return false;
 
-    // After loading all alignments, if any data was read, perform checks.
-    if (currRefId >= 0)
+    resize(index._binIndices, numRefs);
+    resize(index._linearIndices, numRefs);
+    for (unsigned i = 0; i < numRefs; ++i)
     {
-        // Store last alignment chunk to its bin and then write last reference entry with data.
-        _baiAddAlignmentChunkToBin(index, currBin, currOffset, prevOffset);
-
-        // Finally, write any empty references remaining at end of file.
-        SEQAN_ASSERT_GEQ(numRefSeqs, length(index._binIndices));
-        BamIndex<Bai>::TBinIndex_ binIndex;
-        resize(index._binIndices, numRefSeqs, binIndex);  // TODO(holtgrew): binIndex is unnecessary if resize used T() as default value as vector.resize() does.
+        for (BinningIndexBuilder_::TBins::const_iterator it = builder.bins[i].begin(); it != builder.bins[i].end(); ++it)
+            index._binIndices[i][it->first].chunkBegEnds = it->second.chunkBegEnds;
+        index._linearIndices[i] = builder.linear[i];
     }
-
-    // Merge small bins if possible.
-    // SEQAN_FAIL("TODO: Merge bins!");
+    index._unalignedCount = builder.nNoCoor;
     return true;
 }
 
-
 }  // namespace seqan2
 
 #endif  // #ifndef INCLUDE_SEQAN_BAM_IO_BAM_INDEX_BAI_H_
@@ -0,0 +1,418 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Support for the coordinate-sorted index (CSI).
+//
+// CSI generalizes BAI: the size of the smallest bin (1 << minShift) and the
+// number of levels (depth) are stored in the index, so that references
+// longer than 2^29 can be indexed.  Instead of a linear index, each bin
+// stores the smallest offset of a record overlapping its leftmost window.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_BAM_INDEX_CSI_H_
+#define INCLUDE_SEQAN_BAM_IO_BAM_INDEX_CSI_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tag Csi
+// ----------------------------------------------------------------------------
+
+struct Csi_;
+typedef Tag<Csi_> Csi;
+
+// ----------------------------------------------------------------------------
+// Spec CSI BamIndex
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class CsiBamIndex
+ * @headerfile <seqan/bam_io.h>
+ * @extends BamIndex
+ * @brief Access to CSI (coordinate-sorted index), supports references longer than 512 Mbp.
+ *
+ * @signature template <>
+ *            class BamIndex<Csi>;
+ */
+
+template <>
+class BamIndex<Csi>
+{
+public:
+    typedef std::map<uint32_t, BinningIndexBin_> TBinIndex_;
+
+    int32_t _minShift;
+    int32_t _depth;
+    CharString _aux;
+    uint64_t _unalignedCount;
+
+    String<TBinIndex_> _binIndices;
+
+    BamIndex() : _minShift(14), _depth(5), _unalignedCount(std::numeric_limits<uint64_t>::max())
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _csiCheckRegion()
+// ----------------------------------------------------------------------------
+
+template <typename TSpec>
+inline void
+_csiCheckRegion(FormattedFile<Bam, Input, TSpec> & bamFile,
+                BamIndex<Csi> const & index,
+                int32_t const refId,
+                uint32_t regionStart,
+                uint32_t regionEnd)
+{
+    if (!isEqual(format(bamFile), Bam()))
+        SEQAN_THROW(std::logic_error("You attempt to use a BAM format specific functionality on a non-BAM format."));
+
+    if (refId < 0 ||
+        static_cast<decltype(length(contigNames(context(bamFile))))>(refId) >= length(contigNames(context(bamFile))))
+        SEQAN_THROW(std::logic_error("Invalid reference identifier 'refId' passed."));
+
+    if (static_cast<decltype(length(index._binIndices))>(refId) >= length(index._binIndices))
+        SEQAN_THROW(std::logic_error("CSI index bin directory does not match the given reference identifier 'refId'. "
+                   "Maybe your CSI index is corrupted or refers to a different BAM file."));
+
+    if (regionEnd > static_cast<uint32_t>(contigLengths(context(bamFile))[refId]))
+        SEQAN_THROW(std::logic_error("The 'regionEnd' parameter point to a position greater than the length of the reference."));
+
+    if (regionStart > regionEnd)
+        SEQAN_THROW(std::logic_error("Invalid region specified. Parameter regionStart was greater than regionEnd."));
+
+    if (regionStart == 0 || regionEnd == 0)
+        SEQAN_THROW(std::logic_error("Invalid region specified. Region is expected to be 1-based but 0 was passed as an argument."));
+}
+
+// ----------------------------------------------------------------------------
+// Function _csiMinOffset()
+// ----------------------------------------------------------------------------
+
+// Smallest offset of a record that may overlap the 0-based position pos.
+
+inline uint64_t
+_csiMinOffset(BamIndex<Csi> const & index, int32_t refId, uint32_t pos)
+{
+    BamIndex<Csi>::TBinIndex_ const & bins = index._binIndices[refId];
+    uint32_t bin = _binningIndexBinFirst(index._depth) + (pos >> index._minShift);
+    while (true)
+    {
+        BamIndex<Csi>::TBinIndex_::const_iterator it = bins.find(bin);
+        if (it != bins.end())
+            return it->second.loffset;
+        if (bin == 0)
+            return 0;
+        bin = _binningIndexBinParent(bin);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function viewRecords()
+// ----------------------------------------------------------------------------
+
+template <typename TContainer, typename TSpec>
+inline
+SEQAN_FUNC_ENABLE_IF(And<IsSameType<typename Value<TContainer>::Type, BamAlignmentRecord>,
+                     Not<IsSameType<typename Value<TContainer>::Type, TContainer>>>, void)
+viewRecords(TContainer & resultContainer,
+            FormattedFile<Bam, Input, TSpec> & bamFile,
+            BamIndex<Csi> const & index,
+            int32_t const refId,
+            uint32_t regionStart,
+            uint32_t regionEnd)
+{
+    typedef String<Pair<uint64_t, uint64_t> > TChunks;
+
+    _csiCheckRegion(bamFile, index, refId, regionStart, regionEnd);
+    --regionStart;
+    --regionEnd;
+
+    String<uint32_t> candidateBins;
+    _binningIndexReg2Bins(candidateBins, regionStart, (int64_t)regionEnd + 1, index._minShift, index._depth);
+    uint64_t minOffset = _csiMinOffset(index, refId, regionStart);
+
+    BamAlignmentRecord record;
+    for (unsigned i = 0; i < length(candidateBins); ++i)
+    {
+        BamIndex<Csi>::TBinIndex_::const_iterator mIt = index._binIndices[refId].find(candidateBins[i]);
+        if (mIt == index._binIndices[refId].end())
+            continue;
+
+        TChunks const & chunks = mIt->second.chunkBegEnds;
+        for (unsigned c = 0; c < length(chunks); ++c)
+        {
+            if (chunks[c].i2 <= minOffset)
+                continue;
+
+            setPosition(bamFile, std::max(chunks[c].i1, minOffset));
+            while (static_cast<uint64_t>(position(bamFile)) < chunks[c].i2 && !atEnd(bamFile))
+            {
+                readRecord(record, bamFile);
+
+                if (record.rID != refId || record.beginPos == -1 || static_cast<uint32_t>(record.beginPos) > regionEnd)
+                    break;
+
+                if ((record.beginPos + std::max(1u, getAlignmentLengthInRef(record)) - 1) >= regionStart)
+                    appendValue(resultContainer, record, Generous());
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function jumpToRegion()
+// ----------------------------------------------------------------------------
+
+template <typename TSpec>
+inline bool
+jumpToRegion(FormattedFile<Bam, Input, TSpec> & bamFile,
+             bool & hasAlignments,
+             int32_t const refId,
+             uint32_t regionStart,
+             uint32_t regionEnd,
+             BamIndex<Csi> const & index)
+{
+    hasAlignments = false;
+    _csiCheckRegion(bamFile, index, refId, regionStart, regionEnd);
+    --regionStart;
+    --regionEnd;
+
+    if (index._binIndices[refId].empty())
+        return true;
+
+    setPosition(bamFile, _csiMinOffset(index, refId, regionStart));
+    BamAlignmentRecord record;
+    while (!atEnd(bamFile))
+    {
+        uint64_t seekPos = position(bamFile);
+        readRecord(record, bamFile);
+
+        if (record.rID != refId || record.beginPos == -1 || static_cast<uint32_t>(record.beginPos) > regionEnd)
+            break;
+
+        if (static_cast<uint32_t>(record.beginPos) >= regionStart)
+        {
+            hasAlignments = true;
+            setPosition(bamFile, seekPos);
+            break;
+        }
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function getUnalignedCount()
+// ----------------------------------------------------------------------------
+
+inline uint64_t
+getUnalignedCount(BamIndex<Csi> const & index)
+{
+    return index._unalignedCount;
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+inline bool
+open(BamIndex<Csi> & index, char const * filename)
+{
+    clear(index._binIndices);
+    clear(index._aux);
+
+    std::ifstream file(filename, std::ios::binary | std::ios::in);
+    if (!file.good())
+        return false;
+    VirtualStream<char, Input> in;
+    if (!open(in, file))    // CSI files are BGZF compressed
+        return false;
+    typename DirectionIterator<VirtualStream<char, Input>, Input>::Type iter = directionIterator(in, Input());
+
+    SEQAN_TRY
+    {
+        CharString magic;
+        read(magic, iter, 4);
+        if (magic != "CSI\1")
+            return false;
+
+        int32_t auxLen = 0, numRefs = 0;
+        readRawPod(index._minShift, iter);
+        readRawPod(index._depth, iter);
+        readRawPod(auxLen, iter);
+        if (index._minShift < 0 || index._depth < 0 || index._minShift + 3 * index._depth > 63 || auxLen < 0)
+            return false;
+        read(index._aux, iter, auxLen);
+        readRawPod(numRefs, iter);
+        if (numRefs < 0)
+            return false;
+
+        resize(index._binIndices, numRefs);
+        for (int32_t i = 0; i < numRefs; ++i)
+        {
+            int32_t numBins = 0;
+            readRawPod(numBins, iter);
+            for (int32_t j = 0; j < numBins; ++j)
+            {
+                uint32_t bin = 0;
+                int32_t numChunks = 0;
+                readRawPod(bin, iter);
+                BinningIndexBin_ & data = index._binIndices[i][bin];
+                readRawPod(data.loffset, iter);
+                readRawPod(numChunks, iter);
+                resize(data.chunkBegEnds, numChunks);
+                for (int32_t k = 0; k < numChunks; ++k)
+                {
+                    readRawPod(data.chunkBegEnds[k].i1, iter);
+                    readRawPod(data.chunkBegEnds[k].i2, iter);
+                }
+            }
+        }
+    }
+    SEQAN_CATCH(UnexpectedEnd const &)
+    {
+        return false;
+    }
+
+    // Read (optional) number of alignments without coordinate.
+    index._unalignedCount = 0;
+    if (!atEnd(iter))
+    {
+        readRawPod(index._unalignedCount, iter);
+    }
+    return true;
+}
+
+inline bool
+open(BamIndex<Csi> & index, char * filename)
+{
+    return open(index, static_cast<char const *>(filename));
+}
+
+// ---------------------------------------------------------------------------
+// Function save()
+// ---------------------------------------------------------------------------
+
+inline bool
+save(BamIndex<Csi> const & index, char const * csiFilename)
+{
+    std::ofstream file(csiFilename, std::ios::binary | std::ios::out);
+    if (!file.good())
+        return false;
+    {
+        VirtualStream<char, Output> out;
+        if (!open(out, file, BgzfFile()))
+            return false;
+        typename DirectionIterator<VirtualStream<char, Output>, Output>::Type iter = directionIterator(out, Output());
+
+        write(iter, "CSI\1");
+        appendRawPod(iter, index._minShift);
+        appendRawPod(iter, index._depth);
+        appendRawPod(iter, (int32_t)length(index._aux));
+        write(iter, index._aux);
+        appendRawPod(iter, (int32_t)length(index._binIndices));
+        for (unsigned i = 0; i < length(index._binIndices); ++i)
+        {
+            BamIndex<Csi>::TBinIndex_ const & bins = index._binIndices[i];
+            appendRawPod(iter, (int32_t)bins.size());
+            for (BamIndex<Csi>::TBinIndex_::const_iterator it = bins.begin(); it != bins.end(); ++it)
+            {
+                appendRawPod(iter, it->first);
+                appendRawPod(iter, it->second.loffset);
+                appendRawPod(iter, (int32_t)length(it->second.chunkBegEnds));
+                for (unsigned k = 0; k < length(it->second.chunkBegEnds); ++k)
+                {
+                    appendRawPod(iter, it->second.chunkBegEnds[k].i1);
+                    appendRawPod(iter, it->second.chunkBegEnds[k].i2);
+                }
+            }
+        }
+        if (index._unalignedCount != std::numeric_limits<uint64_t>::max())
+            appendRawPod(iter, index._unalignedCount);
+    }
+    return file.good();
+}
+
+// ---------------------------------------------------------------------------
+// Function build()
+// ---------------------------------------------------------------------------
+
+// With depth 0, the depth is chosen such that the longest reference fits.
+
+inline bool
+build(BamIndex<Csi> & index, char const * bamFilename, int minShift = 14, int depth = 0)
+{
+    index._unalignedCount = 0;
+    clear(index._binIndices);
+    clear(index._aux);
+
+    BamFileIn bamFile;
+    if (!open(bamFile, bamFilename) || !isEqual(format(bamFile), Bam()))
+        return false;
+
+    BamHeader header;
+    readHeader(header, bamFile);
+
+    if (depth <= 0)
+    {
+        int64_t maxLen = 0;
+        for (unsigned i = 0; i < length(contigLengths(context(bamFile))); ++i)
+            maxLen = std::max(maxLen, (int64_t)contigLengths(context(bamFile))[i]);
+        maxLen += 256;
+        depth = 0;
+        for (int64_t s = (int64_t)1 << minShift; maxLen > s; ++depth, s <<= 3) {}
+    }
+    if (minShift < 0 || minShift + 3 * depth > 63)
+        return false;
+    index._minShift = minShift;
+    index._depth = depth;
+
+    unsigned numRefs = length(contigNames(context(bamFile)));
+    BinningIndexBuilder_ builder(numRefs, position(bamFile), minShift, depth);
+    if (!_bamIndexScan(builder, bamFile))
+        return false;
+
+    index._binIndices = builder.bins;
+    index._unalignedCount = builder.nNoCoor;
+    return true;
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_BAM_INDEX_CSI_H_
@@ -170,6 +170,7 @@ public:
     CharString              buffer;
     String<CharString>      buffers;
     String<unsigned>        translateFile2GlobalRefId;
+    CramIOContext_          cram;
 
     BamIOContext() :
         _contigNames(TNameStoreMember()),
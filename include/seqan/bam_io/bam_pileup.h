@@ -0,0 +1,589 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Streaming pileup over coordinate-sorted SAM/BAM files.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_BAM_PILEUP_H_
+#define INCLUDE_SEQAN_BAM_IO_BAM_PILEUP_H_
+
+#include <cstring>
+
+namespace seqan2 {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class BamPileupColumn
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BamPileupColumn
+ * @headerfile <seqan/bam_io.h>
+ * @brief The reads covering one reference position, see @link BamPileup @endlink.
+ *
+ * @signature struct BamPileupColumn;
+ *
+ * The counters are fixed-size arrays indexed by strand (0 forward, 1 reverse) and by the ordinal value of the
+ * @link Dna5 @endlink base, so columns can be summed or compared with plain loops.
+ *
+ * @var int32_t BamPileupColumn::rID;
+ * @brief The reference id of the column.
+ *
+ * @var int32_t BamPileupColumn::pos;
+ * @brief The 0-based position of the column.
+ *
+ * @var uint32_t BamPileupColumn::depth;
+ * @brief The number of counted bases and deletions at the column.
+ *
+ * @var uint32_t BamPileupColumn::deletions;
+ * @brief The number of reads with a deletion at the column.
+ *
+ * @var uint32_t BamPileupColumn::insertions;
+ * @brief The number of reads with an insertion between the column and the next one.
+ *
+ * @var uint32_t BamPileupColumn::counts[2][5];
+ * @brief The number of bases, by strand and base.
+ *
+ * @var uint32_t BamPileupColumn::qualSums[2][5];
+ * @brief The sums of the Phred base qualities, by strand and base.
+ */
+
+struct BamPileupColumn
+{
+    int32_t  rID;
+    int32_t  pos;
+    uint32_t depth;
+    uint32_t deletions;
+    uint32_t insertions;
+    uint32_t counts[2][5];
+    uint32_t qualSums[2][5];
+
+    BamPileupColumn()
+    {
+        std::memset(static_cast<void *>(this), 0, sizeof(BamPileupColumn));
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class BamPileupOptions
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BamPileupOptions
+ * @headerfile <seqan/bam_io.h>
+ * @brief Filters of a @link BamPileup @endlink.
+ *
+ * @signature struct BamPileupOptions;
+ *
+ * @var uint16_t BamPileupOptions::skipFlags;
+ * @brief Records with any of these flags are skipped, defaults to unmapped, secondary, QC failed and duplicate
+ *        records.
+ *
+ * @var unsigned BamPileupOptions::minMappingQuality;
+ * @brief Records with a lower mapping quality are skipped, defaults to 0.
+ *
+ * @var unsigned BamPileupOptions::minBaseQuality;
+ * @brief Bases with a lower quality are not counted, defaults to 0.
+ */
+
+struct BamPileupOptions
+{
+    uint16_t    skipFlags;
+    unsigned    minMappingQuality;
+    unsigned    minBaseQuality;
+
+    BamPileupOptions() :
+        skipFlags(BAM_FLAG_UNMAPPED | BAM_FLAG_SECONDARY | BAM_FLAG_QC_NO_PASS | BAM_FLAG_DUPLICATE),
+        minMappingQuality(0),
+        minBaseQuality(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class BamPileup
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BamPileup
+ * @headerfile <seqan/bam_io.h>
+ * @brief Streams the pileup columns of a coordinate-sorted @link BamFileIn @endlink.
+ *
+ * @signature class BamPileup;
+ *
+ * The CIGAR of each record is walked once and its bases are added to a ring buffer of the columns that can still
+ * be covered by further records.  A column is complete as soon as the next record starts behind it.  Only columns
+ * with at least one counted base, deletion or insertion are returned, in the order of the file.  The memory is
+ * proportional to the longest record span, not to the coverage.
+ *
+ * The header of the file must have been read.  To partition the work by region, each thread opens its own
+ * @link BamFileIn @endlink and @link BamPileup @endlink and calls @link BamPileup#jumpToRegion @endlink.
+ *
+ * @section Examples
+ *
+ * @code{.cpp}
+ * BamFileIn bamFile("ex1.bam");
+ * BamHeader header;
+ * readHeader(header, bamFile);
+ *
+ * BamPileup pileup(bamFile);
+ * BamPileupColumn column;
+ * while (!atEnd(pileup))
+ * {
+ *     readColumn(column, pileup);
+ *     std::cout << contigNames(context(bamFile))[column.rID] << '\t' << column.pos + 1 << '\t'
+ *               << column.depth << '\n';
+ * }
+ * @endcode
+ *
+ * @fn BamPileup::BamPileup
+ * @brief Constructor.
+ *
+ * @signature BamPileup::BamPileup(bamFile[, options]);
+ *
+ * @param[in] bamFile The @link BamFileIn @endlink to read from, its header must have been read.
+ * @param[in] options The @link BamPileupOptions @endlink.
+ */
+
+class BamPileup
+{
+public:
+    BamFileIn *             _file;
+    BamPileupOptions        options;
+
+    // the next record to add, read ahead to know which columns are complete
+    BamAlignmentRecord      _record;
+    bool                    _hasRecord;
+
+    // ring buffer of the columns [_begin, _end) of reference _rID, its length is a power of 2
+    String<BamPileupColumn> _ring;
+    int32_t                 _rID;
+    int32_t                 _begin;
+    int32_t                 _end;
+
+    // region [_regionBegin, _regionEnd) of _regionRID the columns are restricted to, _regionRID is -1 if unset
+    int32_t                 _regionRID;
+    int32_t                 _regionBegin;
+    int32_t                 _regionEnd;
+
+    explicit
+    BamPileup(BamFileIn & file, BamPileupOptions const & options = BamPileupOptions()) :
+        _file(&file),
+        options(options),
+        _hasRecord(false),
+        _rID(-1),
+        _begin(0),
+        _end(0),
+        _regionRID(-1),
+        _regionBegin(0),
+        _regionEnd(0)
+    {
+        resize(_ring, 1024);
+    }
+
+private:
+    BamPileup(BamPileup const &);
+    BamPileup & operator=(BamPileup const &);
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamPileupColumn#clear
+ * @brief Resets all counters of a column to 0.
+ *
+ * @signature void clear(column);
+ *
+ * @param[in,out] column The @link BamPileupColumn @endlink to clear.
+ */
+
+inline void
+clear(BamPileupColumn & column)
+{
+    std::memset(static_cast<void *>(&column), 0, sizeof(BamPileupColumn));
+}
+
+// ----------------------------------------------------------------------------
+// Function _reset()
+// ----------------------------------------------------------------------------
+
+inline void
+_reset(BamPileup & pileup)
+{
+    for (size_t i = 0; i < length(pileup._ring); ++i)
+        clear(pileup._ring[i]);
+    pileup._hasRecord = false;
+    pileup._rID = -1;
+    pileup._begin = 0;
+    pileup._end = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamPileupColumn()
+// ----------------------------------------------------------------------------
+
+inline BamPileupColumn &
+_bamPileupColumn(BamPileup & pileup, int32_t pos)
+{
+    return pileup._ring[pos & (length(pileup._ring) - 1)];
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamPileupReserve()
+// ----------------------------------------------------------------------------
+
+// Grows the ring buffer until it holds the columns [_begin, end).
+inline void
+_bamPileupReserve(BamPileup & pileup, int32_t end)
+{
+    size_t span = end - pileup._begin;
+    if (span <= length(pileup._ring))
+        return;
+
+    size_t newLength = length(pileup._ring);
+    while (newLength < span)
+        newLength *= 2;
+
+    String<BamPileupColumn> ring;
+    resize(ring, newLength);
+    for (int32_t pos = pileup._begin; pos < pileup._end; ++pos)
+        ring[pos & (newLength - 1)] = _bamPileupColumn(pileup, pos);
+    swap(ring, pileup._ring);
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamPileupReadNext()
+// ----------------------------------------------------------------------------
+
+// Reads the next record that passes the filters into pileup._record.
+inline void
+_bamPileupReadNext(BamPileup & pileup)
+{
+    int32_t lastRID = pileup._hasRecord ? pileup._record.rID : -1;
+    int32_t lastPos = pileup._hasRecord ? pileup._record.beginPos : -1;
+
+    pileup._hasRecord = false;
+    while (!atEnd(*pileup._file))
+    {
+        BamAlignmentRecord & record = pileup._record;
+        readRecord(record, *pileup._file);
+
+        if (record.rID < 0 || record.beginPos < 0)
+        {
+            // unplaced records are at the end of a sorted file
+            if (hasFlagUnmapped(record))
+                break;
+            continue;
+        }
+        if (record.rID < lastRID || (record.rID == lastRID && record.beginPos < lastPos))
+            SEQAN_THROW(ParseError("BAM file is not sorted by coordinate."));
+        lastRID = record.rID;
+        lastPos = record.beginPos;
+
+        // stop behind the region
+        if (pileup._regionRID >= 0 && record.rID < pileup._regionRID)
+            continue;
+        if (pileup._regionRID >= 0 &&
+            (record.rID > pileup._regionRID || record.beginPos >= pileup._regionEnd))
+            break;
+
+        if ((record.flag & pileup.options.skipFlags) != 0 || record.mapQ < pileup.options.minMappingQuality ||
+            empty(record.cigar))
+            continue;
+        if (pileup._regionRID >= 0 &&
+            record.beginPos + (int32_t)getAlignmentLengthInRef(record) <= pileup._regionBegin)
+            continue;
+
+        pileup._hasRecord = true;
+        return;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamPileupAdd()
+// ----------------------------------------------------------------------------
+
+// Walks the CIGAR of the record and adds its bases to the columns.
+inline void
+_bamPileupAdd(BamPileup & pileup, BamAlignmentRecord const & record)
+{
+    int32_t refPos = record.beginPos;
+    _bamPileupReserve(pileup, refPos + getAlignmentLengthInRef(record));
+
+    unsigned strand = hasFlagRC(record) ? 1 : 0;
+    unsigned minQual = pileup.options.minBaseQuality;
+    size_t readPos = 0;
+    for (size_t i = 0; i < length(record.cigar); ++i)
+    {
+        unsigned count = record.cigar[i].count;
+        switch (record.cigar[i].operation)
+        {
+            case 'M':
+            case '=':
+            case 'X':
+                for (unsigned k = 0; k < count; ++k, ++refPos, ++readPos)
+                {
+                    unsigned qual = (readPos < length(record.qual)) ? (unsigned)(record.qual[readPos] - '!') : 0u;
+                    if (qual < minQual || readPos >= length(record.seq))
+                        continue;
+                    unsigned base = ordValue(Dna5(record.seq[readPos]));
+                    BamPileupColumn & column = _bamPileupColumn(pileup, refPos);
+                    ++column.depth;
+                    ++column.counts[strand][base];
+                    column.qualSums[strand][base] += qual;
+                }
+                break;
+            case 'D':
+                for (unsigned k = 0; k < count; ++k, ++refPos)
+                {
+                    BamPileupColumn & column = _bamPileupColumn(pileup, refPos);
+                    ++column.depth;
+                    ++column.deletions;
+                }
+                break;
+            case 'N':
+                refPos += count;
+                break;
+            case 'I':
+                if (refPos > record.beginPos)
+                    ++_bamPileupColumn(pileup, refPos - 1).insertions;
+                readPos += count;
+                break;
+            case 'S':
+                readPos += count;
+                break;
+            default:  // 'H', 'P'
+                break;
+        }
+    }
+    pileup._end = std::max(pileup._end, refPos);
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamPileupFill()
+// ----------------------------------------------------------------------------
+
+// Adds records until the column at _begin is complete and not empty, returns false if there is none.
+inline bool
+_bamPileupFill(BamPileup & pileup)
+{
+    while (true)
+    {
+        // columns before the next record are complete
+        int32_t limit = pileup._end;
+        if (pileup._hasRecord && pileup._record.rID == pileup._rID)
+            limit = std::min(limit, pileup._record.beginPos);
+        if (pileup._regionRID >= 0)
+            limit = std::min(limit, pileup._regionEnd);
+
+        for (; pileup._begin < limit; ++pileup._begin)
+        {
+            BamPileupColumn & column = _bamPileupColumn(pileup, pileup._begin);
+            if ((column.depth != 0 || column.insertions != 0) &&
+                (pileup._regionRID < 0 || pileup._begin >= pileup._regionBegin))
+                return true;
+            clear(column);
+        }
+
+        if (!pileup._hasRecord)
+        {
+            // the columns behind the region are not returned
+            for (; pileup._begin < pileup._end; ++pileup._begin)
+                clear(_bamPileupColumn(pileup, pileup._begin));
+            return false;
+        }
+
+        if (pileup._record.rID != pileup._rID || pileup._begin >= pileup._end)
+        {
+            // all columns are returned, continue at the next record
+            for (; pileup._begin < pileup._end; ++pileup._begin)
+                clear(_bamPileupColumn(pileup, pileup._begin));
+            pileup._rID = pileup._record.rID;
+            pileup._begin = pileup._end = pileup._record.beginPos;
+        }
+        _bamPileupAdd(pileup, pileup._record);
+        _bamPileupReadNext(pileup);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamPileupStart()
+// ----------------------------------------------------------------------------
+
+inline void
+_bamPileupStart(BamPileup & pileup)
+{
+    if (pileup._rID == -1 && !pileup._hasRecord)
+    {
+        _bamPileupReadNext(pileup);
+        if (pileup._hasRecord)
+        {
+            pileup._rID = pileup._record.rID;
+            pileup._begin = pileup._end = pileup._record.beginPos;
+        }
+        else
+        {
+            pileup._rID = -2;   // no records
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function atEnd()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamPileup#atEnd
+ * @brief Returns whether all columns were read.
+ *
+ * @signature bool atEnd(pileup);
+ *
+ * @param[in,out] pileup The @link BamPileup @endlink, records are read until the next column is complete.
+ *
+ * @return bool <tt>true</tt> if there are no more columns.
+ *
+ * @throw ParseError If the file is not sorted by coordinate.
+ */
+
+inline bool
+atEnd(BamPileup & pileup)
+{
+    _bamPileupStart(pileup);
+    return !_bamPileupFill(pileup);
+}
+
+// ----------------------------------------------------------------------------
+// Function readColumn()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamPileup#readColumn
+ * @brief Reads the next pileup column.
+ *
+ * @signature void readColumn(column, pileup);
+ *
+ * @param[out]    column The @link BamPileupColumn @endlink to read into.
+ * @param[in,out] pileup The @link BamPileup @endlink to read from, must not be at end.
+ *
+ * @throw ParseError If the file is not sorted by coordinate.
+ */
+
+inline void
+readColumn(BamPileupColumn & column, BamPileup & pileup)
+{
+    if (atEnd(pileup))
+        SEQAN_THROW(ParseError("Unexpected end of pileup."));
+
+    BamPileupColumn & next = _bamPileupColumn(pileup, pileup._begin);
+    column = next;
+    column.rID = pileup._rID;
+    column.pos = pileup._begin;
+    clear(next);
+    ++pileup._begin;
+}
+
+#if SEQAN_HAS_ZLIB
+
+// ----------------------------------------------------------------------------
+// Function _bamPileupMinOffset()
+// ----------------------------------------------------------------------------
+
+inline uint64_t
+_bamPileupMinOffset(BamIndex<Bai> const & index, int32_t rID, uint32_t pos)
+{
+    uint64_t offset = 0;
+    if (!_getMinFileOffset(offset, index, rID, pos))
+    {
+        // behind the last window of the linear index, use the last window
+        if (empty(index._linearIndices[rID]))
+            return 0;
+        offset = back(index._linearIndices[rID]);
+    }
+    return offset;
+}
+
+inline uint64_t
+_bamPileupMinOffset(BamIndex<Csi> const & index, int32_t rID, uint32_t pos)
+{
+    return _csiMinOffset(index, rID, pos);
+}
+
+// ----------------------------------------------------------------------------
+// Function jumpToRegion()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamPileup#jumpToRegion
+ * @brief Restricts a pileup to a region and seeks to it using an index.
+ *
+ * @signature void jumpToRegion(pileup, rID, beginPos, endPos, index);
+ *
+ * @param[in,out] pileup    The @link BamPileup @endlink, its @link BamFileIn @endlink must be a BAM file.
+ * @param[in]     rID       The reference id of the region.
+ * @param[in]     beginPos  The 0-based begin of the region.
+ * @param[in]     endPos    The 0-based end of the region, the end position is not included.
+ * @param[in]     index     The @link BamIndex @endlink (<tt>Bai</tt> or <tt>Csi</tt>) of the file.
+ *
+ * The following columns are the columns of <tt>[beginPos, endPos)</tt>, including the bases of records that start
+ * before the region.  Disjoint regions return disjoint columns, so the columns of a file can be computed in
+ * parallel by splitting it into regions.
+ */
+
+template <typename TIndexSpec>
+inline void
+jumpToRegion(BamPileup & pileup, int32_t rID, int32_t beginPos, int32_t endPos, BamIndex<TIndexSpec> const & index)
+{
+    _reset(pileup);
+    pileup._regionRID = rID;
+    pileup._regionBegin = beginPos;
+    pileup._regionEnd = endPos;
+
+    if (rID < 0 || beginPos >= endPos || (size_t)rID >= length(index._binIndices))
+    {
+        pileup._rID = -2;   // empty region
+        return;
+    }
+    setPosition(*pileup._file, _bamPileupMinOffset(index, rID, beginPos));
+}
+
+#endif  // #if SEQAN_HAS_ZLIB
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_BAM_PILEUP_H_
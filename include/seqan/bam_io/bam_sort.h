@@ -0,0 +1,566 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// External sorting and sorted merging of SAM/BAM files.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_BAM_SORT_H_
+#define INCLUDE_SEQAN_BAM_IO_BAM_SORT_H_
+
+#include <cstdio>
+#include <cstdlib>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <seqan/parallel.h>
+
+namespace seqan2 {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class BamSortOptions
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BamSortOptions
+ * @headerfile <seqan/bam_io.h>
+ * @brief Parameters of @link sortBamFiles @endlink.
+ *
+ * @signature struct BamSortOptions;
+ *
+ * @var BamSortOrder BamSortOptions::sortOrder;
+ * @brief The order to sort by, <tt>BAM_SORT_COORDINATE</tt> (default) or <tt>BAM_SORT_QUERYNAME</tt>.
+ *
+ * @var uint64_t BamSortOptions::maxMemory;
+ * @brief The approximate number of bytes of records kept in memory, defaults to 768 MiB.
+ *
+ * @var CharString BamSortOptions::tmpDir;
+ * @brief Directory of the temporary runs.  If empty, <tt>TMPDIR</tt>, <tt>TMP</tt> or <tt>TEMP</tt> is used if set,
+ *        and the system's default temporary directory otherwise.
+ */
+
+struct BamSortOptions
+{
+    BamSortOrder    sortOrder;
+    uint64_t        maxMemory;
+    CharString      tmpDir;
+
+    BamSortOptions() :
+        sortOrder(BAM_SORT_COORDINATE),
+        maxMemory(768ull << 20)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class BamAlignmentRecordCoordinateLess
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BamAlignmentRecordCoordinateLess
+ * @headerfile <seqan/bam_io.h>
+ * @brief Orders @link BamAlignmentRecord BamAlignmentRecords @endlink by reference id and position.
+ *
+ * @signature struct BamAlignmentRecordCoordinateLess;
+ *
+ * Records without reference (<tt>rID == INVALID_REFID</tt>) come last.  This is the <tt>coordinate</tt> order of the
+ * SAM specification, the order of the references is the order of the contigs in the context.  Records of equal
+ * position are not ordered further.
+ */
+
+struct BamAlignmentRecordCoordinateLess
+{
+    static inline uint64_t key(BamAlignmentRecord const & record)
+    {
+        return ((uint64_t)(uint32_t)record.rID << 32) | (uint32_t)(record.beginPos + 1);
+    }
+
+    inline bool operator()(BamAlignmentRecord const & a, BamAlignmentRecord const & b) const
+    {
+        return key(a) < key(b);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class BamAlignmentRecordNameLess
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BamAlignmentRecordNameLess
+ * @headerfile <seqan/bam_io.h>
+ * @brief Orders @link BamAlignmentRecord BamAlignmentRecords @endlink lexicographically by query name, first mates
+ *        before second mates.
+ *
+ * @signature struct BamAlignmentRecordNameLess;
+ */
+
+struct BamAlignmentRecordNameLess
+{
+    inline bool operator()(BamAlignmentRecord const & a, BamAlignmentRecord const & b) const
+    {
+        if (a.qName != b.qName)
+            return a.qName < b.qName;
+        return (a.flag & (BAM_FLAG_FIRST | BAM_FLAG_LAST)) < (b.flag & (BAM_FLAG_FIRST | BAM_FLAG_LAST));
+    }
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _bamSortMemory()
+// ----------------------------------------------------------------------------
+
+// Approximate memory of a record.
+inline uint64_t
+_bamSortMemory(BamAlignmentRecord const & record)
+{
+    return sizeof(BamAlignmentRecord) + length(record.qName) + length(record.seq) + length(record.qual) +
+           length(record.tags) + length(record.cigar) * sizeof(CigarElement<>);
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamSortOrder()
+// ----------------------------------------------------------------------------
+
+// Computes the permutation that stably sorts the records.
+template <typename TRecords>
+inline void
+_bamSortOrder(String<uint32_t> & order, TRecords const & records, BamSortOrder sortOrder)
+{
+    resize(order, length(records), Exact());
+    if (sortOrder == BAM_SORT_COORDINATE)
+    {
+        // sorting the keys together with the record numbers is stable
+        String<Pair<uint64_t, uint32_t> > keys;
+        resize(keys, length(records), Exact());
+
+        SEQAN_OMP_PRAGMA(parallel for)
+        for (int64_t i = 0; i < (int64_t)length(records); ++i)
+            keys[i] = Pair<uint64_t, uint32_t>(BamAlignmentRecordCoordinateLess::key(records[i]), i);
+        sort(keys, Parallel());
+
+        for (size_t i = 0; i < length(keys); ++i)
+            order[i] = keys[i].i2;
+    }
+    else
+    {
+        for (size_t i = 0; i < length(order); ++i)
+            order[i] = i;
+        BamAlignmentRecordNameLess less;
+        stableSort(order, [&records, &less](uint32_t a, uint32_t b)
+        {
+            return less(records[a], records[b]);
+        }, Parallel());
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _writeBamRecords()
+// ----------------------------------------------------------------------------
+
+// Writes the records in the given order, they are converted in parallel.
+template <typename TSpec, typename TRecords>
+inline void
+_writeBamRecords(FormattedFile<Bam, Output, TSpec> & file, TRecords const & records, String<uint32_t> const & order)
+{
+#if SEQAN_HAS_ZLIB
+    // CRAM records are collected in the context until a container is full.
+    if (isEqual(file.format, Cram()))
+    {
+        for (size_t i = 0; i < length(order); ++i)
+            write(file.iter, records[order[i]], context(file), Cram());
+        return;
+    }
+#endif  // #if SEQAN_HAS_ZLIB
+
+    String<CharString> & buffers = context(file).buffers;
+    for (size_t batchBegin = 0; batchBegin < length(order); batchBegin += 4096)
+    {
+        size_t batchSize = _min((size_t)4096, length(order) - batchBegin);
+        resize(buffers, batchSize);
+
+        SEQAN_OMP_PRAGMA(parallel for)
+        for (int i = 0; i < (int)batchSize; ++i)
+        {
+            clear(buffers[i]);
+            write(buffers[i], records[order[batchBegin + i]], context(file), file.format);
+        }
+        for (size_t i = 0; i < batchSize; ++i)
+            write(file.iter, buffers[i]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamSortTempFileName()
+// ----------------------------------------------------------------------------
+
+inline void
+_bamSortTempFileName(CharString & fileName, CharString const & tmpDir, uint64_t prefix, unsigned runNo)
+{
+    CharString dir = tmpDir;
+    if (empty(dir))
+    {
+        char const * env = NULL;
+        if ((env = getenv("TMPDIR")) != NULL || (env = getenv("TMP")) != NULL || (env = getenv("TEMP")) != NULL)
+            dir = env;
+        else
+#ifdef PLATFORM_WINDOWS
+            dir = ".";
+#else
+            dir = "/tmp";
+#endif
+    }
+
+    std::stringstream ss;
+    ss << dir << "/seqan_sort_" << std::hex << prefix << std::dec << '_' << runNo << ".bam";
+    fileName = ss.str();
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamMergeTranslate()
+// ----------------------------------------------------------------------------
+
+// Maps a reference id of the input file to the id of the same contig in the output file.
+template <typename TInContext, typename TOutContext>
+inline int32_t
+_bamMergeTranslate(String<int32_t> & translation, int32_t rID, TInContext & inContext, TOutContext & outContext)
+{
+    if (rID < 0)
+        return rID;
+
+    while ((int32_t)length(translation) <= rID)
+    {
+        size_t inId = length(translation);
+        size_t outId = nameToId(contigNamesCache(outContext), contigNames(inContext)[inId]);
+        if (inId < length(contigLengths(inContext)))
+        {
+            if (length(contigLengths(outContext)) <= outId)
+                resize(contigLengths(outContext), outId + 1, 0);
+            contigLengths(outContext)[outId] = contigLengths(inContext)[inId];
+        }
+        appendValue(translation, (int32_t)outId);
+    }
+    return translation[rID];
+}
+
+// ----------------------------------------------------------------------------
+// Function _bamMergeContigs()
+// ----------------------------------------------------------------------------
+
+// Registers the contigs of all inputs in the output context, in the order of first appearance.
+template <typename TOutSpec, typename TInFile>
+inline void
+_bamMergeContigs(String<String<int32_t> > & translations,
+                 FormattedFile<Bam, Output, TOutSpec> & outFile,
+                 String<TInFile *> & inFiles)
+{
+    resize(translations, length(inFiles));
+    for (size_t i = 0; i < length(inFiles); ++i)
+    {
+        clear(translations[i]);
+        if (!empty(contigNames(context(*inFiles[i]))))
+            _bamMergeTranslate(translations[i], (int32_t)length(contigNames(context(*inFiles[i]))) - 1,
+                               context(*inFiles[i]), context(outFile));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _mergeBamRecords()
+// ----------------------------------------------------------------------------
+
+// Merges the sorted inputs with a heap, records of equal rank keep the order of the inputs.
+template <typename TOutSpec, typename TInFile, typename TLess>
+inline void
+_mergeBamRecords(FormattedFile<Bam, Output, TOutSpec> & outFile,
+                 String<TInFile *> & inFiles,
+                 String<String<int32_t> > & translations,
+                 TLess const & less)
+{
+    size_t numInputs = length(inFiles);
+
+    // two slots per input: the current record and the one before, to check the order of the input
+    String<BamAlignmentRecord> records;
+    resize(records, 2 * numInputs);
+    String<unsigned> current;
+    resize(current, numInputs);
+
+    auto greater = [&](unsigned a, unsigned b)
+    {
+        BamAlignmentRecord const & recA = records[current[a]];
+        BamAlignmentRecord const & recB = records[current[b]];
+        if (less(recB, recA))
+            return true;
+        if (less(recA, recB))
+            return false;
+        return a > b;
+    };
+    std::priority_queue<unsigned, std::vector<unsigned>, decltype(greater)> heap(greater);
+
+    auto readNext = [&](unsigned i)
+    {
+        BamAlignmentRecord & record = records[current[i]];
+        readRecord(record, *inFiles[i]);
+        record.rID = _bamMergeTranslate(translations[i], record.rID, context(*inFiles[i]), context(outFile));
+        record.rNextId = _bamMergeTranslate(translations[i], record.rNextId, context(*inFiles[i]), context(outFile));
+    };
+
+    for (unsigned i = 0; i < numInputs; ++i)
+    {
+        current[i] = 2 * i;
+        if (!atEnd(*inFiles[i]))
+        {
+            readNext(i);
+            heap.push(i);
+        }
+    }
+
+    while (!heap.empty())
+    {
+        unsigned i = heap.top();
+        heap.pop();
+        writeRecord(outFile, records[current[i]]);
+
+        if (atEnd(*inFiles[i]))
+            continue;
+        current[i] ^= 1;
+        readNext(i);
+        if (less(records[current[i]], records[current[i] ^ 1]))
+            SEQAN_THROW(ParseError("Input file is not sorted."));
+        heap.push(i);
+    }
+}
+
+template <typename TOutSpec, typename TInFile>
+inline void
+_mergeBamRecords(FormattedFile<Bam, Output, TOutSpec> & outFile,
+                 String<TInFile *> & inFiles,
+                 String<String<int32_t> > & translations,
+                 BamSortOrder sortOrder)
+{
+    if (sortOrder == BAM_SORT_COORDINATE)
+        _mergeBamRecords(outFile, inFiles, translations, BamAlignmentRecordCoordinateLess());
+    else
+        _mergeBamRecords(outFile, inFiles, translations, BamAlignmentRecordNameLess());
+}
+
+// ----------------------------------------------------------------------------
+// Function mergeSortedBamFiles()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn mergeSortedBamFiles
+ * @headerfile <seqan/bam_io.h>
+ * @brief Merges sorted SAM/BAM files into one sorted file.
+ *
+ * @signature void mergeSortedBamFiles(outFile, header, inFiles, sortOrder);
+ *
+ * @param[in,out] outFile   The @link BamFileOut @endlink to write to.  Its context must not be shared with the
+ *                          input files.
+ * @param[in]     header    The @link BamHeader @endlink to write, e.g. the merged headers of the inputs.  Its sort
+ *                          order is set to <tt>sortOrder</tt>.
+ * @param[in,out] inFiles   A @link String @endlink of pointers to the @link BamFileIn BamFileIns @endlink to merge.
+ *                          Their headers must have been read and each file needs its own context.
+ * @param[in]     sortOrder The order of the inputs, <tt>BAM_SORT_COORDINATE</tt> or <tt>BAM_SORT_QUERYNAME</tt>.
+ *
+ * The inputs are streamed, only one record per input is kept in memory.  The contigs of all inputs are added to the
+ * context of <tt>outFile</tt> in the order of first appearance and the reference ids of the records are translated
+ * by contig name.  Records of equal rank are written in the order of the inputs.
+ *
+ * @throw ParseError If an input is not sorted by <tt>sortOrder</tt> with respect to the output contig order.
+ */
+
+template <typename TOutSpec, typename TInFile>
+inline void
+mergeSortedBamFiles(FormattedFile<Bam, Output, TOutSpec> & outFile,
+                    BamHeader header,
+                    String<TInFile *> & inFiles,
+                    BamSortOrder sortOrder)
+{
+    String<String<int32_t> > translations;
+    _bamMergeContigs(translations, outFile, inFiles);
+    setSortOrder(header, sortOrder);
+    writeHeader(outFile, header);
+    _mergeBamRecords(outFile, inFiles, translations, sortOrder);
+}
+
+// ----------------------------------------------------------------------------
+// Function sortBamFiles()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn sortBamFiles
+ * @headerfile <seqan/bam_io.h>
+ * @brief Sorts the records of SAM/BAM files with bounded memory.
+ *
+ * @signature void sortBamFiles(outFile, header, inFiles[, options]);
+ * @signature void sortBamFiles(outFile, header, inFile[, options]);
+ *
+ * @param[in,out] outFile   The @link BamFileOut @endlink to write to.
+ * @param[in]     header    The @link BamHeader @endlink to write, its sort order is set to the one of
+ *                          <tt>options</tt>.
+ * @param[in,out] inFiles   A @link String @endlink of pointers to @link BamFileIn BamFileIns @endlink or a single
+ *                          @link BamFileIn @endlink.  Their headers must have been read and they must share the
+ *                          context of <tt>outFile</tt>.
+ * @param[in]     options   The @link BamSortOptions @endlink.
+ *
+ * The records are read in runs of up to <tt>options.maxMemory</tt> bytes.  Each run is sorted in parallel and, if
+ * the input does not fit into one run, written to a temporary BAM file.  The runs are then merged with a heap into
+ * <tt>outFile</tt> and removed.  The sort is stable, the header is written after all records are read, so contigs
+ * that are only named by SAM records are part of the output header.
+ *
+ * @throw IOError If a temporary file cannot be written.
+ */
+
+template <typename TOutSpec, typename TInFile>
+inline void
+sortBamFiles(FormattedFile<Bam, Output, TOutSpec> & outFile,
+             BamHeader header,
+             String<TInFile *> & inFiles,
+             BamSortOptions const & options)
+{
+    typedef FormattedFile<Bam, Output, TOutSpec> TOutFile;
+
+    String<BamAlignmentRecord> records;
+    String<uint32_t> order;
+    StringSet<CharString> runFileNames;
+    uint64_t runPrefix = std::random_device()();
+    runPrefix = (runPrefix << 32) ^ (uint64_t)(sysTime() * 1e6);
+
+    size_t inFileNo = 0;
+    while (true)
+    {
+        // read the next run
+        size_t numRecords = 0;
+        uint64_t memory = 0;
+        for (; inFileNo < length(inFiles); ++inFileNo)
+        {
+            TInFile & inFile = *inFiles[inFileNo];
+            while (memory < options.maxMemory && !atEnd(inFile))
+            {
+                if (numRecords == length(records))
+                    resize(records, _max((size_t)1024, 2 * numRecords));
+                readRecord(records[numRecords], inFile);
+                memory += _bamSortMemory(records[numRecords++]);
+            }
+            if (memory >= options.maxMemory)
+                break;
+        }
+        bool lastRun = true;
+        for (size_t i = inFileNo; i < length(inFiles); ++i)
+            lastRun &= atEnd(*inFiles[i]);
+
+        // sort the run, write it directly if everything fits into memory
+        _bamSortOrder(order, prefix(records, numRecords), options.sortOrder);
+        if (lastRun && empty(runFileNames))
+        {
+            setSortOrder(header, options.sortOrder);
+            writeHeader(outFile, header);
+            _writeBamRecords(outFile, prefix(records, numRecords), order);
+            return;
+        }
+
+        CharString runFileName;
+        _bamSortTempFileName(runFileName, options.tmpDir, runPrefix, length(runFileNames));
+        {
+            TOutFile runFile(context(outFile));
+            if (!open(runFile, toCString(runFileName)))
+                SEQAN_THROW(IOError("Could not open temporary file for writing."));
+            appendValue(runFileNames, runFileName);
+            writeHeader(runFile, BamHeader());
+            _writeBamRecords(runFile, prefix(records, numRecords), order);
+        }
+        if (lastRun)
+            break;
+    }
+    clear(records);
+
+    // merge the runs
+    String<BamFileIn *> runFiles;
+    resize(runFiles, length(runFileNames), (BamFileIn *)NULL);
+    BamHeader runHeader;
+    for (size_t i = 0; i < length(runFileNames); ++i)
+    {
+        runFiles[i] = new BamFileIn(toCString(runFileNames[i]));
+        readHeader(runHeader, *runFiles[i]);
+    }
+
+    String<String<int32_t> > translations;
+    _bamMergeContigs(translations, outFile, runFiles);
+    setSortOrder(header, options.sortOrder);
+    writeHeader(outFile, header);
+    _mergeBamRecords(outFile, runFiles, translations, options.sortOrder);
+
+    for (size_t i = 0; i < length(runFileNames); ++i)
+    {
+        delete runFiles[i];
+        std::remove(toCString(runFileNames[i]));
+    }
+}
+
+template <typename TOutSpec, typename TInFile>
+inline void
+sortBamFiles(FormattedFile<Bam, Output, TOutSpec> & outFile,
+             BamHeader const & header,
+             String<TInFile *> & inFiles)
+{
+    sortBamFiles(outFile, header, inFiles, BamSortOptions());
+}
+
+template <typename TOutSpec, typename TInSpec>
+inline void
+sortBamFiles(FormattedFile<Bam, Output, TOutSpec> & outFile,
+             BamHeader const & header,
+             FormattedFile<Bam, Input, TInSpec> & inFile,
+             BamSortOptions const & options)
+{
+    String<FormattedFile<Bam, Input, TInSpec> *> inFiles;
+    appendValue(inFiles, &inFile);
+    sortBamFiles(outFile, header, inFiles, options);
+}
+
+template <typename TOutSpec, typename TInSpec>
+inline void
+sortBamFiles(FormattedFile<Bam, Output, TOutSpec> & outFile,
+             BamHeader const & header,
+             FormattedFile<Bam, Input, TInSpec> & inFile)
+{
+    sortBamFiles(outFile, header, inFile, BamSortOptions());
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_BAM_SORT_H_
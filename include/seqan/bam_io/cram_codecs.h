@@ -0,0 +1,1146 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Low-level building blocks of the CRAM 3.0 format: ITF8/LTF8 integers,
+// blocks and their compression methods (raw, gzip, bzip2, rANS 4x8), the bit
+// and byte codecs used for the data series and the MD5 checksum of reference
+// slices.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_CRAM_CODECS_H_
+#define INCLUDE_SEQAN_BAM_IO_CRAM_CODECS_H_
+
+#include <cstring>
+#include <map>
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// Compression methods of a CRAM block.
+enum CramBlockMethod_
+{
+    CRAM_METHOD_RAW       = 0,
+    CRAM_METHOD_GZIP      = 1,
+    CRAM_METHOD_BZIP2     = 2,
+    CRAM_METHOD_LZMA      = 3,
+    CRAM_METHOD_RANS4X8   = 4
+};
+
+// Content types of a CRAM block.
+enum CramContentType_
+{
+    CRAM_CONTENT_FILE_HEADER        = 0,
+    CRAM_CONTENT_COMPRESSION_HEADER = 1,
+    CRAM_CONTENT_SLICE_HEADER       = 2,
+    CRAM_CONTENT_EXTERNAL           = 4,
+    CRAM_CONTENT_CORE               = 5
+};
+
+// Codec ids used in the encoding maps of the compression header.
+enum CramCodecId_
+{
+    CRAM_CODEC_NULL             = 0,
+    CRAM_CODEC_EXTERNAL         = 1,
+    CRAM_CODEC_GOLOMB           = 2,
+    CRAM_CODEC_HUFFMAN          = 3,
+    CRAM_CODEC_BYTE_ARRAY_LEN   = 4,
+    CRAM_CODEC_BYTE_ARRAY_STOP  = 5,
+    CRAM_CODEC_BETA             = 6,
+    CRAM_CODEC_SUBEXP           = 7,
+    CRAM_CODEC_GOLOMB_RICE      = 8,
+    CRAM_CODEC_GAMMA            = 9
+};
+
+// The data series of CRAM 3.0, their two-letter keys are given by _cramDataSeriesKey().
+enum CramDataSeries_
+{
+    CRAM_DS_BF, CRAM_DS_CF, CRAM_DS_RI, CRAM_DS_RL, CRAM_DS_AP, CRAM_DS_RG, CRAM_DS_RN, CRAM_DS_MF,
+    CRAM_DS_NS, CRAM_DS_NP, CRAM_DS_TS, CRAM_DS_NF, CRAM_DS_TL, CRAM_DS_FN, CRAM_DS_FC, CRAM_DS_FP,
+    CRAM_DS_DL, CRAM_DS_BB, CRAM_DS_QQ, CRAM_DS_BS, CRAM_DS_IN, CRAM_DS_RS, CRAM_DS_PD, CRAM_DS_HC,
+    CRAM_DS_SC, CRAM_DS_MQ, CRAM_DS_BA, CRAM_DS_QS, CRAM_DS_TC, CRAM_DS_TN,
+    CRAM_DS_COUNT
+};
+
+// ----------------------------------------------------------------------------
+// Class CramBlock_
+// ----------------------------------------------------------------------------
+
+// A CRAM block, data always holds the uncompressed content.  pos is the read
+// cursor used when the block is consumed as an external block.
+
+struct CramBlock_
+{
+    unsigned char   method;
+    unsigned char   contentType;
+    int32_t         contentId;
+    CharString      data;
+    size_t          pos;
+
+    CramBlock_() : method(CRAM_METHOD_RAW), contentType(CRAM_CONTENT_EXTERNAL), contentId(0), pos(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class CramEncoding_
+// ----------------------------------------------------------------------------
+
+// Parameters of one encoding from the compression header.  Byte array codecs
+// refer to their sub-encodings by index into the encoding pool of the header.
+
+struct CramEncoding_
+{
+    int32_t         codec;
+    int32_t         contentId;      // EXTERNAL, BYTE_ARRAY_STOP
+    unsigned char   stopByte;       // BYTE_ARRAY_STOP
+    int32_t         offset;         // BETA, SUBEXP, GAMMA
+    int32_t         param;          // BETA: number of bits, SUBEXP: k
+    unsigned        lenEncoding;    // BYTE_ARRAY_LEN
+    unsigned        valEncoding;    // BYTE_ARRAY_LEN
+
+    // Canonical HUFFMAN code, symbols sorted by (code length, symbol).
+    String<int32_t> symbols;
+    String<int32_t> codeLens;
+    int32_t         firstCode[33];
+    int32_t         firstIndex[33];
+    int32_t         lenCount[33];
+
+    CramEncoding_() :
+        codec(CRAM_CODEC_NULL), contentId(0), stopByte(0), offset(0), param(0), lenEncoding(0), valEncoding(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class CramBitReader_
+// ----------------------------------------------------------------------------
+
+// Reads the core block MSB first.
+
+struct CramBitReader_
+{
+    unsigned char const * data;
+    size_t                length;
+    size_t                bytePos;
+    int                   bitPos;
+
+    CramBitReader_() : data(NULL), length(0), bytePos(0), bitPos(7)
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _cramDataSeriesKey()
+// ----------------------------------------------------------------------------
+
+inline int32_t
+_cramDataSeriesKey(int ds)
+{
+    static char const KEYS[] = "BFCFRIRLAPRGRNMFNSNPTSNFTLFNFCFPDLBBQQBSINRSPDHCSCMQBAQSTCTN";
+    return ((int32_t)KEYS[2 * ds] << 8) | (unsigned char)KEYS[2 * ds + 1];
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramLoadLE32()
+// ----------------------------------------------------------------------------
+
+inline uint32_t
+_cramLoadLE32(unsigned char const * p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+template <typename TTarget>
+inline void
+_cramWriteLE32(TTarget & target, uint32_t val)
+{
+    writeValue(target, (char)(val & 0xff));
+    writeValue(target, (char)((val >> 8) & 0xff));
+    writeValue(target, (char)((val >> 16) & 0xff));
+    writeValue(target, (char)((val >> 24) & 0xff));
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramReadItf8()
+// ----------------------------------------------------------------------------
+
+// Number of bytes of an ITF8 value given its first byte.
+inline unsigned
+_cramItf8Size(unsigned char b0)
+{
+    if (b0 < 0x80)
+        return 1;
+    if (b0 < 0xc0)
+        return 2;
+    if (b0 < 0xe0)
+        return 3;
+    if (b0 < 0xf0)
+        return 4;
+    return 5;
+}
+
+inline void
+_cramReadItf8(int32_t & val, char const * & it, char const * itEnd)
+{
+    if (SEQAN_UNLIKELY(it == itEnd))
+        SEQAN_THROW(ParseError("CRAM: unexpected end of ITF8 value."));
+    unsigned char const * p = reinterpret_cast<unsigned char const *>(it);
+    unsigned n = _cramItf8Size(p[0]);
+    if (SEQAN_UNLIKELY(itEnd - it < (std::ptrdiff_t)n))
+        SEQAN_THROW(ParseError("CRAM: unexpected end of ITF8 value."));
+
+    uint32_t v;
+    switch (n)
+    {
+        case 1: v = p[0]; break;
+        case 2: v = ((uint32_t)(p[0] & 0x3f) << 8) | p[1]; break;
+        case 3: v = ((uint32_t)(p[0] & 0x1f) << 16) | ((uint32_t)p[1] << 8) | p[2]; break;
+        case 4: v = ((uint32_t)(p[0] & 0x0f) << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]; break;
+        default:
+            v = ((uint32_t)(p[0] & 0x0f) << 28) | ((uint32_t)p[1] << 20) | ((uint32_t)p[2] << 12) |
+                ((uint32_t)p[3] << 4) | (p[4] & 0x0f);
+    }
+    val = (int32_t)v;
+    it += n;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramReadLtf8()
+// ----------------------------------------------------------------------------
+
+inline void
+_cramReadLtf8(int64_t & val, char const * & it, char const * itEnd)
+{
+    if (SEQAN_UNLIKELY(it == itEnd))
+        SEQAN_THROW(ParseError("CRAM: unexpected end of LTF8 value."));
+    unsigned char b0 = *it;
+    unsigned n = 1;
+    while (n < 9 && (b0 & (0x80 >> (n - 1))))
+        ++n;
+    if (SEQAN_UNLIKELY(itEnd - it < (std::ptrdiff_t)n))
+        SEQAN_THROW(ParseError("CRAM: unexpected end of LTF8 value."));
+
+    // The first byte contributes its bits below the length prefix.
+    uint64_t v = (n < 8) ? (b0 & (0x7f >> (n - 1))) : 0;
+    for (unsigned i = 1; i < n; ++i)
+        v = (v << 8) | (unsigned char)it[i];
+    val = (int64_t)v;
+    it += n;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramWriteItf8()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget>
+inline void
+_cramWriteItf8(TTarget & target, int32_t val)
+{
+    uint32_t v = (uint32_t)val;
+    if (!(v & ~0x7fu))
+    {
+        writeValue(target, (char)v);
+    }
+    else if (!(v & ~0x3fffu))
+    {
+        writeValue(target, (char)(0x80 | (v >> 8)));
+        writeValue(target, (char)(v & 0xff));
+    }
+    else if (!(v & ~0x1fffffu))
+    {
+        writeValue(target, (char)(0xc0 | (v >> 16)));
+        writeValue(target, (char)((v >> 8) & 0xff));
+        writeValue(target, (char)(v & 0xff));
+    }
+    else if (!(v & ~0xfffffffu))
+    {
+        writeValue(target, (char)(0xe0 | (v >> 24)));
+        writeValue(target, (char)((v >> 16) & 0xff));
+        writeValue(target, (char)((v >> 8) & 0xff));
+        writeValue(target, (char)(v & 0xff));
+    }
+    else
+    {
+        writeValue(target, (char)(0xf0 | (v >> 28)));
+        writeValue(target, (char)((v >> 20) & 0xff));
+        writeValue(target, (char)((v >> 12) & 0xff));
+        writeValue(target, (char)((v >> 4) & 0xff));
+        writeValue(target, (char)(v & 0x0f));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramWriteLtf8()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget>
+inline void
+_cramWriteLtf8(TTarget & target, int64_t val)
+{
+    uint64_t v = (uint64_t)val;
+    unsigned n = 1;
+    // n bytes hold 7 * n bits for n < 8, 56 bits for n = 8 and 64 bits for n = 9.
+    while (n < 9 && (n < 8 ? (v >> (7 * n)) != 0 : (n == 8 && (v >> 56) != 0)))
+        ++n;
+
+    unsigned char prefix = (unsigned char)(0xff00 >> (n - 1));
+    if (n < 8)
+        writeValue(target, (char)(prefix | (unsigned char)(v >> (8 * (n - 1)))));
+    else
+        writeValue(target, (char)prefix);
+    for (unsigned i = n - 1; i > 0; --i)
+        writeValue(target, (char)((v >> (8 * (i - 1))) & 0xff));
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramReadInt32()
+// ----------------------------------------------------------------------------
+
+inline void
+_cramReadInt32(int32_t & val, char const * & it, char const * itEnd)
+{
+    if (SEQAN_UNLIKELY(itEnd - it < 4))
+        SEQAN_THROW(ParseError("CRAM: unexpected end of data."));
+    val = (int32_t)_cramLoadLE32(reinterpret_cast<unsigned char const *>(it));
+    it += 4;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramCrc32()
+// ----------------------------------------------------------------------------
+
+inline uint32_t
+_cramCrc32(uint32_t crc, char const * data, size_t len)
+{
+    return crc32(crc, reinterpret_cast<Bytef const *>(data), len);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramGzipCompress()
+// ----------------------------------------------------------------------------
+
+inline void
+_cramGzipCompress(CharString & out, CharString const & in, int level = 5)
+{
+    z_stream zs;
+    std::memset(&zs, 0, sizeof(zs));
+    // windowBits 15 + 16 writes a gzip wrapper as required by the CRAM specification.
+    if (deflateInit2(&zs, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        SEQAN_THROW(IOError("CRAM: could not initialize gzip compression."));
+
+    resize(out, deflateBound(&zs, length(in)) + 32, Exact());
+    zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(begin(in, Standard())));
+    zs.avail_in = length(in);
+    zs.next_out = reinterpret_cast<Bytef *>(begin(out, Standard()));
+    zs.avail_out = length(out);
+    int ret = deflate(&zs, Z_FINISH);
+    size_t written = zs.total_out;
+    deflateEnd(&zs);
+    if (ret != Z_STREAM_END)
+        SEQAN_THROW(IOError("CRAM: gzip compression failed."));
+    resize(out, written);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramGzipUncompress()
+// ----------------------------------------------------------------------------
+
+inline void
+_cramGzipUncompress(CharString & out, char const * in, size_t inLen, size_t rawSize)
+{
+    resize(out, rawSize, Exact());
+    if (rawSize == 0)
+        return;
+
+    z_stream zs;
+    std::memset(&zs, 0, sizeof(zs));
+    // 15 + 32 accepts both gzip and zlib wrappers.
+    if (inflateInit2(&zs, 15 + 32) != Z_OK)
+        SEQAN_THROW(IOError("CRAM: could not initialize gzip decompression."));
+
+    zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(in));
+    zs.avail_in = inLen;
+    zs.next_out = reinterpret_cast<Bytef *>(begin(out, Standard()));
+    zs.avail_out = rawSize;
+    int ret = inflate(&zs, Z_FINISH);
+    size_t written = zs.total_out;
+    inflateEnd(&zs);
+    if ((ret != Z_STREAM_END && ret != Z_OK && ret != Z_BUF_ERROR) || written != rawSize)
+        SEQAN_THROW(ParseError("CRAM: corrupt gzip block."));
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramBzip2Uncompress()
+// ----------------------------------------------------------------------------
+
+inline void
+_cramBzip2Uncompress(CharString & out, char const * in, size_t inLen, size_t rawSize)
+{
+#if SEQAN_HAS_BZIP2
+    resize(out, rawSize, Exact());
+    if (rawSize == 0)
+        return;
+    unsigned int destLen = rawSize;
+    int ret = BZ2_bzBuffToBuffDecompress(begin(out, Standard()), &destLen, const_cast<char *>(in), inLen, 0, 0);
+    if (ret != BZ_OK || destLen != rawSize)
+        SEQAN_THROW(ParseError("CRAM: corrupt bzip2 block."));
+#else
+    (void)out;
+    (void)in;
+    (void)inLen;
+    (void)rawSize;
+    SEQAN_THROW(ParseError("CRAM: bzip2 compressed blocks require SeqAn to be built with BZIP2 support."));
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramRansReadFreqs()
+// ----------------------------------------------------------------------------
+
+// Reads a run-length encoded rANS frequency table (shared by order 0 and the
+// inner tables of order 1).  lookup receives 4096 slots.
+inline void
+_cramRansReadFreqs(uint32_t * freq, uint32_t * start, unsigned char * lookup,
+                   unsigned char const * & p, unsigned char const * pEnd)
+{
+    std::memset(freq, 0, 256 * sizeof(uint32_t));
+    if (p >= pEnd)
+        SEQAN_THROW(ParseError("CRAM: truncated rANS frequency table."));
+
+    unsigned rle = 0;
+    unsigned x = 0;
+    unsigned j = *p++;
+    do
+    {
+        if (pEnd - p < 3)
+            SEQAN_THROW(ParseError("CRAM: truncated rANS frequency table."));
+        unsigned f = *p++;
+        if (f >= 128)
+            f = ((f & 127) << 8) | *p++;
+        if (f == 0)
+            f = 4096;
+        if (x + f > 4096)
+            SEQAN_THROW(ParseError("CRAM: invalid rANS frequency table."));
+        freq[j] = f;
+        start[j] = x;
+        std::memset(lookup + x, (int)j, f);
+        x += f;
+
+        if (!rle && j + 1 == *p)
+        {
+            j = *p++;
+            rle = *p++;
+        }
+        else if (rle)
+        {
+            --rle;
+            if (++j > 255)
+                SEQAN_THROW(ParseError("CRAM: invalid rANS frequency table."));
+        }
+        else
+        {
+            j = *p++;
+        }
+    }
+    while (j);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramRansUncompress()
+// ----------------------------------------------------------------------------
+
+inline void
+_cramRansRenorm(uint32_t & r, unsigned char const * & p, unsigned char const * pEnd)
+{
+    while (r < (1u << 23))
+    {
+        if (SEQAN_UNLIKELY(p >= pEnd))
+            SEQAN_THROW(ParseError("CRAM: truncated rANS stream."));
+        r = (r << 8) | *p++;
+    }
+}
+
+inline void
+_cramRansUncompress(CharString & out, char const * in, size_t inLen)
+{
+    if (inLen < 9)
+        SEQAN_THROW(ParseError("CRAM: truncated rANS block."));
+    unsigned char const * p = reinterpret_cast<unsigned char const *>(in);
+    unsigned char const * pEnd = p + inLen;
+    unsigned order = p[0];
+    uint32_t outSize = _cramLoadLE32(p + 5);
+    p += 9;
+
+    resize(out, outSize, Exact());
+    if (outSize == 0)
+        return;
+    unsigned char * o = reinterpret_cast<unsigned char *>(begin(out, Standard()));
+    uint32_t r[4];
+
+    if (order == 0)
+    {
+        uint32_t freq[256], start[256];
+        unsigned char lookup[4096];
+        _cramRansReadFreqs(freq, start, lookup, p, pEnd);
+
+        if (pEnd - p < 16)
+            SEQAN_THROW(ParseError("CRAM: truncated rANS block."));
+        for (unsigned k = 0; k < 4; ++k, p += 4)
+            r[k] = _cramLoadLE32(p);
+
+        uint32_t outEnd = outSize & ~3u;
+        for (uint32_t i = 0; i < outEnd; i += 4)
+        {
+            for (unsigned k = 0; k < 4; ++k)
+            {
+                uint32_t m = r[k] & 4095;
+                unsigned char c = lookup[m];
+                o[i + k] = c;
+                r[k] = freq[c] * (r[k] >> 12) + m - start[c];
+            }
+            for (unsigned k = 0; k < 4; ++k)
+                _cramRansRenorm(r[k], p, pEnd);
+        }
+        // The remaining symbols are read from the states without renormalisation.
+        for (uint32_t k = 0; outEnd + k < outSize; ++k)
+            o[outEnd + k] = lookup[r[k] & 4095];
+    }
+    else if (order == 1)
+    {
+        String<uint32_t> freqs, starts;
+        String<unsigned char> lookups;
+        resize(freqs, 256 * 256, 0, Exact());
+        resize(starts, 256 * 256, 0, Exact());
+        resize(lookups, 256 * 4096, 0, Exact());
+        uint32_t * freq = begin(freqs, Standard());
+        uint32_t * start = begin(starts, Standard());
+        unsigned char * lookup = begin(lookups, Standard());
+
+        if (p >= pEnd)
+            SEQAN_THROW(ParseError("CRAM: truncated rANS frequency table."));
+        unsigned rleI = 0;
+        unsigned i = *p++;
+        do
+        {
+            _cramRansReadFreqs(freq + 256 * i, start + 256 * i, lookup + 4096 * i, p, pEnd);
+            if (pEnd - p < 2)
+                SEQAN_THROW(ParseError("CRAM: truncated rANS frequency table."));
+            if (!rleI && i + 1 == *p)
+            {
+                i = *p++;
+                rleI = *p++;
+            }
+            else if (rleI)
+            {
+                --rleI;
+                if (++i > 255)
+                    SEQAN_THROW(ParseError("CRAM: invalid rANS frequency table."));
+            }
+            else
+            {
+                i = *p++;
+            }
+        }
+        while (i);
+
+        if (pEnd - p < 16)
+            SEQAN_THROW(ParseError("CRAM: truncated rANS block."));
+        for (unsigned k = 0; k < 4; ++k, p += 4)
+            r[k] = _cramLoadLE32(p);
+
+        // The output is split into 4 interleaved quarters, each with its own context.
+        uint32_t quarter = outSize >> 2;
+        uint32_t pos[4] = { 0, quarter, 2 * quarter, 3 * quarter };
+        unsigned char ctx[4] = { 0, 0, 0, 0 };
+        for (; pos[0] < quarter; ++pos[0], ++pos[1], ++pos[2], ++pos[3])
+        {
+            for (unsigned k = 0; k < 4; ++k)
+            {
+                uint32_t m = r[k] & 4095;
+                unsigned char c = lookup[4096 * ctx[k] + m];
+                o[pos[k]] = c;
+                r[k] = freq[256 * ctx[k] + c] * (r[k] >> 12) + m - start[256 * ctx[k] + c];
+                ctx[k] = c;
+            }
+            for (unsigned k = 0; k < 4; ++k)
+                _cramRansRenorm(r[k], p, pEnd);
+        }
+        for (; pos[3] < outSize; ++pos[3])
+        {
+            uint32_t m = r[3] & 4095;
+            unsigned char c = lookup[4096 * ctx[3] + m];
+            o[pos[3]] = c;
+            r[3] = freq[256 * ctx[3] + c] * (r[3] >> 12) + m - start[256 * ctx[3] + c];
+            ctx[3] = c;
+            _cramRansRenorm(r[3], p, pEnd);
+        }
+    }
+    else
+    {
+        SEQAN_THROW(ParseError("CRAM: unsupported rANS order."));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramRansCompress()
+// ----------------------------------------------------------------------------
+
+// Order-0 rANS 4x8 compression, the variant htslib uses for quality scores.
+
+inline void
+_cramRansCompress(CharString & out, CharString const & in)
+{
+    unsigned char const * src = reinterpret_cast<unsigned char const *>(begin(in, Standard()));
+    uint32_t inSize = length(in);
+
+    // Count and normalise the frequencies to a total of 4096.
+    uint32_t freq[256];
+    std::memset(freq, 0, sizeof(freq));
+    for (uint32_t i = 0; i < inSize; ++i)
+        ++freq[src[i]];
+
+    if (inSize > 0)
+    {
+        uint64_t total = 0;
+        unsigned maxSym = 0;
+        for (unsigned j = 0; j < 256; ++j)
+        {
+            if (!freq[j])
+                continue;
+            uint32_t f = (uint32_t)(((uint64_t)freq[j] * 4096) / inSize);
+            freq[j] = f ? f : 1;
+            total += freq[j];
+            if (freq[j] > freq[maxSym])
+                maxSym = j;
+        }
+        // Adjust the most frequent symbol, steal from others if necessary.
+        while (total != 4096)
+        {
+            if (total < 4096)
+            {
+                freq[maxSym] += 4096 - total;
+                total = 4096;
+            }
+            else
+            {
+                uint64_t excess = total - 4096;
+                if (freq[maxSym] > excess)
+                {
+                    freq[maxSym] -= excess;
+                    total = 4096;
+                }
+                else
+                {
+                    for (unsigned j = 0; j < 256 && total > 4096; ++j)
+                        if (freq[j] > 1)
+                        {
+                            --freq[j];
+                            --total;
+                        }
+                }
+            }
+        }
+    }
+
+    uint32_t start[256];
+    for (unsigned j = 0, x = 0; j < 256; ++j)
+    {
+        start[j] = x;
+        x += freq[j];
+    }
+
+    clear(out);
+    // Header: order, compressed size (patched below), raw size.
+    appendValue(out, '\0');
+    _cramWriteLE32(out, 0);
+    _cramWriteLE32(out, inSize);
+
+    // Frequency table with run-length encoding of consecutive symbols.
+    unsigned rle = 0;
+    for (unsigned j = 0; j < 256; ++j)
+    {
+        if (!freq[j])
+            continue;
+        if (rle)
+        {
+            --rle;
+        }
+        else
+        {
+            appendValue(out, (char)j);
+            if (j > 0 && freq[j - 1])
+            {
+                for (rle = j + 1; rle < 256 && freq[rle]; ++rle) {}
+                rle -= j + 1;
+                appendValue(out, (char)rle);
+            }
+        }
+        if (freq[j] < 128)
+        {
+            appendValue(out, (char)freq[j]);
+        }
+        else
+        {
+            appendValue(out, (char)(128 | (freq[j] >> 8)));
+            appendValue(out, (char)(freq[j] & 0xff));
+        }
+    }
+    appendValue(out, '\0');
+
+    // Encode backwards into a temporary buffer that grows towards the front.
+    String<unsigned char> buf;
+    resize(buf, inSize + inSize / 4 + 64, Exact());
+    unsigned char * bufEnd = end(buf, Standard());
+    unsigned char * ptr = bufEnd;
+    uint32_t r[4] = { 1u << 23, 1u << 23, 1u << 23, 1u << 23 };
+
+    auto encode = [&](uint32_t & state, unsigned char s)
+    {
+        uint32_t xMax = ((1u << 23) >> 12 << 8) * freq[s];
+        while (state >= xMax)
+        {
+            *--ptr = (unsigned char)(state & 0xff);
+            state >>= 8;
+        }
+        state = ((state / freq[s]) << 12) + (state % freq[s]) + start[s];
+    };
+
+    uint32_t i = inSize;
+    switch (inSize & 3)
+    {
+        case 3: encode(r[2], src[i - (inSize & 3) + 2]); SEQAN_FALLTHROUGH
+        case 2: encode(r[1], src[i - (inSize & 3) + 1]); SEQAN_FALLTHROUGH
+        case 1: encode(r[0], src[i - (inSize & 3)]); SEQAN_FALLTHROUGH
+        case 0: break;
+    }
+    for (i = inSize & ~3u; i > 0; i -= 4)
+    {
+        encode(r[3], src[i - 1]);
+        encode(r[2], src[i - 2]);
+        encode(r[1], src[i - 3]);
+        encode(r[0], src[i - 4]);
+    }
+    for (int k = 3; k >= 0; --k)
+    {
+        *--ptr = (unsigned char)(r[k] >> 24);
+        *--ptr = (unsigned char)(r[k] >> 16);
+        *--ptr = (unsigned char)(r[k] >> 8);
+        *--ptr = (unsigned char)(r[k]);
+    }
+
+    size_t tableEnd = length(out);
+    resize(out, tableEnd + (bufEnd - ptr));
+    std::memcpy(begin(out, Standard()) + tableEnd, ptr, bufEnd - ptr);
+    uint32_t compSize = length(out) - 9;
+    for (unsigned k = 0; k < 4; ++k)
+        out[1 + k] = (char)((compSize >> (8 * k)) & 0xff);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramMd5()
+// ----------------------------------------------------------------------------
+
+// MD5 (RFC 1321) of the upper-case reference span covered by a slice.
+
+inline void
+_cramMd5(unsigned char digest[16], char const * data, size_t len)
+{
+    static uint32_t const K[64] =
+    {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+    };
+    static unsigned const S[64] =
+    {
+        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+    };
+
+    uint32_t h[4] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+    unsigned char const * src = reinterpret_cast<unsigned char const *>(data);
+    uint64_t bitLen = (uint64_t)len * 8;
+    size_t nBlocks = (len + 8) / 64 + 1;
+
+    for (size_t b = 0; b < nBlocks; ++b)
+    {
+        // Assemble the block, appending the padding and the length where necessary.
+        unsigned char block[64];
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            size_t idx = b * 64 + i;
+            if (idx < len)
+                block[i] = src[idx];
+            else if (idx == len)
+                block[i] = 0x80;
+            else
+                block[i] = 0;
+        }
+        if (b + 1 == nBlocks)
+            for (unsigned i = 0; i < 8; ++i)
+                block[56 + i] = (unsigned char)(bitLen >> (8 * i));
+
+        uint32_t m[16];
+        for (unsigned i = 0; i < 16; ++i)
+            m[i] = _cramLoadLE32(block + 4 * i);
+
+        uint32_t a = h[0], bb = h[1], c = h[2], d = h[3];
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            uint32_t f;
+            unsigned g;
+            if (i < 16)
+            {
+                f = (bb & c) | (~bb & d);
+                g = i;
+            }
+            else if (i < 32)
+            {
+                f = (d & bb) | (~d & c);
+                g = (5 * i + 1) & 15;
+            }
+            else if (i < 48)
+            {
+                f = bb ^ c ^ d;
+                g = (3 * i + 5) & 15;
+            }
+            else
+            {
+                f = c ^ (bb | ~d);
+                g = (7 * i) & 15;
+            }
+            f += a + K[i] + m[g];
+            a = d;
+            d = c;
+            c = bb;
+            bb += (f << S[i]) | (f >> (32 - S[i]));
+        }
+        h[0] += a;
+        h[1] += bb;
+        h[2] += c;
+        h[3] += d;
+    }
+
+    for (unsigned i = 0; i < 4; ++i)
+        for (unsigned k = 0; k < 4; ++k)
+            digest[4 * i + k] = (unsigned char)(h[i] >> (8 * k));
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramReadBlock()
+// ----------------------------------------------------------------------------
+
+// Parses a block from memory, verifies its CRC32 and stores the uncompressed content.
+
+inline void
+_cramReadBlock(CramBlock_ & block, char const * & it, char const * itEnd)
+{
+    char const * blockBegin = it;
+    if (itEnd - it < 2)
+        SEQAN_THROW(ParseError("CRAM: truncated block."));
+    block.method = *it++;
+    block.contentType = *it++;
+    int32_t compSize, rawSize;
+    _cramReadItf8(block.contentId, it, itEnd);
+    _cramReadItf8(compSize, it, itEnd);
+    _cramReadItf8(rawSize, it, itEnd);
+    if (compSize < 0 || rawSize < 0 || itEnd - it < (std::ptrdiff_t)compSize + 4)
+        SEQAN_THROW(ParseError("CRAM: truncated block."));
+
+    char const * payload = it;
+    it += compSize;
+    int32_t crc;
+    char const * crcPos = it;
+    _cramReadInt32(crc, it, itEnd);
+    if ((uint32_t)crc != _cramCrc32(crc32(0L, Z_NULL, 0), blockBegin, crcPos - blockBegin))
+        SEQAN_THROW(ParseError("CRAM: block CRC32 mismatch."));
+
+    block.pos = 0;
+    switch (block.method)
+    {
+        case CRAM_METHOD_RAW:
+            if (compSize != rawSize)
+                SEQAN_THROW(ParseError("CRAM: invalid raw block size."));
+            resize(block.data, compSize, Exact());
+            std::memcpy(begin(block.data, Standard()), payload, compSize);
+            break;
+        case CRAM_METHOD_GZIP:
+            _cramGzipUncompress(block.data, payload, compSize, rawSize);
+            break;
+        case CRAM_METHOD_BZIP2:
+            _cramBzip2Uncompress(block.data, payload, compSize, rawSize);
+            break;
+        case CRAM_METHOD_RANS4X8:
+            _cramRansUncompress(block.data, payload, compSize);
+            if ((int32_t)length(block.data) != rawSize)
+                SEQAN_THROW(ParseError("CRAM: invalid rANS block size."));
+            break;
+        default:
+            SEQAN_THROW(ParseError("CRAM: unsupported block compression method (only raw, gzip, bzip2 and rANS "
+                                   "4x8 are supported)."));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramWriteBlock()
+// ----------------------------------------------------------------------------
+
+// Compresses data with the preferred method (falling back to raw when that is
+// not smaller) and appends the block including its CRC32 to target.
+
+inline void
+_cramWriteBlock(CharString & target, CharString const & data, unsigned char contentType, int32_t contentId,
+                unsigned char method = CRAM_METHOD_GZIP)
+{
+    CharString compressed;
+    if (length(data) < 32)
+        method = CRAM_METHOD_RAW;
+    if (method == CRAM_METHOD_GZIP)
+        _cramGzipCompress(compressed, data);
+    else if (method == CRAM_METHOD_RANS4X8)
+        _cramRansCompress(compressed, data);
+    if (method != CRAM_METHOD_RAW && length(compressed) >= length(data))
+        method = CRAM_METHOD_RAW;
+    CharString const & payload = (method == CRAM_METHOD_RAW) ? data : compressed;
+
+    size_t blockBegin = length(target);
+    appendValue(target, (char)method);
+    appendValue(target, (char)contentType);
+    _cramWriteItf8(target, contentId);
+    _cramWriteItf8(target, (int32_t)length(payload));
+    _cramWriteItf8(target, (int32_t)length(data));
+    append(target, payload);
+    uint32_t crc = _cramCrc32(crc32(0L, Z_NULL, 0), begin(target, Standard()) + blockBegin,
+                              length(target) - blockBegin);
+    _cramWriteLE32(target, crc);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramReadBit()
+// ----------------------------------------------------------------------------
+
+inline unsigned
+_cramReadBit(CramBitReader_ & reader)
+{
+    if (SEQAN_UNLIKELY(reader.bytePos >= reader.length))
+        SEQAN_THROW(ParseError("CRAM: unexpected end of core block."));
+    unsigned bit = (reader.data[reader.bytePos] >> reader.bitPos) & 1;
+    if (--reader.bitPos < 0)
+    {
+        reader.bitPos = 7;
+        ++reader.bytePos;
+    }
+    return bit;
+}
+
+inline uint32_t
+_cramReadBits(CramBitReader_ & reader, int n)
+{
+    uint32_t val = 0;
+    for (int i = 0; i < n; ++i)
+        val = (val << 1) | _cramReadBit(reader);
+    return val;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramInitHuffman()
+// ----------------------------------------------------------------------------
+
+// Computes the canonical code from the symbols and code lengths read from the
+// compression header.
+
+inline void
+_cramInitHuffman(CramEncoding_ & enc)
+{
+    unsigned n = length(enc.symbols);
+    if (n != length(enc.codeLens))
+        SEQAN_THROW(ParseError("CRAM: invalid HUFFMAN encoding."));
+
+    // Sort by (code length, symbol) which yields the canonical order.
+    String<std::pair<int32_t, int32_t> > sorted;
+    resize(sorted, n, Exact());
+    for (unsigned i = 0; i < n; ++i)
+    {
+        if (enc.codeLens[i] < 0 || enc.codeLens[i] > 32)
+            SEQAN_THROW(ParseError("CRAM: invalid HUFFMAN code length."));
+        sorted[i] = std::make_pair(enc.codeLens[i], enc.symbols[i]);
+    }
+    std::sort(begin(sorted, Standard()), end(sorted, Standard()));
+    for (unsigned i = 0; i < n; ++i)
+    {
+        enc.codeLens[i] = sorted[i].first;
+        enc.symbols[i] = sorted[i].second;
+    }
+
+    for (unsigned l = 0; l <= 32; ++l)
+    {
+        enc.lenCount[l] = 0;
+        enc.firstCode[l] = 0;
+        enc.firstIndex[l] = 0;
+    }
+    int32_t code = 0;
+    int32_t prevLen = 0;
+    for (unsigned i = 0; i < n; ++i)
+    {
+        int32_t len = enc.codeLens[i];
+        if (i > 0)
+            code = (code + 1) << (len - prevLen);
+        if (enc.lenCount[len]++ == 0)
+        {
+            enc.firstCode[len] = code;
+            enc.firstIndex[len] = i;
+        }
+        prevLen = len;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramReadEncoding()
+// ----------------------------------------------------------------------------
+
+// Parses one encoding description, appends it (and nested encodings) to pool
+// and returns its index.
+
+inline unsigned
+_cramReadEncoding(String<CramEncoding_> & pool, char const * & it, char const * itEnd)
+{
+    CramEncoding_ enc;
+    int32_t paramLen;
+    _cramReadItf8(enc.codec, it, itEnd);
+    _cramReadItf8(paramLen, it, itEnd);
+    if (paramLen < 0 || itEnd - it < paramLen)
+        SEQAN_THROW(ParseError("CRAM: truncated encoding."));
+    char const * pEnd = it + paramLen;
+
+    switch (enc.codec)
+    {
+        case CRAM_CODEC_NULL:
+            break;
+        case CRAM_CODEC_EXTERNAL:
+            _cramReadItf8(enc.contentId, it, pEnd);
+            break;
+        case CRAM_CODEC_HUFFMAN:
+        {
+            int32_t n, val;
+            _cramReadItf8(n, it, pEnd);
+            for (int32_t i = 0; i < n; ++i)
+            {
+                _cramReadItf8(val, it, pEnd);
+                appendValue(enc.symbols, val);
+            }
+            _cramReadItf8(n, it, pEnd);
+            for (int32_t i = 0; i < n; ++i)
+            {
+                _cramReadItf8(val, it, pEnd);
+                appendValue(enc.codeLens, val);
+            }
+            _cramInitHuffman(enc);
+            break;
+        }
+        case CRAM_CODEC_BYTE_ARRAY_LEN:
+            enc.lenEncoding = _cramReadEncoding(pool, it, pEnd);
+            enc.valEncoding = _cramReadEncoding(pool, it, pEnd);
+            break;
+        case CRAM_CODEC_BYTE_ARRAY_STOP:
+            if (it == pEnd)
+                SEQAN_THROW(ParseError("CRAM: truncated encoding."));
+            enc.stopByte = *it++;
+            _cramReadItf8(enc.contentId, it, pEnd);
+            break;
+        case CRAM_CODEC_BETA:
+        case CRAM_CODEC_SUBEXP:
+            _cramReadItf8(enc.offset, it, pEnd);
+            _cramReadItf8(enc.param, it, pEnd);
+            break;
+        case CRAM_CODEC_GAMMA:
+            _cramReadItf8(enc.offset, it, pEnd);
+            break;
+        default:
+            SEQAN_THROW(ParseError("CRAM: unsupported encoding."));
+    }
+    it = pEnd;
+    appendValue(pool, enc);
+    return length(pool) - 1;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramWriteExternalEncoding()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget>
+inline void
+_cramWriteExternalEncoding(TTarget & target, int32_t contentId)
+{
+    CharString params;
+    _cramWriteItf8(params, contentId);
+    _cramWriteItf8(target, (int32_t)CRAM_CODEC_EXTERNAL);
+    _cramWriteItf8(target, (int32_t)length(params));
+    append(target, params);
+}
+
+template <typename TTarget>
+inline void
+_cramWriteByteArrayStopEncoding(TTarget & target, char stopByte, int32_t contentId)
+{
+    CharString params;
+    appendValue(params, stopByte);
+    _cramWriteItf8(params, contentId);
+    _cramWriteItf8(target, (int32_t)CRAM_CODEC_BYTE_ARRAY_STOP);
+    _cramWriteItf8(target, (int32_t)length(params));
+    append(target, params);
+}
+
+template <typename TTarget>
+inline void
+_cramWriteByteArrayLenEncoding(TTarget & target, int32_t contentId)
+{
+    CharString params;
+    _cramWriteExternalEncoding(params, contentId);
+    _cramWriteExternalEncoding(params, contentId);
+    _cramWriteItf8(target, (int32_t)CRAM_CODEC_BYTE_ARRAY_LEN);
+    _cramWriteItf8(target, (int32_t)length(params));
+    append(target, params);
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_CRAM_CODECS_H_
@@ -0,0 +1,460 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Support for the CRAM index (.crai).
+//
+// A CRAI file is a gzip-compressed text file with one line per slice (and
+// reference for multi-reference slices):
+//
+//   refId  alnStart  alnSpan  containerOffset  sliceOffset  sliceSize
+//
+// refId is the index of the @SQ line, -1 for unmapped reads.  alnStart is
+// 1-based, the slice offset is relative to the end of the container header.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_CRAM_INDEX_CRAI_H_
+#define INCLUDE_SEQAN_BAM_IO_CRAM_INDEX_CRAI_H_
+
+#include <algorithm>
+
+namespace seqan2 {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tag Crai
+// ----------------------------------------------------------------------------
+
+struct Crai_;
+typedef Tag<Crai_> Crai;
+
+// ----------------------------------------------------------------------------
+// Helper Class CraiEntry_
+// ----------------------------------------------------------------------------
+
+struct CraiEntry_
+{
+    int32_t  refId;
+    int64_t  alnStart;
+    int64_t  alnSpan;
+    uint64_t containerOffset;
+    uint64_t sliceOffset;
+    uint64_t sliceSize;
+
+    CraiEntry_() : refId(-1), alnStart(0), alnSpan(0), containerOffset(0), sliceOffset(0), sliceSize(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Spec CRAI BamIndex
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class CraiBamIndex
+ * @headerfile <seqan/bam_io.h>
+ * @extends BamIndex
+ * @brief Access to CRAI (CRAM index).
+ *
+ * @signature template <>
+ *            class BamIndex<Crai>;
+ *
+ * The index can be used with @link BamFileIn#jumpToRegion @endlink and @link BamFileIn#viewRecords @endlink
+ * on BamFileIn objects reading CRAM files.
+ */
+
+template <>
+class BamIndex<Crai>
+{
+public:
+    String<CraiEntry_> _entries;    // in file order
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _craiFileRefId()
+// ----------------------------------------------------------------------------
+
+// The index stores the reference ids of the CRAM file, returns -1 if the
+// global refId does not occur in the file.
+
+template <typename TSpec>
+inline int32_t
+_craiFileRefId(FormattedFile<Bam, Input, TSpec> & bamFile, int32_t refId)
+{
+    String<unsigned> const & translate = context(bamFile).translateFile2GlobalRefId;
+    for (unsigned i = 0; i < length(translate); ++i)
+        if ((int32_t)translate[i] == refId)
+            return i;
+    return -1;
+}
+
+// ----------------------------------------------------------------------------
+// Function _craiCheckRegion()
+// ----------------------------------------------------------------------------
+
+template <typename TSpec>
+inline void
+_craiCheckRegion(FormattedFile<Bam, Input, TSpec> & bamFile,
+                 int32_t const refId,
+                 uint32_t regionStart,
+                 uint32_t regionEnd)
+{
+    if (!isEqual(format(bamFile), Cram()))
+        SEQAN_THROW(std::logic_error("You attempt to use a CRAM format specific functionality on a non-CRAM format."));
+
+    if (refId < 0 ||
+        static_cast<decltype(length(contigNames(context(bamFile))))>(refId) >= length(contigNames(context(bamFile))))
+        SEQAN_THROW(std::logic_error("Invalid reference identifier 'refId' passed."));
+
+    if (regionStart > regionEnd)
+        SEQAN_THROW(std::logic_error("Invalid region specified. Parameter regionStart was greater than regionEnd."));
+
+    if (regionStart == 0 || regionEnd == 0)
+        SEQAN_THROW(std::logic_error("Invalid region specified. Region is expected to be 1-based but 0 was passed as an argument."));
+}
+
+// ----------------------------------------------------------------------------
+// Function _craiOverlaps()
+// ----------------------------------------------------------------------------
+
+// regionStart and regionEnd are 1-based and inclusive, like the CRAI entries.
+
+inline bool
+_craiOverlaps(CraiEntry_ const & entry, int32_t fileRefId, uint32_t regionStart, uint32_t regionEnd)
+{
+    return entry.refId == fileRefId &&
+           entry.alnStart <= (int64_t)regionEnd &&
+           entry.alnStart + std::max((int64_t)1, entry.alnSpan) - 1 >= (int64_t)regionStart;
+}
+
+// ----------------------------------------------------------------------------
+// Function _craiLoadContainer()
+// ----------------------------------------------------------------------------
+
+// Decodes the container at the given offset into the record queue of the file.
+
+template <typename TSpec>
+inline void
+_craiLoadContainer(FormattedFile<Bam, Input, TSpec> & bamFile, uint64_t offset)
+{
+    CramIOContext_ & cram = context(bamFile).cram;
+    setPosition(bamFile, offset);
+    unsigned batchSize = cram.batchSize;
+    cram.batchSize = 1;
+    _cramReadRecords(context(bamFile), bamFile.iter);
+    cram.batchSize = batchSize;
+}
+
+// ----------------------------------------------------------------------------
+// Function viewRecords()
+// ----------------------------------------------------------------------------
+
+template <typename TContainer, typename TSpec>
+inline
+SEQAN_FUNC_ENABLE_IF(And<IsSameType<typename Value<TContainer>::Type, BamAlignmentRecord>,
+                     Not<IsSameType<typename Value<TContainer>::Type, TContainer>>>, void)
+viewRecords(TContainer & resultContainer,
+            FormattedFile<Bam, Input, TSpec> & bamFile,
+            BamIndex<Crai> const & index,
+            int32_t const refId,
+            uint32_t regionStart,
+            uint32_t regionEnd)
+{
+    _craiCheckRegion(bamFile, refId, regionStart, regionEnd);
+
+    int32_t fileRefId = _craiFileRefId(bamFile, refId);
+    CramIOContext_ & cram = context(bamFile).cram;
+
+    // Containers are visited once even if several of their slices overlap the region.
+    uint64_t lastOffset = std::numeric_limits<uint64_t>::max();
+    for (unsigned i = 0; i < length(index._entries); ++i)
+    {
+        CraiEntry_ const & entry = index._entries[i];
+        if (!_craiOverlaps(entry, fileRefId, regionStart, regionEnd) || entry.containerOffset == lastOffset)
+            continue;
+        lastOffset = entry.containerOffset;
+
+        _craiLoadContainer(bamFile, entry.containerOffset);
+        for (; cram.recordPos < length(cram.records); ++cram.recordPos)
+        {
+            BamAlignmentRecord const & record = cram.records[cram.recordPos];
+            if (record.rID != refId || record.beginPos == -1)
+                continue;
+            if (static_cast<uint32_t>(record.beginPos) <= regionEnd - 1 &&
+                record.beginPos + std::max(1u, getAlignmentLengthInRef(record)) >= regionStart)
+                appendValue(resultContainer, record, Generous());
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function jumpToRegion()
+// ----------------------------------------------------------------------------
+
+// Jumps to the first record starting in the 1-based region [regionStart, regionEnd].
+
+template <typename TSpec>
+inline bool
+jumpToRegion(FormattedFile<Bam, Input, TSpec> & bamFile,
+             bool & hasAlignments,
+             int32_t const refId,
+             uint32_t regionStart,
+             uint32_t regionEnd,
+             BamIndex<Crai> const & index)
+{
+    hasAlignments = false;
+    _craiCheckRegion(bamFile, refId, regionStart, regionEnd);
+
+    int32_t fileRefId = _craiFileRefId(bamFile, refId);
+    unsigned first = 0;
+    for (; first < length(index._entries); ++first)
+        if (_craiOverlaps(index._entries[first], fileRefId, regionStart, regionEnd))
+            break;
+    if (first == length(index._entries))
+        return fileRefId != -1;
+
+    // Records are coordinate-sorted, skip the ones before the region.
+    CramIOContext_ & cram = context(bamFile).cram;
+    _craiLoadContainer(bamFile, index._entries[first].containerOffset);
+    while (!atEnd(bamFile))
+    {
+        BamAlignmentRecord const & record = cram.records[cram.recordPos];
+        if (record.rID == -1 || record.rID > refId ||
+            (record.rID == refId && static_cast<uint32_t>(record.beginPos) > regionEnd - 1))
+            break;
+        if (record.rID == refId && static_cast<uint32_t>(record.beginPos) >= regionStart - 1)
+        {
+            hasAlignments = true;
+            break;
+        }
+        ++cram.recordPos;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+inline bool
+open(BamIndex<Crai> & index, char const * filename)
+{
+    clear(index._entries);
+
+    std::ifstream file(filename, std::ios::binary | std::ios::in);
+    if (!file.good())
+        return false;
+    VirtualStream<char, Input> in;
+    if (!open(in, file))    // the compression is detected from the content
+        return false;
+
+    typename DirectionIterator<VirtualStream<char, Input>, Input>::Type iter = directionIterator(in, Input());
+    CharString buffer;
+    SEQAN_TRY
+    {
+        while (!atEnd(iter))
+        {
+            CraiEntry_ entry;
+            for (unsigned field = 0; field < 6; ++field)
+            {
+                clear(buffer);
+                readUntil(buffer, iter, OrFunctor<IsBlank, IsNewline>());
+                skipUntil(iter, NotFunctor<IsBlank>());
+                if (empty(buffer))
+                    return false;
+                switch (field)
+                {
+                    case 0: entry.refId = lexicalCast<int32_t>(buffer); break;
+                    case 1: entry.alnStart = lexicalCast<int64_t>(buffer); break;
+                    case 2: entry.alnSpan = lexicalCast<int64_t>(buffer); break;
+                    case 3: entry.containerOffset = lexicalCast<uint64_t>(buffer); break;
+                    case 4: entry.sliceOffset = lexicalCast<uint64_t>(buffer); break;
+                    default: entry.sliceSize = lexicalCast<uint64_t>(buffer);
+                }
+            }
+            skipLine(iter);
+            appendValue(index._entries, entry);
+        }
+    }
+    SEQAN_CATCH(BadLexicalCast const &)
+    {
+        return false;
+    }
+    return true;
+}
+
+inline bool
+open(BamIndex<Crai> & index, char * filename)
+{
+    return open(index, static_cast<char const *>(filename));
+}
+
+// ---------------------------------------------------------------------------
+// Function save()
+// ---------------------------------------------------------------------------
+
+inline bool
+save(BamIndex<Crai> const & index, char const * craiFilename)
+{
+    std::ofstream file(craiFilename, std::ios::binary | std::ios::out);
+    if (!file.good())
+        return false;
+    VirtualStream<char, Output> out;
+    if (!open(out, file, GZFile()))
+        return false;
+
+    typename DirectionIterator<VirtualStream<char, Output>, Output>::Type iter = directionIterator(out, Output());
+    for (unsigned i = 0; i < length(index._entries); ++i)
+    {
+        CraiEntry_ const & entry = index._entries[i];
+        appendNumber(iter, entry.refId);
+        writeValue(iter, '\t');
+        appendNumber(iter, entry.alnStart);
+        writeValue(iter, '\t');
+        appendNumber(iter, entry.alnSpan);
+        writeValue(iter, '\t');
+        appendNumber(iter, entry.containerOffset);
+        writeValue(iter, '\t');
+        appendNumber(iter, entry.sliceOffset);
+        writeValue(iter, '\t');
+        appendNumber(iter, entry.sliceSize);
+        writeValue(iter, '\n');
+    }
+    close(out);
+    return file.good();
+}
+
+// ---------------------------------------------------------------------------
+// Function build()
+// ---------------------------------------------------------------------------
+
+// Multi-reference slices are decoded without bases to get one entry per reference.
+
+inline bool
+build(BamIndex<Crai> & index, char const * cramFilename)
+{
+    clear(index._entries);
+
+    BamFileIn cramFile;
+    if (!open(cramFile, cramFilename) || !isEqual(format(cramFile), Cram()))
+        return false;
+
+    BamHeader header;
+    readHeader(header, cramFile);
+    context(cramFile).cram.decodeBases = false;
+
+    CramContainer_ container;
+    String<BamAlignmentRecord> records;
+    while (true)
+    {
+        uint64_t containerOffset = position(cramFile);
+        if (!_cramReadContainer(container, cramFile.iter))
+            break;
+        if (container.nRecords == 0)    // e.g. the EOF container
+            continue;
+
+        char const * dataBegin = begin(container.data, Standard());
+        char const * dataEnd = end(container.data, Standard());
+        char const * it = dataBegin;
+        CramBlock_ block;
+        _cramReadBlock(block, it, dataEnd);
+        CramCompressionHeader_ compressionHeader;
+        _cramParseCompressionHeader(compressionHeader, block.data);
+
+        for (unsigned s = 0; s < length(container.landmarks); ++s)
+        {
+            int32_t sliceBegin = container.landmarks[s];
+            int32_t sliceEnd = (s + 1 < length(container.landmarks)) ? container.landmarks[s + 1]
+                                                                    : length(container.data);
+            if (sliceBegin < 0 || sliceBegin > sliceEnd || sliceEnd > (int32_t)length(container.data))
+                return false;
+
+            CraiEntry_ entry;
+            entry.containerOffset = containerOffset;
+            entry.sliceOffset = sliceBegin;
+            entry.sliceSize = sliceEnd - sliceBegin;
+
+            it = dataBegin + sliceBegin;
+            _cramReadBlock(block, it, dataBegin + sliceEnd);
+            char const * headerIt = begin(block.data, Standard());
+            char const * headerEnd = end(block.data, Standard());
+            int32_t sliceRefId, start, span;
+            _cramReadItf8(sliceRefId, headerIt, headerEnd);
+            _cramReadItf8(start, headerIt, headerEnd);
+            _cramReadItf8(span, headerIt, headerEnd);
+            if (sliceRefId != -2)
+            {
+                entry.refId = sliceRefId;
+                entry.alnStart = (sliceRefId == -1) ? 0 : start;
+                entry.alnSpan = (sliceRefId == -1) ? 0 : span;
+                appendValue(index._entries, entry);
+                continue;
+            }
+
+            clear(records);
+            _cramDecodeSlice(records, compressionHeader, dataBegin + sliceBegin, dataBegin + sliceEnd,
+                             CramRefRegion_(), context(cramFile), true);
+            std::map<int32_t, std::pair<int64_t, int64_t> > ranges;
+            for (unsigned i = 0; i < length(records); ++i)
+            {
+                int32_t fileRefId = (records[i].rID < 0) ? -1 : _craiFileRefId(cramFile, records[i].rID);
+                int64_t beginPos = (fileRefId < 0) ? 0 : records[i].beginPos + 1;
+                int64_t endPos = (fileRefId < 0) ? 0 : beginPos + std::max(1u, getAlignmentLengthInRef(records[i]));
+                if (ranges.count(fileRefId) == 0)
+                    ranges[fileRefId] = std::make_pair(beginPos, endPos);
+                ranges[fileRefId].first = std::min(ranges[fileRefId].first, beginPos);
+                ranges[fileRefId].second = std::max(ranges[fileRefId].second, endPos);
+            }
+            for (std::map<int32_t, std::pair<int64_t, int64_t> >::const_iterator r = ranges.begin();
+                 r != ranges.end(); ++r)
+            {
+                entry.refId = r->first;
+                entry.alnStart = r->second.first;
+                entry.alnSpan = r->second.second - r->second.first;
+                appendValue(index._entries, entry);
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_CRAM_INDEX_CRAI_H_
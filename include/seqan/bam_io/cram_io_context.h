@@ -0,0 +1,85 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// State kept by BamFileIn/BamFileOut while reading or writing CRAM.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_CRAM_IO_CONTEXT_H_
+#define INCLUDE_SEQAN_BAM_IO_CRAM_IO_CONTEXT_H_
+
+#include <functional>
+
+namespace seqan2 {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class CramIOContext_
+// ----------------------------------------------------------------------------
+
+// CRAM is container based, so records are decoded and encoded in batches.  The
+// reader keeps the decoded records of the last batch of containers, the writer
+// collects records until a container is full.
+//
+// The reference is accessed through fetchReference which is set up by
+// setCramReference().  It returns the (upper-case) bases of the half-open
+// interval [beginPos, endPos) of the given contig, clipped to the contig end,
+// or false if the contig is unknown.  It is only called from a single thread.
+
+struct CramIOContext_
+{
+    typedef std::function<bool(CharString &, CharString const &, int32_t, int32_t)> TFetchReference;
+
+    TFetchReference             fetchReference;
+
+    // Reading.
+    String<BamAlignmentRecord>  records;        // decoded records of the current batch
+    size_t                      recordPos;      // next record to return
+    StringSet<CharString>       readGroups;     // read group ids in header order
+    unsigned                    batchSize;      // containers decoded per batch, 0 = number of threads
+    bool                        decodeBases;    // false if mapped reads are decoded without bases
+
+    // Writing.
+    String<BamAlignmentRecord>  pending;        // records of the container under construction
+    int64_t                     recordCounter;  // number of records written before the pending ones
+    unsigned                    containerSize;  // maximal number of records per container
+    bool                        headerWritten;
+
+    CramIOContext_() :
+        recordPos(0), batchSize(0), decodeBases(true), recordCounter(0), containerSize(10000), headerWritten(false)
+    {}
+};
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_CRAM_IO_CONTEXT_H_
@@ -0,0 +1,1245 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Code for reading CRAM 3.0.
+//
+// Containers are read sequentially from the stream, the reference regions
+// they cover are fetched up front and a batch of containers is then decoded
+// in parallel.  Multi-reference containers are decoded afterwards in the
+// calling thread as the regions they need are only known while decoding.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_READ_CRAM_H_
+#define INCLUDE_SEQAN_BAM_IO_READ_CRAM_H_
+
+#include <exception>
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+/*!
+ * @tag FileFormats#Cram
+ * @brief Identify the CRAM format (version 3.0).
+ *
+ * Reading and writing CRAM requires zlib.  Reference-based compression uses the reference set with
+ * @link BamFileIn#setCramReference @endlink.
+ */
+
+struct Cram_;
+typedef Tag<Cram_> Cram;
+
+template <typename T>
+struct FileExtensions<Cram, T>
+{
+    static char const * VALUE[1];    // default is one extension
+};
+
+template <typename T>
+char const * FileExtensions<Cram, T>::VALUE[1] =
+{
+    ".cram"     // default output extension
+};
+
+template <typename T>
+struct MagicHeader<Cram, T>
+{
+    static unsigned char const VALUE[4];
+};
+
+template <typename T>
+unsigned char const MagicHeader<Cram, T>::VALUE[4] = { 'C', 'R', 'A', 'M' };  // CRAM's magic header
+
+// ----------------------------------------------------------------------------
+// Class CramContainer_
+// ----------------------------------------------------------------------------
+
+// A container header and the raw bytes of all its blocks.
+
+struct CramContainer_
+{
+    int32_t         refId;
+    int32_t         start;
+    int32_t         span;
+    int32_t         nRecords;
+    int64_t         recordCounter;
+    int64_t         bases;
+    int32_t         nBlocks;
+    String<int32_t> landmarks;
+    CharString      data;
+
+    CramContainer_() : refId(-1), start(0), span(0), nRecords(0), recordCounter(0), bases(0), nBlocks(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class CramCompressionHeader_
+// ----------------------------------------------------------------------------
+
+struct CramCompressionHeader_
+{
+    bool                    readNamesIncluded;
+    bool                    apDelta;
+    bool                    referenceRequired;
+    char                    substitution[5][4];         // [reference base][code] -> read base
+    String<CharString>      tagLines;                   // concatenated 3-byte tag ids per line
+    String<CramEncoding_>   encodings;                  // pool of all encodings
+    int32_t                 dataSeries[CRAM_DS_COUNT];  // index into encodings or -1
+    std::map<int32_t, unsigned> tagEncodings;           // (c0 << 16 | c1 << 8 | type) -> encoding
+
+    CramCompressionHeader_() : readNamesIncluded(true), apDelta(true), referenceRequired(true)
+    {
+        for (unsigned i = 0; i < CRAM_DS_COUNT; ++i)
+            dataSeries[i] = -1;
+        _setSubstitutionMatrix(0x1b1b1b1b1bull);
+    }
+
+    // Sets the matrix from the 5 packed bytes of the SM preservation entry.
+    void _setSubstitutionMatrix(uint64_t packed)
+    {
+        static char const BASES[] = "ACGTN";
+        for (unsigned r = 0; r < 5; ++r)
+        {
+            unsigned char byte = (packed >> (8 * (4 - r))) & 0xff;
+            for (unsigned i = 0, a = 0; a < 5; ++a)
+            {
+                if (a == r)
+                    continue;
+                substitution[r][(byte >> (6 - 2 * i)) & 3] = BASES[a];
+                ++i;
+            }
+        }
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class CramRefRegion_
+// ----------------------------------------------------------------------------
+
+// Upper-case reference bases [beginPos, beginPos + length(seq)) of a contig.
+// toEnd is set if the region was clipped at the end of the contig.
+
+struct CramRefRegion_
+{
+    int32_t     refId;
+    int32_t     beginPos;
+    CharString  seq;
+    bool        toEnd;
+
+    CramRefRegion_() : refId(-1), beginPos(0), toEnd(false)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class CramSliceContext_
+// ----------------------------------------------------------------------------
+
+struct CramSliceContext_
+{
+    CramCompressionHeader_ const *  header;
+    String<CramBlock_>              blocks;
+    String<CramBlock_ *>            encodingBlocks;     // external block of each encoding in the pool
+    CramBitReader_                  core;
+
+    CramSliceContext_() : header(NULL)
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _cramCopyItf8()
+// ----------------------------------------------------------------------------
+
+// Copies the raw bytes of an ITF8/LTF8 value from a stream, used to verify the
+// container header CRC.
+
+template <typename TForwardIter>
+inline void
+_cramCopyItf8(CharString & raw, TForwardIter & iter)
+{
+    char c;
+    readOne(c, iter);
+    appendValue(raw, c);
+    for (unsigned n = _cramItf8Size(c); n > 1; --n)
+    {
+        readOne(c, iter);
+        appendValue(raw, c);
+    }
+}
+
+template <typename TForwardIter>
+inline void
+_cramCopyLtf8(CharString & raw, TForwardIter & iter)
+{
+    char c;
+    readOne(c, iter);
+    appendValue(raw, c);
+    unsigned n = 1;
+    while (n < 9 && ((unsigned char)c & (0x80 >> (n - 1))))
+        ++n;
+    for (; n > 1; --n)
+    {
+        char d;
+        readOne(d, iter);
+        appendValue(raw, d);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramReadContainer()
+// ----------------------------------------------------------------------------
+
+// Reads the next container, returns false at the end of the stream.
+
+template <typename TForwardIter>
+inline bool
+_cramReadContainer(CramContainer_ & container, TForwardIter & iter)
+{
+    if (atEnd(iter))
+        return false;
+
+    CharString raw;
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        char c;
+        readOne(c, iter);
+        appendValue(raw, c);
+    }
+    for (unsigned i = 0; i < 4; ++i)
+        _cramCopyItf8(raw, iter);
+    _cramCopyLtf8(raw, iter);
+    _cramCopyLtf8(raw, iter);
+    _cramCopyItf8(raw, iter);
+    size_t landmarksPos = length(raw);
+    _cramCopyItf8(raw, iter);
+    {
+        int32_t nLandmarks;
+        char const * it = begin(raw, Standard()) + landmarksPos;
+        _cramReadItf8(nLandmarks, it, end(raw, Standard()));
+        for (int32_t i = 0; i < nLandmarks; ++i)
+            _cramCopyItf8(raw, iter);
+    }
+
+    uint32_t crc;
+    readRawPod(crc, iter);
+    if (crc != _cramCrc32(crc32(0L, Z_NULL, 0), begin(raw, Standard()), length(raw)))
+        SEQAN_THROW(ParseError("CRAM: container header CRC32 mismatch."));
+
+    char const * it = begin(raw, Standard());
+    char const * itEnd = end(raw, Standard());
+    int32_t len, nLandmarks;
+    _cramReadInt32(len, it, itEnd);
+    _cramReadItf8(container.refId, it, itEnd);
+    _cramReadItf8(container.start, it, itEnd);
+    _cramReadItf8(container.span, it, itEnd);
+    _cramReadItf8(container.nRecords, it, itEnd);
+    _cramReadLtf8(container.recordCounter, it, itEnd);
+    _cramReadLtf8(container.bases, it, itEnd);
+    _cramReadItf8(container.nBlocks, it, itEnd);
+    _cramReadItf8(nLandmarks, it, itEnd);
+    resize(container.landmarks, nLandmarks, Exact());
+    for (int32_t i = 0; i < nLandmarks; ++i)
+        _cramReadItf8(container.landmarks[i], it, itEnd);
+
+    if (len < 0)
+        SEQAN_THROW(ParseError("CRAM: invalid container length."));
+    clear(container.data);
+    write(container.data, iter, len);
+    if ((int32_t)length(container.data) != len)
+        SEQAN_THROW(ParseError("CRAM: truncated container."));
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramParseCompressionHeader()
+// ----------------------------------------------------------------------------
+
+inline void
+_cramParseCompressionHeader(CramCompressionHeader_ & header, CharString const & data)
+{
+    char const * it = begin(data, Standard());
+    char const * itEnd = end(data, Standard());
+    int32_t size, n;
+
+    // Preservation map.
+    _cramReadItf8(size, it, itEnd);
+    if (size < 0 || itEnd - it < size)
+        SEQAN_THROW(ParseError("CRAM: truncated preservation map."));
+    char const * mapEnd = it + size;
+    _cramReadItf8(n, it, mapEnd);
+    for (int32_t i = 0; i < n; ++i)
+    {
+        if (mapEnd - it < 3)
+            SEQAN_THROW(ParseError("CRAM: truncated preservation map."));
+        char k0 = *it++;
+        char k1 = *it++;
+        if ((k0 == 'R' && k1 == 'N') || (k0 == 'A' && k1 == 'P') || (k0 == 'R' && k1 == 'R'))
+        {
+            bool val = *it++ != 0;
+            if (k0 == 'A')
+                header.apDelta = val;
+            else if (k1 == 'N')
+                header.readNamesIncluded = val;
+            else
+                header.referenceRequired = val;
+        }
+        else if (k0 == 'S' && k1 == 'M')
+        {
+            if (mapEnd - it < 5)
+                SEQAN_THROW(ParseError("CRAM: truncated substitution matrix."));
+            uint64_t packed = 0;
+            for (unsigned r = 0; r < 5; ++r)
+                packed = (packed << 8) | (unsigned char)*it++;
+            header._setSubstitutionMatrix(packed);
+        }
+        else if (k0 == 'T' && k1 == 'D')
+        {
+            int32_t len;
+            _cramReadItf8(len, it, mapEnd);
+            if (len < 0 || mapEnd - it < len)
+                SEQAN_THROW(ParseError("CRAM: truncated tag dictionary."));
+            char const * lineBegin = it;
+            for (char const * p = it; p != it + len; ++p)
+                if (*p == '\0')
+                {
+                    appendValue(header.tagLines, CharString());
+                    append(back(header.tagLines), infix(data, lineBegin - begin(data, Standard()),
+                                                         p - begin(data, Standard())));
+                    lineBegin = p + 1;
+                }
+            it += len;
+        }
+        else
+        {
+            SEQAN_THROW(ParseError("CRAM: unknown preservation map entry."));
+        }
+    }
+    it = mapEnd;
+
+    // Data series encoding map.
+    _cramReadItf8(size, it, itEnd);
+    if (size < 0 || itEnd - it < size)
+        SEQAN_THROW(ParseError("CRAM: truncated data series encoding map."));
+    mapEnd = it + size;
+    _cramReadItf8(n, it, mapEnd);
+    for (int32_t i = 0; i < n; ++i)
+    {
+        if (mapEnd - it < 2)
+            SEQAN_THROW(ParseError("CRAM: truncated data series encoding map."));
+        int32_t key = ((int32_t)(unsigned char)it[0] << 8) | (unsigned char)it[1];
+        it += 2;
+        unsigned enc = _cramReadEncoding(header.encodings, it, mapEnd);
+        for (unsigned ds = 0; ds < CRAM_DS_COUNT; ++ds)
+            if (_cramDataSeriesKey(ds) == key)
+                header.dataSeries[ds] = enc;
+    }
+    it = mapEnd;
+
+    // Tag encoding map.
+    _cramReadItf8(size, it, itEnd);
+    if (size < 0 || itEnd - it < size)
+        SEQAN_THROW(ParseError("CRAM: truncated tag encoding map."));
+    mapEnd = it + size;
+    _cramReadItf8(n, it, mapEnd);
+    for (int32_t i = 0; i < n; ++i)
+    {
+        int32_t key;
+        _cramReadItf8(key, it, mapEnd);
+        header.tagEncodings[key] = _cramReadEncoding(header.encodings, it, mapEnd);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramSeries()
+// ----------------------------------------------------------------------------
+
+inline unsigned
+_cramSeries(CramSliceContext_ const & slice, int ds)
+{
+    int32_t enc = slice.header->dataSeries[ds];
+    if (SEQAN_UNLIKELY(enc < 0))
+        SEQAN_THROW(ParseError("CRAM: missing encoding for a required data series."));
+    return enc;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramExternalBlock()
+// ----------------------------------------------------------------------------
+
+inline CramBlock_ &
+_cramExternalBlock(CramSliceContext_ & slice, unsigned enc)
+{
+    CramBlock_ * block = slice.encodingBlocks[enc];
+    if (SEQAN_UNLIKELY(block == NULL))
+        SEQAN_THROW(ParseError("CRAM: missing external block."));
+    return *block;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramDecodeInt()
+// ----------------------------------------------------------------------------
+
+inline int32_t
+_cramDecodeInt(CramSliceContext_ & slice, unsigned enc)
+{
+    CramEncoding_ const & e = slice.header->encodings[enc];
+    switch (e.codec)
+    {
+        case CRAM_CODEC_EXTERNAL:
+        {
+            CramBlock_ & block = _cramExternalBlock(slice, enc);
+            char const * it = begin(block.data, Standard()) + block.pos;
+            int32_t val;
+            _cramReadItf8(val, it, end(block.data, Standard()));
+            block.pos = it - begin(block.data, Standard());
+            return val;
+        }
+        case CRAM_CODEC_HUFFMAN:
+        {
+            if (e.lenCount[0] != 0)
+                return e.symbols[e.firstIndex[0]];
+            int32_t code = 0;
+            for (unsigned len = 1; len <= 32; ++len)
+            {
+                code = (code << 1) | _cramReadBit(slice.core);
+                if (e.lenCount[len] != 0 && code >= e.firstCode[len] && code - e.firstCode[len] < e.lenCount[len])
+                    return e.symbols[e.firstIndex[len] + code - e.firstCode[len]];
+            }
+            SEQAN_THROW(ParseError("CRAM: invalid HUFFMAN code."));
+        }
+        case CRAM_CODEC_BETA:
+            return (int32_t)_cramReadBits(slice.core, e.param) - e.offset;
+        case CRAM_CODEC_GAMMA:
+        {
+            int n = 0;
+            while (_cramReadBit(slice.core) == 0)
+                ++n;
+            return (int32_t)((1u << n) | _cramReadBits(slice.core, n)) - e.offset;
+        }
+        case CRAM_CODEC_SUBEXP:
+        {
+            int i = 0;
+            while (_cramReadBit(slice.core) == 1)
+                ++i;
+            uint32_t val;
+            if (i == 0)
+                val = _cramReadBits(slice.core, e.param);
+            else
+                val = (1u << (i + e.param - 1)) | _cramReadBits(slice.core, i + e.param - 1);
+            return (int32_t)val - e.offset;
+        }
+        default:
+            SEQAN_THROW(ParseError("CRAM: unsupported integer encoding."));
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramDecodeByte()
+// ----------------------------------------------------------------------------
+
+inline char
+_cramDecodeByte(CramSliceContext_ & slice, unsigned enc)
+{
+    if (slice.header->encodings[enc].codec == CRAM_CODEC_EXTERNAL)
+    {
+        CramBlock_ & block = _cramExternalBlock(slice, enc);
+        if (SEQAN_UNLIKELY(block.pos >= length(block.data)))
+            SEQAN_THROW(ParseError("CRAM: unexpected end of external block."));
+        return block.data[block.pos++];
+    }
+    return (char)_cramDecodeInt(slice, enc);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramDecodeBytes()
+// ----------------------------------------------------------------------------
+
+// Appends n bytes decoded with the given encoding to target.
+
+template <typename TTarget>
+inline void
+_cramDecodeBytes(TTarget & target, CramSliceContext_ & slice, unsigned enc, size_t n)
+{
+    if (slice.header->encodings[enc].codec == CRAM_CODEC_EXTERNAL)
+    {
+        CramBlock_ & block = _cramExternalBlock(slice, enc);
+        if (SEQAN_UNLIKELY(block.pos + n > length(block.data)))
+            SEQAN_THROW(ParseError("CRAM: unexpected end of external block."));
+        append(target, infix(block.data, block.pos, block.pos + n));
+        block.pos += n;
+        return;
+    }
+    for (size_t i = 0; i < n; ++i)
+        appendValue(target, _cramDecodeByte(slice, enc));
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramDecodeByteArray()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget>
+inline void
+_cramDecodeByteArray(TTarget & target, CramSliceContext_ & slice, unsigned enc)
+{
+    CramEncoding_ const & e = slice.header->encodings[enc];
+    if (e.codec == CRAM_CODEC_BYTE_ARRAY_LEN)
+    {
+        int32_t len = _cramDecodeInt(slice, e.lenEncoding);
+        if (len < 0)
+            SEQAN_THROW(ParseError("CRAM: negative byte array length."));
+        _cramDecodeBytes(target, slice, e.valEncoding, len);
+    }
+    else if (e.codec == CRAM_CODEC_BYTE_ARRAY_STOP)
+    {
+        CramBlock_ & block = _cramExternalBlock(slice, enc);
+        size_t stop = block.pos;
+        while (stop < length(block.data) && (unsigned char)block.data[stop] != e.stopByte)
+            ++stop;
+        if (SEQAN_UNLIKELY(stop == length(block.data)))
+            SEQAN_THROW(ParseError("CRAM: unterminated byte array."));
+        append(target, infix(block.data, block.pos, stop));
+        block.pos = stop + 1;
+    }
+    else
+    {
+        SEQAN_THROW(ParseError("CRAM: unsupported byte array encoding."));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramRefBase()
+// ----------------------------------------------------------------------------
+
+inline char
+_cramRefBase(CramRefRegion_ const * ref, int64_t pos)
+{
+    if (SEQAN_UNLIKELY(ref == NULL))
+        SEQAN_THROW(IOError("CRAM: reference sequence required for decoding, see setCramReference()."));
+    int64_t i = pos - ref->beginPos;
+    if (i >= 0 && i < (int64_t)length(ref->seq))
+        return ref->seq[i];
+    if (i >= 0 && ref->toEnd)
+        return 'N';
+    SEQAN_THROW(ParseError("CRAM: alignment exceeds the reference region of its container."));
+    return 'N';
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramBaseIndex()
+// ----------------------------------------------------------------------------
+
+inline unsigned
+_cramBaseIndex(char c)
+{
+    switch (c)
+    {
+        case 'A': return 0;
+        case 'C': return 1;
+        case 'G': return 2;
+        case 'T': return 3;
+        default: return 4;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramAppendCigar()
+// ----------------------------------------------------------------------------
+
+inline void
+_cramAppendCigar(String<CigarElement<> > & cigar, char op, uint32_t count)
+{
+    if (count == 0)
+        return;
+    if (!empty(cigar) && back(cigar).operation == op)
+        back(cigar).count += count;
+    else
+        appendValue(cigar, CigarElement<>(op, count));
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramFetchReference()
+// ----------------------------------------------------------------------------
+
+// Fetches [beginPos, endPos) of the contig with the given name.
+
+inline bool
+_cramFetchReference(CramRefRegion_ & region, CramIOContext_ & cram, CharString const & name, int32_t refId,
+                    int32_t beginPos, int32_t endPos)
+{
+    region.refId = -1;
+    clear(region.seq);
+    if (!cram.fetchReference || !cram.fetchReference(region.seq, name, beginPos, endPos))
+        return false;
+    region.refId = refId;
+    region.beginPos = beginPos;
+    region.toEnd = (int64_t)beginPos + (int64_t)length(region.seq) < (int64_t)endPos;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramResolveMates()
+// ----------------------------------------------------------------------------
+
+// Fills in the mate information of records that were stored with attached
+// mates (CF 0x4); next[i] is the index of the downstream mate or -1.
+
+inline void
+_cramResolveMates(String<BamAlignmentRecord> & records, size_t first, String<int32_t> const & next)
+{
+    size_t n = length(next);
+    String<bool> hasUpstream;
+    resize(hasUpstream, n, false, Exact());
+    for (size_t i = 0; i < n; ++i)
+        if (next[i] >= 0)
+            hasUpstream[next[i]] = true;
+
+    String<size_t> chain;
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (next[i] < 0 || hasUpstream[i])
+            continue;
+
+        clear(chain);
+        for (int32_t j = i; j >= 0 && length(chain) <= n; j = next[j])
+            appendValue(chain, j);
+
+        // Template length over all segments if they are mapped to the same contig.
+        bool sameRef = true;
+        int32_t left = MaxValue<int32_t>::VALUE;
+        int32_t right = MinValue<int32_t>::VALUE;
+        for (size_t k = 0; k < length(chain); ++k)
+        {
+            BamAlignmentRecord const & r = records[first + chain[k]];
+            if (hasFlagUnmapped(r) || r.rID != records[first + chain[0]].rID)
+            {
+                sameRef = false;
+                break;
+            }
+            left = std::min(left, r.beginPos);
+            right = std::max(right, r.beginPos + (int32_t)getAlignmentLengthInRef(r));
+        }
+        bool leftAssigned = false;
+        for (size_t k = 0; k < length(chain); ++k)
+        {
+            BamAlignmentRecord & r = records[first + chain[k]];
+            BamAlignmentRecord const & mate = records[first + chain[(k + 1) % length(chain)]];
+            r.rNextId = mate.rID;
+            r.pNext = mate.beginPos;
+            if (hasFlagUnmapped(mate))
+                r.flag |= BAM_FLAG_NEXT_UNMAPPED;
+            if (hasFlagRC(mate))
+                r.flag |= BAM_FLAG_NEXT_RC;
+            r.tLen = 0;
+            if (sameRef)
+            {
+                // The leftmost segment gets the positive length.
+                if (!leftAssigned && r.beginPos == left)
+                {
+                    r.tLen = right - left;
+                    leftAssigned = true;
+                }
+                else
+                {
+                    r.tLen = left - right;
+                }
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramDecodeSlice()
+// ----------------------------------------------------------------------------
+
+// Decodes the slice starting at it and appends its records.  ref is the
+// prefetched region of single-reference containers, in the sequential pass
+// (sequential = true) missing regions are fetched on demand.
+
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+_cramDecodeSlice(String<BamAlignmentRecord> & records,
+                 CramCompressionHeader_ const & header,
+                 char const * it,
+                 char const * itEnd,
+                 CramRefRegion_ const & ref,
+                 BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                 bool sequential)
+{
+    CramIOContext_ & cram = context.cram;
+    CramSliceContext_ slice;
+    slice.header = &header;
+
+    // Slice header.
+    CramBlock_ headerBlock;
+    _cramReadBlock(headerBlock, it, itEnd);
+    if (headerBlock.contentType != CRAM_CONTENT_SLICE_HEADER)
+        SEQAN_THROW(ParseError("CRAM: expected slice header block."));
+
+    int32_t sliceRefId, sliceStart, sliceSpan, nRecords, nBlocks, nIds, embeddedRefId;
+    int64_t recordCounter;
+    {
+        char const * h = begin(headerBlock.data, Standard());
+        char const * hEnd = end(headerBlock.data, Standard());
+        _cramReadItf8(sliceRefId, h, hEnd);
+        _cramReadItf8(sliceStart, h, hEnd);
+        _cramReadItf8(sliceSpan, h, hEnd);
+        _cramReadItf8(nRecords, h, hEnd);
+        _cramReadLtf8(recordCounter, h, hEnd);
+        _cramReadItf8(nBlocks, h, hEnd);
+        _cramReadItf8(nIds, h, hEnd);
+        for (int32_t i = 0, id; i < nIds; ++i)
+            _cramReadItf8(id, h, hEnd);
+        _cramReadItf8(embeddedRefId, h, hEnd);
+    }
+    if (nRecords < 0 || nBlocks < 0)
+        SEQAN_THROW(ParseError("CRAM: invalid slice header."));
+
+    resize(slice.blocks, nBlocks, Exact());
+    CramBlock_ * coreBlock = NULL;
+    for (int32_t i = 0; i < nBlocks; ++i)
+    {
+        _cramReadBlock(slice.blocks[i], it, itEnd);
+        if (slice.blocks[i].contentType == CRAM_CONTENT_CORE)
+            coreBlock = &slice.blocks[i];
+    }
+    if (coreBlock != NULL)
+    {
+        slice.core.data = reinterpret_cast<unsigned char const *>(begin(coreBlock->data, Standard()));
+        slice.core.length = length(coreBlock->data);
+    }
+
+    resize(slice.encodingBlocks, length(header.encodings), (CramBlock_ *)NULL, Exact());
+    for (unsigned e = 0; e < length(header.encodings); ++e)
+    {
+        int32_t codec = header.encodings[e].codec;
+        if (codec != CRAM_CODEC_EXTERNAL && codec != CRAM_CODEC_BYTE_ARRAY_STOP)
+            continue;
+        for (unsigned b = 0; b < length(slice.blocks); ++b)
+            if (slice.blocks[b].contentType == CRAM_CONTENT_EXTERNAL &&
+                slice.blocks[b].contentId == header.encodings[e].contentId)
+                slice.encodingBlocks[e] = &slice.blocks[b];
+    }
+
+    // The reference is either embedded, prefetched or (sequential pass only) fetched on demand.
+    CramRefRegion_ embedded;
+    std::map<int32_t, CramRefRegion_> fetched;
+    if (embeddedRefId >= 0)
+    {
+        for (unsigned b = 0; b < length(slice.blocks); ++b)
+            if (slice.blocks[b].contentType == CRAM_CONTENT_EXTERNAL && slice.blocks[b].contentId == embeddedRefId)
+            {
+                embedded.refId = sliceRefId;
+                embedded.beginPos = sliceStart - 1;
+                embedded.seq = slice.blocks[b].data;
+                toUpper(embedded.seq);
+            }
+    }
+
+    unsigned dsBF = _cramSeries(slice, CRAM_DS_BF);
+    unsigned dsCF = _cramSeries(slice, CRAM_DS_CF);
+    unsigned dsRL = _cramSeries(slice, CRAM_DS_RL);
+    unsigned dsAP = _cramSeries(slice, CRAM_DS_AP);
+    unsigned dsRG = _cramSeries(slice, CRAM_DS_RG);
+    unsigned dsTL = _cramSeries(slice, CRAM_DS_TL);
+
+    size_t first = length(records);
+    resize(records, first + nRecords);
+    String<int32_t> next;
+    resize(next, nRecords, -1, Exact());
+    String<int32_t> fileRefIds;
+    resize(fileRefIds, nRecords, -1, Exact());
+    String<int32_t> mateFileRefIds;
+    resize(mateFileRefIds, nRecords, -1, Exact());
+
+    CharString seq;
+    CharString bytes;
+    int32_t prevPos = sliceStart;
+
+    for (int32_t i = 0; i < nRecords; ++i)
+    {
+        BamAlignmentRecord & record = records[first + i];
+        clear(record);
+
+        record.flag = _cramDecodeInt(slice, dsBF);
+        int32_t cf = _cramDecodeInt(slice, dsCF);
+        int32_t refId = (sliceRefId == -2) ? _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_RI)) : sliceRefId;
+        int32_t readLen = _cramDecodeInt(slice, dsRL);
+        int32_t pos = _cramDecodeInt(slice, dsAP);
+        if (header.apDelta)
+        {
+            pos += prevPos;
+            prevPos = pos;
+        }
+        int32_t rg = _cramDecodeInt(slice, dsRG);
+        if (readLen < 0)
+            SEQAN_THROW(ParseError("CRAM: negative read length."));
+
+        fileRefIds[i] = refId;
+        record.beginPos = pos - 1;
+
+        if (header.readNamesIncluded)
+            _cramDecodeByteArray(record.qName, slice, _cramSeries(slice, CRAM_DS_RN));
+
+        // Mate information.
+        if (cf & 0x2)
+        {
+            int32_t mf = _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_MF));
+            if (mf & 0x1)
+                record.flag |= BAM_FLAG_NEXT_RC;
+            if (mf & 0x2)
+                record.flag |= BAM_FLAG_NEXT_UNMAPPED;
+            if (!header.readNamesIncluded)
+                _cramDecodeByteArray(record.qName, slice, _cramSeries(slice, CRAM_DS_RN));
+            mateFileRefIds[i] = _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_NS));
+            record.pNext = _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_NP)) - 1;
+            record.tLen = _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_TS));
+        }
+        else if (cf & 0x4)
+        {
+            int32_t nf = _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_NF));
+            if (nf < 0 || i + nf + 1 >= nRecords)
+                SEQAN_THROW(ParseError("CRAM: mate record outside of slice."));
+            next[i] = i + nf + 1;
+        }
+        if (empty(record.qName))
+            appendNumber(record.qName, recordCounter + i + 1);
+
+        // Auxiliary tags.
+        int32_t tl = _cramDecodeInt(slice, dsTL);
+        if (tl < 0 || tl >= (int32_t)length(header.tagLines))
+            SEQAN_THROW(ParseError("CRAM: invalid tag line."));
+        CharString const & tagLine = header.tagLines[tl];
+        for (unsigned t = 0; t + 3 <= length(tagLine); t += 3)
+        {
+            int32_t key = ((int32_t)(unsigned char)tagLine[t] << 16) |
+                          ((int32_t)(unsigned char)tagLine[t + 1] << 8) | (unsigned char)tagLine[t + 2];
+            std::map<int32_t, unsigned>::const_iterator enc = header.tagEncodings.find(key);
+            if (enc == header.tagEncodings.end())
+                SEQAN_THROW(ParseError("CRAM: missing tag encoding."));
+            append(record.tags, infix(tagLine, t, t + 3));
+            _cramDecodeByteArray(record.tags, slice, enc->second);
+        }
+        if (rg >= 0)
+        {
+            if (rg >= (int32_t)length(cram.readGroups))
+                SEQAN_THROW(ParseError("CRAM: invalid read group."));
+            append(record.tags, "RGZ");
+            append(record.tags, cram.readGroups[rg]);
+            appendValue(record.tags, '\0');
+        }
+
+        bool hasSeq = !(cf & 0x8);
+        clear(seq);
+        if (!hasFlagUnmapped(record))
+        {
+            // Bases are only reconstructed if requested, indexing only needs the CIGAR.
+            bool withBases = hasSeq && cram.decodeBases;
+            CramRefRegion_ const * recordRef = NULL;
+            if (withBases && refId >= 0)
+            {
+                if (!empty(embedded.seq) && embedded.refId == refId)
+                    recordRef = &embedded;
+                else if (!empty(ref.seq) && ref.refId == refId)
+                    recordRef = &ref;
+                else if (sequential)
+                {
+                    std::map<int32_t, CramRefRegion_>::iterator f = fetched.find(refId);
+                    if (f == fetched.end())
+                    {
+                        CramRefRegion_ & region = fetched[refId];
+                        if (refId < (int32_t)length(context.translateFile2GlobalRefId))
+                            _cramFetchReference(region, cram,
+                                                contigNames(context)[context.translateFile2GlobalRefId[refId]],
+                                                refId, 0, MaxValue<int32_t>::VALUE);
+                        f = fetched.find(refId);
+                    }
+                    if (f->second.refId == refId)
+                        recordRef = &f->second;
+                }
+            }
+
+            // Read features and reconstruct sequence and CIGAR.
+            if (withBases)
+                resize(seq, readLen, 'N');
+            int32_t nFeatures = _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_FN));
+            int32_t readPos = 0;
+            int64_t refPos = record.beginPos;
+            int32_t prevFeaturePos = 0;
+            for (int32_t f = 0; f < nFeatures; ++f)
+            {
+                char code = _cramDecodeByte(slice, _cramSeries(slice, CRAM_DS_FC));
+                int32_t featurePos = prevFeaturePos + _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_FP));
+                prevFeaturePos = featurePos;
+                int32_t gap = featurePos - 1 - readPos;
+                if (gap < 0 || featurePos - 1 > readLen)
+                    SEQAN_THROW(ParseError("CRAM: invalid read feature position."));
+                if (withBases)
+                    for (int32_t k = 0; k < gap; ++k)
+                        seq[readPos + k] = _cramRefBase(recordRef, refPos + k);
+                _cramAppendCigar(record.cigar, 'M', gap);
+                readPos += gap;
+                refPos += gap;
+
+                int32_t len = 0;
+                switch (code)
+                {
+                    case 'X':
+                    {
+                        unsigned char bs = _cramDecodeByte(slice, _cramSeries(slice, CRAM_DS_BS));
+                        if (readPos >= readLen)
+                            SEQAN_THROW(ParseError("CRAM: read feature beyond read end."));
+                        if (withBases)
+                            seq[readPos] = header.substitution[_cramBaseIndex(_cramRefBase(recordRef, refPos))][bs & 3];
+                        _cramAppendCigar(record.cigar, 'M', 1);
+                        ++readPos;
+                        ++refPos;
+                        break;
+                    }
+                    case 'B':
+                    {
+                        char base = _cramDecodeByte(slice, _cramSeries(slice, CRAM_DS_BA));
+                        _cramDecodeByte(slice, _cramSeries(slice, CRAM_DS_QS));
+                        if (readPos >= readLen)
+                            SEQAN_THROW(ParseError("CRAM: read feature beyond read end."));
+                        if (withBases)
+                            seq[readPos] = base;
+                        _cramAppendCigar(record.cigar, 'M', 1);
+                        ++readPos;
+                        ++refPos;
+                        break;
+                    }
+                    case 'b':
+                    case 'I':
+                    case 'S':
+                    {
+                        clear(bytes);
+                        int ds = (code == 'b') ? CRAM_DS_BB : ((code == 'I') ? CRAM_DS_IN : CRAM_DS_SC);
+                        _cramDecodeByteArray(bytes, slice, _cramSeries(slice, ds));
+                        len = length(bytes);
+                        if (readPos + len > readLen)
+                            SEQAN_THROW(ParseError("CRAM: read feature beyond read end."));
+                        if (withBases)
+                            std::copy(begin(bytes, Standard()), end(bytes, Standard()), begin(seq, Standard()) + readPos);
+                        _cramAppendCigar(record.cigar, (code == 'b') ? 'M' : code, len);
+                        readPos += len;
+                        if (code == 'b')
+                            refPos += len;
+                        break;
+                    }
+                    case 'i':
+                    {
+                        char base = _cramDecodeByte(slice, _cramSeries(slice, CRAM_DS_BA));
+                        if (readPos >= readLen)
+                            SEQAN_THROW(ParseError("CRAM: read feature beyond read end."));
+                        if (withBases)
+                            seq[readPos] = base;
+                        _cramAppendCigar(record.cigar, 'I', 1);
+                        ++readPos;
+                        break;
+                    }
+                    case 'D':
+                    case 'N':
+                        len = _cramDecodeInt(slice, _cramSeries(slice, (code == 'D') ? CRAM_DS_DL : CRAM_DS_RS));
+                        _cramAppendCigar(record.cigar, code, len);
+                        refPos += len;
+                        break;
+                    case 'H':
+                        _cramAppendCigar(record.cigar, 'H', _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_HC)));
+                        break;
+                    case 'P':
+                        _cramAppendCigar(record.cigar, 'P', _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_PD)));
+                        break;
+                    case 'q':
+                        clear(bytes);
+                        _cramDecodeByteArray(bytes, slice, _cramSeries(slice, CRAM_DS_QQ));
+                        break;
+                    case 'Q':
+                        _cramDecodeByte(slice, _cramSeries(slice, CRAM_DS_QS));
+                        break;
+                    default:
+                        SEQAN_THROW(ParseError("CRAM: unknown read feature."));
+                }
+            }
+            // Remaining bases match the reference.
+            int32_t gap = readLen - readPos;
+            if (withBases)
+                for (int32_t k = 0; k < gap; ++k)
+                    seq[readPos + k] = _cramRefBase(recordRef, refPos + k);
+            _cramAppendCigar(record.cigar, 'M', gap);
+
+            record.mapQ = _cramDecodeInt(slice, _cramSeries(slice, CRAM_DS_MQ));
+        }
+        else
+        {
+            record.mapQ = 0;
+            if (hasSeq)
+                _cramDecodeBytes(seq, slice, _cramSeries(slice, CRAM_DS_BA), readLen);
+        }
+
+        if (cf & 0x1)
+        {
+            _cramDecodeBytes(record.qual, slice, _cramSeries(slice, CRAM_DS_QS), readLen);
+            for (unsigned k = 0; k < length(record.qual); ++k)
+                record.qual[k] += '!';
+        }
+        assign(record.seq, seq);
+    }
+
+    // Translate the contig ids of the file into global ids.
+    for (int32_t i = 0; i < nRecords; ++i)
+    {
+        BamAlignmentRecord & record = records[first + i];
+        for (unsigned k = 0; k < 2; ++k)
+        {
+            int32_t fileId = (k == 0) ? fileRefIds[i] : mateFileRefIds[i];
+            int32_t & target = (k == 0) ? record.rID : record.rNextId;
+            if (fileId < 0)
+                target = BamAlignmentRecord::INVALID_REFID;
+            else if (fileId < (int32_t)length(context.translateFile2GlobalRefId))
+                target = context.translateFile2GlobalRefId[fileId];
+            else
+                SEQAN_THROW(ParseError("CRAM: invalid reference id."));
+        }
+    }
+    _cramResolveMates(records, first, next);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramDecodeContainer()
+// ----------------------------------------------------------------------------
+
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+_cramDecodeContainer(String<BamAlignmentRecord> & records,
+                     CramContainer_ const & container,
+                     CramRefRegion_ const & ref,
+                     BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                     bool sequential)
+{
+    char const * dataBegin = begin(container.data, Standard());
+    char const * dataEnd = end(container.data, Standard());
+    char const * it = dataBegin;
+
+    CramBlock_ block;
+    _cramReadBlock(block, it, dataEnd);
+    if (block.contentType != CRAM_CONTENT_COMPRESSION_HEADER)
+        SEQAN_THROW(ParseError("CRAM: expected compression header block."));
+    CramCompressionHeader_ header;
+    _cramParseCompressionHeader(header, block.data);
+
+    for (unsigned s = 0; s < length(container.landmarks); ++s)
+    {
+        int32_t sliceBegin = container.landmarks[s];
+        int32_t sliceEnd = (s + 1 < length(container.landmarks)) ? container.landmarks[s + 1] : length(container.data);
+        if (sliceBegin < 0 || sliceBegin > sliceEnd || sliceEnd > (int32_t)length(container.data))
+            SEQAN_THROW(ParseError("CRAM: invalid slice offset."));
+        _cramDecodeSlice(records, header, dataBegin + sliceBegin, dataBegin + sliceEnd, ref, context, sequential);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramReadRecords()
+// ----------------------------------------------------------------------------
+
+// Reads the next batch of containers and decodes them into context.cram.records.
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+_cramReadRecords(BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context, TForwardIter & iter)
+{
+    CramIOContext_ & cram = context.cram;
+    clear(cram.records);
+    cram.recordPos = 0;
+
+    unsigned batchSize = (cram.batchSize != 0) ? cram.batchSize : std::max(1, omp_get_max_threads());
+    String<CramContainer_> containers;
+    while (length(containers) < batchSize)
+    {
+        CramContainer_ container;
+        if (!_cramReadContainer(container, iter))
+            break;
+        if (container.nRecords == 0)    // e.g. the EOF container
+            continue;
+        appendValue(containers, container);
+    }
+    int nContainers = length(containers);
+    if (nContainers == 0)
+        return;
+
+    // Fetch the reference regions of single-reference containers.
+    String<CramRefRegion_> refs;
+    resize(refs, nContainers, Exact());
+    for (int i = 0; i < nContainers; ++i)
+    {
+        CramContainer_ const & container = containers[i];
+        if (container.refId >= 0 && container.refId < (int32_t)length(context.translateFile2GlobalRefId))
+            _cramFetchReference(refs[i], cram, contigNames(context)[context.translateFile2GlobalRefId[container.refId]],
+                                container.refId, container.start - 1, container.start - 1 + container.span);
+    }
+
+    // Decode in parallel, exceptions are passed to the calling thread.
+    String<String<BamAlignmentRecord> > results;
+    resize(results, nContainers, Exact());
+    std::vector<std::exception_ptr> errors(nContainers);
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic) if (nContainers > 1))
+    for (int i = 0; i < nContainers; ++i)
+    {
+        if (containers[i].refId == -2)
+            continue;
+        try
+        {
+            _cramDecodeContainer(results[i], containers[i], refs[i], context, false);
+        }
+        catch (...)
+        {
+            errors[i] = std::current_exception();
+        }
+    }
+    for (int i = 0; i < nContainers; ++i)
+        if (errors[i])
+            std::rethrow_exception(errors[i]);
+
+    for (int i = 0; i < nContainers; ++i)
+    {
+        if (containers[i].refId == -2)
+            _cramDecodeContainer(results[i], containers[i], refs[i], context, true);
+        append(cram.records, results[i]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function readHeader()                                              BamHeader
+// ----------------------------------------------------------------------------
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readHeader(BamHeader & header,
+           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           Cram const & /*tag*/)
+{
+    clear(header);
+
+    // File definition: magic, version and file id.
+    String<char, Array<4> > magic;
+    read(magic, iter, 4);
+    if (magic != "CRAM")
+        SEQAN_THROW(ParseError("Not in CRAM format."));
+    char major, minor;
+    readOne(major, iter);
+    readOne(minor, iter);
+    if (major != 3)
+        SEQAN_THROW(ParseError("CRAM: only version 3 is supported."));
+    CharString fileId;
+    read(fileId, iter, 20);
+
+    // Header container, its first block holds the SAM header text.
+    CramContainer_ container;
+    if (!_cramReadContainer(container, iter))
+        SEQAN_THROW(ParseError("CRAM: missing header container."));
+    CramBlock_ block;
+    char const * it = begin(container.data, Standard());
+    _cramReadBlock(block, it, end(container.data, Standard()));
+    it = begin(block.data, Standard());
+    int32_t lText;
+    _cramReadInt32(lText, it, end(block.data, Standard()));
+    if (lText < 0 || lText > (int32_t)length(block.data) - 4)
+        SEQAN_THROW(ParseError("CRAM: invalid header length."));
+    CharString samHeader = infix(block.data, 4, 4 + lText);
+    cropAfterFirst(samHeader, EqualsChar<'\0'>());
+
+    Iterator<CharString, Rooted>::Type textIt = begin(samHeader);
+    readHeader(header, context, textIt, Sam());
+
+    // References are numbered in the order of the @SQ lines, read groups in the order of the @RG lines.
+    CramIOContext_ & cram = context.cram;
+    clear(context.translateFile2GlobalRefId);
+    clear(cram.readGroups);
+    clear(cram.records);
+    cram.recordPos = 0;
+    for (unsigned i = 0; i < length(header); ++i)
+    {
+        if (header[i].type != BAM_HEADER_REFERENCE && header[i].type != BAM_HEADER_READ_GROUP)
+            continue;
+        CharString const * id = NULL;
+        for (unsigned j = 0; j < length(header[i].tags); ++j)
+            if (header[i].tags[j].i1 == ((header[i].type == BAM_HEADER_REFERENCE) ? "SN" : "ID"))
+                id = &header[i].tags[j].i2;
+        if (id == NULL)
+            SEQAN_THROW(ParseError("CRAM: @SQ or @RG header line without name."));
+        if (header[i].type == BAM_HEADER_REFERENCE)
+            appendValue(context.translateFile2GlobalRefId, nameToId(contigNamesCache(context), *id));
+        else
+            appendValue(cram.readGroups, *id);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _readBamRecord()
+// ----------------------------------------------------------------------------
+
+// CRAM records cannot be read one by one, readRecords() uses readRecord() instead.
+template <typename TBuffer, typename TForwardIter>
+inline void
+_readBamRecord(TBuffer & /*rawRecord*/, TForwardIter & /*iter*/, Cram)
+{
+    SEQAN_THROW(IOError("CRAM records cannot be read as raw records."));
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecord()                                     BamAlignmentRecord
+// ----------------------------------------------------------------------------
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readRecord(BamAlignmentRecord & record,
+           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           Cram const & /*tag*/)
+{
+    CramIOContext_ & cram = context.cram;
+    if (cram.recordPos == length(cram.records))
+        _cramReadRecords(context, iter);
+    if (cram.recordPos == length(cram.records))
+        SEQAN_THROW(UnexpectedEnd());
+    record = cram.records[cram.recordPos++];
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_READ_CRAM_H_
@@ -0,0 +1,666 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Code for writing CRAM 3.0.
+//
+// Records are collected until a container is full and then written as a
+// container with a single slice.  All data series are stored in external
+// blocks, mates are always stored detached.  Without a reference (or for
+// contigs missing from it) the bases are stored verbatim.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_WRITE_CRAM_H_
+#define INCLUDE_SEQAN_BAM_IO_WRITE_CRAM_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _cramWriteContainerHeader()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget>
+inline void
+_cramWriteContainerHeader(TTarget & target, int32_t len, int32_t refId, int32_t start, int32_t span,
+                          int32_t nRecords, int64_t recordCounter, int64_t bases, int32_t nBlocks,
+                          String<int32_t> const & landmarks)
+{
+    CharString raw;
+    _cramWriteLE32(raw, len);
+    _cramWriteItf8(raw, refId);
+    _cramWriteItf8(raw, start);
+    _cramWriteItf8(raw, span);
+    _cramWriteItf8(raw, nRecords);
+    _cramWriteLtf8(raw, recordCounter);
+    _cramWriteLtf8(raw, bases);
+    _cramWriteItf8(raw, nBlocks);
+    _cramWriteItf8(raw, (int32_t)length(landmarks));
+    for (unsigned i = 0; i < length(landmarks); ++i)
+        _cramWriteItf8(raw, landmarks[i]);
+    uint32_t crc = _cramCrc32(crc32(0L, Z_NULL, 0), begin(raw, Standard()), length(raw));
+    _cramWriteLE32(raw, crc);
+    write(target, raw);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramWriteEofContainer()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget>
+inline void
+_cramWriteEofContainer(TTarget & target)
+{
+    static unsigned char const EOF_CONTAINER[38] =
+    {
+        0x0f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xe0, 0x45, 0x4f, 0x46, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0x00, 0x05, 0xbd, 0xd9, 0x4f, 0x00, 0x01, 0x00, 0x06, 0x06, 0x01, 0x00, 0x01, 0x00,
+        0x01, 0x00, 0xee, 0x63, 0x01, 0x4b
+    };
+    for (unsigned i = 0; i < 38; ++i)
+        writeValue(target, (char)EOF_CONTAINER[i]);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramTagValueLength()
+// ----------------------------------------------------------------------------
+
+// Returns the length of the value of the BAM tag whose type byte is at pos.
+
+inline size_t
+_cramTagValueLength(CharString const & tags, size_t pos)
+{
+    char type = tags[pos];
+    if (type == 'Z' || type == 'H')
+    {
+        size_t end = pos + 1;
+        while (end < length(tags) && tags[end] != '\0')
+            ++end;
+        if (end == length(tags))
+            SEQAN_THROW(IOError("CRAM: unterminated string tag."));
+        return end - pos;  // includes the terminating '\0'
+    }
+    if (type == 'B')
+    {
+        if (pos + 6 > length(tags))
+            SEQAN_THROW(IOError("CRAM: truncated array tag."));
+        int size = getBamTypeSize(tags[pos + 1]);
+        uint32_t count = _cramLoadLE32(reinterpret_cast<unsigned char const *>(begin(tags, Standard()) + pos + 2));
+        if (size <= 0 || pos + 6 + (size_t)count * size > length(tags))
+            SEQAN_THROW(IOError("CRAM: invalid array tag."));
+        return 5 + (size_t)count * size;
+    }
+    int size = getBamTypeSize(type);
+    if (size <= 0 || pos + 1 + size > length(tags))
+        SEQAN_THROW(IOError("CRAM: invalid tag type."));
+    return size;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramQueryLength()
+// ----------------------------------------------------------------------------
+
+inline int32_t
+_cramQueryLength(String<CigarElement<> > const & cigar)
+{
+    int32_t len = 0;
+    for (unsigned i = 0; i < length(cigar); ++i)
+        if (cigar[i].operation == 'M' || cigar[i].operation == 'I' || cigar[i].operation == 'S' ||
+            cigar[i].operation == '=' || cigar[i].operation == 'X')
+            len += cigar[i].count;
+    return len;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramEncodeFeatures()
+// ----------------------------------------------------------------------------
+
+// Appends the read features of a mapped record to the data series, ref is
+// NULL if the bases are to be stored verbatim.
+
+inline void
+_cramEncodeFeatures(String<CharString> & series,
+                    BamAlignmentRecord const & record,
+                    CharString const & seq,
+                    CramRefRegion_ const * ref)
+{
+    bool hasSeq = !empty(seq);
+    int32_t readPos = 0;
+    int64_t refPos = record.beginPos;
+    int32_t prevFeaturePos = 0;
+    int32_t nFeatures = 0;
+
+    auto addFeature = [&](char code)
+    {
+        appendValue(series[CRAM_DS_FC], code);
+        _cramWriteItf8(series[CRAM_DS_FP], readPos + 1 - prevFeaturePos);
+        prevFeaturePos = readPos + 1;
+        ++nFeatures;
+    };
+
+    for (unsigned i = 0; i < length(record.cigar); ++i)
+    {
+        char op = record.cigar[i].operation;
+        int32_t count = record.cigar[i].count;
+        switch (op)
+        {
+            case 'M':
+            case '=':
+            case 'X':
+                if (!hasSeq)
+                {
+                }
+                else if (ref != NULL)
+                {
+                    for (int32_t k = 0; k < count; ++k)
+                    {
+                        char base = seq[readPos + k];
+                        char refBase = _cramRefBase(ref, refPos + k);
+                        if (base == refBase)
+                            continue;
+                        int32_t savedPos = readPos;
+                        readPos += k;
+                        unsigned bi = _cramBaseIndex(base);
+                        unsigned ri = _cramBaseIndex(refBase);
+                        if ((bi < 4 || base == 'N') && (ri < 4 || refBase == 'N'))
+                        {
+                            // The default substitution matrix codes the alternatives in ACGTN order.
+                            addFeature('X');
+                            appendValue(series[CRAM_DS_BS], (char)(bi < ri ? bi : bi - 1));
+                        }
+                        else
+                        {
+                            addFeature('B');
+                            appendValue(series[CRAM_DS_BA], base);
+                            appendValue(series[CRAM_DS_QS], (readPos < (int32_t)length(record.qual)) ?
+                                                            (char)(record.qual[readPos] - '!') : '\xff');
+                        }
+                        readPos = savedPos;
+                    }
+                }
+                else
+                {
+                    addFeature('b');
+                    _cramWriteItf8(series[CRAM_DS_BB], count);
+                    append(series[CRAM_DS_BB], infix(seq, readPos, readPos + count));
+                }
+                readPos += count;
+                refPos += count;
+                break;
+            case 'I':
+            case 'S':
+                addFeature(op);
+                if (hasSeq)
+                    append(series[op == 'I' ? CRAM_DS_IN : CRAM_DS_SC], infix(seq, readPos, readPos + count));
+                else
+                    resize(series[op == 'I' ? CRAM_DS_IN : CRAM_DS_SC],
+                           length(series[op == 'I' ? CRAM_DS_IN : CRAM_DS_SC]) + count, 'N');
+                appendValue(series[op == 'I' ? CRAM_DS_IN : CRAM_DS_SC], '\0');
+                readPos += count;
+                break;
+            case 'D':
+            case 'N':
+                addFeature(op);
+                _cramWriteItf8(series[op == 'D' ? CRAM_DS_DL : CRAM_DS_RS], count);
+                refPos += count;
+                break;
+            case 'H':
+            case 'P':
+                addFeature(op);
+                _cramWriteItf8(series[op == 'H' ? CRAM_DS_HC : CRAM_DS_PD], count);
+                break;
+            default:
+                SEQAN_THROW(IOError("CRAM: invalid CIGAR operation."));
+        }
+    }
+    _cramWriteItf8(series[CRAM_DS_FN], nFeatures);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramWriteContainer()
+// ----------------------------------------------------------------------------
+
+// Encodes the first n pending records into a container and removes them.
+
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+_cramWriteContainer(TTarget & target,
+                    BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                    size_t n)
+{
+    CramIOContext_ & cram = context.cram;
+    if (n == 0)
+        return;
+    String<BamAlignmentRecord> const & records = cram.pending;
+
+    // Reference id and covered range of the container.
+    int32_t refId = records[0].rID;
+    for (size_t i = 1; i < n; ++i)
+        if (records[i].rID != refId)
+            refId = -2;
+    bool apDelta = refId != -2;
+
+    int32_t alnStart = 0, alnSpan = 0;
+    std::map<int32_t, std::pair<int32_t, int32_t> > ranges;
+    for (size_t i = 0; i < n; ++i)
+    {
+        BamAlignmentRecord const & record = records[i];
+        if (record.rID < 0 || record.beginPos < 0)
+            continue;
+        int32_t endPos = record.beginPos + std::max(1, (int32_t)getAlignmentLengthInRef(record));
+        std::map<int32_t, std::pair<int32_t, int32_t> >::iterator it = ranges.find(record.rID);
+        if (it == ranges.end())
+            ranges[record.rID] = std::make_pair(record.beginPos, endPos);
+        else
+            it->second = std::make_pair(std::min(it->second.first, record.beginPos),
+                                        std::max(it->second.second, endPos));
+    }
+    if (refId >= 0 && !ranges.empty())
+    {
+        alnStart = ranges[refId].first + 1;
+        alnSpan = ranges[refId].second - ranges[refId].first;
+    }
+
+    // Fetch the reference regions.
+    std::map<int32_t, CramRefRegion_> refs;
+    for (std::map<int32_t, std::pair<int32_t, int32_t> >::const_iterator it = ranges.begin(); it != ranges.end(); ++it)
+        if (it->first < (int32_t)length(contigNames(context)))
+            _cramFetchReference(refs[it->first], cram, contigNames(context)[it->first], it->first,
+                                it->second.first, it->second.second);
+
+    // Read groups by name.
+    std::map<CharString, int32_t> readGroupIds;
+    for (unsigned i = 0; i < length(cram.readGroups); ++i)
+        readGroupIds[cram.readGroups[i]] = i;
+
+    String<CharString> series;
+    resize(series, CRAM_DS_COUNT, Exact());
+    std::map<int32_t, CharString> tagBlocks;
+    std::map<CharString, int32_t> tagLineIds;
+    String<CharString> tagLines;
+    bool usedRef = false;
+    int64_t bases = 0;
+    int32_t prevPos = alnStart;
+    CharString seq, tagLine;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        BamAlignmentRecord const & record = records[i];
+        assign(seq, record.seq);
+        bool mapped = !hasFlagUnmapped(record);
+
+        int32_t readLen = length(seq);
+        if (empty(seq) && mapped)
+            readLen = _cramQueryLength(record.cigar);
+        else if (mapped && !empty(record.cigar) && _cramQueryLength(record.cigar) != readLen)
+            SEQAN_THROW(IOError("CRAM: CIGAR does not match the sequence length."));
+        bool hasQual = !empty(seq) && (int32_t)length(record.qual) == readLen;
+        bases += readLen;
+
+        int32_t cf = 0x2;
+        if (hasQual)
+            cf |= 0x1;
+        if (empty(seq))
+            cf |= 0x8;
+
+        // Auxiliary tags, a read group from the header is stored in the RG series.
+        int32_t rg = -1;
+        clear(tagLine);
+        for (size_t pos = 0; pos + 3 <= length(record.tags);)
+        {
+            size_t valueLen = _cramTagValueLength(record.tags, pos + 2);
+            char c0 = record.tags[pos], c1 = record.tags[pos + 1], type = record.tags[pos + 2];
+            if (c0 == 'R' && c1 == 'G' && type == 'Z' && rg == -1)
+            {
+                std::map<CharString, int32_t>::const_iterator it =
+                    readGroupIds.find(CharString(infix(record.tags, pos + 3, pos + 2 + valueLen)));
+                if (it != readGroupIds.end())
+                {
+                    rg = it->second;
+                    pos += 3 + valueLen;
+                    continue;
+                }
+            }
+            appendValue(tagLine, c0);
+            appendValue(tagLine, c1);
+            appendValue(tagLine, type);
+            int32_t key = ((int32_t)(unsigned char)c0 << 16) | ((int32_t)(unsigned char)c1 << 8) | (unsigned char)type;
+            CharString & block = tagBlocks[key];
+            _cramWriteItf8(block, (int32_t)valueLen);
+            append(block, infix(record.tags, pos + 3, pos + 3 + valueLen));
+            pos += 3 + valueLen;
+        }
+        std::map<CharString, int32_t>::iterator lineIt = tagLineIds.find(tagLine);
+        if (lineIt == tagLineIds.end())
+        {
+            lineIt = tagLineIds.insert(std::make_pair(tagLine, (int32_t)length(tagLines))).first;
+            appendValue(tagLines, tagLine);
+        }
+
+        _cramWriteItf8(series[CRAM_DS_BF], record.flag);
+        _cramWriteItf8(series[CRAM_DS_CF], cf);
+        if (refId == -2)
+            _cramWriteItf8(series[CRAM_DS_RI], record.rID);
+        _cramWriteItf8(series[CRAM_DS_RL], readLen);
+        int32_t pos = record.beginPos + 1;
+        _cramWriteItf8(series[CRAM_DS_AP], apDelta ? pos - prevPos : pos);
+        prevPos = pos;
+        _cramWriteItf8(series[CRAM_DS_RG], rg);
+        append(series[CRAM_DS_RN], record.qName);
+        appendValue(series[CRAM_DS_RN], '\0');
+        _cramWriteItf8(series[CRAM_DS_MF], (hasFlagNextRC(record) ? 0x1 : 0) | (hasFlagNextUnmapped(record) ? 0x2 : 0));
+        _cramWriteItf8(series[CRAM_DS_NS], record.rNextId);
+        _cramWriteItf8(series[CRAM_DS_NP], record.pNext + 1);
+        _cramWriteItf8(series[CRAM_DS_TS], record.tLen);
+        _cramWriteItf8(series[CRAM_DS_TL], lineIt->second);
+
+        if (mapped)
+        {
+            CramRefRegion_ const * ref = NULL;
+            std::map<int32_t, CramRefRegion_>::const_iterator refIt = refs.find(record.rID);
+            if (refIt != refs.end() && refIt->second.refId == record.rID)
+                ref = &refIt->second;
+            usedRef |= ref != NULL && !empty(seq);
+            _cramEncodeFeatures(series, record, seq, ref);
+            _cramWriteItf8(series[CRAM_DS_MQ], record.mapQ);
+        }
+        else
+        {
+            append(series[CRAM_DS_BA], seq);
+        }
+        if (hasQual)
+            for (int32_t k = 0; k < readLen; ++k)
+                appendValue(series[CRAM_DS_QS], (char)(record.qual[k] - '!'));
+    }
+
+    // Compression header: preservation map, data series and tag encodings.
+    CharString map, entries;
+    {
+        CharString dictionary;
+        for (unsigned i = 0; i < length(tagLines); ++i)
+        {
+            append(dictionary, tagLines[i]);
+            appendValue(dictionary, '\0');
+        }
+        _cramWriteItf8(entries, 5);
+        append(entries, "RN");
+        appendValue(entries, '\1');
+        append(entries, "AP");
+        appendValue(entries, apDelta ? '\1' : '\0');
+        append(entries, "RR");
+        appendValue(entries, usedRef ? '\1' : '\0');
+        append(entries, "SM");
+        for (unsigned i = 0; i < 5; ++i)
+            appendValue(entries, '\x1b');
+        append(entries, "TD");
+        _cramWriteItf8(entries, (int32_t)length(dictionary));
+        append(entries, dictionary);
+        _cramWriteItf8(map, (int32_t)length(entries));
+        append(map, entries);
+    }
+    {
+        clear(entries);
+        unsigned nSeries = 0;
+        for (unsigned ds = 0; ds < CRAM_DS_COUNT; ++ds)
+        {
+            if (ds == CRAM_DS_NF || ds == CRAM_DS_QQ || ds == CRAM_DS_TC || ds == CRAM_DS_TN ||
+                (ds == CRAM_DS_RI && refId != -2))
+                continue;
+            int32_t key = _cramDataSeriesKey(ds);
+            appendValue(entries, (char)(key >> 8));
+            appendValue(entries, (char)(key & 0xff));
+            if (ds == CRAM_DS_RN || ds == CRAM_DS_IN || ds == CRAM_DS_SC)
+                _cramWriteByteArrayStopEncoding(entries, '\0', ds + 1);
+            else if (ds == CRAM_DS_BB)
+                _cramWriteByteArrayLenEncoding(entries, ds + 1);
+            else
+                _cramWriteExternalEncoding(entries, ds + 1);
+            ++nSeries;
+        }
+        CharString tmp;
+        _cramWriteItf8(tmp, (int32_t)nSeries);
+        append(tmp, entries);
+        _cramWriteItf8(map, (int32_t)length(tmp));
+        append(map, tmp);
+    }
+    {
+        clear(entries);
+        _cramWriteItf8(entries, (int32_t)tagBlocks.size());
+        for (std::map<int32_t, CharString>::const_iterator it = tagBlocks.begin(); it != tagBlocks.end(); ++it)
+        {
+            _cramWriteItf8(entries, it->first);
+            _cramWriteByteArrayLenEncoding(entries, it->first);
+        }
+        _cramWriteItf8(map, (int32_t)length(entries));
+        append(map, entries);
+    }
+
+    CharString containerData;
+    _cramWriteBlock(containerData, map, CRAM_CONTENT_COMPRESSION_HEADER, 0, CRAM_METHOD_RAW);
+    String<int32_t> landmarks;
+    appendValue(landmarks, (int32_t)length(containerData));
+
+    // External blocks.
+    CharString blocks;
+    String<int32_t> contentIds;
+    for (unsigned ds = 0; ds < CRAM_DS_COUNT; ++ds)
+    {
+        if (ds == CRAM_DS_NF || ds == CRAM_DS_QQ || ds == CRAM_DS_TC || ds == CRAM_DS_TN ||
+            (ds == CRAM_DS_RI && refId != -2))
+            continue;
+        _cramWriteBlock(blocks, series[ds], CRAM_CONTENT_EXTERNAL, ds + 1,
+                        (ds == CRAM_DS_QS) ? CRAM_METHOD_RANS4X8 : CRAM_METHOD_GZIP);
+        appendValue(contentIds, ds + 1);
+    }
+    for (std::map<int32_t, CharString>::const_iterator it = tagBlocks.begin(); it != tagBlocks.end(); ++it)
+    {
+        _cramWriteBlock(blocks, it->second, CRAM_CONTENT_EXTERNAL, it->first);
+        appendValue(contentIds, it->first);
+    }
+
+    // Slice header, the MD5 covers the reference span of single-reference slices.
+    unsigned char md5[16];
+    std::memset(md5, 0, sizeof(md5));
+    if (refId >= 0 && usedRef)
+    {
+        CramRefRegion_ const & ref = refs[refId];
+        size_t len = std::min((size_t)alnSpan, length(ref.seq));
+        _cramMd5(md5, begin(ref.seq, Standard()), len);
+    }
+    CharString sliceHeader;
+    _cramWriteItf8(sliceHeader, refId);
+    _cramWriteItf8(sliceHeader, alnStart);
+    _cramWriteItf8(sliceHeader, alnSpan);
+    _cramWriteItf8(sliceHeader, (int32_t)n);
+    _cramWriteLtf8(sliceHeader, cram.recordCounter);
+    _cramWriteItf8(sliceHeader, (int32_t)length(contentIds) + 1);
+    _cramWriteItf8(sliceHeader, (int32_t)length(contentIds));
+    for (unsigned i = 0; i < length(contentIds); ++i)
+        _cramWriteItf8(sliceHeader, contentIds[i]);
+    _cramWriteItf8(sliceHeader, -1);
+    for (unsigned i = 0; i < 16; ++i)
+        appendValue(sliceHeader, (char)md5[i]);
+
+    _cramWriteBlock(containerData, sliceHeader, CRAM_CONTENT_SLICE_HEADER, 0, CRAM_METHOD_RAW);
+    _cramWriteBlock(containerData, CharString(), CRAM_CONTENT_CORE, 0, CRAM_METHOD_RAW);
+    append(containerData, blocks);
+
+    _cramWriteContainerHeader(target, length(containerData), refId, alnStart, alnSpan, n, cram.recordCounter,
+                              bases, 3 + length(contentIds), landmarks);
+    write(target, containerData);
+
+    cram.recordCounter += n;
+    erase(cram.pending, 0, n);
+}
+
+// ----------------------------------------------------------------------------
+// Function _cramFinish()
+// ----------------------------------------------------------------------------
+
+// Writes the pending records and the EOF container.
+
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+_cramFinish(TTarget & target, BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context)
+{
+    CramIOContext_ & cram = context.cram;
+    if (!cram.headerWritten)
+        return;
+    _cramWriteContainer(target, context, length(cram.pending));
+    _cramWriteEofContainer(target);
+    cram.headerWritten = false;
+}
+
+// ----------------------------------------------------------------------------
+// Function write()                                                   BamHeader
+// ----------------------------------------------------------------------------
+
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+write(TTarget & target,
+      BamHeader const & header,
+      BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+      Cram const & /*tag*/)
+{
+    CramIOContext_ & cram = context.cram;
+
+    // File definition: magic, version 3.0 and an empty file id.
+    write(target, "CRAM");
+    writeValue(target, '\3');
+    writeValue(target, '\0');
+    for (unsigned i = 0; i < 20; ++i)
+        writeValue(target, '\0');
+
+    // The @SQ lines are written in the order of the contigs in the context so
+    // that CRAM reference ids equal the global ids.
+    clear(cram.readGroups);
+    String<int> sqRecord;
+    int32_t nRef = _max(length(contigNames(context)), length(contigLengths(context)));
+    resize(sqRecord, nRef, -1);
+    for (unsigned i = 0; i < length(header); ++i)
+    {
+        for (unsigned j = 0; j < length(header[i].tags); ++j)
+        {
+            size_t globalRefId = 0;
+            if (header[i].type == BAM_HEADER_REFERENCE && header[i].tags[j].i1 == "SN" &&
+                getIdByName(globalRefId, contigNamesCache(context), header[i].tags[j].i2) &&
+                (int32_t)globalRefId < nRef)
+                sqRecord[globalRefId] = i;
+            else if (header[i].type == BAM_HEADER_READ_GROUP && header[i].tags[j].i1 == "ID")
+                appendValue(cram.readGroups, header[i].tags[j].i2);
+        }
+    }
+
+    CharString text;
+    bool sqWritten = false;
+    for (unsigned i = 0; i <= length(header); ++i)
+    {
+        if (i < length(header) && header[i].type != BAM_HEADER_REFERENCE)
+        {
+            write(text, header[i], context, Sam());
+            continue;
+        }
+        if (sqWritten)
+            continue;
+        for (int32_t r = 0; r < nRef; ++r)
+        {
+            if (sqRecord[r] >= 0)
+            {
+                write(text, header[sqRecord[r]], context, Sam());
+                continue;
+            }
+            write(text, "@SQ\tSN:");
+            if (r < (int32_t)length(contigNames(context)))
+                write(text, contigNames(context)[r]);
+            write(text, "\tLN:");
+            appendNumber(text, (r < (int32_t)length(contigLengths(context))) ? contigLengths(context)[r] : 0);
+            writeValue(text, '\n');
+        }
+        sqWritten = true;
+    }
+
+    CharString content, block;
+    _cramWriteLE32(content, length(text));
+    append(content, text);
+    _cramWriteBlock(block, content, CRAM_CONTENT_FILE_HEADER, 0, CRAM_METHOD_RAW);
+    _cramWriteContainerHeader(target, length(block), 0, 0, 0, 0, 0, 0, 1, String<int32_t>());
+    write(target, block);
+
+    clear(cram.pending);
+    cram.recordCounter = 0;
+    cram.headerWritten = true;
+}
+
+// ----------------------------------------------------------------------------
+// Function write()                                          BamAlignmentRecord
+// ----------------------------------------------------------------------------
+
+// Containers hold up to containerSize records of one contig.  Small contigs
+// with less than 100 records are pooled into multi-reference containers.
+
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+write(TTarget & target,
+      BamAlignmentRecord const & record,
+      BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+      Cram const & /*tag*/)
+{
+    static size_t const MIN_SINGLE_REF = 100;
+    CramIOContext_ & cram = context.cram;
+
+    // Length of the run of records on the same contig at the end of the pending records.
+    size_t run = 0;
+    while (run < length(cram.pending) && run < MIN_SINGLE_REF &&
+           cram.pending[length(cram.pending) - 1 - run].rID == back(cram.pending).rID)
+        ++run;
+
+    if (!empty(cram.pending) && back(cram.pending).rID != record.rID && run >= MIN_SINGLE_REF)
+    {
+        // Previous contig has enough records for its own container.
+        _cramWriteContainer(target, context, length(cram.pending));
+    }
+    else if (!empty(cram.pending) && back(cram.pending).rID == record.rID && run + 1 == MIN_SINGLE_REF &&
+             length(cram.pending) > run)
+    {
+        // Write pooled records of small contigs, the current contig gets its own container.
+        _cramWriteContainer(target, context, length(cram.pending) - run);
+    }
+
+    appendValue(cram.pending, record);
+    if (length(cram.pending) >= cram.containerSize)
+        _cramWriteContainer(target, context, length(cram.pending));
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_WRITE_CRAM_H_
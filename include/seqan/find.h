@@ -92,6 +92,7 @@
 
 #include <seqan/find/find_score.h>
 #include <seqan/find/find_myers_ukkonen.h>
+#include <seqan/find/find_multiple_myers.h>
 #include <seqan/find/find_abndm.h>
 #include <seqan/find/find_pex.h>
 
@@ -0,0 +1,506 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Approximate multi-pattern search with Myers' bit-vector algorithm.
+//
+// Every needle occupies one 64 bit lane of a SIMD vector, so a single pass
+// over the haystack advances the automata of all needles in lockstep.  The
+// bit masks are stored character-major ([character][block]) so the blocks
+// touched for one haystack character are contiguous in memory.  Without SIMD
+// support the lanes fall back to plain 64 bit words.
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_FIND_MULTIPLE_MYERS_H
+#define SEQAN_HEADER_FIND_MULTIPLE_MYERS_H
+
+namespace seqan2
+{
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+/*!
+ * @class MultipleMyersPattern
+ * @extends Pattern
+ * @headerfile <seqan/find.h>
+ * @brief Approximate multiple string matching with bit-parallel Myers automata in SIMD lanes.
+ *
+ * @signature template <typename TNeedles>
+ *            class Pattern<TNeedles, MultipleMyersUkkonen>;
+ *
+ * @tparam TNeedles The needle type, a string of keywords. Types: String, StringSet
+ *
+ * Each keyword must have a length between 1 and 64.  The keywords are packed into the lanes of
+ * <tt>SimdVector&lt;uint64_t&gt;</tt> if SIMD is enabled and processed one after another otherwise.  All
+ * keywords are searched with the same score limit (negative edit distance), see @link
+ * MultipleMyersPattern#setScoreLimit @endlink.
+ *
+ * After a successful @link Finder#find @endlink, the finder points to the end position of the match,
+ * <tt>position(pattern)</tt> returns the index of the matching keyword and @link MultipleMyersPattern#getScore
+ * @endlink its score.  If several keywords end at the same position they are reported in ascending order
+ * before the finder is advanced.
+ *
+ * @section Examples
+ *
+ * @code{.cpp}
+ * StringSet<DnaString> primers;
+ * appendValue(primers, "ACGTTGCA");
+ * appendValue(primers, "TTGACCAG");
+ *
+ * DnaString genome = "GGACGATGCATTGACGAG";
+ * Finder<DnaString> finder(genome);
+ * Pattern<StringSet<DnaString>, MultipleMyersUkkonen> pattern(primers, -1);
+ * while (find(finder, pattern))
+ *     std::cout << position(pattern) << '\t' << position(finder) << '\t' << getScore(pattern) << '\n';
+ * @endcode
+ */
+
+struct MultipleMyersUkkonen_;
+typedef Tag<MultipleMyersUkkonen_> MultipleMyersUkkonen;
+
+template <typename TNeedles>
+class Pattern<TNeedles, MultipleMyersUkkonen>
+{
+public:
+#ifdef SEQAN_SEQANSIMD_ENABLED
+    typedef typename SimdVector<uint64_t>::Type TVector;
+#else
+    typedef uint64_t TVector;
+#endif
+    typedef String<TVector, Alloc<OverAligned> > TVectors;
+    typedef typename Size<TNeedles>::Type TSize;
+
+    Holder<TNeedles> data_host;
+    TVectors bitMasks;          // match masks per character and block (Eq in "Myers")
+    TVectors lastBits;          // per lane: position of the highest bit (|keyword| - 1)
+    TVectors scoreLimits;       // per lane: maxErrors + 1, 0 for unused lanes
+    TVectors VP;
+    TVectors VN;
+    TVectors errors;            // per lane: edit distance of the keyword to the haystack suffix
+    unsigned alphabetSize;
+    unsigned blockCount;
+    unsigned maxErrors;
+    std::deque<Pair<TSize, unsigned> > data_hits;  // keywords (and their errors) ending at the current position
+    TSize data_keywordIndex;
+    unsigned data_errors;
+
+    Pattern() :
+        alphabetSize(0), blockCount(0), maxErrors(0), data_keywordIndex(0), data_errors(0)
+    {}
+
+    template <typename TNeedles2>
+    Pattern(TNeedles2 const & ndls, int _limit = -1) :
+        alphabetSize(0), blockCount(0), maxErrors(-_limit), data_keywordIndex(0), data_errors(0)
+    {
+        setHost(*this, ndls);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+template <typename TNeedles>
+struct Host<Pattern<TNeedles, MultipleMyersUkkonen> >
+{
+    typedef TNeedles Type;
+};
+
+template <typename TNeedles>
+struct Host<Pattern<TNeedles, MultipleMyersUkkonen> const>
+{
+    typedef TNeedles const Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _multipleMyersLane()
+// ----------------------------------------------------------------------------
+
+// Lane access for the scalar fallback and the SIMD vector type.
+
+inline uint64_t
+_multipleMyersLane(uint64_t const & vec, unsigned)
+{
+    return vec;
+}
+
+inline void
+_multipleMyersSetLane(uint64_t & vec, unsigned, uint64_t val)
+{
+    vec = val;
+}
+
+#ifdef SEQAN_SEQANSIMD_ENABLED
+inline uint64_t
+_multipleMyersLane(SimdVector<uint64_t>::Type const & vec, unsigned lane)
+{
+    return vec[lane];
+}
+
+inline void
+_multipleMyersSetLane(SimdVector<uint64_t>::Type & vec, unsigned lane, uint64_t val)
+{
+    vec[lane] = val;
+}
+#endif
+
+template <typename TVector>
+struct MultipleMyersLanes_
+{
+    static const unsigned VALUE = sizeof(TVector) / sizeof(uint64_t);
+};
+
+// ----------------------------------------------------------------------------
+// Function _multipleMyersFill()
+// ----------------------------------------------------------------------------
+
+template <typename TVector>
+inline void
+_multipleMyersFill(String<TVector, Alloc<OverAligned> > & vectors, unsigned count, uint64_t val)
+{
+    resize(vectors, count, Exact());
+    for (unsigned i = 0; i < count; ++i)
+        for (unsigned lane = 0; lane < MultipleMyersLanes_<TVector>::VALUE; ++lane)
+            _multipleMyersSetLane(vectors[i], lane, val);
+}
+
+// ----------------------------------------------------------------------------
+// Function setHost()
+// ----------------------------------------------------------------------------
+
+template <typename TNeedles, typename TNeedles2>
+inline void
+setHost(Pattern<TNeedles, MultipleMyersUkkonen> & me, TNeedles2 const & ndls)
+{
+    typedef Pattern<TNeedles, MultipleMyersUkkonen> TPattern;
+    typedef typename TPattern::TVector TVector;
+    typedef typename Value<TNeedles>::Type TKeyword;
+    typedef typename Value<TKeyword>::Type TAlphabet;
+
+    unsigned const LANES = MultipleMyersLanes_<TVector>::VALUE;
+
+    me.alphabetSize = ValueSize<TAlphabet>::VALUE;
+    me.blockCount = (length(ndls) + LANES - 1) / LANES;
+
+    _multipleMyersFill(me.bitMasks, me.alphabetSize * me.blockCount, 0u);
+    _multipleMyersFill(me.lastBits, me.blockCount, 0u);
+    _multipleMyersFill(me.scoreLimits, me.blockCount, 0u);
+
+    for (unsigned i = 0; i < length(ndls); ++i)
+    {
+        TKeyword const & keyword = ndls[i];
+        SEQAN_ASSERT_GT_MSG(length(keyword), 0u, "Keywords must not be empty.");
+        SEQAN_ASSERT_LEQ_MSG(length(keyword), 64u, "Keywords must not be longer than 64 characters.");
+
+        unsigned block = i / LANES;
+        unsigned lane = i % LANES;
+        for (unsigned j = 0; j < length(keyword); ++j)
+        {
+            TVector & mask = me.bitMasks[ordValue(convert<TAlphabet>(keyword[j])) * me.blockCount + block];
+            _multipleMyersSetLane(mask, lane, _multipleMyersLane(mask, lane) | (1ull << j));
+        }
+        _multipleMyersSetLane(me.lastBits[block], lane, length(keyword) - 1);
+    }
+    setValue(me.data_host, ndls);
+    _patternInit(me);
+}
+
+template <typename TNeedles, typename TNeedles2>
+inline void
+setHost(Pattern<TNeedles, MultipleMyersUkkonen> & me, TNeedles2 & ndls)
+{
+    setHost(me, reinterpret_cast<TNeedles2 const &>(ndls));
+}
+
+// ----------------------------------------------------------------------------
+// Function _patternInit()
+// ----------------------------------------------------------------------------
+
+template <typename TNeedles>
+inline void
+_patternInit(Pattern<TNeedles, MultipleMyersUkkonen> & me)
+{
+    typedef typename Pattern<TNeedles, MultipleMyersUkkonen>::TVector TVector;
+    unsigned const LANES = MultipleMyersLanes_<TVector>::VALUE;
+
+    _multipleMyersFill(me.VP, me.blockCount, ~0ull);
+    _multipleMyersFill(me.VN, me.blockCount, 0u);
+    _multipleMyersFill(me.errors, me.blockCount, 0u);
+
+    // unused lanes act as never matching keywords of length 1
+    for (unsigned block = 0; block < me.blockCount; ++block)
+        for (unsigned lane = 0; lane < LANES; ++lane)
+            _multipleMyersSetLane(me.errors[block], lane, _multipleMyersLane(me.lastBits[block], lane) + 1);
+    for (unsigned i = 0; i < length(value(me.data_host)); ++i)
+        _multipleMyersSetLane(me.scoreLimits[i / LANES], i % LANES, me.maxErrors + 1);
+    me.data_hits.clear();
+    me.data_keywordIndex = 0;
+    me.data_errors = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function host()
+// ----------------------------------------------------------------------------
+
+template <typename TNeedles>
+inline typename Host<Pattern<TNeedles, MultipleMyersUkkonen> const>::Type &
+host(Pattern<TNeedles, MultipleMyersUkkonen> & me)
+{
+    return value(me.data_host);
+}
+
+template <typename TNeedles>
+inline typename Host<Pattern<TNeedles, MultipleMyersUkkonen> const>::Type &
+host(Pattern<TNeedles, MultipleMyersUkkonen> const & me)
+{
+    return value(me.data_host);
+}
+
+// ----------------------------------------------------------------------------
+// Function position()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn MultipleMyersPattern#position
+ * @brief Index of the keyword of the last match.
+ *
+ * @signature TSize position(pattern);
+ *
+ * @param[in] pattern The pattern to query.
+ *
+ * @return TSize The index of the keyword in the needle set.
+ */
+
+template <typename TNeedles>
+inline typename Size<TNeedles>::Type
+position(Pattern<TNeedles, MultipleMyersUkkonen> const & me)
+{
+    return me.data_keywordIndex;
+}
+
+// ----------------------------------------------------------------------------
+// Function scoreLimit()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn MultipleMyersPattern#scoreLimit
+ * @brief The minimal score a match must reach.
+ *
+ * @signature int scoreLimit(pattern);
+ *
+ * @param[in] pattern The pattern to query.
+ *
+ * @return int The score limit, i.e. the negative number of allowed errors.
+ */
+
+template <typename TNeedles>
+inline int
+scoreLimit(Pattern<TNeedles, MultipleMyersUkkonen> const & me)
+{
+    return -(int)me.maxErrors;
+}
+
+// ----------------------------------------------------------------------------
+// Function setScoreLimit()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn MultipleMyersPattern#setScoreLimit
+ * @brief Set the minimal score a match must reach.
+ *
+ * @signature void setScoreLimit(pattern, limit);
+ *
+ * @param[in,out] pattern The pattern to set the limit for.
+ * @param[in]     limit   The score limit, i.e. the negative number of allowed errors.
+ *
+ * The limit takes effect with the next search started on an empty finder.
+ */
+
+template <typename TNeedles, typename TScoreValue>
+inline void
+setScoreLimit(Pattern<TNeedles, MultipleMyersUkkonen> & me, TScoreValue minScore)
+{
+    me.maxErrors = -(int)minScore;
+}
+
+// ----------------------------------------------------------------------------
+// Function getScore()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn MultipleMyersPattern#getScore
+ * @brief Score of the last match.
+ *
+ * @signature int getScore(pattern);
+ *
+ * @param[in] pattern The pattern to query.
+ *
+ * @return int The negative edit distance of the keyword to the haystack window ending at the match position.
+ */
+
+template <typename TNeedles>
+inline int
+getScore(Pattern<TNeedles, MultipleMyersUkkonen> const & me)
+{
+    return -(int)me.data_errors;
+}
+
+// ----------------------------------------------------------------------------
+// Function _multipleMyersStep()
+// ----------------------------------------------------------------------------
+
+// Advances all automata by one haystack character and returns whether a lane
+// reached the score limit.
+
+template <typename TNeedles>
+inline bool
+_multipleMyersStep(Pattern<TNeedles, MultipleMyersUkkonen> & me, unsigned ord)
+{
+    typedef typename Pattern<TNeedles, MultipleMyersUkkonen>::TVector TVector;
+
+    TVector const * eqs = begin(me.bitMasks, Standard()) + ord * me.blockCount;
+    TVector * VP = begin(me.VP, Standard());
+    TVector * VN = begin(me.VN, Standard());
+    TVector * errors = begin(me.errors, Standard());
+    TVector const * lastBits = begin(me.lastBits, Standard());
+    TVector const * limits = begin(me.scoreLimits, Standard());
+
+    TVector anyHit = errors[0] ^ errors[0];
+    for (unsigned block = 0; block < me.blockCount; ++block)
+    {
+        TVector X = eqs[block] | VN[block];
+        TVector D0 = (((X & VP[block]) + VP[block]) ^ VP[block]) | X;
+        TVector HN = VP[block] & D0;
+        TVector HP = VN[block] | ~(VP[block] | D0);
+        X = HP << 1;
+        VN[block] = X & D0;
+        VP[block] = (HN << 1) | ~(X | D0);
+        errors[block] = errors[block] + ((HP >> lastBits[block]) & 1) - ((HN >> lastBits[block]) & 1);
+        anyHit |= errors[block] - limits[block];
+    }
+
+    // the sign bit of (errors - limit) is set exactly for lanes with errors <= maxErrors
+    uint64_t hit = 0;
+    for (unsigned lane = 0; lane < MultipleMyersLanes_<TVector>::VALUE; ++lane)
+        hit |= _multipleMyersLane(anyHit, lane);
+    return (hit >> 63) != 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _multipleMyersCollectHits()
+// ----------------------------------------------------------------------------
+
+template <typename TNeedles>
+inline void
+_multipleMyersCollectHits(Pattern<TNeedles, MultipleMyersUkkonen> & me)
+{
+    typedef Pattern<TNeedles, MultipleMyersUkkonen> TPattern;
+    typedef typename TPattern::TVector TVector;
+    typedef typename TPattern::TSize TSize;
+
+    unsigned const LANES = MultipleMyersLanes_<TVector>::VALUE;
+    for (unsigned block = 0; block < me.blockCount; ++block)
+        for (unsigned lane = 0; lane < LANES; ++lane)
+        {
+            uint64_t errors = _multipleMyersLane(me.errors[block], lane);
+            if (((errors - _multipleMyersLane(me.scoreLimits[block], lane)) >> 63) != 0)
+                me.data_hits.push_back(Pair<TSize, unsigned>(block * LANES + lane, errors));
+        }
+}
+
+// ----------------------------------------------------------------------------
+// Function _multipleMyersNextHit()
+// ----------------------------------------------------------------------------
+
+template <typename TFinder, typename TNeedles>
+inline void
+_multipleMyersNextHit(TFinder & finder, Pattern<TNeedles, MultipleMyersUkkonen> & me)
+{
+    me.data_keywordIndex = me.data_hits.front().i1;
+    me.data_errors = me.data_hits.front().i2;
+    me.data_hits.pop_front();
+    _setFinderEnd(finder);
+}
+
+// ----------------------------------------------------------------------------
+// Function find()
+// ----------------------------------------------------------------------------
+
+template <typename TFinder, typename TNeedles>
+inline bool
+find(TFinder & finder, Pattern<TNeedles, MultipleMyersUkkonen> & me)
+{
+    typedef typename Value<TNeedles>::Type TKeyword;
+    typedef typename Value<TKeyword>::Type TAlphabet;
+
+    if (empty(finder))
+    {
+        _patternInit(me);
+        _finderSetNonEmpty(finder);
+    }
+    else
+    {
+        if (!empty(me.data_hits))
+        {
+            _multipleMyersNextHit(finder, me);
+            return true;
+        }
+        if (atEnd(finder))
+            return false;
+        goNext(finder);
+    }
+
+    if (me.blockCount == 0)
+    {
+        goEnd(finder);
+        return false;
+    }
+
+    for (; !atEnd(finder); goNext(finder))
+    {
+        if (_multipleMyersStep(me, ordValue(convert<TAlphabet>(*finder))))
+        {
+            _multipleMyersCollectHits(me);
+            _multipleMyersNextHit(finder, me);
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef SEQAN_HEADER_FIND_MULTIPLE_MYERS_H
@@ -97,30 +97,37 @@ getDistanceMatrix(Graph<Alignment<TStringSet, TCargo, TSpec> >& g,
     TSize nseq = length(str);
     resize(distanceMatrix, nseq * nseq, 0);
 
-    // All pairwise alignments
+    // All pairwise alignments, the rows are aligned in parallel
     typedef String<String<TVertexDescriptor> > TSegmentString;
-    TValue maxScore = 0;
-    for(TSize i=0; i<nseq; ++i) {
-        TSegmentString seq1;
+    String<TSegmentString> leafStrings;
+    resize(leafStrings, nseq);
+    SEQAN_OMP_PRAGMA(parallel for)
+    for(int64_t i=0; i<(int64_t) nseq; ++i)
+        _buildLeafString(g, i, leafStrings[i]);
+
+    String<TValue> rowMaxScore;
+    resize(rowMaxScore, nseq, 0);
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for(int64_t i=0; i<(int64_t) nseq; ++i) {
         TSize len1 = length(str[i]);
-        _buildLeafString(g, i, seq1);
         for(TSize j=i+1; j<nseq; ++j) {
             // Align the 2 strings
-            TSegmentString seq2;
             TSize len2 = length(str[j]);
-            _buildLeafString(g, j, seq2);
             TSegmentString alignSeq;
-            TValue score = heaviestCommonSubsequence(g,seq1,seq2,alignSeq);
+            TValue score = heaviestCommonSubsequence(g,leafStrings[i],leafStrings[j],alignSeq);
 
             // Normalize by distance
             if (len1 > len2) score /= len1;
             else score /= len2;
-            if (score > maxScore) maxScore = score;
+            if (score > rowMaxScore[i]) rowMaxScore[i] = score;
 
             // Remember the value
             distanceMatrix[i*nseq+j] = score;
         }
     }
+    TValue maxScore = 0;
+    for(TSize i=0; i<nseq; ++i)
+        if (rowMaxScore[i] > maxScore) maxScore = rowMaxScore[i];
 
     // Normalize values
     for(TSize i=0; i<nseq; ++i)
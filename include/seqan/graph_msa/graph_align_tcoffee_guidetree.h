@@ -893,6 +893,406 @@ upgmaTree(TDistance& dist,
 }
 
 
+
+//////////////////////////////////////////////////////////////////////////////
+// mBed
+//////////////////////////////////////////////////////////////////////////////
+
+// Guide trees for large sequence sets following mBed (Blackshields et al., 2010): every sequence is embedded by
+// its distances to O(log^2 n) seed sequences, the embedded points are split by bisecting k-means into small
+// clusters and only those are clustered with UPGMA.  Distances are Jaccard distances of bottom-s MinHash
+// sketches of the k-mer sets, i.e. neither time nor memory is quadratic in the number of sequences.
+
+inline uint32_t
+_mBedHash(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return static_cast<uint32_t>(x);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Bottom-s sketch of the k-mers of a sequence: the s smallest distinct k-mer hashes in increasing order.
+template<typename TString, typename TSize, typename TAlphabet>
+inline void
+_mBedSketch(TString const & str,
+            String<uint32_t> & sketch,
+            TSize ktup,
+            TSize sketchSize,
+            TAlphabet)
+{
+    String<uint64_t> tupelString;
+    _getTupelString(str, tupelString, (uint64_t) ktup, TAlphabet());
+
+    clear(sketch);
+    reserve(sketch, length(tupelString), Exact());
+    for (TSize i = 0; i < (TSize) length(tupelString); ++i)
+        appendValue(sketch, _mBedHash(tupelString[i]));
+    std::sort(begin(sketch, Standard()), end(sketch, Standard()));
+    resize(sketch, std::unique(begin(sketch, Standard()), end(sketch, Standard())) - begin(sketch, Standard()));
+    if (length(sketch) > sketchSize)
+        resize(sketch, sketchSize);
+    shrinkToFit(sketch);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Jaccard distance estimated from the sketchSize smallest hashes of the union of two sketches.
+template<typename TSize>
+inline double
+_mBedSketchDistance(String<uint32_t> const & sketch1,
+                    String<uint32_t> const & sketch2,
+                    TSize sketchSize)
+{
+    TSize len1 = length(sketch1);
+    TSize len2 = length(sketch2);
+    TSize i = 0, j = 0, count = 0, shared = 0;
+    for (; count < sketchSize && (i < len1 || j < len2); ++count)
+    {
+        if (j == len2 || (i < len1 && sketch1[i] < sketch2[j]))
+            ++i;
+        else if (i == len1 || sketch2[j] < sketch1[i])
+            ++j;
+        else
+        {
+            ++shared;
+            ++i;
+            ++j;
+        }
+    }
+    return (count == 0) ? 0.0 : 1.0 - (double) shared / (double) count;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// UPGMA (average linkage) of the sequences order[clusterBegin..clusterEnd).  The merges are stored as triples of
+// the two merged nodes and the height of the new node; leaves are numbered 0..m-1, merged nodes m, m+1, ...
+template<typename TSize, typename TMerges>
+inline void
+_mBedClusterUpgma(String<TSize> const & order,
+                  TSize clusterBegin,
+                  TSize clusterEnd,
+                  String<String<uint32_t> > const & sketches,
+                  TSize sketchSize,
+                  TMerges & merges)
+{
+    TSize m = clusterEnd - clusterBegin;
+    clear(merges);
+
+    String<double> mat;
+    resize(mat, m * m, 0.0);
+    for (TSize i = 0; i < m; ++i)
+        for (TSize j = i + 1; j < m; ++j)
+            mat[i * m + j] = mat[j * m + i] = _mBedSketchDistance(sketches[order[clusterBegin + i]],
+                                                                  sketches[order[clusterBegin + j]], sketchSize);
+
+    String<TSize> members;
+    resize(members, m, 1);
+    String<TSize> nodes;
+    resize(nodes, m);
+    for (TSize i = 0; i < m; ++i)
+        nodes[i] = i;
+
+    for (TSize step = 1; step < m; ++step)
+    {
+        TSize bestI = 0, bestJ = 0;
+        double best = std::numeric_limits<double>::max();
+        for (TSize i = 0; i < m; ++i)
+        {
+            if (members[i] == 0)
+                continue;
+            for (TSize j = i + 1; j < m; ++j)
+                if (members[j] != 0 && mat[i * m + j] < best)
+                {
+                    best = mat[i * m + j];
+                    bestI = i;
+                    bestJ = j;
+                }
+        }
+
+        appendValue(merges, Triple<TSize, TSize, double>(nodes[bestI], nodes[bestJ], best / 2));
+        for (TSize k = 0; k < m; ++k)
+        {
+            if (members[k] == 0 || k == bestI || k == bestJ)
+                continue;
+            double d = (mat[bestI * m + k] * members[bestI] + mat[bestJ * m + k] * members[bestJ]) /
+                       (members[bestI] + members[bestJ]);
+            mat[bestI * m + k] = mat[k * m + bestI] = d;
+        }
+        members[bestI] += members[bestJ];
+        members[bestJ] = 0;
+        nodes[bestI] = m + step - 1;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+template<typename TSize>
+inline double
+_mBedSquaredDistance(String<double> const & coords,
+                     TSize point,
+                     String<double> const & center,
+                     TSize dim)
+{
+    double d = 0;
+    for (TSize k = 0; k < dim; ++k)
+    {
+        double diff = coords[point * dim + k] - center[k];
+        d += diff * diff;
+    }
+    return d;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Splits order[clusterBegin..clusterEnd) recursively by bisecting k-means until the clusters have at most
+// maxClusterSize members.  Returns the index of the resulting split or, for a leaf cluster, -1 - its index.
+template<typename TSize>
+inline int64_t
+_mBedBisect(String<TSize> & order,
+            TSize clusterBegin,
+            TSize clusterEnd,
+            String<double> const & coords,
+            TSize dim,
+            TSize maxClusterSize,
+            String<Pair<TSize> > & clusters,
+            String<Triple<int64_t, int64_t, double> > & splits)
+{
+    TSize m = clusterEnd - clusterBegin;
+    if (m <= maxClusterSize)
+    {
+        appendValue(clusters, Pair<TSize>(clusterBegin, clusterEnd));
+        return -(int64_t) length(clusters);
+    }
+
+    // Start with two points far apart: the farthest point from the first one and the farthest from that.
+    String<double> center[2];
+    for (unsigned c = 0; c < 2; ++c)
+        resize(center[c], dim);
+    TSize far = order[clusterBegin];
+    for (unsigned round = 0; round < 2; ++round)
+    {
+        for (TSize k = 0; k < dim; ++k)
+            center[round][k] = coords[far * dim + k];
+        double farDist = -1;
+        for (TSize i = clusterBegin; i < clusterEnd; ++i)
+        {
+            double d = _mBedSquaredDistance(coords, order[i], center[round], dim);
+            if (d > farDist)
+            {
+                farDist = d;
+                far = order[i];
+            }
+        }
+    }
+    for (TSize k = 0; k < dim; ++k)
+        center[0][k] = coords[far * dim + k];
+
+    // Lloyd iterations with two centers.
+    String<char> side;
+    resize(side, m, 2);
+    for (unsigned iter = 0; iter < 10; ++iter)
+    {
+        int64_t changed = 0;
+        SEQAN_OMP_PRAGMA(parallel for reduction(+:changed) if(m > 1000))
+        for (int64_t i = 0; i < (int64_t) m; ++i)
+        {
+            char s = _mBedSquaredDistance(coords, order[clusterBegin + i], center[1], dim) <
+                     _mBedSquaredDistance(coords, order[clusterBegin + i], center[0], dim);
+            if (side[i] != s)
+            {
+                side[i] = s;
+                ++changed;
+            }
+        }
+        if (changed == 0)
+            break;
+
+        TSize count[2] = {0, 0};
+        for (unsigned c = 0; c < 2; ++c)
+            std::fill(begin(center[c], Standard()), end(center[c], Standard()), 0.0);
+        for (TSize i = 0; i < m; ++i)
+        {
+            ++count[(int) side[i]];
+            for (TSize k = 0; k < dim; ++k)
+                center[(int) side[i]][k] += coords[order[clusterBegin + i] * dim + k];
+        }
+        if (count[0] == 0 || count[1] == 0)
+            break;
+        for (unsigned c = 0; c < 2; ++c)
+            for (TSize k = 0; k < dim; ++k)
+                center[c][k] /= count[c];
+    }
+
+    // Move the points of the first side to the front, fall back to halving if k-means did not split.
+    String<TSize> reordered;
+    reserve(reordered, m, Exact());
+    for (unsigned c = 0; c < 2; ++c)
+        for (TSize i = 0; i < m; ++i)
+            if (side[i] == (char) c)
+                appendValue(reordered, order[clusterBegin + i]);
+    TSize clusterMid = clusterBegin + std::count(begin(side, Standard()), end(side, Standard()), (char) 0);
+    if (clusterMid == clusterBegin || clusterMid == clusterEnd)
+        clusterMid = clusterBegin + m / 2;
+    else
+        std::copy(begin(reordered, Standard()), end(reordered, Standard()), begin(order, Standard()) + clusterBegin);
+
+    double height = std::sqrt(_mBedSquaredDistance(center[0], (TSize) 0, center[1], dim) / dim) / 2;
+    int64_t left = _mBedBisect(order, clusterBegin, clusterMid, coords, dim, maxClusterSize, clusters, splits);
+    int64_t right = _mBedBisect(order, clusterMid, clusterEnd, coords, dim, maxClusterSize, clusters, splits);
+    appendValue(splits, Triple<int64_t, int64_t, double>(left, right, height));
+    return length(splits) - 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @fn mBedTree
+ * @headerfile <seqan/graph_msa.h>
+ * @brief Computes a guide tree for large sequence sets without a distance matrix.
+ *
+ * @signature void mBedTree(strSet, tree[, ktup[, sketchSize]]);
+ *
+ * @param[in]  strSet     The @link StringSet @endlink of sequences.
+ * @param[out] tree       The guide tree, leaf <tt>i</tt> is sequence <tt>i</tt>.
+ * @param[in]  ktup       The k-mer length, default: <tt>3</tt>.
+ * @param[in]  sketchSize The number of k-mer hashes kept per sequence, default: <tt>128</tt>.
+ *
+ * Follows mBed (Blackshields et al., 2010).  The sequences are embedded by their distances to
+ * <tt>log<sup>2</sup>(n)</tt> seed sequences, split by bisecting k-means into clusters of at most 64 sequences
+ * and every cluster is joined by UPGMA.  Distances are Jaccard distances of MinHash sketches of the k-mer sets.
+ * Time and memory are <tt>O(n log<sup>2</sup>(n))</tt>, the embedding and the clusters are computed in parallel.
+ */
+
+template<typename TString, typename TStrSpec, typename TCargo, typename TSpec, typename TSize>
+inline void
+mBedTree(StringSet<TString, TStrSpec> const & strSet,
+         Graph<Tree<TCargo, TSpec> > & g,
+         TSize ktup,
+         TSize sketchSize)
+{
+    typedef Graph<Tree<TCargo, TSpec> > TGraph;
+    typedef typename VertexDescriptor<TGraph>::Type TVertexDescriptor;
+    typedef typename Value<TString>::Type TAlphabet;
+    typedef Triple<TSize, TSize, double> TMerge;
+
+    TSize const maxClusterSize = 64;
+    TSize nseq = length(strSet);
+    clearVertices(g);
+    for (TSize i = 0; i < nseq; ++i)
+        addVertex(g);
+    if (nseq <= 1)
+    {
+        if (nseq == 1)
+            g.data_root = 0;
+        return;
+    }
+
+    // Sketch all sequences.
+    String<String<uint32_t> > sketches;
+    resize(sketches, nseq);
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 64))
+    for (int64_t i = 0; i < (int64_t) nseq; ++i)
+        _mBedSketch(strSet[i], sketches[i], ktup, sketchSize, TAlphabet());
+
+    // Sort by length, use sequences evenly spaced in this order as seeds and embed by the distances to them.
+    String<TSize> order;
+    resize(order, nseq);
+    for (TSize i = 0; i < nseq; ++i)
+        order[i] = i;
+    std::stable_sort(begin(order, Standard()), end(order, Standard()),
+                     [&strSet] (TSize a, TSize b) { return length(strSet[a]) < length(strSet[b]); });
+
+    double log2n = std::log((double) nseq) / std::log(2.0);
+    TSize dim = std::max((TSize) 1, std::min(nseq, (TSize) std::ceil(log2n * log2n)));
+    String<TSize> seeds;
+    resize(seeds, dim);
+    for (TSize k = 0; k < dim; ++k)
+        seeds[k] = order[(TSize) ((uint64_t) k * nseq / dim)];
+
+    String<double> coords;
+    resize(coords, (uint64_t) nseq * dim);
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 64))
+    for (int64_t i = 0; i < (int64_t) nseq; ++i)
+        for (TSize k = 0; k < dim; ++k)
+            coords[i * dim + k] = _mBedSketchDistance(sketches[i], sketches[seeds[k]], sketchSize);
+
+    // Split into small clusters and join each cluster by UPGMA.
+    for (TSize i = 0; i < nseq; ++i)
+        order[i] = i;
+    String<Pair<TSize> > clusters;
+    String<Triple<int64_t, int64_t, double> > splits;
+    _mBedBisect(order, (TSize) 0, nseq, coords, dim, maxClusterSize, clusters, splits);
+    clear(coords);
+
+    String<String<TMerge> > clusterMerges;
+    resize(clusterMerges, length(clusters));
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int64_t c = 0; c < (int64_t) length(clusters); ++c)
+        _mBedClusterUpgma(order, clusters[c].i1, clusters[c].i2, sketches, sketchSize, clusterMerges[c]);
+
+    // Build the tree, leaf vertex i corresponds to sequence i.
+    String<double> height;
+    resize(height, nseq, 0.0);
+    String<TVertexDescriptor> clusterRoot;
+    resize(clusterRoot, length(clusters));
+    String<TVertexDescriptor> localNodes;
+    for (TSize c = 0; c < (TSize) length(clusters); ++c)
+    {
+        clear(localNodes);
+        for (TSize i = clusters[c].i1; i < clusters[c].i2; ++i)
+            appendValue(localNodes, order[i]);
+        for (TSize i = 0; i < (TSize) length(clusterMerges[c]); ++i)
+        {
+            TMerge const & merge = clusterMerges[c][i];
+            TVertexDescriptor v = addVertex(g);
+            TVertexDescriptor child1 = localNodes[merge.i1];
+            TVertexDescriptor child2 = localNodes[merge.i2];
+            double h = std::max(merge.i3, std::max(height[child1], height[child2]));
+            appendValue(height, h);
+            addEdge(g, v, child1, (TCargo) (h - height[child1]));
+            addEdge(g, v, child2, (TCargo) (h - height[child2]));
+            appendValue(localNodes, v);
+        }
+        clusterRoot[c] = back(localNodes);
+    }
+
+    String<TVertexDescriptor> splitNodes;
+    for (TSize i = 0; i < (TSize) length(splits); ++i)
+    {
+        TVertexDescriptor v = addVertex(g);
+        TVertexDescriptor child1 = (splits[i].i1 < 0) ? clusterRoot[-splits[i].i1 - 1] : splitNodes[splits[i].i1];
+        TVertexDescriptor child2 = (splits[i].i2 < 0) ? clusterRoot[-splits[i].i2 - 1] : splitNodes[splits[i].i2];
+        double h = std::max(splits[i].i3, std::max(height[child1], height[child2]));
+        appendValue(height, h);
+        addEdge(g, v, child1, (TCargo) (h - height[child1]));
+        addEdge(g, v, child2, (TCargo) (h - height[child2]));
+        appendValue(splitNodes, v);
+    }
+    g.data_root = empty(splitNodes) ? clusterRoot[0] : back(splitNodes);
+}
+
+template<typename TString, typename TStrSpec, typename TCargo, typename TSpec, typename TSize>
+inline void
+mBedTree(StringSet<TString, TStrSpec> const & strSet,
+         Graph<Tree<TCargo, TSpec> > & g,
+         TSize ktup)
+{
+    mBedTree(strSet, g, ktup, (TSize) 128);
+}
+
+template<typename TString, typename TStrSpec, typename TCargo, typename TSpec>
+inline void
+mBedTree(StringSet<TString, TStrSpec> const & strSet,
+         Graph<Tree<TCargo, TSpec> > & g)
+{
+    mBedTree(strSet, g, 3u, 128u);
+}
+
 }// namespace seqan2
 
 #endif //#ifndef SEQAN_HEADER_...
@@ -94,6 +94,8 @@ getKmerSimilarityMatrix(StringSet<TString, TSpec> const& strSet,
     typedef TSize TWord;
     typedef String<TWord> TTupelString;
     typedef String<TTupelString> TTupelStringSet;
+    typedef typename Iterator<TTupelString const, Standard>::Type TTupelIter;
+    typedef typename Iterator<String<TWord>, Standard>::Type TIndexIter;
     typedef typename Value<THitMatrix>::Type TValue;
 
     // Number of sequences
@@ -108,26 +110,38 @@ getKmerSimilarityMatrix(StringSet<TString, TSpec> const& strSet,
     // Transform the set of strings into a set of strings of k-tupels
     TTupelStringSet tupSet;
     resize(tupSet, length(strSet));
-    for(TSize k=0;k<(TSize) length(strSet);++k) _getTupelString(strSet[k], tupSet[k], ktup, TAlphabet());
-
-    // Build for each sequence the q-gram Index and count common hits
-    String<TWord> qIndex;
-    String<TWord> compareIndex;
-    for(TSize k=0;k<nseq;++k) {
-        clear(qIndex);
-        resize(qIndex, qIndexSize, (TWord) 0, Exact());
-        for(TSize i = 0;i < (TSize) length(tupSet[k]);++i) ++qIndex[ tupSet[k][i] ];
-        TWord value;
-        for (TSize k2=k; k2<nseq; ++k2) {
+    SEQAN_OMP_PRAGMA(parallel for)
+    for(int64_t k=0;k<(int64_t) length(strSet);++k) _getTupelString(strSet[k], tupSet[k], ktup, TAlphabet());
+
+    // Build for each sequence the q-gram Index and count common hits, the rows are counted in parallel
+    SEQAN_OMP_PRAGMA(parallel)
+    {
+        String<TWord> qIndex;
+        String<TWord> compareIndex;
+
+        SEQAN_OMP_PRAGMA(for schedule(dynamic))
+        for(int64_t k=0;k<(int64_t) nseq;++k) {
+            clear(qIndex);
+            resize(qIndex, qIndexSize, (TWord) 0, Exact());
+            for(TSize i = 0;i < (TSize) length(tupSet[k]);++i) ++qIndex[ tupSet[k][i] ];
+            TWord value;
             clear(compareIndex);
             resize(compareIndex, qIndexSize, (TWord) 0, Exact());
-            value = 0;
-            for(TSize i = 0;i < (TSize) length(tupSet[k2]);++i) {
-                //std::cout << tupSet[k2][i] << "," << compareIndex[ tupSet[k2][i] ] << "," << qIndex[ tupSet[k2][i] ]<< std::endl;
-                if (compareIndex[ tupSet[k2][i] ] < qIndex[ tupSet[k2][i] ]) ++value;
-                ++compareIndex[ tupSet[k2][i] ];
+            TIndexIter itCompare = begin(compareIndex, Standard());
+            TIndexIter itQ = begin(qIndex, Standard());
+            for (TSize k2=k; k2<nseq; ++k2) {
+                value = 0;
+                TTupelIter itTupBegin = begin(tupSet[k2], Standard());
+                TTupelIter itTupEnd = end(tupSet[k2], Standard());
+                for(TTupelIter itTup = itTupBegin; itTup != itTupEnd; ++itTup) {
+                    if (itCompare[*itTup] < itQ[*itTup]) ++value;
+                    ++itCompare[*itTup];
+                }
+                mat[k*nseq+k2] = value;
+                // Only reset the counters of the k-tupels of k2
+                for(TTupelIter itTup = itTupBegin; itTup != itTupEnd; ++itTup)
+                    itCompare[*itTup] = 0;
             }
-            mat[k*nseq+k2] = value;
         }
     }
 
@@ -605,6 +605,62 @@ _makePairSet(TStringSet const & str, TPairIter const & it1, TPairIter const & it
 
 //////////////////////////////////////////////////////////////////////////////
 
+// Aligns the pairs of pList in parallel with alignPair(pairMatches, pairScores, pairSet) and appends the segment
+// matches and scores in the order of pList, i.e. the library does not depend on the number of threads.
+template<typename TString, typename TSpec, typename TSize2, typename TSpec2, typename TSegmentMatches, typename TScoreValues, typename TDistance, typename TAlignPair>
+inline void
+_appendPairwiseSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
+                              String<TSize2, TSpec2> const& pList,
+                              TSegmentMatches& matches,
+                              TScoreValues& scores,
+                              TDistance& dist,
+                              TAlignPair const& alignPair)
+{
+    typedef StringSet<TString, Dependent<TSpec> > TStringSet;
+    typedef typename Size<TStringSet>::Type TSize;
+    typedef typename Iterator<String<TSize2, TSpec2> const, Standard>::Type TPairIter;
+
+    SEQAN_ASSERT_EQ(length(pList) % 2, 0u);
+
+    TSize nseq = length(str);
+    int64_t nPairs = length(pList) / 2;
+    TPairIter itPairs = begin(pList, Standard());
+
+    // The pairs are aligned in blocks to bound the memory for the not yet appended matches.
+    int64_t blockSize = 64 * omp_get_max_threads();
+    String<TSegmentMatches> blockMatches;
+    String<TScoreValues> blockScores;
+    resize(blockMatches, blockSize);
+    resize(blockScores, blockSize);
+
+    for (int64_t blockBegin = 0; blockBegin < nPairs; blockBegin += blockSize)
+    {
+        int64_t blockEnd = std::min(blockBegin + blockSize, nPairs);
+
+        SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+        for (int64_t pair = blockBegin; pair < blockEnd; ++pair)
+        {
+            TStringSet pairSet = _makePairSet(str, itPairs + 2 * pair, itPairs + 2 * pair + 1);
+            clear(blockMatches[pair - blockBegin]);
+            clear(blockScores[pair - blockBegin]);
+            alignPair(blockMatches[pair - blockBegin], blockScores[pair - blockBegin], pairSet);
+        }
+
+        for (int64_t pair = blockBegin; pair < blockEnd; ++pair)
+        {
+            TSize from = length(matches);
+            append(matches, blockMatches[pair - blockBegin]);
+            append(scores, blockScores[pair - blockBegin]);
+
+            // Get the alignment statistics
+            TStringSet pairSet = _makePairSet(str, itPairs + 2 * pair, itPairs + 2 * pair + 1);
+            _setDistanceValue(matches, pairSet, dist, (TSize) itPairs[2 * pair], (TSize) itPairs[2 * pair + 1], nseq, from);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 template<typename TString, typename TSpec, typename TSize2, typename TSpec2, typename TSegmentMatches, typename TScores>
 inline void
 appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
@@ -614,36 +670,26 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
                      LcsLibrary)
 {
     typedef StringSet<TString, Dependent<TSpec> > TStringSet;
-    typedef String<TSize2, TSpec2> TPairList;
-    typedef typename Size<TStringSet>::Type TSize;
-    //typedef typename Value<TSegmentMatches>::Type TFragment;
-    //typedef typename Value<TScores>::Type TScoreValue;
-    typedef typename Iterator<TPairList const, Standard>::Type TPairIter;
-
-    SEQAN_ASSERT_EQ(length(pList) % 2, 0u);
+    typedef typename Iterator<TSegmentMatches, Standard>::Type TMatchIter;
+    typedef typename Iterator<TScores, Standard>::Type TScoreIter;
 
     // Pairwise longest common subsequence
-    for (TPairIter itPair = begin(pList, Standard()), itPairEnd = end(pList, Standard()); itPair != itPairEnd; itPair += 2) {
-        TStringSet pairSet = _makePairSet(str, itPair, itPair + 1);
-
+    Nothing noth;
+    _appendPairwiseSegmentMatches(str, pList, matches, scores, noth,
+                                  [] (TSegmentMatches & pairMatches, TScores & pairScores, TStringSet & pairSet)
+    {
         // Lcs between first and second string
-        TSize from = length(matches);
-        globalAlignment(matches, pairSet, Lcs());
-        TSize to = length(matches);
+        globalAlignment(pairMatches, pairSet, Lcs());
 
         // Record the scores
-        resize(scores, to);
-        typedef typename Iterator<TSegmentMatches, Standard>::Type TMatchIter;
-        typedef typename Iterator<TScores, Standard>::Type TScoreIter;
-        TScoreIter itScore = begin(scores, Standard());
-        TScoreIter itScoreEnd = end(scores, Standard());
-        TMatchIter itMatch = begin(matches, Standard());
-        itScore += from;
-        itMatch += from;
+        resize(pairScores, length(pairMatches));
+        TScoreIter itScore = begin(pairScores, Standard());
+        TScoreIter itScoreEnd = end(pairScores, Standard());
+        TMatchIter itMatch = begin(pairMatches, Standard());
         for (; itScore != itScoreEnd; ++itScore, ++itMatch) {
             *itScore = (*itMatch).len;
         }
-    }
+    });
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -757,16 +803,14 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
                      DefaultAlignment)
 {
     typedef StringSet<TString, Dependent<TSpec> > TStringSet;
-    typedef String<TSize2, TSpec2> TPairList;
-    typedef typename Iterator<TPairList const, Standard>::Type TPairIter;
-
-    SEQAN_ASSERT_EQ(length(pList) % 2, 0u);
 
     // Pairwise alignments
-    for (TPairIter itPair = begin(pList, Standard()), itPairEnd = end(pList, Standard()); itPair != itPairEnd; itPair += 2) {
-        TStringSet pairSet = _makePairSet(str, itPair, itPair + 1);
-        _multiLocalAlignment(pairSet, matches, scores, score_type, 4, SmithWatermanClump());
-    }
+    Nothing noth;
+    _appendPairwiseSegmentMatches(str, pList, matches, scores, noth,
+                                  [&score_type] (TSegmentMatches & pairMatches, TScoreValues & pairScores, TStringSet & pairSet)
+    {
+        _multiLocalAlignment(pairSet, pairMatches, pairScores, score_type, 4, SmithWatermanClump());
+    });
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -782,21 +826,17 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
                      DeepAlignment)
 {
     typedef StringSet<TString, Dependent<TSpec> > TStringSet;
-    typedef String<TSize2, TSpec2> TPairList;
-    typedef typename Iterator<TPairList const, Standard>::Type TPairIter;
     typedef typename Value<TScoreValues>::Type TScoreValue;
     typedef typename Size<TStringSet>::Type TSize;
 
-    SEQAN_ASSERT_EQ(length(pList) % 2, 0u);
-
     // Pairwise alignments
-    for (TPairIter itPair = begin(pList, Standard()), itPairEnd = end(pList, Standard()); itPair != itPairEnd; itPair += 2) {
-        TStringSet pairSet = _makePairSet(str, itPair, itPair + 1);
-        TSize from = length(matches);
-        TScoreValue myScore = localAlignment(matches, pairSet, score_type);
-        TSize to = length(matches);
-        _recordScores(scores, myScore, from, to);
-    }
+    Nothing noth;
+    _appendPairwiseSegmentMatches(str, pList, matches, scores, noth,
+                                  [&score_type] (TSegmentMatches & pairMatches, TScoreValues & pairScores, TStringSet & pairSet)
+    {
+        TScoreValue myScore = localAlignment(pairMatches, pairSet, score_type);
+        _recordScores(pairScores, myScore, (TSize) 0, (TSize) length(pairMatches));
+    });
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -829,25 +869,20 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
                      Banded)
 {
     typedef StringSet<TString, Dependent<TSpec> > TStringSet;
-    typedef String<TSize2, TSpec2> TPairList;
-    typedef typename Iterator<TPairList const, Standard>::Type TPairIter;
     typedef typename Value<TScoreValues>::Type TScoreValue;
     typedef typename Size<TStringSet>::Type TSize;
 
-    SEQAN_ASSERT_EQ(length(pList) % 2, 0u);
-
     // Pairwise alignments
-    for (TPairIter itPair = begin(pList, Standard()), itPairEnd = end(pList, Standard()); itPair != itPairEnd; itPair += 2) {
-        TStringSet pairSet = _makePairSet(str, itPair, itPair + 1);
-
+    Nothing noth;
+    _appendPairwiseSegmentMatches(str, pList, matches, scores, noth,
+                                  [&score_type, &bandWidth] (TSegmentMatches & pairMatches, TScoreValues & pairScores, TStringSet & pairSet)
+    {
         Pair<int, int> bandBottomRight = assureBandedRestriction_(pairSet, bandWidth);
 
         // Alignment
-        TSize from = length(matches);
-        TScoreValue myScore = localAlignment(matches, pairSet, score_type, bandBottomRight.i1, bandBottomRight.i2);
-        TSize to = length(matches);
-        _recordScores(scores, myScore, from, to);
-    }
+        TScoreValue myScore = localAlignment(pairMatches, pairSet, score_type, bandBottomRight.i1, bandBottomRight.i2);
+        _recordScores(pairScores, myScore, (TSize) 0, (TSize) length(pairMatches));
+    });
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -981,28 +1016,18 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
     typedef StringSet<TString, Dependent<TSpec> > TStringSet;
     typedef typename Size<TStringSet>::Type TSize;
     typedef typename Value<TScoreValues>::Type TScoreValue;
-    typedef typename Iterator<String<TSize2, TSpec2> const, Standard>::Type TPairIter;
-
-    SEQAN_ASSERT_EQ(length(pList) % 2, 0u);
 
     // Initialization
     TSize nseq = length(str);
     _resizeWithRespectToDistance(dist, nseq);
 
     // Pairwise alignments
-    for (TPairIter itPair = begin(pList, Standard()), itPairEnd = end(pList, Standard()); itPair != itPairEnd; itPair += 2) {
-        TStringSet pairSet = _makePairSet(str, itPair, itPair + 1);
-
-        // Alignment
-        TSize from = length(matches);
-        TScoreValue myScore = globalAlignment(matches, pairSet, score_type, ac, Gotoh());
-        TSize to = length(matches);
-
-        _recordScores(scores, myScore, from, to);
-
-        // Get the alignment statistics
-        _setDistanceValue(matches, pairSet, dist, (TSize) * itPair, (TSize) *(itPair + 1), (TSize) nseq, (TSize)from);
-    }
+    _appendPairwiseSegmentMatches(str, pList, matches, scores, dist,
+                                  [&score_type, &ac] (TSegmentMatches & pairMatches, TScoreValues & pairScores, TStringSet & pairSet)
+    {
+        TScoreValue myScore = globalAlignment(pairMatches, pairSet, score_type, ac, Gotoh());
+        _recordScores(pairScores, myScore, (TSize) 0, (TSize) length(pairMatches));
+    });
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -1023,30 +1048,21 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
     typedef StringSet<TString, Dependent<TSpec> > TStringSet;
     typedef typename Size<TStringSet>::Type TSize;
     typedef typename Value<TScoreValues>::Type TScoreValue;
-    typedef typename Iterator<String<TSize2, TSpec2> const, Standard>::Type TPairIter;
-
-    SEQAN_ASSERT_EQ(length(pList) % 2, 0u);
 
     // Initialization
     TSize nseq = length(str);
     _resizeWithRespectToDistance(dist, nseq);
 
     // Pairwise alignments
-    for (TPairIter itPair = begin(pList, Standard()), itPairEnd = end(pList, Standard()); itPair != itPairEnd; itPair += 2) {
-        TStringSet pairSet = _makePairSet(str, itPair, itPair + 1);
-
+    _appendPairwiseSegmentMatches(str, pList, matches, scores, dist,
+                                  [&score_type, &ac, &bandWidth] (TSegmentMatches & pairMatches, TScoreValues & pairScores, TStringSet & pairSet)
+    {
         Pair<int, int> bandBottomRight = assureBandedRestriction_(pairSet, bandWidth);
 
         // Alignment
-        TSize from = length(matches);
-        TScoreValue myScore = globalAlignment(matches, pairSet, score_type, ac, bandBottomRight.i1, bandBottomRight.i2, Gotoh());
-        TSize to = length(matches);
-
-        _recordScores(scores, myScore, from, to);
-
-        // Get the alignment statistics
-        _setDistanceValue(matches, pairSet, dist, (TSize)*itPair, (TSize)*(itPair + 1), (TSize)nseq, (TSize)from);
-    }
+        TScoreValue myScore = globalAlignment(pairMatches, pairSet, score_type, ac, bandBottomRight.i1, bandBottomRight.i2, Gotoh());
+        _recordScores(pairScores, myScore, (TSize) 0, (TSize) length(pairMatches));
+    });
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -85,7 +85,8 @@ public:
      * @brief Methods for computing guide tre.
      *
      * 0 Neighbor-joining, 1 UPGMA single linkage, 2 UPGMA complete linkage,
-     * 3 UPGMA average linkage, 4 UPGMA weighted average linkage.
+     * 3 UPGMA average linkage, 4 UPGMA weighted average linkage, 5 mBed k-mer sketch embedding
+     * (see @link mBedTree @endlink).
      */
     unsigned build;
 
@@ -502,6 +503,10 @@ void globalMsaAlignment(Graph<Alignment<TStringSet, TCargo, TSpec> > & gAlign,
         read(strm_tree, guideTree, sequenceNames, NewickFormat());  // Read newick tree
         strm_tree.close();
     }
+    else if (msaOpt.build == 5)
+    {
+        mBedTree(seqSet, guideTree);
+    }
     else
     {
         // Check if we have a valid distance matrix
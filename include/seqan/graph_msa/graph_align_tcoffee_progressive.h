@@ -160,18 +160,35 @@ progressiveAlignment(Graph<Alignment<TStringSet, TCargo, TSpec> >& g,
     for(;!atEnd(bfsIt);goNext(bfsIt), --itVertEnd)
         *itVertEnd = *bfsIt;
 
-    // Progressive alignment
-    itVert = begin(vertices, Standard());
-    itVertEnd = end(vertices, Standard());
-    for(;itVert != itVertEnd; ++itVert) {
-        if(isLeaf(tree, *itVert)) _buildLeafString(g, *itVert, segString[*itVert]);
-        else {
-            // Align the two children (Binary tree)
-            TAdjacencyIterator adjIt(tree, *itVert);
-            TVertexDescriptor child1 = *adjIt; goNext(adjIt);
-            heaviestCommonSubsequence(g, segString[child1], segString[*adjIt], segString[*itVert]);
-            clear(segString[child1]);
-            clear(segString[*adjIt]);
+    // Group the vertices by their height, subtrees of the same height are independent
+    String<TSize> height;
+    resize(height, getIdUpperBound(_getVertexIdManager(tree)), 0);
+    TSize maxHeight = 0;
+    for(itVert = begin(vertices, Standard()), itVertEnd = end(vertices, Standard()); itVert != itVertEnd; ++itVert) {
+        for(TAdjacencyIterator adjIt(tree, *itVert); !atEnd(adjIt); goNext(adjIt))
+            height[*itVert] = std::max(height[*itVert], height[*adjIt] + 1);
+        maxHeight = std::max(maxHeight, height[*itVert]);
+    }
+    String<TVertexString> levels;
+    resize(levels, maxHeight + 1);
+    for(itVert = begin(vertices, Standard()); itVert != itVertEnd; ++itVert)
+        appendValue(levels[height[*itVert]], *itVert);
+
+    // Progressive alignment, the subtrees of one level are aligned in parallel
+    for(TSize level = 0; level <= maxHeight; ++level) {
+        TVertexString const & levelVertices = levels[level];
+        SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+        for(int64_t i = 0; i < (int64_t) length(levelVertices); ++i) {
+            TVertexDescriptor v = levelVertices[i];
+            if(isLeaf(tree, v)) _buildLeafString(g, v, segString[v]);
+            else {
+                // Align the two children (Binary tree)
+                TAdjacencyIterator adjIt(tree, v);
+                TVertexDescriptor child1 = *adjIt; goNext(adjIt);
+                heaviestCommonSubsequence(g, segString[child1], segString[*adjIt], segString[v]);
+                clear(segString[child1]);
+                clear(segString[*adjIt]);
+            }
         }
     }
 
@@ -1320,6 +1320,7 @@ inline bool _swiftMultiProcessQGram(
 
 ////////////////////////////////////////////////////////////////////////////////////
 // resets counter and lastIncrement of all buckets listed in patterns verify list
+// hstkLength must be greater than the last scanned haystack position
 template <
     typename TFinder,
     typename TIndex,
@@ -1327,7 +1328,8 @@ template <
 >
 inline bool _swiftMultiFlushBuckets(
     TFinder & finder,
-    Pattern<TIndex, Swift<TSpec> > & pattern
+    Pattern<TIndex, Swift<TSpec> > & pattern,
+    int64_t hstkLength
     )
 {
     typedef Pattern<TIndex, Swift<TSpec> >                      TPattern;
@@ -1343,8 +1345,6 @@ inline bool _swiftMultiFlushBuckets(
 
     typedef typename Size<TIndex>::Type                         TSize;
 
-    int64_t hstkLength = length(haystack(finder));
-
     TListIterator verifyBkt = begin(pattern.verifyList, Standard());
     TListIterator verifyListEnd = end(pattern.verifyList, Standard());
     for (; verifyBkt < verifyListEnd; ++verifyBkt)
@@ -1377,6 +1377,19 @@ inline bool _swiftMultiFlushBuckets(
     return !empty(finder.hits);
 }
 
+template <
+    typename TFinder,
+    typename TIndex,
+    typename TSpec
+>
+inline bool _swiftMultiFlushBuckets(
+    TFinder & finder,
+    Pattern<TIndex, Swift<TSpec> > & pattern
+    )
+{
+    return _swiftMultiFlushBuckets(finder, pattern, (int64_t)length(haystack(finder)));
+}
+
 //////////////////////////////////////////////////////
 // no resetting is needed for the semiglobal version
 template <
@@ -1386,12 +1399,25 @@ template <
 >
 inline bool _swiftMultiFlushBuckets(
     TFinder &,
-    Pattern<TIndex, Swift<Tag<SwiftSemiGlobal_<TSpec_> > > > &)
+    Pattern<TIndex, Swift<Tag<SwiftSemiGlobal_<TSpec_> > > > &,
+    int64_t)
 {
     // there is nothing to be done here as we dump matches immediately after reaching the threshold
     return false;
 }
 
+template <
+    typename TFinder,
+    typename TIndex,
+    typename TSpec_
+>
+inline bool _swiftMultiFlushBuckets(
+    TFinder &,
+    Pattern<TIndex, Swift<Tag<SwiftSemiGlobal_<TSpec_> > > > &)
+{
+    return false;
+}
+
 template <typename TIndex, typename TSpec>
 inline bool
 empty(Pattern<TIndex, Swift<TSpec> > & me)
@@ -2054,6 +2080,280 @@ find(
     return true;
 }
 
+//____________________________________________________________________________
+// Parallel SWIFT scan
+//
+// The haystack is split into chunks of bucket diagonals.  Every chunk is scanned by one thread with its own copy
+// of the buckets, from the chunk begin up to the last haystack position a q-gram of its buckets can lie at.
+// A bucket only counts q-grams right of its begin diagonal, so each chunk sees all q-grams of the buckets it owns
+// and reports exactly the hits the sequential scan reports for them.
+
+// returns the begin diagonal of the bucket the hit was created for, see _createHit()
+template <typename THstkPos>
+inline int64_t
+_swiftHitDiagonal(SwiftHit_<THstkPos> const & hit)
+{
+    return hit.hstkPos + hit.bucketWidth - hit.ndlPos - hit.hitLengthNeedle;
+}
+
+template <typename THstkPos>
+inline int64_t
+_swiftHitDiagonal(SwiftHitSemiGlobal_<THstkPos> const & hit)
+{
+    return hit.hstkPos;
+}
+
+struct SwiftHitLess_
+{
+    template <typename THstkPos>
+    inline bool
+    operator()(SwiftHit_<THstkPos> const & a, SwiftHit_<THstkPos> const & b) const
+    {
+        if (a.hstkPos != b.hstkPos) return a.hstkPos < b.hstkPos;
+        if (a.ndlSeqNo != b.ndlSeqNo) return a.ndlSeqNo < b.ndlSeqNo;
+        if (a.ndlPos != b.ndlPos) return a.ndlPos < b.ndlPos;
+        if (a.bucketWidth != b.bucketWidth) return a.bucketWidth < b.bucketWidth;
+        return a.hitLengthNeedle < b.hitLengthNeedle;
+    }
+
+    template <typename THstkPos>
+    inline bool
+    operator()(SwiftHitSemiGlobal_<THstkPos> const & a, SwiftHitSemiGlobal_<THstkPos> const & b) const
+    {
+        if (a.hstkPos != b.hstkPos) return a.hstkPos < b.hstkPos;
+        if (a.ndlSeqNo != b.ndlSeqNo) return a.ndlSeqNo < b.ndlSeqNo;
+        return a.bucketWidth < b.bucketWidth;
+    }
+};
+
+struct SwiftRangeEndLess_
+{
+    inline bool
+    operator()(int64_t pos, Pair<int64_t> const & range) const
+    {
+        return pos < range.i2;
+    }
+};
+
+// collects the ranges of q-gram begin positions outside the repeats of the finder
+template <typename THaystack, typename TSpec, typename TSpan>
+inline void
+_swiftQGramRanges(
+    String<Pair<int64_t> > & ranges,
+    Finder<THaystack, Swift<TSpec> > & finder,
+    TSpan span)
+{
+    typedef typename Finder<THaystack, Swift<TSpec> >::TRepeatIterator  TRepeatIterator;
+
+    clear(ranges);
+    int64_t rangeBegin = 0;
+    TRepeatIterator it = begin(finder.data_repeats, Standard());
+    TRepeatIterator itEnd = end(finder.data_repeats, Standard());
+    for (; it != itEnd; ++it)
+    {
+        if ((int64_t)(*it).beginPosition >= rangeBegin + (int64_t)span)
+            appendValue(ranges, Pair<int64_t>(rangeBegin, (int64_t)(*it).beginPosition - span + 1));
+        rangeBegin = (*it).endPosition;
+    }
+    int64_t hstkLength = length(haystack(finder));
+    if (hstkLength >= rangeBegin + (int64_t)span)
+        appendValue(ranges, Pair<int64_t>(rangeBegin, hstkLength - span + 1));
+}
+
+// copies the filter parameters and buckets of an initialized pattern
+template <typename TIndex, typename TSpec>
+inline void
+_swiftCopyFilterState(
+    Pattern<TIndex, Swift<TSpec> > & dest,
+    Pattern<TIndex, Swift<TSpec> > const & source)
+{
+    dest.shape = source.shape;
+    dest.buckets = source.buckets;
+    dest.bucketParams = source.bucketParams;
+    dest.params = source.params;
+    dest.finderPosOffset = source.finderPosOffset;
+    dest.finderPosNextOffset = source.finderPosNextOffset;
+    dest.finderLength = source.finderLength;
+    dest.maxPatternLength = source.maxPatternLength;
+    dest._currentErrorRate = source._currentErrorRate;
+    dest._currentMinLengthForAll = source._currentMinLengthForAll;
+}
+
+// scans the q-grams beginning in [scanBegin, scanEnd) and flushes the buckets
+template <typename THaystack, typename TIndex, typename TSpec, typename TText>
+inline void
+_swiftScanRange(
+    Finder<THaystack, Swift<TSpec> > & finder,
+    Pattern<TIndex, Swift<TSpec> > & pattern,
+    TText & text,
+    String<Pair<int64_t> > const & ranges,
+    int64_t scanBegin,
+    int64_t scanEnd)
+{
+    typedef typename Iterator<String<Pair<int64_t> > const, Standard>::Type TRangeIterator;
+    typedef typename Iterator<TText, Standard>::Type                        TTextIterator;
+
+    TRangeIterator rangeEnd = end(ranges, Standard());
+    TRangeIterator range = std::upper_bound(begin(ranges, Standard()), rangeEnd, scanBegin, SwiftRangeEndLess_());
+    for (; range != rangeEnd && (*range).i1 < scanEnd; ++range)
+    {
+        int64_t localBegin = _max((*range).i1, scanBegin);
+        int64_t localEnd = _min((*range).i2, scanEnd);
+
+        TTextIterator it = begin(text, Standard()) + localBegin;
+        finder.curPos = localBegin;
+        _swiftMultiProcessQGram(finder, pattern, hash(pattern.shape, it));
+        for (++finder.curPos, ++it; (int64_t)finder.curPos < localEnd; ++finder.curPos, ++it)
+            _swiftMultiProcessQGram(finder, pattern, hashNext(pattern.shape, it));
+    }
+    _swiftMultiFlushBuckets(finder, pattern, scanEnd);
+}
+
+template <typename THaystack, typename TIndex, typename TSpec, typename TSize>
+inline void
+_swiftFindAll(
+    Finder<THaystack, Swift<TSpec> > & finder,
+    Pattern<TIndex, Swift<TSpec> > & pattern,
+    double errorRate,
+    TSize minLength)
+{
+    typedef Finder<THaystack, Swift<TSpec> >            TFinder;
+    typedef Pattern<TIndex, Swift<TSpec> >              TPattern;
+    typedef typename TFinder::THitString                THitString;
+    typedef typename Iterator<THitString, Standard>::Type THitIterator;
+    typedef typename TPattern::TBucketParams            TBucketParams;
+    typedef typename Size<TIndex>::Type                 TNdlSize;
+
+    typename Parameter_<THaystack>::Type text = haystack(finder);
+    int64_t textLength = length(text);
+
+    String<Pair<int64_t> > ranges;
+    _swiftQGramRanges(ranges, finder, length(pattern.shape));
+
+    // all q-grams of a bucket begin less than maxReach positions right of its begin diagonal
+    int64_t maxReach = 1;
+    for (TNdlSize seqNo = 0; seqNo < countSequences(host(pattern)); ++seqNo)
+    {
+        TBucketParams & bucketParams = _swiftBucketParams(pattern, seqNo);
+        maxReach = _max(maxReach, (int64_t)sequenceLength(seqNo, host(pattern)) +
+                                  bucketParams.delta + bucketParams.overlap);
+    }
+
+    // a few chunks per thread balance the load, each chunk rescans up to maxReach positions of its successor
+    int64_t numChunks = 1;
+    if (omp_get_max_threads() > 1)
+        numChunks = _max((int64_t)1, _min((int64_t)4 * omp_get_max_threads(), textLength / (8 * maxReach)));
+    int64_t chunkSize = (textLength + numChunks - 1) / numChunks;
+
+    String<THitString> chunkHits;
+    resize(chunkHits, numChunks);
+
+    SEQAN_OMP_PRAGMA(parallel)
+    {
+        TFinder localFinder;
+        TPattern localPattern(host(pattern));
+        _swiftCopyFilterState(localPattern, pattern);
+
+        SEQAN_OMP_PRAGMA(for schedule(dynamic, 1))
+        for (int64_t chunk = 0; chunk < numChunks; ++chunk)
+        {
+            int64_t ownBegin = chunk * chunkSize;
+            int64_t ownEnd = _min(ownBegin + chunkSize, textLength);
+            // the first chunk also owns buckets of negative diagonals, the last those behind the haystack
+            int64_t diagBegin = (chunk == 0) ? std::numeric_limits<int64_t>::min() : ownBegin;
+            int64_t diagEnd = (chunk + 1 == numChunks) ? std::numeric_limits<int64_t>::max() : ownEnd;
+
+            _patternInit(localPattern, errorRate, minLength);   // cheap reset of all buckets
+            clear(localFinder.hits);
+            _swiftScanRange(localFinder, localPattern, text, ranges, ownBegin, _min(ownEnd + maxReach, textLength));
+
+            THitIterator it = begin(localFinder.hits, Standard());
+            THitIterator itEnd = end(localFinder.hits, Standard());
+            for (; it != itEnd; ++it)
+            {
+                int64_t diag = _swiftHitDiagonal(*it);
+                if (diagBegin <= diag && diag < diagEnd)
+                    appendValue(chunkHits[chunk], *it);
+            }
+        }
+    }
+
+    clear(finder.hits);
+    for (int64_t chunk = 0; chunk < numChunks; ++chunk)
+        append(finder.hits, chunkHits[chunk]);
+    std::sort(begin(finder.hits, Standard()), end(finder.hits, Standard()), SwiftHitLess_());
+}
+
+/*!
+ * @fn SwiftFinder#find
+ * @headerfile <seqan/index.h>
+ * @brief Scans the haystack in parallel and iterates over the SWIFT hits.
+ *
+ * @signature bool find(finder, pattern, errorRate[, minLength], Parallel());
+ *
+ * @param[in,out] finder    A SwiftFinder.
+ * @param[in,out] pattern   A SwiftPattern.
+ * @param[in]     errorRate Maximal error rate of the matches.  Types: <tt>double</tt>
+ * @param[in]     minLength Minimal length of the matches.  Mandatory for @link SwiftLocalFinder @endlink.
+ *
+ * @return bool <tt>true</tt> if a hit was found, <tt>false</tt> after the last hit.
+ *
+ * The first call splits the haystack into chunks that are filtered by all OpenMP threads, later calls iterate over the
+ * hits.  The hits are the same as the sequential <tt>find</tt> reports, but sorted by their begin in the haystack and
+ * independent of the number of threads.  Changes of the thresholds during the iteration, e.g. by
+ * @link SwiftPattern#setMinThreshold @endlink, do not affect the hits of the current scan.
+ *
+ * @section Examples
+ *
+ * @code{.cpp}
+ * Finder<Dna5String, Swift<SwiftLocal> > finder(genome);
+ * Pattern<TQGramIndex, Swift<SwiftLocal> > pattern(qgramIndex);
+ * while (find(finder, pattern, 0.05, 100, Parallel()))
+ *     std::cout << positionRange(finder) << '\t' << pattern.curSeqNo << std::endl;
+ * @endcode
+ */
+
+template <typename THaystack, typename TIndex, typename TSpec, typename TSize>
+inline bool
+find(
+    Finder<THaystack, Swift<TSpec> > &finder,
+    Pattern<TIndex, Swift<TSpec> > &pattern,
+    double errorRate,
+    TSize minLength,
+    Parallel)
+{
+    if (empty(finder))
+    {
+        pattern.finderLength = pattern.params.tabooLength + length(container(finder));
+        _patternInit(pattern, errorRate, minLength);
+        _finderSetNonEmpty(finder);
+        _swiftFindAll(finder, pattern, errorRate, minLength);
+        finder.curHit = begin(finder.hits, Standard());
+        finder.endHit = end(finder.hits, Standard());
+    }
+    else if (finder.curHit != finder.endHit)
+    {
+        ++finder.curHit;
+    }
+
+    if (finder.curHit == finder.endHit)
+        return false;
+
+    _copySwiftHit(finder, pattern);
+    return true;
+}
+
+template <typename THaystack, typename TIndex, typename TSpec>
+inline bool
+find(
+    Finder<THaystack, Swift<Tag<SwiftSemiGlobal_<TSpec> > > > &finder,
+    Pattern<TIndex, Swift<Tag<SwiftSemiGlobal_<TSpec> > > > &pattern,
+    double errorRate,
+    Parallel)
+{
+    return find(finder, pattern, errorRate, 0, Parallel());
+}
+
 /*!
  * @fn SwiftFinder#windowFindBegin
  * @headerfile <seqan/index.h>
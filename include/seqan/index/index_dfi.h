@@ -665,6 +665,30 @@ namespace seqan2
             }
     }
 
+//////////////////////////////////////////////////////////////////////////////
+// parallel eager construction
+
+    template <typename TText, typename TPredHull, typename TPred, typename TDirValue>
+    inline bool
+    _wotdHullPredicate(Index<TText, IndexWotd<Dfi<TPredHull, TPred> > > const &index, TDirValue w0)
+    {
+        return (w0 & index.DFI_PRED_HULL) != 0;
+    }
+
+    template <typename TText, typename TPredHull, typename TPred>
+    inline Index<TText, IndexWotd<Dfi<TPredHull, TPred> > > *
+    _wotdNewWorker(Index<TText, IndexWotd<Dfi<TPredHull, TPred> > > &index)
+    {
+        typedef Index<TText, IndexWotd<Dfi<TPredHull, TPred> > >    TIndex;
+
+        TIndex *worker = new TIndex(indexText(index), index.predHull, index.pred);
+        _wotdInitWorker(*worker, index);
+        worker->ds = index.ds;
+        worker->nodeEntry = index.nodeEntry;
+        worker->childEntry = index.childEntry;
+        return worker;
+    }
+
 //////////////////////////////////////////////////////////////////////////////
 // interface for automatic index creation
 
@@ -2039,6 +2039,294 @@ SEQAN_CONCEPT_IMPL((Index<TText, IndexWotd<TSpec> > const), (StringTreeConcept))
         return true;
     }
 
+//////////////////////////////////////////////////////////////////////////////
+// parallel eager construction
+
+    // a node whose children are still to be computed
+    template <typename TSize>
+    struct WotdTask_
+    {
+        TSize        node;            // position of the node entry in directory
+        TSize        left;            // SA interval of the node
+        TSize        right;
+        TSize        parentRepLen;    // representative length of parent node
+
+        WotdTask_() : node(0), left(0), right(0), parentRepLen(0) {}
+
+        WotdTask_(TSize node, TSize left, TSize right, TSize parentRepLen) :
+            node(node), left(left), right(right), parentRepLen(parentRepLen) {}
+    };
+
+    // larger SA intervals first
+    struct WotdTaskGreater_
+    {
+        template <typename TSize>
+        inline bool operator()(WotdTask_<TSize> const &a, WotdTask_<TSize> const &b) const
+        {
+            return a.right - a.left > b.right - b.left;
+        }
+    };
+
+    // nodes that fail the hull predicate are never visited and remain unevaluated
+    template <typename TText, typename TSpec, typename TDirValue>
+    inline bool
+    _wotdHullPredicate(Index<TText, IndexWotd<TSpec> > const &, TDirValue)
+    {
+        return true;
+    }
+
+    // append the children of an evaluated node that have children themselves
+    template <typename TText, typename TSpec, typename TSize>
+    inline void
+    _wotdAppendChildTasks(
+        String<WotdTask_<TSize> > &tasks,
+        Index<TText, IndexWotd<TSpec> > const &index,
+        TSize firstChild,
+        TSize left,
+        TSize repLen)
+    {
+        TSize childLeft = left;
+        for (TSize child = firstChild; ; )
+        {
+            TSize w0 = dirAt(child, index);
+            TSize childRight = childLeft + 1;
+            if (!(w0 & index.LEAF))
+            {
+                childRight = dirAt(child + 1, index) & index.BITMASK1;
+                if (_wotdHullPredicate(index, w0))
+                    appendValue(tasks, WotdTask_<TSize>(child, childLeft, childRight, repLen));
+            }
+            if (w0 & index.LAST_CHILD)
+                break;
+            child += (w0 & index.LEAF)? 1: 2;
+            childLeft = childRight;
+        }
+    }
+
+    // evaluate a node without an iterator (see _wotdEvaluate) and append its children
+    template <typename TText, typename TSpec, typename TSize>
+    inline void
+    _wotdEvaluateTask(
+        String<WotdTask_<TSize> > &tasks,
+        Index<TText, IndexWotd<TSpec> > &index,
+        WotdTask_<TSize> const &task)
+    {
+        TSize repLen = _bucketLcp(
+            infix(indexSA(index), task.left, task.right),
+            indexText(index),
+            task.parentRepLen);
+        TSize dst = length(indexDir(index));
+
+        TSize size = _sortWotdBucket(index, task.left, task.right, repLen);
+        resize(indexDir(index), dst + size, Generous());
+        _storeWotdChildren(index, dst, repLen);
+
+        // mark nodes with solely empty child edges
+        TSize w1 = dst;
+        if (index.sentinelOcc > 0)
+        {
+            TSize sentinelSize = index.sentinelOcc;
+            if (index.interSentinelNodes && sentinelSize > 2)
+                sentinelSize = 2;
+            if (size == sentinelSize) w1 |= index.SENTINELS;
+        }
+        dirAt(task.node + 1, index) = w1;
+
+        _wotdAppendChildTasks(tasks, index, dst, task.left, repLen);
+    }
+
+    // evaluate all nodes below a node depth-first
+    template <typename TText, typename TSpec, typename TSize>
+    inline void
+    _wotdEvaluateSubtree(
+        Index<TText, IndexWotd<TSpec> > &index,
+        WotdTask_<TSize> const &root)
+    {
+        String<WotdTask_<TSize> > stack;
+        appendValue(stack, root);
+        while (!empty(stack))
+        {
+            WotdTask_<TSize> task = back(stack);
+            eraseBack(stack);
+            _wotdEvaluateTask(stack, index, task);
+        }
+    }
+
+    // a worker index shares the text and has its own SA interval, directory and counters
+    template <typename TText, typename TSpec>
+    inline void
+    _wotdInitWorker(Index<TText, IndexWotd<TSpec> > &worker, Index<TText, IndexWotd<TSpec> > const &index)
+    {
+        worker.interSentinelNodes = index.interSentinelNodes;
+        resize(worker.tempOcc, length(index.tempOcc), Exact());
+        resize(worker.tempBound, length(index.tempBound), Exact());
+    }
+
+    template <typename TText, typename TSpec>
+    inline Index<TText, IndexWotd<TSpec> > *
+    _wotdNewWorker(Index<TText, IndexWotd<TSpec> > &index)
+    {
+        Index<TText, IndexWotd<TSpec> > *worker = new Index<TText, IndexWotd<TSpec> >(indexText(index));
+        _wotdInitWorker(*worker, index);
+        return worker;
+    }
+
+    // copy the subtree evaluated by a worker for the SA interval starting at saOffset to the end of the directory
+    template <typename TText, typename TSpec, typename TSize, typename TWorkerDir>
+    inline void
+    _wotdAppendWorkerDir(
+        Index<TText, IndexWotd<TSpec> > &index,
+        TSize node,
+        TWorkerDir const &workerDir,
+        TSize saOffset)
+    {
+        typedef Index<TText, IndexWotd<TSpec> > TIndex;
+        typedef typename Fibre<TIndex, WotdDir>::Type TDir;
+        typedef typename Value<TDir>::Type            TDirValue;
+
+        // the worker's root entry is at 0 and its nodes start at 2
+        TSize dirOffset = length(indexDir(index)) - 2;
+        append(indexDir(index), suffix(workerDir, 2), Generous());
+
+        TDirValue w1 = workerDir[1];
+        dirAt(node + 1, index) = (w1 & ~index.BITMASK1) | ((w1 & index.BITMASK1) + dirOffset);
+
+        // SA links are relative to saOffset and topology links relative to dirOffset,
+        // the first child stores the parent's repLength instead of its SA link
+        String<TSize> blocks;
+        appendValue(blocks, (TSize)(w1 & index.BITMASK1));
+        while (!empty(blocks))
+        {
+            TSize firstChild = back(blocks);
+            eraseBack(blocks);
+            for (TSize child = firstChild; ; )
+            {
+                TDirValue &w0 = dirAt(child + dirOffset, index);
+                if (child != firstChild)
+                    w0 = (w0 & ~index.BITMASK0) | ((w0 & index.BITMASK0) + saOffset);
+                if (!(w0 & index.LEAF))
+                {
+                    TDirValue &cw1 = dirAt(child + dirOffset + 1, index);
+                    if (cw1 & index.UNEVALUATED)
+                    {
+                        cw1 = (cw1 & ~index.BITMASK1) | ((cw1 & index.BITMASK1) + saOffset);
+                    }
+                    else
+                    {
+                        appendValue(blocks, (TSize)(cw1 & index.BITMASK1));
+                        cw1 = (cw1 & ~index.BITMASK1) | ((cw1 & index.BITMASK1) + dirOffset);
+                    }
+                }
+                if (w0 & index.LAST_CHILD)
+                    break;
+                child += (w0 & index.LEAF)? 1: 2;
+            }
+        }
+    }
+
+    template <typename TText, typename TSpec>
+    inline void
+    _wotdEvaluateAll(Index<TText, IndexWotd<TSpec> > &index)
+    {
+        typedef Index<TText, IndexWotd<TSpec> >         TIndex;
+        typedef typename Size<TIndex>::Type             TSize;
+        typedef typename Fibre<TIndex, WotdDir>::Type   TDir;
+        typedef WotdTask_<TSize>                        TTask;
+
+        if (dirAt(0, index) & index.LEAF)
+            return;
+
+        String<TTask> tasks;
+        _wotdAppendChildTasks(tasks, index, (TSize)(dirAt(1, index) & index.BITMASK1), (TSize)0, (TSize)0);
+
+        int threads = omp_get_max_threads();
+        if (threads <= 1)
+        {
+            for (TSize t = 0; t < length(tasks); ++t)
+                _wotdEvaluateSubtree(index, tasks[t]);
+            return;
+        }
+
+        // evaluate the upper levels until there are enough independent subtrees
+        while (!empty(tasks) && length(tasks) < 8 * (TSize)threads)
+        {
+            String<TTask> nextTasks;
+            for (TSize t = 0; t < length(tasks); ++t)
+                _wotdEvaluateTask(nextTasks, index, tasks[t]);
+            swap(tasks, nextTasks);
+        }
+        std::sort(begin(tasks, Standard()), end(tasks, Standard()), WotdTaskGreater_());
+
+        // evaluate the subtrees in parallel, each in the SA interval and directory of a worker
+        String<TDir> results;
+        resize(results, length(tasks));
+
+        SEQAN_OMP_PRAGMA(parallel)
+        {
+            TIndex *worker = _wotdNewWorker(index);
+
+            SEQAN_OMP_PRAGMA(for schedule(dynamic))
+            for (int t = 0; t < (int)length(tasks); ++t)
+            {
+                TTask const &task = tasks[t];
+                assign(indexSA(*worker), infix(indexSA(index), task.left, task.right), Exact());
+                clear(indexDir(*worker));
+                resize(indexDir(*worker), 2);
+                dirAt(0, *worker) = index.LAST_CHILD;
+                dirAt(1, *worker) = (task.right - task.left) | index.UNEVALUATED;
+
+                _wotdEvaluateSubtree(*worker, TTask(0, 0, task.right - task.left, task.parentRepLen));
+
+                arrayCopyForward(begin(indexSA(*worker), Standard()), end(indexSA(*worker), Standard()),
+                                 begin(indexSA(index), Standard()) + task.left);
+                swap(results[t], indexDir(*worker));
+            }
+
+            delete worker;
+        }
+
+        // append the subtrees in a fixed order, independent of the number of threads
+        for (TSize t = 0; t < length(tasks); ++t)
+        {
+            _wotdAppendWorkerDir(index, tasks[t].node, results[t], tasks[t].left);
+            clear(results[t]);
+            shrinkToFit(results[t]);
+        }
+    }
+
+/*!
+ * @fn IndexWotd#indexCreate
+ * @headerfile <seqan/index.h>
+ * @brief Builds the wotd tree eagerly and in parallel.
+ *
+ * @signature bool indexCreate(index, WotdDir(), Parallel());
+ *
+ * @param[in,out] index The @link IndexWotd @endlink or @link IndexDfi @endlink to build.
+ *
+ * @return bool <tt>true</tt> on success.
+ *
+ * Instead of evaluating nodes lazily while the tree is traversed, all nodes are evaluated before.  Below the
+ * first levels, subtrees are independent and are evaluated by <tt>omp_get_max_threads()</tt> threads that take
+ * them from a shared queue, largest first.  An @link IndexDfi @endlink only evaluates the nodes that fulfill the
+ * monotonic hull predicate, the others are never visited.  Iterators traverse the same tree as with lazy
+ * evaluation, only the layout of the directory differs.  The original wotd variant (<tt>WotdOriginal</tt>) is
+ * still evaluated lazily.
+ */
+
+    template <typename TText, typename TSpec>
+    inline bool indexCreate(Index<TText, IndexWotd<TSpec> > &index, WotdDir const, Parallel const)
+    {
+        indexCreate(index, WotdDir(), Default());
+        _wotdEvaluateAll(index);
+        return true;
+    }
+
+    template <typename TText>
+    inline bool indexCreate(Index<TText, IndexWotd<WotdOriginal> > &index, WotdDir const, Parallel const)
+    {
+        return indexCreate(index, WotdDir(), Default());
+    }
+
 
 //////////////////////////////////////////////////////////////////////////////
 // clear
@@ -58,6 +58,7 @@
 // ===========================================================================
 
 #include <seqan/journaled_string_tree/delta_store.h>
+#include <seqan/journaled_string_tree/delta_coverage_compressed.h>
 #include <seqan/journaled_string_tree/delta_map_entry.h>
 #include <seqan/journaled_string_tree/delta_map.h>
 #include <seqan/journaled_string_tree/delta_map_iterator.h>
@@ -90,4 +91,14 @@
 #include <seqan/journaled_string_tree/jst_extension_shiftor.h>
 #include <seqan/journaled_string_tree/jst_extension_myers_ukkonen.h>
 
+#include <seqan/journaled_string_tree/journaled_string_tree_traverser_parallel.h>
+
+// ===========================================================================
+// Journaled String Tree I/O.
+// ===========================================================================
+
+#include <seqan/vcf_io.h>
+
+#include <seqan/journaled_string_tree/journaled_string_tree_io.h>
+
 #endif // INCLUDE_SEQAN_JOURNALED_STRING_TREE_H_
@@ -0,0 +1,578 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Implements a compressed representation of the coverage of a delta.
+//
+// Most variants of large cohorts are covered by a few haplotypes only, or
+// by long runs of haplotypes.  The coverage is thus stored either as sorted
+// list of ids, as list of half-open runs [b, e) or as plain 64 bit words,
+// whichever needs the least memory.  The words use the layout of the packed
+// bit vector (the first id is the most significant bit), such that the
+// traversal can combine the coverage word-wise with the coverage of a node.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_JOURNALED_STRING_TREE_DELTA_COVERAGE_COMPRESSED_H_
+#define INCLUDE_SEQAN_JOURNALED_STRING_TREE_DELTA_COVERAGE_COMPRESSED_H_
+
+namespace seqan2
+{
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class CompressedDeltaCoverage
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class CompressedDeltaCoverage
+ * @headerfile <seqan/journaled_string_tree.h>
+ * @brief Compressed coverage of a delta.
+ *
+ * @signature class CompressedDeltaCoverage;
+ *
+ * Stores the ids of the sequences covering a delta either as sorted list, as list of runs or as bit vector. The
+ * representation is chosen per delta, such that it uses the least memory. The encoding only depends on the
+ * coverage, i.e. two equal coverages have the same representation.
+ *
+ * Use @link CompressedJstConfig @endlink to store the coverages of a @link JournaledStringTree @endlink in this
+ * form.
+ */
+
+class CompressedDeltaCoverage
+{
+public:
+    enum Mode_
+    {
+        SPARSE = 0,     // Sorted list of covered ids.
+        RUNS   = 1,     // Sorted list of half-open runs [b, e) of covered ids.
+        BITS   = 2      // Packed bit vector, two values per 64 bit word (high word first).
+    };
+
+    uint32_t         _length;
+    uint8_t          _mode;
+    String<uint32_t> _data;
+
+    CompressedDeltaCoverage() : _length(0), _mode(SPARSE)
+    {}
+
+    template <typename THostSpec>
+    CompressedDeltaCoverage(String<bool, Packed<THostSpec> > const & bits) : _length(0), _mode(SPARSE)
+    {
+        compress(*this, bits);
+    }
+
+    template <typename THostSpec>
+    CompressedDeltaCoverage &
+    operator=(String<bool, Packed<THostSpec> > const & bits)
+    {
+        compress(*this, bits);
+        return *this;
+    }
+
+    inline bool operator[](uint32_t id) const;
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+template <>
+struct Size<CompressedDeltaCoverage>
+{
+    typedef uint32_t Type;
+};
+
+template <>
+struct Size<CompressedDeltaCoverage const> : Size<CompressedDeltaCoverage>
+{};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+namespace impl
+{
+
+// ----------------------------------------------------------------------------
+// Function impl::wordMaskFrom()
+// ----------------------------------------------------------------------------
+
+// Mask of the bits with offset >= k in a MSB-first 64 bit word.
+inline uint64_t
+wordMaskFrom(uint32_t k)
+{
+    return (k >= 64u) ? 0ull : (~0ull >> k);
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::bitVectorWord()
+// ----------------------------------------------------------------------------
+
+// Returns the w-th word of a packed bit vector with the bits behind the end cleared.
+template <typename THostSpec>
+inline uint64_t
+bitVectorWord(String<bool, Packed<THostSpec> > const & bits, uint32_t w)
+{
+    static_assert(PackedTraits_<String<bool, Packed<THostSpec> > >::VALUES_PER_HOST_VALUE == 64,
+                  "Only bit vectors with 64 bit words are supported.");
+
+    uint64_t word = host(bits)[w + 1].i;
+    uint64_t rest = length(bits) - (static_cast<uint64_t>(w) << 6);
+    return (rest < 64u) ? (word & ~wordMaskFrom(rest)) : word;
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::forEachCoveredInWord()
+// ----------------------------------------------------------------------------
+
+template <typename TFunctor>
+inline void
+forEachCoveredInWord(uint64_t word, uint32_t offset, TFunctor && f)
+{
+    while (word != 0u)
+    {
+        unsigned bit = bitScanReverse(word);
+        f(offset + 63u - bit);
+        word ^= (1ull << bit);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::forEachCovered()
+// ----------------------------------------------------------------------------
+
+// Calls f(id) for all ids in [beginId, endId) that are set in the coverage.
+
+template <typename THostSpec, typename TFunctor>
+inline void
+forEachCovered(String<bool, Packed<THostSpec> > const & bits, uint32_t beginId, uint32_t endId, TFunctor && f)
+{
+    endId = std::min(endId, static_cast<uint32_t>(length(bits)));
+    if (beginId >= endId)
+        return;
+
+    uint32_t wBegin = beginId >> 6;
+    uint32_t wLast = (endId - 1) >> 6;
+    for (uint32_t w = wBegin; w <= wLast; ++w)
+    {
+        uint64_t word = bitVectorWord(bits, w);
+        if (w == wBegin)
+            word &= wordMaskFrom(beginId & 63u);
+        if (w == wLast)
+            word &= ~wordMaskFrom(endId - (w << 6));
+        forEachCoveredInWord(word, w << 6, f);
+    }
+}
+
+template <typename TFunctor>
+inline void
+forEachCovered(CompressedDeltaCoverage const & cov, uint32_t beginId, uint32_t endId, TFunctor && f)
+{
+    typedef typename Iterator<String<uint32_t> const, Standard>::Type TIter;
+
+    endId = std::min(endId, cov._length);
+    if (beginId >= endId)
+        return;
+
+    TIter it = begin(cov._data, Standard());
+    TIter itEnd = end(cov._data, Standard());
+    switch (cov._mode)
+    {
+        case CompressedDeltaCoverage::SPARSE:
+        {
+            for (it = std::lower_bound(it, itEnd, beginId); it != itEnd && *it < endId; ++it)
+                f(*it);
+            break;
+        }
+        case CompressedDeltaCoverage::RUNS:
+        {
+            for (; it != itEnd && *it < endId; it += 2)
+                for (uint32_t id = std::max(*it, beginId); id < std::min(*(it + 1), endId); ++id)
+                    f(id);
+            break;
+        }
+        default:
+        {
+            uint32_t wBegin = beginId >> 6;
+            uint32_t wLast = (endId - 1) >> 6;
+            for (uint32_t w = wBegin; w <= wLast; ++w)
+            {
+                uint64_t word = (static_cast<uint64_t>(cov._data[2 * w]) << 32) | cov._data[2 * w + 1];
+                if (w == wBegin)
+                    word &= wordMaskFrom(beginId & 63u);
+                if (w == wLast)
+                    word &= ~wordMaskFrom(endId - (w << 6));
+                forEachCoveredInWord(word, w << 6, f);
+            }
+        }
+    }
+}
+
+template <typename TCoverage, typename TFunctor>
+inline void
+forEachCovered(TCoverage const & cov, TFunctor && f)
+{
+    forEachCovered(cov, 0u, static_cast<uint32_t>(length(cov)), f);
+}
+
+// ----------------------------------------------------------------------------
+// Class impl::CompressedCoverageWordCursor_
+// ----------------------------------------------------------------------------
+
+// Decodes the coverage word by word.  The words must be requested in increasing order.
+struct CompressedCoverageWordCursor_
+{
+    CompressedDeltaCoverage const * cov;
+    uint32_t                        pos;
+
+    explicit CompressedCoverageWordCursor_(CompressedDeltaCoverage const & _cov) : cov(&_cov), pos(0)
+    {}
+
+    inline uint64_t
+    operator()(uint32_t w)
+    {
+        uint32_t const wBegin = w << 6;
+        uint32_t const wEnd = wBegin + 64u;
+        uint32_t const n = length(cov->_data);
+        uint64_t word = 0;
+        switch (cov->_mode)
+        {
+            case CompressedDeltaCoverage::SPARSE:
+            {
+                for (; pos < n && cov->_data[pos] < wEnd; ++pos)
+                    word |= 1ull << (63u - (cov->_data[pos] - wBegin));
+                break;
+            }
+            case CompressedDeltaCoverage::RUNS:
+            {
+                for (; pos < n && cov->_data[pos] < wEnd; pos += 2)
+                {
+                    uint32_t b = std::max(cov->_data[pos], wBegin);
+                    uint32_t e = std::min(cov->_data[pos + 1], wEnd);
+                    word |= wordMaskFrom(b - wBegin) & ~wordMaskFrom(e - wBegin);
+                    if (cov->_data[pos + 1] > wEnd)  // Run continues in the next word.
+                        break;
+                }
+                break;
+            }
+            default:
+                word = (static_cast<uint64_t>(cov->_data[2 * w]) << 32) | cov->_data[2 * w + 1];
+        }
+        return word;
+    }
+};
+
+}  // namespace impl
+
+// ----------------------------------------------------------------------------
+// Function compress()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn CompressedDeltaCoverage#compress
+ * @headerfile <seqan/journaled_string_tree.h>
+ * @brief Encodes a bit vector.
+ *
+ * @signature void compress(cov, bits);
+ *
+ * @param[out] cov  The @link CompressedDeltaCoverage @endlink to fill.
+ * @param[in]  bits The coverage as <tt>String&lt;bool, Packed&lt;&gt; &gt;</tt>.
+ */
+
+template <typename THostSpec>
+inline void
+compress(CompressedDeltaCoverage & cov, String<bool, Packed<THostSpec> > const & bits)
+{
+    SEQAN_ASSERT_LEQ(length(bits), static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()));
+
+    cov._length = length(bits);
+    clear(cov._data);
+
+    // Count set bits and runs to select the smallest representation.
+    uint32_t const words = (cov._length + 63u) >> 6;
+    uint64_t ones = 0;
+    uint64_t runs = 0;
+    uint64_t carry = 0;
+    for (uint32_t w = 0; w < words; ++w)
+    {
+        uint64_t word = impl::bitVectorWord(bits, w);
+        ones += popCount(word);
+        runs += popCount(word & ~((word >> 1) | (carry << 63)));
+        carry = word & 1u;
+    }
+
+    if (ones <= 2 * runs && ones <= 2ull * words)
+    {
+        cov._mode = CompressedDeltaCoverage::SPARSE;
+        reserve(cov._data, ones, Exact());
+        impl::forEachCovered(bits, [&cov](uint32_t id)
+        {
+            appendValue(cov._data, id);
+        });
+    }
+    else if (2 * runs <= 2ull * words)
+    {
+        cov._mode = CompressedDeltaCoverage::RUNS;
+        reserve(cov._data, 2 * runs, Exact());
+        impl::forEachCovered(bits, [&cov](uint32_t id)
+        {
+            if (!empty(cov._data) && back(cov._data) == id)
+            {
+                ++back(cov._data);
+            }
+            else
+            {
+                appendValue(cov._data, id);
+                appendValue(cov._data, id + 1);
+            }
+        });
+    }
+    else
+    {
+        cov._mode = CompressedDeltaCoverage::BITS;
+        resize(cov._data, 2 * words, Exact());
+        for (uint32_t w = 0; w < words; ++w)
+        {
+            uint64_t word = impl::bitVectorWord(bits, w);
+            cov._data[2 * w] = static_cast<uint32_t>(word >> 32);
+            cov._data[2 * w + 1] = static_cast<uint32_t>(word);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function decompress()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn CompressedDeltaCoverage#decompress
+ * @headerfile <seqan/journaled_string_tree.h>
+ * @brief Decodes the coverage into a bit vector.
+ *
+ * @signature void decompress(bits, cov);
+ *
+ * @param[out] bits The decoded coverage as <tt>String&lt;bool, Packed&lt;&gt; &gt;</tt>.
+ * @param[in]  cov  The @link CompressedDeltaCoverage @endlink to decode.
+ */
+
+template <typename THostSpec>
+inline void
+decompress(String<bool, Packed<THostSpec> > & bits, CompressedDeltaCoverage const & cov)
+{
+    clear(bits);
+    resize(bits, cov._length, false, Exact());
+    impl::forEachCovered(cov, [&bits](uint32_t id)
+    {
+        bits[id] = true;
+    });
+}
+
+// ----------------------------------------------------------------------------
+// Function length()
+// ----------------------------------------------------------------------------
+
+inline uint32_t
+length(CompressedDeltaCoverage const & cov)
+{
+    return cov._length;
+}
+
+// ----------------------------------------------------------------------------
+// Function empty()
+// ----------------------------------------------------------------------------
+
+inline bool
+empty(CompressedDeltaCoverage const & cov)
+{
+    return cov._length == 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+inline void
+clear(CompressedDeltaCoverage & cov)
+{
+    cov._length = 0;
+    cov._mode = CompressedDeltaCoverage::SPARSE;
+    clear(cov._data);
+}
+
+// ----------------------------------------------------------------------------
+// Function resize()
+// ----------------------------------------------------------------------------
+
+template <typename TSize, typename TExpand>
+inline void
+resize(CompressedDeltaCoverage & cov, TSize const newLength, bool const val, Tag<TExpand> const & tag)
+{
+    String<bool, Packed<> > bits;
+    decompress(bits, cov);
+    resize(bits, newLength, val, tag);
+    compress(cov, bits);
+}
+
+template <typename TSize>
+inline void
+resize(CompressedDeltaCoverage & cov, TSize const newLength, bool const val)
+{
+    resize(cov, newLength, val, Exact());
+}
+
+// ----------------------------------------------------------------------------
+// Function CompressedDeltaCoverage::operator[]()
+// ----------------------------------------------------------------------------
+
+inline bool
+CompressedDeltaCoverage::operator[](uint32_t id) const
+{
+    typedef Iterator<String<uint32_t> const, Standard>::Type TIter;
+
+    SEQAN_ASSERT_LT(id, _length);
+
+    TIter itBegin = begin(_data, Standard());
+    TIter itEnd = end(_data, Standard());
+    switch (_mode)
+    {
+        case SPARSE:
+            return std::binary_search(itBegin, itEnd, id);
+        case RUNS:
+        {
+            // Position of the first boundary greater than id; odd positions lie within a run.
+            return ((std::upper_bound(itBegin, itEnd, id) - itBegin) & 1) != 0;
+        }
+        default:
+            return ((_data[2 * (id >> 6) + ((id & 63u) >> 5)] >> (31u - (id & 31u))) & 1u) != 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function testAllZeros()
+// ----------------------------------------------------------------------------
+
+inline bool
+testAllZeros(CompressedDeltaCoverage const & cov)
+{
+    if (cov._mode != CompressedDeltaCoverage::BITS)
+        return empty(cov._data);
+    return std::find_if(begin(cov._data, Standard()), end(cov._data, Standard()),
+                        [](uint32_t w) { return w != 0u; }) == end(cov._data, Standard());
+}
+
+// ----------------------------------------------------------------------------
+// Function transform()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn CompressedDeltaCoverage#transform
+ * @headerfile <seqan/journaled_string_tree.h>
+ * @brief Combines a bit vector word-wise with a compressed coverage.
+ *
+ * @signature void transform(target, lhs, cov, binaryFunctor);
+ *
+ * @param[out] target The resulting bit vector. Can be the same object as <tt>lhs</tt>.
+ * @param[in]  lhs    The left operand of type <tt>String&lt;bool, Packed&lt;&gt; &gt;</tt>.
+ * @param[in]  cov    The right operand of type @link CompressedDeltaCoverage @endlink.
+ * @param[in]  binaryFunctor The functor applied to the words of both operands.
+ *
+ * The coverage is decoded word by word without materializing the full bit vector.
+ */
+
+template <typename THostSpec, typename TBinaryFunctor>
+inline void
+transform(String<bool, Packed<THostSpec> > & target,
+          String<bool, Packed<THostSpec> > const & lhs,
+          CompressedDeltaCoverage const & cov,
+          TBinaryFunctor const & binaryFunctor)
+{
+    typedef String<bool, Packed<THostSpec> > TBitVector;
+    typedef typename Host<TBitVector>::Type THost;
+    typedef typename Value<THost>::Type THostValue;
+
+    if (empty(host(lhs)))
+        return;
+
+    SEQAN_ASSERT_EQ(length(lhs), length(cov));
+
+    resize(target, length(lhs), Exact());
+
+    impl::CompressedCoverageWordCursor_ cursor(cov);
+    THostValue rhsValue;
+    uint32_t const words = (length(lhs) + 63u) >> 6;
+    for (uint32_t w = 0; w < words; ++w)
+    {
+        rhsValue.i = cursor(w);
+        host(target)[w + 1] = binaryFunctor(host(lhs)[w + 1], rhsValue);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function operator==()
+// ----------------------------------------------------------------------------
+
+inline bool
+operator==(CompressedDeltaCoverage const & lhs, CompressedDeltaCoverage const & rhs)
+{
+    return lhs._length == rhs._length && lhs._mode == rhs._mode && lhs._data == rhs._data;
+}
+
+inline bool
+operator!=(CompressedDeltaCoverage const & lhs, CompressedDeltaCoverage const & rhs)
+{
+    return !(lhs == rhs);
+}
+
+// ----------------------------------------------------------------------------
+// Function _printCoverage()
+// ----------------------------------------------------------------------------
+
+inline String<char>
+_printCoverage(CompressedDeltaCoverage const & cov)
+{
+    String<char> tmp;
+    resize(tmp, length(cov), '0');
+    impl::forEachCovered(cov, [&tmp](uint32_t id)
+    {
+        tmp[id] = '1';
+    });
+    return tmp;
+}
+
+}
+
+#endif // INCLUDE_SEQAN_JOURNALED_STRING_TREE_DELTA_COVERAGE_COMPRESSED_H_
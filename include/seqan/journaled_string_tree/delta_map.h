@@ -172,12 +172,31 @@ struct Member<DeltaMap<TConfig, TSpec> const, TTag>
  * @return TValue The value type to use for <tt>TDeltaMap</tt>.
  */
 
+// The coverage type is taken from TConfig::TCoverage if the config defines it.
+template <typename T>
+struct DeltaMapVoid_
+{
+    typedef void Type;
+};
+
+template <typename TConfig, typename TEnable = void>
+struct DeltaMapConfigCoverage_
+{
+    typedef String<bool, Packed<> > Type;
+};
+
+template <typename TConfig>
+struct DeltaMapConfigCoverage_<TConfig, typename DeltaMapVoid_<typename TConfig::TCoverage>::Type>
+{
+    typedef typename TConfig::TCoverage Type;
+};
+
 template <typename TConfig, typename TSpec>
 struct Value<DeltaMap<TConfig, TSpec> >
 {
     typedef typename Member<DeltaMap<TConfig, TSpec>, DeltaMapStoreMember>::Type TDeltaStore_;
     typedef typename Size<TDeltaStore_>::Type TSize_;
-    typedef DeltaMapEntry<typename TConfig::TDeltaPos, TSize_> Type;
+    typedef DeltaMapEntry<typename TConfig::TDeltaPos, TSize_, typename DeltaMapConfigCoverage_<TConfig>::Type> Type;
 };
 
 template <typename TConfig, typename TSpec>
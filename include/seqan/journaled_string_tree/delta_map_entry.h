@@ -82,7 +82,10 @@ typedef Tag<DeltaMapEntryDeltaPosition_> DeltaMapEntryDeltaPosition;
 // Class DeltaMapEntry
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
+// TCov is the type used to store the coverage of the delta. The default is a
+// plain bit vector, CompressedDeltaCoverage stores it as sparse id list or runs.
+
+template <typename TRefPos, typename TStorePos, typename TCov = String<bool, Packed<> > >
 class DeltaMapEntry
 {
 public:
@@ -101,14 +104,16 @@ public:
     {}
 
     // Custom C'tor.
-    DeltaMapEntry(TDeltaPos _deltaPos, TDeltaRecord _deltaRecord, TCoverage const & _coverage) :
+    template <typename TCoverage_>
+    DeltaMapEntry(TDeltaPos _deltaPos, TDeltaRecord _deltaRecord, TCoverage_ const & _coverage) :
     deltaPosition(_deltaPos),
     deltaRecord(_deltaRecord),
     deltaCoverage(_coverage),
     deltaTypeEnd(DeltaEndType::IS_BOTH)
     {}
 
-    DeltaMapEntry(TDeltaPos _deltaPos, TDeltaRecord _deltaRecord, TCoverage const & _coverage, DeltaEndType endType) :
+    template <typename TCoverage_>
+    DeltaMapEntry(TDeltaPos _deltaPos, TDeltaRecord _deltaRecord, TCoverage_ const & _coverage, DeltaEndType endType) :
         deltaPosition(_deltaPos),
         deltaRecord(_deltaRecord),
         deltaCoverage(_coverage),
@@ -160,14 +165,14 @@ struct DeltaMapEntryPosLessThanComparator_
 // Metafunction DeltaPosition
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
-struct DeltaPosition<DeltaMapEntry<TRefPos, TStorePos> >
+template <typename TRefPos, typename TStorePos, typename TCov>
+struct DeltaPosition<DeltaMapEntry<TRefPos, TStorePos, TCov> >
 {
     typedef TRefPos Type;
 };
 
-template <typename TRefPos, typename TStorePos>
-struct DeltaPosition<DeltaMapEntry<TRefPos, TStorePos> const>
+template <typename TRefPos, typename TStorePos, typename TCov>
+struct DeltaPosition<DeltaMapEntry<TRefPos, TStorePos, TCov> const>
 {
     typedef TRefPos const Type;
 };
@@ -176,33 +181,33 @@ struct DeltaPosition<DeltaMapEntry<TRefPos, TStorePos> const>
 // Metafunction DeltaCoverage
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
-struct DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos> >
+template <typename TRefPos, typename TStorePos, typename TCov>
+struct DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos, TCov> >
 {
-    typedef String<bool, Packed<> > Type;
+    typedef TCov Type;
 };
 
-template <typename TRefPos, typename TStorePos>
-struct DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos> const>
+template <typename TRefPos, typename TStorePos, typename TCov>
+struct DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos, TCov> const>
 {
-    typedef typename DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos> >::Type const Type;
+    typedef typename DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos, TCov> >::Type const Type;
 };
 
 // ----------------------------------------------------------------------------
 // Metafunction DeltaRecord
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
-struct DeltaRecord<DeltaMapEntry<TRefPos, TStorePos> >
+template <typename TRefPos, typename TStorePos, typename TCov>
+struct DeltaRecord<DeltaMapEntry<TRefPos, TStorePos, TCov> >
 {
     static const unsigned REMAINING_BITS = BitsPerValue<TStorePos>::VALUE - BitsPerValue<DeltaType>::VALUE;
     typedef Pair<TStorePos, TStorePos, BitPacked<BitsPerValue<DeltaType>::VALUE, REMAINING_BITS> > Type;
 };
 
-template <typename TRefPos, typename TStorePos>
-struct DeltaRecord<DeltaMapEntry<TRefPos, TStorePos> const>
+template <typename TRefPos, typename TStorePos, typename TCov>
+struct DeltaRecord<DeltaMapEntry<TRefPos, TStorePos, TCov> const>
 {
-    typedef typename DeltaRecord<DeltaMapEntry<TRefPos, TStorePos> >::Type const Type;
+    typedef typename DeltaRecord<DeltaMapEntry<TRefPos, TStorePos, TCov> >::Type const Type;
 };
 
 // ============================================================================
@@ -213,9 +218,9 @@ struct DeltaRecord<DeltaMapEntry<TRefPos, TStorePos> const>
 // Function setRefPosition()
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos, typename TPosition>
+template <typename TRefPos, typename TStorePos, typename TCov, typename TPosition>
 inline void
-setDeltaPosition(DeltaMapEntry<TRefPos, TStorePos> & deltaEntry, TPosition newRefPos)
+setDeltaPosition(DeltaMapEntry<TRefPos, TStorePos, TCov> & deltaEntry, TPosition newRefPos)
 {
     deltaEntry.refPos = newRefPos;
 }
@@ -224,16 +229,16 @@ setDeltaPosition(DeltaMapEntry<TRefPos, TStorePos> & deltaEntry, TPosition newRe
 // Function getRefPosition()
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
-inline typename DeltaPosition<DeltaMapEntry<TRefPos, TStorePos> >::Type &
-getDeltaPosition(DeltaMapEntry<TRefPos, TStorePos> & deltaEntry)
+template <typename TRefPos, typename TStorePos, typename TCov>
+inline typename DeltaPosition<DeltaMapEntry<TRefPos, TStorePos, TCov> >::Type &
+getDeltaPosition(DeltaMapEntry<TRefPos, TStorePos, TCov> & deltaEntry)
 {
     return deltaEntry.deltaPosition;
 }
 
-template <typename TRefPos, typename TStorePos>
-inline typename DeltaPosition<DeltaMapEntry<TRefPos, TStorePos> const>::Type &
-getDeltaPosition(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
+template <typename TRefPos, typename TStorePos, typename TCov>
+inline typename DeltaPosition<DeltaMapEntry<TRefPos, TStorePos, TCov> const>::Type &
+getDeltaPosition(DeltaMapEntry<TRefPos, TStorePos, TCov> const & deltaEntry)
 {
     return deltaEntry.deltaPosition;
 }
@@ -242,9 +247,9 @@ getDeltaPosition(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
 // Function setDeltaCoverage()
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos, typename TCoverage>
+template <typename TRefPos, typename TStorePos, typename TCov, typename TCoverage>
 inline void
-setDeltaCoverage(DeltaMapEntry<TRefPos, TStorePos> & deltaEntry, TCoverage newDeltaCoverage)
+setDeltaCoverage(DeltaMapEntry<TRefPos, TStorePos, TCov> & deltaEntry, TCoverage newDeltaCoverage)
 {
     deltaEntry.deltaCoverage = newDeltaCoverage;
 }
@@ -253,16 +258,16 @@ setDeltaCoverage(DeltaMapEntry<TRefPos, TStorePos> & deltaEntry, TCoverage newDe
 // Function getDeltaCoverage()
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
-inline typename DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos> >::Type &
-getDeltaCoverage(DeltaMapEntry<TRefPos, TStorePos> & deltaEntry)
+template <typename TRefPos, typename TStorePos, typename TCov>
+inline typename DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos, TCov> >::Type &
+getDeltaCoverage(DeltaMapEntry<TRefPos, TStorePos, TCov> & deltaEntry)
 {
     return deltaEntry.deltaCoverage;
 }
 
-template <typename TRefPos, typename TStorePos>
-inline typename DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos> const>::Type &
-getDeltaCoverage(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
+template <typename TRefPos, typename TStorePos, typename TCov>
+inline typename DeltaCoverage<DeltaMapEntry<TRefPos, TStorePos, TCov> const>::Type &
+getDeltaCoverage(DeltaMapEntry<TRefPos, TStorePos, TCov> const & deltaEntry)
 {
     return deltaEntry.deltaCoverage;
 }
@@ -271,9 +276,9 @@ getDeltaCoverage(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
 // Function setDeltaRecord()
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos, typename TRecord>
+template <typename TRefPos, typename TStorePos, typename TCov, typename TRecord>
 inline void
-setDeltaRecord(DeltaMapEntry<TRefPos, TStorePos> & deltaEntry, TRecord newDeltaRecord)
+setDeltaRecord(DeltaMapEntry<TRefPos, TStorePos, TCov> & deltaEntry, TRecord newDeltaRecord)
 {
     deltaEntry.deltaRecord = newDeltaRecord;
 }
@@ -282,16 +287,16 @@ setDeltaRecord(DeltaMapEntry<TRefPos, TStorePos> & deltaEntry, TRecord newDeltaR
 // Function getDeltaCoverage()
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
-inline typename DeltaRecord<DeltaMapEntry<TRefPos, TStorePos> >::Type &
-getDeltaRecord(DeltaMapEntry<TRefPos, TStorePos> & deltaEntry)
+template <typename TRefPos, typename TStorePos, typename TCov>
+inline typename DeltaRecord<DeltaMapEntry<TRefPos, TStorePos, TCov> >::Type &
+getDeltaRecord(DeltaMapEntry<TRefPos, TStorePos, TCov> & deltaEntry)
 {
     return deltaEntry.deltaRecord;
 }
 
-template <typename TRefPos, typename TStorePos>
-inline typename DeltaRecord<DeltaMapEntry<TRefPos, TStorePos> const>::Type &
-getDeltaRecord(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
+template <typename TRefPos, typename TStorePos, typename TCov>
+inline typename DeltaRecord<DeltaMapEntry<TRefPos, TStorePos, TCov> const>::Type &
+getDeltaRecord(DeltaMapEntry<TRefPos, TStorePos, TCov> const & deltaEntry)
 {
     return deltaEntry.deltaRecord;
 }
@@ -309,9 +314,9 @@ getDeltaRecord(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
  * @return TId The id for the current delta event of type <tt>DeltaType</tt>.
  */
 
-template <typename TRefPos, typename TStorePos>
+template <typename TRefPos, typename TStorePos, typename TCov>
 inline TStorePos
-getStorePosition(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
+getStorePosition(DeltaMapEntry<TRefPos, TStorePos, TCov> const & deltaEntry)
 {
     return getDeltaRecord(deltaEntry).i2;
 }
@@ -329,9 +334,9 @@ getStorePosition(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
  * @return TId The id for the current delta event of type <tt>DeltaType</tt>.
  */
 
-template <typename TRefPos, typename TStorePos>
+template <typename TRefPos, typename TStorePos, typename TCov>
 inline DeltaType
-getDeltaType(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
+getDeltaType(DeltaMapEntry<TRefPos, TStorePos, TCov> const & deltaEntry)
 {
     return static_cast<DeltaType>(getDeltaRecord(deltaEntry).i1);
 }
@@ -340,9 +345,9 @@ getDeltaType(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
 // Function isLeftEnd();
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
+template <typename TRefPos, typename TStorePos, typename TCov>
 inline bool
-isLeftEnd(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
+isLeftEnd(DeltaMapEntry<TRefPos, TStorePos, TCov> const & deltaEntry)
 {
     return deltaEntry.deltaEndType == DeltaEndType::IS_LEFT;
 }
@@ -351,9 +356,9 @@ isLeftEnd(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
 // Function isRightEnd();
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
+template <typename TRefPos, typename TStorePos, typename TCov>
 inline bool
-isRightEnd(DeltaMapEntry<TRefPos, TStorePos> const & deltaEntry)
+isRightEnd(DeltaMapEntry<TRefPos, TStorePos, TCov> const & deltaEntry)
 {
     return deltaEntry.deltaTypeEnd == DeltaEndType::IS_RIGHT;
 }
@@ -390,8 +395,8 @@ applyOnDelta(TFunctor & func,
 // Function operator==()
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
-inline bool operator==(DeltaMapEntry<TRefPos, TStorePos> const & lhs, DeltaMapEntry<TRefPos, TStorePos> const & rhs)
+template <typename TRefPos, typename TStorePos, typename TCov>
+inline bool operator==(DeltaMapEntry<TRefPos, TStorePos, TCov> const & lhs, DeltaMapEntry<TRefPos, TStorePos, TCov> const & rhs)
 {
     return (lhs.deltaPosition == rhs.deltaPosition) && (lhs.deltaRecord == rhs.deltaRecord) &&
            (lhs.deltaCoverage == rhs.deltaCoverage);
@@ -401,8 +406,8 @@ inline bool operator==(DeltaMapEntry<TRefPos, TStorePos> const & lhs, DeltaMapEn
 // Function operator!=()
 // ----------------------------------------------------------------------------
 
-template <typename TRefPos, typename TStorePos>
-inline bool operator!=(DeltaMapEntry<TRefPos, TStorePos> const & lhs, DeltaMapEntry<TRefPos, TStorePos> const & rhs)
+template <typename TRefPos, typename TStorePos, typename TCov>
+inline bool operator!=(DeltaMapEntry<TRefPos, TStorePos, TCov> const & lhs, DeltaMapEntry<TRefPos, TStorePos, TCov> const & rhs)
 {
     return !(lhs == rhs);
 }
@@ -428,8 +433,8 @@ _printCoverage(TCoverage const & cov)
 // Function operator<<()
 // ----------------------------------------------------------------------------
 
-template <typename TStream, typename TRefPos, typename TStorePos>
-inline TStream & operator<<(TStream & stream, DeltaMapEntry<TRefPos, TStorePos> const & entry)
+template <typename TStream, typename TRefPos, typename TStorePos, typename TCov>
+inline TStream & operator<<(TStream & stream, DeltaMapEntry<TRefPos, TStorePos, TCov> const & entry)
 {
     stream << "<" << entry.deltaPosition << ", ";
     switch (entry.deltaRecord.i1)
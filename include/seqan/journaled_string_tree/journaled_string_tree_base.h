@@ -118,6 +118,29 @@ struct DefaultJstConfig
     typedef Pair<TDelValue, TInsValue>      TSVValue;   // Value type of structural variants (combination of deletion and insertion).
 };
 
+// ----------------------------------------------------------------------------
+// Class CompressedJstConfig
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class CompressedJstConfig
+ * @headerfile <seqan/journaled_string_tree.h>
+ * @brief Journaled-String-Tree configuration storing the coverages compressed.
+ *
+ * @signature template <typename TSequence>
+ *            class CompressedJstConfig<TSequence>;
+ *
+ * @tparam TSequence Type of the underlying base sequence.
+ *
+ * Same as the @link DefaultJstConfig @endlink but stores the coverage of every delta as
+ * @link CompressedDeltaCoverage @endlink. Use this configuration for large numbers of sequences.
+ */
+template <typename TSequence>
+struct CompressedJstConfig : DefaultJstConfig<TSequence>
+{
+    typedef CompressedDeltaCoverage         TCoverage;  // Storage type of the delta coverages.
+};
+
 // ============================================================================
 // Metafunctions
 // ============================================================================
@@ -596,8 +596,7 @@ insert(JournaledStringTree<TSequence, TConfig, TSpec> & jst,
        TDeltaType /*deltaType*/)
 {
     typedef JournaledStringTree<TSequence, TConfig, TSpec>  TJst;
-    typedef typename Member<TJst, JstDeltaMapMember>::Type  TDeltaMap;
-    typedef typename DeltaCoverage<TDeltaMap>::Type         TCoverage;
+    typedef String<bool, Packed<> >                         TCoverage;
     typedef typename Value<TIds>::Type                      TID;
     typedef typename Size<TJst>::Type                       TSize   SEQAN_TYPEDEF_FOR_DEBUG;
 
@@ -0,0 +1,598 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Builds a journaled string tree from a VCF file and stores it on disk.
+//
+// The VCF records are streamed once, every haplotype of every sample becomes
+// one sequence of the tree.  The binary file written by save() contains the
+// source and the deltas with compressed coverages in native byte order:
+//
+//   "SQJST" version:u8 dimension:u64 |source|:u64 source:u8[] #deltas:u64
+//   per delta: pos:u64 type:u8 value coverage
+//
+// The value is the ordinal value of a SNP, the size of a deletion, the
+// length and ordinal values of an insertion, or both for an SV.  The
+// coverage is stored as mode:u8 length:u32 #data:u64 data:u32[].
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_JOURNALED_STRING_TREE_JOURNALED_STRING_TREE_IO_H_
+#define INCLUDE_SEQAN_JOURNALED_STRING_TREE_JOURNALED_STRING_TREE_IO_H_
+
+#include <fstream>
+
+namespace seqan2
+{
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+namespace impl
+{
+
+// ----------------------------------------------------------------------------
+// Class impl::JstVcfDelta_
+// ----------------------------------------------------------------------------
+
+// A normalized delta of one ALT allele.
+struct JstVcfDelta_
+{
+    uint32_t    pos;
+    DeltaType   type;
+    uint32_t    delLength;
+    CharString  insValue;
+};
+
+}  // namespace impl
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+namespace impl
+{
+
+// ----------------------------------------------------------------------------
+// Function impl::jstVcfDeltas()
+// ----------------------------------------------------------------------------
+
+// Converts one ALT allele into deltas.  The common prefix and suffix of REF
+// and ALT are removed, equally long alleles become SNPs.  Returns false for
+// symbolic, breakend, and missing alleles.
+template <typename TString>
+inline bool
+jstVcfDeltas(String<JstVcfDelta_> & deltas, uint32_t beginPos, CharString const & ref, TString const & alt)
+{
+    clear(deltas);
+    if (empty(alt) || alt == "*" || alt == "." || std::find_if(begin(alt, Standard()), end(alt, Standard()),
+                                                                [](char c) { return c == '<' || c == '[' || c == ']'; })
+                                                   != end(alt, Standard()))
+        return false;
+
+    uint32_t refBegin = 0, refEnd = length(ref), altEnd = length(alt);
+    while (refBegin < refEnd && refBegin < altEnd && toUpperValue(ref[refBegin]) == toUpperValue(alt[refBegin]))
+        ++refBegin;
+    uint32_t altBegin = refBegin;
+    while (refEnd > refBegin && altEnd > altBegin && toUpperValue(ref[refEnd - 1]) == toUpperValue(alt[altEnd - 1]))
+    {
+        --refEnd;
+        --altEnd;
+    }
+
+    JstVcfDelta_ delta;
+    delta.pos = beginPos + refBegin;
+    delta.delLength = refEnd - refBegin;
+    uint32_t insLength = altEnd - altBegin;
+    if (delta.delLength == insLength)
+    {
+        delta.type = DELTA_TYPE_SNP;
+        delta.delLength = 1;
+        for (uint32_t i = 0; i < insLength; ++i, ++delta.pos)
+        {
+            if (toUpperValue(ref[refBegin + i]) == toUpperValue(alt[altBegin + i]))
+                continue;
+            clear(delta.insValue);
+            appendValue(delta.insValue, alt[altBegin + i]);
+            appendValue(deltas, delta);
+        }
+        return true;
+    }
+
+    delta.insValue = infix(alt, altBegin, altEnd);
+    if (delta.delLength == 0)
+        delta.type = DELTA_TYPE_INS;
+    else if (insLength == 0)
+        delta.type = DELTA_TYPE_DEL;
+    else
+        delta.type = DELTA_TYPE_SV;
+    appendValue(deltas, delta);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::jstVcfGenotype()
+// ----------------------------------------------------------------------------
+
+// Writes the allele of every haplotype of the sample to alleles[offset..offset + ploidy).
+// Missing alleles and missing haplotypes refer to the reference.
+template <typename TAlleles>
+inline void
+jstVcfGenotype(TAlleles & alleles, unsigned offset, unsigned ploidy, CharString const & info)
+{
+    typedef Iterator<CharString const, Standard>::Type TIter;
+
+    TIter it = begin(info, Standard());
+    TIter itEnd = end(info, Standard());
+    for (unsigned h = 0; h < ploidy; ++h)
+    {
+        unsigned allele = 0;
+        for (; it != itEnd && isdigit(*it); ++it)
+            allele = allele * 10 + (*it - '0');
+        alleles[offset + h] = allele;
+        for (; it != itEnd && *it != '|' && *it != '/' && *it != ':'; ++it)
+        {}
+        if (it == itEnd || *it == ':')
+            it = itEnd;
+        else
+            ++it;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::jstVcfPloidy()
+// ----------------------------------------------------------------------------
+
+inline unsigned
+jstVcfPloidy(CharString const & info)
+{
+    unsigned ploidy = 1;
+    for (unsigned i = 0; i < length(info) && info[i] != ':'; ++i)
+        if (info[i] == '|' || info[i] == '/')
+            ++ploidy;
+    return ploidy;
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::jstWrite()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline void
+jstWrite(std::ostream & stream, TValue const value)
+{
+    stream.write(reinterpret_cast<char const *>(&value), sizeof(TValue));
+}
+
+template <typename TSequence>
+inline void
+jstWriteSequence(std::ostream & stream, TSequence const & seq)
+{
+    static_assert(BitsPerValue<typename Value<TSequence>::Type>::VALUE <= 8,
+                  "Only alphabets with at most 256 values can be stored.");
+
+    jstWrite(stream, static_cast<uint64_t>(length(seq)));
+    String<uint8_t> buffer;
+    resize(buffer, length(seq), Exact());
+    for (uint64_t i = 0; i < length(seq); ++i)
+        buffer[i] = ordValue(seq[i]);
+    stream.write(reinterpret_cast<char const *>(begin(buffer, Standard())), length(buffer));
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::jstRead()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline bool
+jstRead(std::istream & stream, TValue & value)
+{
+    return static_cast<bool>(stream.read(reinterpret_cast<char *>(&value), sizeof(TValue)));
+}
+
+template <typename TSequence>
+inline bool
+jstReadSequence(std::istream & stream, TSequence & seq)
+{
+    typedef typename Value<TSequence>::Type TValue;
+
+    uint64_t len = 0;
+    if (!jstRead(stream, len))
+        return false;
+    String<uint8_t> buffer;
+    resize(buffer, len, Exact());
+    if (!stream.read(reinterpret_cast<char *>(begin(buffer, Standard())), len))
+        return false;
+    resize(seq, len, Exact());
+    for (uint64_t i = 0; i < len; ++i)
+        seq[i] = TValue(buffer[i]);
+    return true;
+}
+
+}  // namespace impl
+
+// ----------------------------------------------------------------------------
+// Function buildFromVcf()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn JournaledStringTree#buildFromVcf
+ * @headerfile <seqan/journaled_string_tree.h>
+ * @brief Builds the journaled string tree from the variants of one contig of a VCF file.
+ *
+ * @signature void buildFromVcf(jst, vcfFile, contigName);
+ *
+ * @param[in,out] jst        The journaled string tree. The @link JournaledStringTree#host @endlink must be set to
+ *                           the sequence of the contig, all deltas are replaced.
+ * @param[in,out] vcfFile    The @link VcfFileIn @endlink to read from. The header must not be read yet.
+ * @param[in]     contigName The name of the contig to read the variants for, records of other contigs are skipped.
+ *
+ * @throw ParseError If the records of the contig are not sorted, the REF allele exceeds the host or a genotype refers
+ *                   to a missing ALT allele.
+ *
+ * Every haplotype of every sample becomes one sequence, i.e. the sequence <tt>s * ploidy + h</tt> is the haplotype
+ * <tt>h</tt> of sample <tt>s</tt>. The ploidy is taken from the first genotype of the file, the first FORMAT field
+ * must be <tt>GT</tt>. The records are streamed once and each delta is inserted with its coverage, such that with
+ * @link CompressedJstConfig @endlink the full coverage is never stored per delta.
+ *
+ * The common prefix and suffix of REF and ALT are removed. Equally long alleles become SNPs, the others insertions,
+ * deletions or structural variants. Symbolic alleles are skipped. If the variants of one haplotype overlap, the
+ * first one is kept.
+ */
+
+template <typename TSequence, typename TConfig, typename TSpec, typename TNameStore, typename TContigName>
+inline void
+buildFromVcf(JournaledStringTree<TSequence, TConfig, TSpec> & jst,
+             FormattedFile<Vcf, Input, TNameStore> & vcfFile,
+             TContigName const & contigName)
+{
+    typedef JournaledStringTree<TSequence, TConfig, TSpec>  TJst;
+    typedef typename Member<TJst, JstDeltaMapMember>::Type  TDeltaMap;
+    typedef typename Host<TJst>::Type                       THost;
+    typedef typename Value<THost>::Type                     TValue;
+
+    TDeltaMap & deltaMap = impl::member(jst, JstDeltaMapMember());
+    THost const & source = host(jst);
+    uint64_t const srcLength = length(source);
+
+    VcfHeader header;
+    readHeader(header, vcfFile);
+
+    unsigned const samples = length(sampleNames(context(vcfFile)));
+    unsigned ploidy = 0;
+    uint64_t dimension = 0;
+
+    clear(deltaMap);
+    String<uint64_t> blockedUntil;     // Haplotypes can get the next delta only behind this position.
+    String<unsigned> alleles;          // Allele of every haplotype for the current record.
+    String<bool, Packed<> > coverage;  // Reused for every inserted delta.
+    String<impl::JstVcfDelta_> deltas;
+    StringSet<CharString> alts;
+    CharString info;
+
+    VcfRecord record;
+    int32_t rID = VcfRecord::INVALID_REFID;
+    int32_t lastPos = 0;
+    while (!atEnd(vcfFile))
+    {
+        readRecord(record, vcfFile);
+
+        if (ploidy == 0)
+        {
+            ploidy = 1;
+            if (samples > 0 && _vcfNumGenotypeInfos(record) > 0)
+            {
+                getGenotypeInfo(info, record, 0);
+                ploidy = impl::jstVcfPloidy(info);
+            }
+            dimension = static_cast<uint64_t>(samples) * ploidy;
+            resize(blockedUntil, dimension, 0, Exact());
+            resize(alleles, dimension, Exact());
+        }
+
+        // Only the records of the requested contig are used.
+        if (record.rID != rID)
+        {
+            if (contigNames(context(vcfFile))[record.rID] != contigName)
+                continue;
+            rID = record.rID;
+        }
+        if (record.beginPos < lastPos)
+            SEQAN_THROW(ParseError("The records of the contig are not sorted by position."));
+        lastPos = record.beginPos;
+        if (static_cast<uint64_t>(record.beginPos) + length(record.ref) > srcLength)
+            SEQAN_THROW(ParseError("The REF allele exceeds the reference sequence."));
+
+        if (dimension == 0 || _vcfNumGenotypeInfos(record) == 0)
+            continue;
+        if (!isPrefix("GT", record.format) || (length(record.format) > 2 && record.format[2] != ':'))
+            SEQAN_THROW(ParseError("The first FORMAT field must be GT."));
+
+        clear(alts);
+        strSplit(alts, record.alt, EqualsChar<','>());
+        for (unsigned s = 0; s < samples; ++s)
+        {
+            getGenotypeInfo(info, record, s);
+            impl::jstVcfGenotype(alleles, s * ploidy, ploidy, info);
+        }
+        for (unsigned h = 0; h < dimension; ++h)
+            if (alleles[h] > length(alts))
+                SEQAN_THROW(ParseError("Genotype refers to a missing ALT allele."));
+
+        for (unsigned a = 1; a <= length(alts); ++a)
+        {
+            if (!impl::jstVcfDeltas(deltas, record.beginPos, record.ref, alts[a - 1]))
+                continue;
+
+            for (unsigned d = 0; d < length(deltas); ++d)
+            {
+                impl::JstVcfDelta_ const & delta = deltas[d];
+                // Deltas touching the end of the source block insertions at the end.
+                uint64_t deltaEnd = delta.pos + std::max(delta.delLength, 1u);
+                if (deltaEnd >= srcLength)
+                    ++deltaEnd;
+
+                clear(coverage);
+                resize(coverage, dimension, false, Exact());
+                bool covered = false;
+                for (uint64_t h = 0; h < dimension; ++h)
+                {
+                    if (alleles[h] != a || delta.pos < blockedUntil[h])
+                        continue;
+                    coverage[h] = true;
+                    blockedUntil[h] = deltaEnd;
+                    covered = true;
+                }
+                if (!covered)
+                    continue;
+
+                switch (delta.type)
+                {
+                    case DELTA_TYPE_SNP:
+                        insert(deltaMap, delta.pos, static_cast<typename TConfig::TSnpValue>(TValue(delta.insValue[0])),
+                               coverage, DeltaTypeSnp());
+                        break;
+                    case DELTA_TYPE_INS:
+                        insert(deltaMap, delta.pos, typename TConfig::TInsValue(delta.insValue), coverage,
+                               DeltaTypeIns());
+                        break;
+                    case DELTA_TYPE_DEL:
+                        insert(deltaMap, delta.pos, static_cast<typename TConfig::TDelValue>(delta.delLength),
+                               coverage, DeltaTypeDel());
+                        break;
+                    default:
+                        insert(deltaMap, delta.pos,
+                               typename TConfig::TSVValue(delta.delLength, typename TConfig::TInsValue(delta.insValue)),
+                               coverage, DeltaTypeSV());
+                }
+            }
+        }
+    }
+    jst._dimension = dimension;
+}
+
+// ----------------------------------------------------------------------------
+// Function save()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn JournaledStringTree#save
+ * @headerfile <seqan/journaled_string_tree.h>
+ * @brief Saves the journaled string tree to disk.
+ *
+ * @signature bool save(jst, fileName);
+ *
+ * @param[in] jst      The journaled string tree to save.
+ * @param[in] fileName The name of the file to write (Type: <tt>char const *</tt>).
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise.
+ *
+ * The file contains the host and the deltas with their coverages in compressed form. The values are stored in the
+ * native byte order.
+ */
+
+template <typename TSequence, typename TConfig, typename TSpec>
+inline bool
+save(JournaledStringTree<TSequence, TConfig, TSpec> const & jst, char const * fileName)
+{
+    typedef JournaledStringTree<TSequence, TConfig, TSpec>  TJst;
+    typedef typename Member<TJst, JstDeltaMapMember>::Type  TDeltaMap;
+    typedef typename Iterator<TDeltaMap const, Standard>::Type TMapIter;
+
+    std::ofstream file(fileName, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    TDeltaMap const & deltaMap = impl::member(jst, JstDeltaMapMember());
+    file.write("SQJST", 5);
+    impl::jstWrite(file, static_cast<uint8_t>(1));
+    impl::jstWrite(file, static_cast<uint64_t>(length(jst)));
+    impl::jstWriteSequence(file, host(jst));
+
+    uint64_t deltas = 0;
+    for (TMapIter it = begin(deltaMap, Standard()); it != end(deltaMap, Standard()); ++it)
+        deltas += !isRightEnd(*it);
+    impl::jstWrite(file, deltas);
+
+    CompressedDeltaCoverage cov;
+    for (TMapIter it = begin(deltaMap, Standard()); it != end(deltaMap, Standard()); ++it)
+    {
+        if (isRightEnd(*it))
+            continue;
+
+        impl::jstWrite(file, static_cast<uint64_t>(getDeltaPosition(*it)));
+        impl::jstWrite(file, static_cast<uint8_t>(getDeltaType(*it)));
+        switch (getDeltaType(*it))
+        {
+            case DELTA_TYPE_SNP:
+                impl::jstWrite(file, static_cast<uint8_t>(ordValue(deltaValue(it, DeltaTypeSnp()))));
+                break;
+            case DELTA_TYPE_DEL:
+                impl::jstWrite(file, static_cast<uint64_t>(deltaValue(it, DeltaTypeDel())));
+                break;
+            case DELTA_TYPE_INS:
+                impl::jstWriteSequence(file, deltaValue(it, DeltaTypeIns()));
+                break;
+            default:
+                impl::jstWrite(file, static_cast<uint64_t>(deltaValue(it, DeltaTypeSV()).i1));
+                impl::jstWriteSequence(file, deltaValue(it, DeltaTypeSV()).i2);
+        }
+
+        cov = getDeltaCoverage(*it);
+        impl::jstWrite(file, cov._mode);
+        impl::jstWrite(file, cov._length);
+        impl::jstWrite(file, static_cast<uint64_t>(length(cov._data)));
+        file.write(reinterpret_cast<char const *>(begin(cov._data, Standard())), length(cov._data) * sizeof(uint32_t));
+    }
+    return file.good();
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn JournaledStringTree#open
+ * @headerfile <seqan/journaled_string_tree.h>
+ * @brief Opens a journaled string tree that was saved with @link JournaledStringTree#save @endlink.
+ *
+ * @signature bool open(jst, source, fileName);
+ *
+ * @param[out] jst      The journaled string tree to open.
+ * @param[out] source   The sequence to store the host in. The <tt>jst</tt> refers to it and it must live as long as
+ *                      the <tt>jst</tt>.
+ * @param[in]  fileName The name of the file to read (Type: <tt>char const *</tt>).
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> if the file could not be read or is not a valid file.
+ */
+
+template <typename TSequence, typename TConfig, typename TSpec, typename TSource>
+inline bool
+open(JournaledStringTree<TSequence, TConfig, TSpec> & jst, TSource & source, char const * fileName)
+{
+    typedef JournaledStringTree<TSequence, TConfig, TSpec>  TJst;
+    typedef typename Member<TJst, JstDeltaMapMember>::Type  TDeltaMap;
+    typedef typename Value<TSequence>::Type                 TValue;
+
+    std::ifstream file(fileName, std::ios::binary);
+    char magic[5];
+    uint8_t version = 0;
+    uint64_t dimension = 0;
+    if (!file.read(magic, 5) || std::string(magic, 5) != "SQJST" || !impl::jstRead(file, version) || version != 1 ||
+        !impl::jstRead(file, dimension) || !impl::jstReadSequence(file, source))
+        return false;
+
+    setHost(jst, source);
+    TDeltaMap & deltaMap = impl::member(jst, JstDeltaMapMember());
+
+    uint64_t deltas = 0;
+    bool success = impl::jstRead(file, deltas);
+    CompressedDeltaCoverage cov;
+    String<bool, Packed<> > coverage;
+    typename TConfig::TInsValue insValue;
+    for (uint64_t i = 0; success && i < deltas; ++i)
+    {
+        uint64_t pos = 0, del = 0;
+        uint8_t type = 0, snp = 0;
+        success = impl::jstRead(file, pos) && impl::jstRead(file, type) && pos <= length(source);
+        switch (type)
+        {
+            case DELTA_TYPE_SNP:
+                success = success && impl::jstRead(file, snp);
+                break;
+            case DELTA_TYPE_DEL:
+                success = success && impl::jstRead(file, del);
+                break;
+            case DELTA_TYPE_INS:
+                success = success && impl::jstReadSequence(file, insValue);
+                break;
+            case DELTA_TYPE_SV:
+                success = success && impl::jstRead(file, del) && impl::jstReadSequence(file, insValue);
+                break;
+            default:
+                success = false;
+        }
+
+        uint64_t dataLength = 0;
+        uint64_t const words = (dimension + 63) / 64;
+        success = success && impl::jstRead(file, cov._mode) && impl::jstRead(file, cov._length) &&
+                  impl::jstRead(file, dataLength) && cov._length == dimension &&
+                  ((cov._mode == CompressedDeltaCoverage::SPARSE && dataLength <= dimension) ||
+                   (cov._mode == CompressedDeltaCoverage::RUNS && dataLength % 2 == 0 && dataLength <= 2 * words) ||
+                   (cov._mode == CompressedDeltaCoverage::BITS && dataLength == 2 * words));
+        if (!success)
+            break;
+        resize(cov._data, dataLength, Exact());
+        success = static_cast<bool>(file.read(reinterpret_cast<char *>(begin(cov._data, Standard())),
+                                              dataLength * sizeof(uint32_t)));
+        // Ids and run boundaries must be increasing and in range.
+        uint64_t const maxId = dimension - (cov._mode == CompressedDeltaCoverage::SPARSE);
+        for (uint64_t j = 0; success && cov._mode != CompressedDeltaCoverage::BITS && j < dataLength; ++j)
+            success = cov._data[j] <= maxId && (j == 0 || cov._data[j - 1] < cov._data[j]);
+        if (!success)
+            break;
+        decompress(coverage, cov);
+
+        switch (type)
+        {
+            case DELTA_TYPE_SNP:
+                insert(deltaMap, pos, static_cast<typename TConfig::TSnpValue>(TValue(snp)), coverage, DeltaTypeSnp());
+                break;
+            case DELTA_TYPE_DEL:
+                insert(deltaMap, pos, static_cast<typename TConfig::TDelValue>(del), coverage, DeltaTypeDel());
+                break;
+            case DELTA_TYPE_INS:
+                insert(deltaMap, pos, insValue, coverage, DeltaTypeIns());
+                break;
+            default:
+                insert(deltaMap, pos, typename TConfig::TSVValue(del, insValue), coverage, DeltaTypeSV());
+        }
+    }
+
+    if (!success)
+    {
+        clear(jst);
+        return false;
+    }
+    jst._dimension = dimension;
+    return true;
+}
+
+}
+
+#endif // INCLUDE_SEQAN_JOURNALED_STRING_TREE_JOURNALED_STRING_TREE_IO_H_
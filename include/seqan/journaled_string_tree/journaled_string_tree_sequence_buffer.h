@@ -329,14 +329,15 @@ create(JstBuffer_<TJst, TSpec> & buffer)
             if (SEQAN_UNLIKELY((*f.mapIt).deltaTypeEnd == DeltaEndType::IS_RIGHT))
                 continue;
 
-            auto covIt = begin(getDeltaCoverage(*f.mapIt), Standard()) +
-                (f.setIt - begin(buffer._journaledSet, Standard()));
-            for (; f.setIt != jSetSplitter[jobId + 1]; ++f.setIt, ++covIt)
+            // Apply the delta to all sequences of this job that cover it.
+            TJSetIter setBegin = begin(buffer._journaledSet, Standard());
+            impl::forEachCovered(getDeltaCoverage(*f.mapIt), jSetSplitter[jobId] - setBegin,
+                                 jSetSplitter[jobId + 1] - setBegin, [&f, setBegin](uint32_t id)
             {
                 DeltaTypeSelector deltaSelector;
-                if (*covIt)  // If the current sequence covers the current delta.
-                    applyOnDelta(f, getDeltaType(*f.mapIt), deltaSelector);
-            }
+                f.setIt = setBegin + id;
+                applyOnDelta(f, getDeltaType(*f.mapIt), deltaSelector);
+            });
         }
     }
 }
@@ -380,8 +381,12 @@ synchronize(JstBuffer_<TJst, TSpec> & buffer)
 //                                             position(buffer._sourceEnd), DeltaExtensionCompareLessPos_());
 
     // Stream from the beginning to the expected range to get the begin positions of the current segment.
+    // Without any delta the number of sequences set by init() is kept.
     auto mapIt = begin(*buffer._deltaMapPtr, Standard());
-    resize(buffer._startPositions, length(getDeltaCoverage(*mapIt)), position(buffer._sourceBegin), Exact());
+    if (mapIt != end(*buffer._deltaMapPtr, Standard()))
+        resize(buffer._startPositions, length(getDeltaCoverage(*mapIt)), Exact());
+    std::fill(begin(buffer._startPositions, Standard()), end(buffer._startPositions, Standard()),
+              position(buffer._sourceBegin));
 
     if (position(buffer._sourceBegin) == 0)  // Special case: We also set the begin position to 0 even if there is an insertion at the 0th position.
         return true;
@@ -389,18 +394,13 @@ synchronize(JstBuffer_<TJst, TSpec> & buffer)
     for (; mapIt != buffer._deltaRangeBegin; ++mapIt)
     {
         auto net = netSize(mapIt);
-        auto covBegin = begin(getDeltaCoverage(*mapIt), Standard());
-        for (auto covIt = covBegin; covIt != end(getDeltaCoverage(*mapIt), Standard()); ++covIt)
+        impl::forEachCovered(getDeltaCoverage(*mapIt), [&buffer, net](uint32_t id)
         {
-            if (*covIt)
-            {
-                if (SEQAN_UNLIKELY(static_cast<TSize>(std::abs(net)) > buffer._startPositions[covIt - covBegin] &&
-                                   (net < 0)))
-                    buffer._startPositions[covIt - covBegin] = 0;  // In case the entire prefix of this sequence is deleted.
-                else
-                    buffer._startPositions[covIt - covBegin] += net;
-            }
-        }
+            if (SEQAN_UNLIKELY(static_cast<TSize>(std::abs(net)) > buffer._startPositions[id] && (net < 0)))
+                buffer._startPositions[id] = 0;  // In case the entire prefix of this sequence is deleted.
+            else
+                buffer._startPositions[id] += net;
+        });
     }
     buffer._isSynchronized = true;
     return true;
@@ -552,6 +552,7 @@ init(JstBuffer_<TJst, TSpec> & me,
     setDeltaMap(me, impl::member(jst, JstDeltaMapMember()));
     setSourceBegin(me, begin(impl::member(jst, JstSourceMember()), Standard()));
     setSourceEnd(me, end(impl::member(jst, JstSourceMember()), Standard()));
+    resize(me._startPositions, length(jst), Exact());
     sync(me);
     create(me);
 }
@@ -57,7 +57,7 @@ public:
     typedef JstBuffer_<TJst>                                            TBuffer;  // Provides a sequence context.
     typedef std::shared_ptr<TBuffer>                                    TBufferPtr;
     typedef typename Member<TJst, JstDeltaMapMember>::Type              TDeltaMap;
-    typedef typename DeltaCoverage<TDeltaMap>::Type                     TCoverage;
+    typedef String<bool, Packed<> >                                     TCoverage;
 
     // __ Member Variables ____________________________________________________
 
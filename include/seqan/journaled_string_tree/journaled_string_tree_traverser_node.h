@@ -57,7 +57,7 @@ public:
     typedef typename MakeSigned<TPosition>::Type                        TSignedPos;
     typedef typename Member<TJst, JstDeltaMapMember>::Type              TDeltaMap;
     typedef typename Iterator<TDeltaMap, Standard>::Type                TDeltaIterator;
-    typedef typename DeltaCoverage<TDeltaMap>::Type                     TCoverage;
+    typedef String<bool, Packed<> >                                     TCoverage;
     typedef typename Size<TJst>::Type                                   TSize;
 
     // __ Mapping Resources ___________________________________________________
@@ -0,0 +1,375 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Block-wise parallel search in a journaled string tree.
+//
+// The source is split into blocks [b_k, b_k+1).  For every block a journaled
+// string tree over the source infix [s_k, b_k+1) is built, where s_k lies
+// far enough left of b_k that every context ending in the block is contained
+// in it.  Deltas are clipped to the infix, so deletions and structural
+// variants that span a border are represented in both blocks.  Every block is
+// searched sequentially on its own thread and a hit is reported by the block
+// that contains the reference position of its last character.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_JOURNALED_STRING_TREE_JOURNALED_STRING_TREE_TRAVERSER_PARALLEL_H_
+#define INCLUDE_SEQAN_JOURNALED_STRING_TREE_JOURNALED_STRING_TREE_TRAVERSER_PARALLEL_H_
+
+namespace seqan2
+{
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+namespace impl
+{
+
+// ----------------------------------------------------------------------------
+// Function impl::sequencePrefixLengths()
+// ----------------------------------------------------------------------------
+
+// Computes for every position x in refPositions (sorted ascending) and every
+// sequence the number of characters of the sequence that stem from source
+// positions before x.  Inserted characters count for the position of the
+// insertion.  The delta map is streamed once.
+
+template <typename TLengths, typename TDeltaMap, typename TPositions, typename TSize>
+inline void
+sequencePrefixLengths(TLengths & lengths,
+                      TDeltaMap & deltaMap,
+                      TPositions const & refPositions,
+                      TSize const dimension)
+{
+    typedef typename Value<typename Value<TLengths>::Type>::Type    TLength;
+    typedef typename Iterator<TDeltaMap, Standard>::Type            TMapIter;
+
+    // Net size of all processed deltas and end of the last deletion per sequence.
+    String<int64_t> netSizes;
+    String<TLength> delEnd;
+    resize(netSizes, dimension, 0, Exact());
+    resize(delEnd, dimension, 0, Exact());
+
+    resize(lengths, length(refPositions), Exact());
+    TMapIter mapIt = begin(deltaMap, Standard());
+    TMapIter mapEnd = end(deltaMap, Standard());
+    for (unsigned i = 0; i < length(refPositions); ++i)
+    {
+        TLength x = refPositions[i];
+        for (; mapIt != mapEnd && static_cast<TLength>(getDeltaPosition(*mapIt)) < x; ++mapIt)
+        {
+            if (isRightEnd(*mapIt))
+                continue;
+
+            TLength pos = getDeltaPosition(*mapIt);
+            int64_t net = netSize(mapIt);
+            TLength del = delSize(mapIt);
+            impl::forEachCovered(getDeltaCoverage(*mapIt), [&](uint32_t id)
+            {
+                netSizes[id] += net;
+                if (del > 0)
+                    delEnd[id] = pos + del;
+            });
+        }
+
+        // Deletions that reach beyond x only delete the characters before x.
+        resize(lengths[i], dimension, Exact());
+        for (TSize j = 0; j < dimension; ++j)
+            lengths[i][j] = static_cast<TLength>(static_cast<int64_t>(x) + netSizes[j] +
+                                                 ((delEnd[j] > x) ? static_cast<int64_t>(delEnd[j] - x) : 0));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::blockContextBegin()
+// ----------------------------------------------------------------------------
+
+// Returns a source position s <= blockBegin such that every sequence has at
+// least contextSize - 1 characters stemming from [s, blockBegin) or s is 0.
+// The characters of a sequence in [s, blockBegin) are at least the positions
+// of the interval that are not deleted in any sequence.
+
+template <typename TPos, typename TDelIntervals, typename TSize>
+inline TPos
+blockContextBegin(TPos blockBegin, TDelIntervals const & delIntervals, TSize contextSize)
+{
+    auto it = std::upper_bound(begin(delIntervals, Standard()), end(delIntervals, Standard()), blockBegin,
+                               [](TPos pos, typename Value<TDelIntervals>::Type const & iv) { return pos < iv.i1; });
+    auto itBegin = begin(delIntervals, Standard());
+
+    TPos pos = blockBegin;
+    TPos needed = (contextSize > 1) ? contextSize - 1 : 0;
+    while (needed > 0 && pos > 0)
+    {
+        if (it != itBegin && (it - 1)->i2 >= pos)  // Skip the deleted interval left of pos.
+        {
+            pos = std::min(pos, static_cast<TPos>((it - 1)->i1));
+            --it;
+            continue;
+        }
+        TPos freeBegin = (it != itBegin) ? static_cast<TPos>((it - 1)->i2) : 0;
+        TPos step = std::min(needed, static_cast<TPos>(pos - freeBegin));
+        pos -= step;
+        needed -= step;
+    }
+    return pos;
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::createBlockJst()
+// ----------------------------------------------------------------------------
+
+// Fills blockJst with the deltas of jst clipped to the source infix
+// [beginPos, endPos).  Insertions at endPos are only kept at the end of the
+// source.
+
+template <typename TBlockJst, typename TJst, typename TPos>
+inline void
+createBlockJst(TBlockJst & blockJst, TJst & jst, TPos beginPos, TPos endPos)
+{
+    typedef typename Member<TJst, JstDeltaMapMember>::Type  TDeltaMap;
+    typedef typename Iterator<TDeltaMap, Standard>::Type    TMapIter;
+    typedef typename DeltaValue<TDeltaMap, DeltaTypeDel>::Type TDel;
+    typedef typename DeltaValue<TDeltaMap, DeltaTypeSV>::Type  TSV;
+
+    auto & deltaMap = impl::member(jst, JstDeltaMapMember());
+    auto & blockMap = impl::member(blockJst, JstDeltaMapMember());
+    TPos srcLength = length(host(jst));
+
+    // Deletions and structural variants that begin left of the block and reach into it.
+    TMapIter mapIt = begin(deltaMap, Standard());
+    for (; mapIt != end(deltaMap, Standard()) && static_cast<TPos>(getDeltaPosition(*mapIt)) < beginPos; ++mapIt)
+    {
+        TPos pos = getDeltaPosition(*mapIt);
+        TPos del = delSize(mapIt);
+        if (isRightEnd(*mapIt) || pos + del <= beginPos)
+            continue;
+        insert(blockMap, 0, static_cast<TDel>(std::min(pos + del, endPos) - beginPos), getDeltaCoverage(*mapIt),
+               DeltaTypeDel());
+    }
+
+    for (; mapIt != end(deltaMap, Standard()) && static_cast<TPos>(getDeltaPosition(*mapIt)) <= endPos; ++mapIt)
+    {
+        TPos pos = getDeltaPosition(*mapIt);
+        if (isRightEnd(*mapIt) || (pos == endPos && (endPos != srcLength || deltaType(mapIt) != DELTA_TYPE_INS)))
+            continue;
+
+        switch (deltaType(mapIt))
+        {
+            case DELTA_TYPE_SNP:
+                insert(blockMap, pos - beginPos, deltaValue(mapIt, DeltaTypeSnp()), getDeltaCoverage(*mapIt),
+                       DeltaTypeSnp());
+                break;
+            case DELTA_TYPE_INS:
+                insert(blockMap, pos - beginPos, deltaValue(mapIt, DeltaTypeIns()), getDeltaCoverage(*mapIt),
+                       DeltaTypeIns());
+                break;
+            case DELTA_TYPE_DEL:
+                insert(blockMap, pos - beginPos,
+                       static_cast<TDel>(std::min(static_cast<TPos>(deltaValue(mapIt, DeltaTypeDel())), endPos - pos)),
+                       getDeltaCoverage(*mapIt), DeltaTypeDel());
+                break;
+            case DELTA_TYPE_SV:
+            {
+                TSV sv = deltaValue(mapIt, DeltaTypeSV());
+                sv.i1 = std::min(static_cast<TPos>(sv.i1), endPos - pos);
+                insert(blockMap, pos - beginPos, sv, getDeltaCoverage(*mapIt), DeltaTypeSV());
+                break;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function impl::findParallel()
+// ----------------------------------------------------------------------------
+
+template <typename TJst, typename TSpec,
+          typename TAlgorithm,
+          typename TDelegate,
+          typename TSize>
+inline void
+findParallel(TraverserImpl<TJst, JstTraversalSpec<TSpec> > & traverser,
+             TAlgorithm & algorithm,
+             TDelegate && delegate,
+             TSize blockCount)
+{
+    typedef typename RemoveConst<TJst>::Type                                    TBlockJst;
+    typedef typename RemoveConst<typename Host<TBlockJst>::Type>::Type          TSource;
+    typedef typename Traverser<TBlockJst>::Type                                 TBlockTraverser;
+    typedef typename Position<TraverserImpl<TJst, JstTraversalSpec<TSpec> > >::Type TPositions;
+    typedef typename Value<TPositions>::Type                                    TPosPair;
+    typedef typename Position<TSource>::Type                                    TPos;
+    typedef typename Member<TJst, JstDeltaMapMember>::Type                      TDeltaMap;
+    typedef typename Iterator<TDeltaMap, Standard>::Type                        TMapIter;
+
+    TJst & jst = container(traverser);
+    auto & deltaMap = impl::member(jst, JstDeltaMapMember());
+    TPos srcLength = length(host(jst));
+    TPos ctxSize = std::max(contextSize(traverser), static_cast<decltype(contextSize(traverser))>(1));
+
+    TPos numBlocks = std::max(std::min(static_cast<TPos>(blockCount), srcLength), static_cast<TPos>(1));
+
+    if (numBlocks == 1)
+    {
+        find(traverser, algorithm, [&traverser, &delegate]() { delegate(position(traverser)); });
+        return;
+    }
+
+    // Merged intervals of all deleted source positions.
+    String<Pair<TPos, TPos> > delIntervals;
+    for (TMapIter mapIt = begin(deltaMap, Standard()); mapIt != end(deltaMap, Standard()); ++mapIt)
+    {
+        if (isRightEnd(*mapIt) || delSize(mapIt) == 0)
+            continue;
+        TPos pos = getDeltaPosition(*mapIt);
+        TPos del = delSize(mapIt);
+        if (!empty(delIntervals) && back(delIntervals).i2 >= pos)
+            back(delIntervals).i2 = std::max(back(delIntervals).i2, pos + del);
+        else
+            appendValue(delIntervals, Pair<TPos, TPos>(pos, pos + del));
+    }
+
+    // Block borders and the begin positions of the block journaled string trees.
+    String<TPos> blockBegins;
+    String<TPos> contextBegins;
+    for (TPos k = 0; k < numBlocks; ++k)
+    {
+        appendValue(blockBegins, srcLength / numBlocks * k);
+        appendValue(contextBegins, impl::blockContextBegin(back(blockBegins), delIntervals, ctxSize));
+    }
+    appendValue(blockBegins, srcLength);
+
+    // Begin positions of the sequences at the context begins.
+    String<Pair<TPos, unsigned> > sortedBegins;
+    for (unsigned k = 0; k < numBlocks; ++k)
+        appendValue(sortedBegins, Pair<TPos, unsigned>(contextBegins[k], k));
+    std::sort(begin(sortedBegins, Standard()), end(sortedBegins, Standard()));
+    String<TPos> sortedPositions;
+    for (unsigned k = 0; k < numBlocks; ++k)
+        appendValue(sortedPositions, sortedBegins[k].i1);
+    StringSet<String<TPos> > sortedOffsets;
+    impl::sequencePrefixLengths(sortedOffsets, deltaMap, sortedPositions, length(jst));
+    StringSet<String<TPos> > offsets;
+    resize(offsets, numBlocks, Exact());
+    for (unsigned k = 0; k < numBlocks; ++k)
+        offsets[sortedBegins[k].i2] = sortedOffsets[k];
+    clear(sortedOffsets);
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 1))
+    for (int k = 0; k < static_cast<int>(numBlocks); ++k)
+    {
+        TPos ctxBegin = contextBegins[k];
+        TPos blockEnd = blockBegins[k + 1];
+
+        TSource blockSource = infix(host(jst), ctxBegin, blockEnd);
+        TBlockJst blockJst(blockSource, length(jst));
+        impl::createBlockJst(blockJst, jst, ctxBegin, blockEnd);
+
+        // Number of characters of each sequence in the left context.
+        StringSet<String<TPos> > contextLengths;
+        String<TPos> blockBeginPos;
+        appendValue(blockBeginPos, blockBegins[k] - ctxBegin);
+        impl::sequencePrefixLengths(contextLengths, impl::member(blockJst, JstDeltaMapMember()), blockBeginPos,
+                                    length(jst));
+
+        std::unique_ptr<TAlgorithm> blockAlgorithm;
+        SEQAN_OMP_PRAGMA(critical(JstFindParallel_))
+        blockAlgorithm.reset(new TAlgorithm(algorithm._pattern));  // Initializes the shared pattern.
+
+        TBlockTraverser blockTraverser(blockJst, contextSize(traverser), branchSize(traverser));
+        TPositions hit;
+        find(blockTraverser, *blockAlgorithm, [&]()
+        {
+            clear(hit);
+            for (auto const & p : position(blockTraverser))
+                if (p.i2 >= contextLengths[0][p.i1])
+                    appendValue(hit, TPosPair(p.i1, offsets[k][p.i1] + p.i2));
+            if (!empty(hit))
+            {
+                SEQAN_OMP_PRAGMA(critical(JstFindParallelDelegate_))
+                delegate(hit);
+            }
+        });
+    }
+}
+
+}  // namespace impl
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function find()                                                  [Parallel]
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn JstTraverser#find
+ * @headerfile <seqan/journaled_string_tree.h>
+ * @brief Searches a journaled string tree block-wise in parallel.
+ *
+ * @signature void find(traverser, extension, delegate, Parallel());
+ *
+ * @param[in]     traverser  The traverser of the journaled string tree to search.  Only its container, context size
+ *                           and branch size are used, the traverser itself is not moved.
+ * @param[in,out] extension  The search algorithm, e.g. <tt>JstExtension&lt;Pattern&lt;TNeedle, ShiftAnd&gt; &gt;</tt>.
+ * @param[in]     delegate   A functor that is called with the positions of a hit, a @link String @endlink of
+ *                           <tt>Pair&lt;seqId, pos&gt;</tt> as returned by <tt>position(traverser)</tt>.  The calls are
+ *                           serialized, their order is unspecified.
+ *
+ * The source sequence is split into four blocks per thread, but blocks are at least 16 times as long as the context.
+ * The blocks are searched on separate threads using OpenMP.  Each block is
+ * traversed in a journaled string tree over its source infix, extended to the left by enough characters to contain
+ * every context that ends in the block.  Deletions and structural variants spanning a block border are clipped.
+ * Every hit is reported exactly once with its position in the full sequences, by the block containing the source
+ * position of the last character of the hit.
+ */
+
+template <typename TJst, typename TSpec,
+          typename TAlgorithm,
+          typename TDelegate>
+inline void
+find(TraverserImpl<TJst, JstTraversalSpec<TSpec> > & traverser,
+     TAlgorithm & algorithm,
+     TDelegate && delegate,
+     Parallel const & /*tag*/)
+{
+    // Blocks should be clearly longer than the context.
+    auto minBlockLength = 16 * std::max(contextSize(traverser), static_cast<decltype(contextSize(traverser))>(1));
+    auto blockCount = std::min(static_cast<decltype(minBlockLength)>(4 * omp_get_max_threads()),
+                               length(host(container(traverser))) / minBlockLength);
+    impl::findParallel(traverser, algorithm, std::forward<TDelegate>(delegate), blockCount);
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_JOURNALED_STRING_TREE_JOURNALED_STRING_TREE_TRAVERSER_PARALLEL_H_
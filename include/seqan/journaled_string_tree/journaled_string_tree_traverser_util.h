@@ -381,7 +381,7 @@ mapBranchPointToVirtual(TIterator & resultIt,
         // Now we move to the right until we find the node that we are looking for and reconstruct the offset of the virtual positions.
         while(getDeltaPosition(*itVar) != static_cast<TDeltaMapPos>(hostPos) && !atEnd(itVar, variantStore))
         {
-            if (getDeltaCoverage(*itVar)[proxyId] != true)  // irrelevant variant.
+            if (getDeltaCoverage(*itVar)[proxyId] != true || isRightEnd(*itVar))  // irrelevant variant or end point.
             {
                 ++itVar;
                 continue;
@@ -919,7 +919,7 @@ init(TraverserImpl<TJst, JstTraversalSpec<TSpec> > & me,
 
     node.begEdgeIt = begin(impl::member(container(me), JstSourceMember()), Standard());  // This points to some value already -> what could this position be?
     node.curEdgeIt = node.begEdgeIt;
-    node.endEdgeIt = node.begEdgeIt + (getDeltaPosition(*node.nextDelta) - position(node.begEdgeIt));
+    node.endEdgeIt = node.begEdgeIt + (impl::getPos(me, node.nextDelta) - position(node.begEdgeIt));
     node.remainingSize = me._branchLength - 1;
     node.isBase = true;
 
@@ -0,0 +1,545 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// An interval index in array layout (implicit augmented interval tree).
+//
+// The intervals are sorted by their left boundary and stored in one string.
+// The sorted array is read as a complete binary search tree: the node at
+// position i has level k if the k lowest bits of i are set and the (k+1)th
+// bit is not, its children are i - 2^(k-1) and i + 2^(k-1).  A second string
+// holds the largest right boundary of each subtree.  No pointers are stored
+// and a query touches contiguous memory, small subtrees are scanned linearly.
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_MISC_IMPLICIT_INTERVAL_TREE_H
+#define SEQAN_HEADER_MISC_IMPLICIT_INTERVAL_TREE_H
+
+#include <seqan/misc/interval_tree.h>
+#include <seqan/parallel.h>
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+/*!
+ * @class ImplicitIntervalTree
+ * @headerfile <seqan/misc/implicit_interval_tree.h>
+ * @brief Static interval index stored as a sorted array.
+ *
+ * @signature template <[typename TValue[, typename TCargo]]>
+ *            class ImplicitIntervalTree;
+ *
+ * @tparam TValue The type to use for coordinates.  Default: <tt>int</tt>.
+ * @tparam TCargo The type to use for cargo.  Default: <tt>unsigned</tt>.
+ *
+ * The tree provides the query interface of the @link IntervalTree @endlink but keeps the intervals sorted by their left
+ * boundary in a single string, annotated with the largest right boundary of each implicit subtree.  This needs a
+ * fraction of the memory of the node-based tree and answers queries with few cache misses.  Many queries can be
+ * answered at once with the batch variant of @link ImplicitIntervalTree#findIntervals @endlink, optionally in
+ * parallel.
+ *
+ * Intervals added with @link ImplicitIntervalTree#addInterval @endlink are indexed lazily by the next query.  Call
+ * @link ImplicitIntervalTree#createIntervalTree @endlink or query once before querying the tree from several threads.
+ *
+ * @fn ImplicitIntervalTree::ImplicitIntervalTree
+ * @brief Constructor
+ *
+ * @signature ImplicitIntervalTree::ImplicitIntervalTree();
+ * @signature ImplicitIntervalTree::ImplicitIntervalTree(intervals[, parallelTag]);
+ *
+ * @param[in] intervals   A @link String @endlink of @link IntervalAndCargo @endlink objects.
+ * @param[in] parallelTag Build the index in parallel if <tt>Parallel</tt>.  Types: @link ParallelismTags @endlink.
+ *                        Default: <tt>Serial</tt>.
+ */
+
+template <typename TValue = int, typename TCargo = unsigned int>
+class ImplicitIntervalTree
+{
+public:
+    typedef IntervalAndCargo<TValue, TCargo> TInterval;
+
+    mutable String<TInterval> _intervals;   // sorted by left boundary once indexed
+    mutable String<TValue> _maxRight;       // largest right boundary in the subtree of every node
+    mutable int _maxLevel;                  // level of the root, -1 if the tree is empty
+    mutable bool _indexed;
+    size_t interval_counter;
+
+    ImplicitIntervalTree() : _maxLevel(-1), _indexed(true), interval_counter(0)
+    {}
+
+    template <typename TSpec>
+    ImplicitIntervalTree(String<TInterval, TSpec> const & intervals) :
+        _maxLevel(-1), _indexed(true), interval_counter(0)
+    {
+        createIntervalTree(*this, intervals);
+    }
+
+    template <typename TSpec, typename TParallelTag>
+    ImplicitIntervalTree(String<TInterval, TSpec> const & intervals, Tag<TParallelTag> const & parallelTag) :
+        _maxLevel(-1), _indexed(true), interval_counter(0)
+    {
+        createIntervalTree(*this, intervals, parallelTag);
+    }
+};
+
+// Orders intervals by their left boundary.
+struct ImplicitIntervalTreeLess_
+{
+    template <typename TInterval>
+    inline bool operator()(TInterval const & a, TInterval const & b) const
+    {
+        return a.i1 < b.i1;
+    }
+};
+
+// A node on the traversal stack, the flag tells whether the left subtree was already visited.
+struct ImplicitIntervalTreeNode_
+{
+    int64_t pos;
+    int level;
+    bool leftDone;
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+template <typename TValue, typename TCargo>
+struct Value<ImplicitIntervalTree<TValue, TCargo> >
+{
+    typedef TValue Type;
+};
+
+template <typename TValue, typename TCargo>
+struct Cargo<ImplicitIntervalTree<TValue, TCargo> >
+{
+    typedef TCargo Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _queryBegin()
+// ----------------------------------------------------------------------------
+
+// A batch query is either a point or an interval.
+
+template <typename TPoint>
+inline TPoint const &
+_queryBegin(TPoint const & point)
+{
+    return point;
+}
+
+template <typename T1, typename T2, typename TSpec>
+inline T1 const &
+_queryBegin(Pair<T1, T2, TSpec> const & interval)
+{
+    return interval.i1;
+}
+
+template <typename TValue, typename TCargo>
+inline TValue const &
+_queryBegin(IntervalAndCargo<TValue, TCargo> const & interval)
+{
+    return interval.i1;
+}
+
+// Orders query ids by the begin position of the query.
+template <typename TQueries>
+struct ImplicitIntervalTreeQueryLess_
+{
+    TQueries const & queries;
+
+    ImplicitIntervalTreeQueryLess_(TQueries const & queries) : queries(queries)
+    {}
+
+    template <typename TId>
+    inline bool operator()(TId a, TId b) const
+    {
+        return _queryBegin(queries[a]) < _queryBegin(queries[b]);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Function _indexIntervals()
+// ----------------------------------------------------------------------------
+
+// Sorts the intervals and computes the largest right boundary of every subtree, level by level from the leaves.
+template <typename TValue, typename TCargo, typename TParallelTag>
+inline void
+_indexIntervals(ImplicitIntervalTree<TValue, TCargo> const & tree, Tag<TParallelTag> const & parallelTag)
+{
+    if (tree._indexed)
+        return;
+
+    bool const parallel = IsSameType<Tag<TParallelTag>, Parallel>::VALUE;
+    ignoreUnusedVariableWarning(parallel);
+    int64_t n = length(tree._intervals);
+    tree._indexed = true;
+    tree._maxLevel = -1;
+    resize(tree._maxRight, n, Exact());
+    if (n == 0)
+        return;
+
+    sort(tree._intervals, ImplicitIntervalTreeLess_(), parallelTag);
+
+    SEQAN_OMP_PRAGMA(parallel for if(parallel))
+    for (int64_t i = 0; i < n; i += 2)
+        tree._maxRight[i] = tree._intervals[i].i2;
+
+    // The right child of a node may lie behind the end of the array, its subtree then only holds the nodes on the
+    // path from the last leaf upwards.
+    int64_t last = (n - 1) & ~static_cast<int64_t>(1);
+    TValue lastMax = tree._maxRight[last];
+    int level = 1;
+    for (; (static_cast<int64_t>(1) << level) <= n; ++level)
+    {
+        int64_t x = static_cast<int64_t>(1) << (level - 1);
+        int64_t numNodes = (n - (2 * x - 1) + 4 * x - 1) / (4 * x);
+
+        SEQAN_OMP_PRAGMA(parallel for if(parallel))
+        for (int64_t j = 0; j < numNodes; ++j)
+        {
+            int64_t i = 2 * x - 1 + j * 4 * x;
+            TValue maxRight = std::max(tree._intervals[i].i2, tree._maxRight[i - x]);
+            tree._maxRight[i] = std::max(maxRight, (i + x < n) ? tree._maxRight[i + x] : lastMax);
+        }
+
+        last = ((last >> level) & 1) ? last - x : last + x;
+        if (last < n && lastMax < tree._maxRight[last])
+            lastMax = tree._maxRight[last];
+    }
+    tree._maxLevel = level - 1;
+}
+
+// ----------------------------------------------------------------------------
+// Function createIntervalTree()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn ImplicitIntervalTree#createIntervalTree
+ * @brief Builds the index from a string of intervals.
+ *
+ * @signature void createIntervalTree(intervalTree, intervals[, parallelTag]);
+ *
+ * @param[out] intervalTree The @link ImplicitIntervalTree @endlink to build.  Previous contents are replaced.
+ * @param[in]  intervals    A @link String @endlink of @link IntervalAndCargo @endlink objects.
+ * @param[in]  parallelTag  Sort and index in parallel if <tt>Parallel</tt>.  Types: @link ParallelismTags @endlink.
+ *                          Default: <tt>Serial</tt>.
+ */
+
+template <typename TValue, typename TCargo, typename TIntervals, typename TParallelTag>
+inline void
+createIntervalTree(ImplicitIntervalTree<TValue, TCargo> & tree,
+                   TIntervals const & intervals,
+                   Tag<TParallelTag> const & parallelTag)
+{
+    tree._intervals = intervals;
+    tree.interval_counter = length(intervals);
+    tree._indexed = false;
+    _indexIntervals(tree, parallelTag);
+}
+
+template <typename TValue, typename TCargo, typename TIntervals>
+inline void
+createIntervalTree(ImplicitIntervalTree<TValue, TCargo> & tree,
+                   TIntervals const & intervals)
+{
+    createIntervalTree(tree, intervals, Serial());
+}
+
+// ----------------------------------------------------------------------------
+// Function addInterval()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn ImplicitIntervalTree#addInterval
+ * @brief Adds an interval to the tree.  The index is rebuilt by the next query.
+ *
+ * @signature void addInterval(intervalTree, interval);
+ * @signature void addInterval(intervalTree, begin, end[, cargo]);
+ *
+ * @param[in,out] intervalTree The @link ImplicitIntervalTree @endlink to add the interval to.
+ * @param[in]     interval     The @link IntervalAndCargo @endlink to add.
+ * @param[in]     begin        Begin position of the interval.
+ * @param[in]     end          End position of the interval.
+ * @param[in]     cargo        Cargo of the interval.  Default: the number of intervals added before.
+ */
+
+template <typename TValue, typename TCargo>
+inline void
+addInterval(ImplicitIntervalTree<TValue, TCargo> & tree, IntervalAndCargo<TValue, TCargo> const & interval)
+{
+    appendValue(tree._intervals, interval);
+    ++tree.interval_counter;
+    tree._indexed = false;
+}
+
+template <typename TValue, typename TCargo>
+inline void
+addInterval(ImplicitIntervalTree<TValue, TCargo> & tree, TValue begin, TValue end, TCargo cargo)
+{
+    addInterval(tree, IntervalAndCargo<TValue, TCargo>(begin, end, cargo));
+}
+
+template <typename TValue, typename TCargo>
+inline void
+addInterval(ImplicitIntervalTree<TValue, TCargo> & tree, TValue begin, TValue end)
+{
+    addInterval(tree, IntervalAndCargo<TValue, TCargo>(begin, end, tree.interval_counter));
+}
+
+// ----------------------------------------------------------------------------
+// Function length()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TCargo>
+inline typename Size<String<IntervalAndCargo<TValue, TCargo> > >::Type
+length(ImplicitIntervalTree<TValue, TCargo> const & tree)
+{
+    return length(tree._intervals);
+}
+
+// ----------------------------------------------------------------------------
+// Function empty()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TCargo>
+inline bool
+empty(ImplicitIntervalTree<TValue, TCargo> const & tree)
+{
+    return empty(tree._intervals);
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TCargo>
+inline void
+clear(ImplicitIntervalTree<TValue, TCargo> & tree)
+{
+    clear(tree._intervals);
+    clear(tree._maxRight);
+    tree._maxLevel = -1;
+    tree._indexed = true;
+    tree.interval_counter = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _findIntervals()
+// ----------------------------------------------------------------------------
+
+// Appends the cargos of all intervals overlapping [queryBegin, queryEnd) to result, or of all intervals containing
+// queryBegin if isPoint is set.  The tree must be indexed.
+template <typename TCargo, typename TSpec, typename TValue, typename TValue2>
+inline void
+_findIntervals(String<TCargo, TSpec> & result,
+               ImplicitIntervalTree<TValue, TCargo> const & tree,
+               TValue2 const & queryBegin,
+               TValue2 const & queryEnd,
+               bool isPoint)
+{
+    typedef IntervalAndCargo<TValue, TCargo> TInterval;
+
+    if (tree._maxLevel < 0)
+        return;
+
+    int64_t n = length(tree._intervals);
+    TInterval const * intervals = begin(tree._intervals, Standard());
+    TValue const * maxRight = begin(tree._maxRight, Standard());
+
+    ImplicitIntervalTreeNode_ stack[64];
+    int top = 0;
+    stack[top++] = ImplicitIntervalTreeNode_{(static_cast<int64_t>(1) << tree._maxLevel) - 1, tree._maxLevel, false};
+    while (top > 0)
+    {
+        ImplicitIntervalTreeNode_ node = stack[--top];
+        if (node.level <= 3)
+        {
+            // Scan small subtrees linearly.
+            int64_t i = node.pos >> node.level << node.level;
+            int64_t iEnd = std::min(i + (static_cast<int64_t>(1) << (node.level + 1)) - 1, n);
+            for (; i < iEnd && (isPoint ? !(queryBegin < intervals[i].i1) : intervals[i].i1 < queryEnd); ++i)
+                if (queryBegin < intervals[i].i2)
+                    appendValue(result, intervals[i].cargo, Generous());
+        }
+        else if (!node.leftDone)
+        {
+            // Revisit the node after its left subtree, which is skipped if all its intervals end before the query.
+            int64_t left = node.pos - (static_cast<int64_t>(1) << (node.level - 1));
+            stack[top++] = ImplicitIntervalTreeNode_{node.pos, node.level, true};
+            if (left >= n || queryBegin < maxRight[left])
+                stack[top++] = ImplicitIntervalTreeNode_{left, node.level - 1, false};
+        }
+        else if (node.pos < n &&
+                 (isPoint ? !(queryBegin < intervals[node.pos].i1) : intervals[node.pos].i1 < queryEnd))
+        {
+            // All intervals in the right subtree start after this one.
+            if (queryBegin < intervals[node.pos].i2)
+                appendValue(result, intervals[node.pos].cargo, Generous());
+            stack[top++] = ImplicitIntervalTreeNode_{node.pos + (static_cast<int64_t>(1) << (node.level - 1)),
+                                                     node.level - 1, false};
+        }
+    }
+}
+
+template <typename TCargo, typename TSpec, typename TValue, typename TValue2>
+inline void
+_findIntervals(String<TCargo, TSpec> & result,
+               ImplicitIntervalTree<TValue, TCargo> const & tree,
+               TValue2 const & point)
+{
+    _findIntervals(result, tree, point, point, true);
+}
+
+template <typename TCargo, typename TSpec, typename TValue, typename T1, typename T2, typename TPairSpec>
+inline void
+_findIntervals(String<TCargo, TSpec> & result,
+               ImplicitIntervalTree<TValue, TCargo> const & tree,
+               Pair<T1, T2, TPairSpec> const & interval)
+{
+    _findIntervals(result, tree, interval.i1, static_cast<T1>(interval.i2), false);
+}
+
+template <typename TCargo, typename TSpec, typename TValue, typename TValue2, typename TCargo2>
+inline void
+_findIntervals(String<TCargo, TSpec> & result,
+               ImplicitIntervalTree<TValue, TCargo> const & tree,
+               IntervalAndCargo<TValue2, TCargo2> const & interval)
+{
+    _findIntervals(result, tree, interval.i1, interval.i2, false);
+}
+
+// ----------------------------------------------------------------------------
+// Function findIntervals()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn ImplicitIntervalTree#findIntervals
+ * @brief Find all intervals that contain the query point or overlap with the query interval.
+ *
+ * @signature void findIntervals(result, intervalTree, query);
+ * @signature void findIntervals(result, intervalTree, queryBegin, queryEnd);
+ * @signature void findIntervals(results, intervalTree, queries[, parallelTag]);
+ *
+ * @param[out] result       The cargos of the found intervals, ordered by the left boundary of the intervals.
+ *                          Types: @link String @endlink.
+ * @param[out] results      A @link String @endlink of result strings, one per query.
+ * @param[in]  intervalTree An @link ImplicitIntervalTree @endlink.
+ * @param[in]  query        A query point.
+ * @param[in]  queryBegin   The begin position of the query interval.
+ * @param[in]  queryEnd     The end position of the query interval.
+ * @param[in]  queries      A @link String @endlink of query points or query intervals, the latter given as
+ *                          @link Pair @endlink or @link IntervalAndCargo @endlink objects.
+ * @param[in]  parallelTag  Answer the queries in parallel if <tt>Parallel</tt>.  Types: @link ParallelismTags @endlink.
+ *                          Default: <tt>Serial</tt>.
+ *
+ * As for the @link IntervalTree @endlink, an interval <tt>[b, e)</tt> contains the point <tt>p</tt> if
+ * <tt>b &lt;= p &lt; e</tt> and it overlaps with the query interval <tt>[qb, qe)</tt> if <tt>b &lt; qe</tt> and
+ * <tt>qb &lt; e</tt>.
+ *
+ * The batch variant answers the queries in the order of their begin positions, such that consecutive queries visit
+ * the same parts of the index.  The results are stored in the order of the queries.
+ */
+
+template <typename TCargo, typename TSpec, typename TValue, typename TValue2>
+inline void
+findIntervals(String<TCargo, TSpec> & result,
+              ImplicitIntervalTree<TValue, TCargo> const & tree,
+              TValue2 query)
+{
+    clear(result);
+    _indexIntervals(tree, Serial());
+    _findIntervals(result, tree, query, query, true);
+}
+
+template <typename TCargo, typename TSpec, typename TValue, typename TValue2>
+inline void
+findIntervals(String<TCargo, TSpec> & result,
+              ImplicitIntervalTree<TValue, TCargo> const & tree,
+              TValue2 queryBegin,
+              TValue2 queryEnd)
+{
+    clear(result);
+    _indexIntervals(tree, Serial());
+    _findIntervals(result, tree, queryBegin, queryEnd, false);
+}
+
+template <typename TCargo, typename TSpec, typename TResultsSpec, typename TValue, typename TQuery,
+          typename TQueriesSpec, typename TParallelTag>
+inline void
+findIntervals(String<String<TCargo, TSpec>, TResultsSpec> & results,
+              ImplicitIntervalTree<TValue, TCargo> const & tree,
+              String<TQuery, TQueriesSpec> const & queries,
+              Tag<TParallelTag> const & parallelTag)
+{
+    typedef String<TQuery, TQueriesSpec> TQueries;
+
+    bool const parallel = IsSameType<Tag<TParallelTag>, Parallel>::VALUE;
+    ignoreUnusedVariableWarning(parallel);
+    _indexIntervals(tree, parallelTag);
+
+    int64_t numQueries = length(queries);
+    resize(results, numQueries);
+    String<int64_t> order;
+    resize(order, numQueries, Exact());
+    for (int64_t i = 0; i < numQueries; ++i)
+        order[i] = i;
+    sort(order, ImplicitIntervalTreeQueryLess_<TQueries>(queries), parallelTag);
+
+    // Every thread gets a contiguous range of the sorted queries.
+    SEQAN_OMP_PRAGMA(parallel for schedule(static) if(parallel))
+    for (int64_t i = 0; i < numQueries; ++i)
+    {
+        clear(results[order[i]]);
+        _findIntervals(results[order[i]], tree, queries[order[i]]);
+    }
+}
+
+template <typename TCargo, typename TSpec, typename TResultsSpec, typename TValue, typename TQuery,
+          typename TQueriesSpec>
+inline void
+findIntervals(String<String<TCargo, TSpec>, TResultsSpec> & results,
+              ImplicitIntervalTree<TValue, TCargo> const & tree,
+              String<TQuery, TQueriesSpec> const & queries)
+{
+    findIntervals(results, tree, queries, Serial());
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef SEQAN_HEADER_MISC_IMPLICIT_INTERVAL_TREE_H
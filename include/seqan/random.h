@@ -55,6 +55,9 @@
 // Rng With Special Distributions not contained in the STL.
 #include <seqan/random/random_beta.h>
 
+// Counter-based Rngs with jump-ahead and independent streams.
+#include <seqan/random/random_counter_based.h>
+
 // Functions with randomness.
 #include <seqan/random/random_util.h>
 
@@ -0,0 +1,478 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Counter-based random number generators Philox4x32-10 and Threefry2x64-20
+// as described in Salmon et al., "Parallel random numbers: as easy as
+// 1, 2, 3", SC'11.  The n-th block of random numbers is a bijection of the
+// counter n under a key, hence jumping ahead is O(1) and disjoint streams
+// are obtained by reserving a part of the counter for the stream number.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_RANDOM_RANDOM_COUNTER_BASED_H_
+#define INCLUDE_SEQAN_RANDOM_RANDOM_COUNTER_BASED_H_
+
+namespace seqan2 {
+
+// ===========================================================================
+// Forwards, Tags.
+// ===========================================================================
+
+/*!
+ * @tag CounterBasedRngTags#Philox
+ * @headerfile <seqan/random.h>
+ * @brief Philox4x32-10, generates blocks of four 32 bit numbers with ten rounds of multiplications.
+ *
+ * @signature typedef Tag<Philox_> Philox;
+ *
+ * @tag CounterBasedRngTags#Threefry
+ * @headerfile <seqan/random.h>
+ * @brief Threefry2x64-20, generates blocks of two 64 bit numbers with twenty rounds of additions, rotations and
+ *        xors.
+ *
+ * @signature typedef Tag<Threefry_> Threefry;
+ */
+
+struct Philox_;
+typedef Tag<Philox_> Philox;
+
+struct Threefry_;
+typedef Tag<Threefry_> Threefry;
+
+template <unsigned LANES>
+inline void _generateBlocks(uint32_t * target, uint64_t block, uint64_t stream, uint64_t seed, Philox const &);
+
+template <unsigned LANES>
+inline void _generateBlocks(uint64_t * target, uint64_t block, uint64_t stream, uint64_t seed, Threefry const &);
+
+// ===========================================================================
+// Classes
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+// Class CounterBasedRngTraits_
+// ---------------------------------------------------------------------------
+
+// The value type, the number of values per block and the number of blocks that are generated together when filling
+// buffers, such that one round over all blocks fits into a vector register.
+
+template <typename TSpec>
+struct CounterBasedRngTraits_;
+
+template <>
+struct CounterBasedRngTraits_<Philox>
+{
+    typedef uint32_t TValue;
+    static const unsigned BLOCK_SIZE = 4;
+    static const unsigned LANES = 8;
+};
+
+template <>
+struct CounterBasedRngTraits_<Threefry>
+{
+    typedef uint64_t TValue;
+    static const unsigned BLOCK_SIZE = 2;
+    static const unsigned LANES = 4;
+};
+
+// ---------------------------------------------------------------------------
+// Class CounterBasedRng
+// ---------------------------------------------------------------------------
+
+/*!
+ * @class CounterBasedRng
+ * @headerfile <seqan/random.h>
+ * @brief Counter-based random number generator with jump-ahead and independent streams.
+ *
+ * @signature template <typename TSpec>
+ *            class CounterBasedRng;
+ *
+ * @tparam TSpec The algorithm, one of @link CounterBasedRngTags#Philox @endlink and
+ *               @link CounterBasedRngTags#Threefry @endlink.  Defaults to @link CounterBasedRngTags#Philox @endlink.
+ *
+ * The generator conforms to the <tt>UniformRandomBitGenerator</tt> concept of the STL and can be used with the
+ * distributions of <tt>&lt;random&gt;</tt>.  The i-th number of a stream is computed from the seed, the stream
+ * number and i alone.  Thus, @link CounterBasedRng#jumpAhead @endlink takes constant time and the streams selected
+ * with @link CounterBasedRng#setStream @endlink do not overlap, e.g. one stream per thread or per work item gives
+ * results that do not depend on the number of threads.  @link CounterBasedRng#fillRandom @endlink generates many
+ * numbers at once with a loop that the compiler vectorizes.
+ *
+ * @section Examples
+ *
+ * @code{.cpp}
+ * SEQAN_OMP_PRAGMA(parallel for)
+ * for (int i = 0; i < (int)length(reads); ++i)
+ * {
+ *     CounterBasedRng<Philox> rng(seed, i);  // one stream per read
+ *     std::uniform_int_distribution<unsigned> dist(0, 3);
+ *     ...
+ * }
+ * @endcode
+ */
+
+/*!
+ * @fn CounterBasedRng::CounterBasedRng
+ * @brief Constructor.
+ *
+ * @signature CounterBasedRng::CounterBasedRng([seed[, stream]]);
+ *
+ * @param[in] seed   The <tt>uint64_t</tt> seed, defaults to 0.
+ * @param[in] stream The <tt>uint64_t</tt> number of the stream, defaults to 0.
+ */
+
+template <typename TSpec = Philox>
+class CounterBasedRng
+{
+public:
+    typedef CounterBasedRngTraits_<TSpec> TTraits;
+    typedef typename TTraits::TValue result_type;  // Conform the stl standard.
+
+    static const unsigned BLOCK_SIZE = TTraits::BLOCK_SIZE;
+
+    // The key of the bijection, the stream and the number of the next block to generate.
+    uint64_t _seed;
+    uint64_t _stream;
+    uint64_t _block;
+    // The values of the previous block and the index of the next value to return from it.
+    result_type _buffer[BLOCK_SIZE];
+    unsigned _index;
+
+    explicit CounterBasedRng(uint64_t seed = 0, uint64_t stream = 0) :
+        _seed(seed), _stream(stream), _block(0), _index(BLOCK_SIZE)
+    {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    void seed(uint64_t seed = 0)
+    {
+        _seed = seed;
+        _block = 0;
+        _index = BLOCK_SIZE;
+    }
+
+    result_type operator()()
+    {
+        if (_index == BLOCK_SIZE)
+        {
+            _generateBlocks<1>(_buffer, _block++, _stream, _seed, TSpec());
+            _index = 0;
+        }
+        return _buffer[_index++];
+    }
+
+    void discard(unsigned long long n)
+    {
+        jumpAhead(*this, n);
+    }
+
+    bool operator==(CounterBasedRng const & other) const
+    {
+        return _seed == other._seed && _stream == other._stream && position(*this) == position(other);
+    }
+
+    bool operator!=(CounterBasedRng const & other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// ===========================================================================
+// Metafunctions
+// ===========================================================================
+
+// ===========================================================================
+// Functions
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+// Function _philox4x32Rounds()
+// ---------------------------------------------------------------------------
+
+// Applies the ten rounds of Philox4x32 to LANES counters that are stored as structure of arrays.
+
+template <unsigned LANES>
+inline void
+_philox4x32Rounds(uint32_t * SEQAN_RESTRICT c0, uint32_t * SEQAN_RESTRICT c1,
+                  uint32_t * SEQAN_RESTRICT c2, uint32_t * SEQAN_RESTRICT c3,
+                  uint32_t k0, uint32_t k1)
+{
+    for (unsigned round = 0; round < 10; ++round)
+    {
+        for (unsigned lane = 0; lane < LANES; ++lane)
+        {
+            uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * c0[lane];
+            uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * c2[lane];
+            uint32_t x0 = static_cast<uint32_t>(p1 >> 32) ^ c1[lane] ^ k0;
+            uint32_t x2 = static_cast<uint32_t>(p0 >> 32) ^ c3[lane] ^ k1;
+            c1[lane] = static_cast<uint32_t>(p1);
+            c3[lane] = static_cast<uint32_t>(p0);
+            c0[lane] = x0;
+            c2[lane] = x2;
+        }
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Function _threefry2x64Rounds()
+// ---------------------------------------------------------------------------
+
+// Applies the twenty rounds of Threefry2x64 including the key injections to LANES counters.
+
+template <unsigned LANES>
+inline void
+_threefry2x64Rounds(uint64_t * SEQAN_RESTRICT c0, uint64_t * SEQAN_RESTRICT c1, uint64_t k0, uint64_t k1)
+{
+    static const unsigned ROTATIONS[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+    uint64_t const ks[3] = {k0, k1, 0x1BD11BDAA9FC1A22ull ^ k0 ^ k1};
+
+    for (unsigned lane = 0; lane < LANES; ++lane)
+    {
+        c0[lane] += ks[0];
+        c1[lane] += ks[1];
+    }
+    for (unsigned round = 0; round < 20; ++round)
+    {
+        unsigned r = ROTATIONS[round % 8];
+        for (unsigned lane = 0; lane < LANES; ++lane)
+        {
+            c0[lane] += c1[lane];
+            c1[lane] = (c1[lane] << r) | (c1[lane] >> (64 - r));
+            c1[lane] ^= c0[lane];
+        }
+        if (round % 4 == 3)
+        {
+            unsigned s = (round + 1) / 4;
+            for (unsigned lane = 0; lane < LANES; ++lane)
+            {
+                c0[lane] += ks[s % 3];
+                c1[lane] += ks[(s + 1) % 3] + s;
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Function _generateBlocks()
+// ---------------------------------------------------------------------------
+
+// Writes the LANES consecutive blocks beginning with block of the given stream to target.
+
+template <unsigned LANES>
+inline void
+_generateBlocks(uint32_t * target, uint64_t block, uint64_t stream, uint64_t seed, Philox const &)
+{
+    uint32_t c0[LANES], c1[LANES], c2[LANES], c3[LANES];
+    for (unsigned lane = 0; lane < LANES; ++lane)
+    {
+        c0[lane] = static_cast<uint32_t>(block + lane);
+        c1[lane] = static_cast<uint32_t>((block + lane) >> 32);
+        c2[lane] = static_cast<uint32_t>(stream);
+        c3[lane] = static_cast<uint32_t>(stream >> 32);
+    }
+    _philox4x32Rounds<LANES>(c0, c1, c2, c3, static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32));
+    for (unsigned lane = 0; lane < LANES; ++lane)
+    {
+        target[4 * lane] = c0[lane];
+        target[4 * lane + 1] = c1[lane];
+        target[4 * lane + 2] = c2[lane];
+        target[4 * lane + 3] = c3[lane];
+    }
+}
+
+template <unsigned LANES>
+inline void
+_generateBlocks(uint64_t * target, uint64_t block, uint64_t stream, uint64_t seed, Threefry const &)
+{
+    uint64_t c0[LANES], c1[LANES];
+    for (unsigned lane = 0; lane < LANES; ++lane)
+    {
+        c0[lane] = block + lane;
+        c1[lane] = stream;
+    }
+    _threefry2x64Rounds<LANES>(c0, c1, seed, 0);
+    for (unsigned lane = 0; lane < LANES; ++lane)
+    {
+        target[2 * lane] = c0[lane];
+        target[2 * lane + 1] = c1[lane];
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Function position()
+// ---------------------------------------------------------------------------
+
+/*!
+ * @fn CounterBasedRng#position
+ * @brief Returns the number of values generated from the current stream.
+ *
+ * @signature uint64_t position(rng);
+ *
+ * @param[in] rng The CounterBasedRng to query.
+ *
+ * @return uint64_t The number of values drawn since seeding or selecting the stream, including skipped ones.
+ */
+
+template <typename TSpec>
+inline uint64_t
+position(CounterBasedRng<TSpec> const & rng)
+{
+    return rng._block * CounterBasedRng<TSpec>::BLOCK_SIZE - (CounterBasedRng<TSpec>::BLOCK_SIZE - rng._index);
+}
+
+// ---------------------------------------------------------------------------
+// Function jumpAhead()
+// ---------------------------------------------------------------------------
+
+/*!
+ * @fn CounterBasedRng#jumpAhead
+ * @brief Skips values in constant time.
+ *
+ * @signature void jumpAhead(rng, n);
+ *
+ * @param[in,out] rng The CounterBasedRng to advance.
+ * @param[in]     n   The number of values to skip.
+ */
+
+template <typename TSpec>
+inline void
+jumpAhead(CounterBasedRng<TSpec> & rng, uint64_t n)
+{
+    unsigned const BLOCK_SIZE = CounterBasedRng<TSpec>::BLOCK_SIZE;
+
+    uint64_t pos = position(rng) + n;
+    rng._block = pos / BLOCK_SIZE;
+    rng._index = pos % BLOCK_SIZE;
+    if (rng._index == 0)
+        rng._index = BLOCK_SIZE;
+    else
+        _generateBlocks<1>(rng._buffer, rng._block++, rng._stream, rng._seed, TSpec());
+}
+
+// ---------------------------------------------------------------------------
+// Function setStream()
+// ---------------------------------------------------------------------------
+
+/*!
+ * @fn CounterBasedRng#setStream
+ * @brief Selects a stream and restarts at its beginning.
+ *
+ * @signature void setStream(rng, stream);
+ *
+ * @param[in,out] rng    The CounterBasedRng to modify.
+ * @param[in]     stream The <tt>uint64_t</tt> number of the stream.
+ *
+ * Streams with different numbers and the same seed never overlap.
+ */
+
+template <typename TSpec>
+inline void
+setStream(CounterBasedRng<TSpec> & rng, uint64_t stream)
+{
+    rng._stream = stream;
+    rng._block = 0;
+    rng._index = CounterBasedRng<TSpec>::BLOCK_SIZE;
+}
+
+// ---------------------------------------------------------------------------
+// Function getStream()
+// ---------------------------------------------------------------------------
+
+/*!
+ * @fn CounterBasedRng#getStream
+ * @brief Returns the number of the current stream.
+ *
+ * @signature uint64_t getStream(rng);
+ *
+ * @param[in] rng The CounterBasedRng to query.
+ *
+ * @return uint64_t The number of the stream.
+ */
+
+template <typename TSpec>
+inline uint64_t
+getStream(CounterBasedRng<TSpec> const & rng)
+{
+    return rng._stream;
+}
+
+// ---------------------------------------------------------------------------
+// Function fillRandom()
+// ---------------------------------------------------------------------------
+
+/*!
+ * @fn CounterBasedRng#fillRandom
+ * @brief Fills a buffer with random numbers.
+ *
+ * @signature void fillRandom(target, rng);
+ *
+ * @param[out]    target The @link ContainerConcept @endlink to fill, its length is kept.
+ * @param[in,out] rng    The CounterBasedRng to draw the numbers from.
+ *
+ * The target gets the same numbers as with <tt>length(target)</tt> calls of <tt>rng()</tt>, but the complete
+ * blocks are generated several at once.
+ */
+
+template <typename TTarget, typename TSpec>
+inline void
+fillRandom(TTarget & target, CounterBasedRng<TSpec> & rng)
+{
+    typedef typename Iterator<TTarget, Standard>::Type TIter;
+    typedef typename CounterBasedRng<TSpec>::result_type TValue;
+    unsigned const BLOCK_SIZE = CounterBasedRng<TSpec>::BLOCK_SIZE;
+    unsigned const LANES = CounterBasedRng<TSpec>::TTraits::LANES;
+
+    TIter it = begin(target, Standard());
+    TIter itEnd = end(target, Standard());
+
+    // Return the rest of the current block first.
+    for (; it != itEnd && rng._index != BLOCK_SIZE; ++it)
+        *it = rng._buffer[rng._index++];
+
+    // Generate LANES blocks at once.
+    TValue values[BLOCK_SIZE * LANES];
+    while (itEnd - it >= (std::ptrdiff_t)(BLOCK_SIZE * LANES))
+    {
+        _generateBlocks<LANES>(values, rng._block, rng._stream, rng._seed, TSpec());
+        rng._block += LANES;
+        for (unsigned i = 0; i < BLOCK_SIZE * LANES; ++i, ++it)
+            *it = values[i];
+    }
+
+    // The remaining values are drawn one by one.
+    for (; it != itEnd; ++it)
+        *it = rng();
+}
+
+}  // namespace seqan2
+
+#endif  // INCLUDE_SEQAN_RANDOM_RANDOM_COUNTER_BASED_H_
@@ -65,7 +65,13 @@ namespace seqan2 {
  * @signature TValue bandedChainAlignment(gapsH, gapsV,   seedChain, scoringScheme1[, scoringScheme2] [, alignConfig] [, k]);
  * @signature TValue bandedChainAlignment(frags, strings, seedChain, scoringScheme1[, scoringScheme2] [, alignConfig] [, k]);
  * @signature TValue bandedChainAlignment(alignmentGraph, seedChain, scoringScheme1[, scoringScheme2] [, alignConfig] [, k]);
+ * @signature TValue bandedChainAlignment(execPolicy, align,        seedChain, scoringScheme1[, scoringScheme2] [, alignConfig] [, k]);
+ * @signature TValue bandedChainAlignment(execPolicy, gapsH, gapsV, seedChain, scoringScheme1[, scoringScheme2] [, alignConfig] [, k]);
  *
+ * @param[in] execPolicy  An @link ExecutionPolicy @endlink with the @link ParallelismTags#Parallel @endlink tag.  The
+ *                        chain is cut in the middle of some of its anchors and the pieces are aligned in parallel
+ *                        using <tt>numThreads(execPolicy)</tt> threads.  The alignment is forced through the cut
+ *                        points; for anchors of exact matches the score equals the one of the serial version.
  * @param[in,out] align   An @link Align @endlink object that stores the alignment. The number of rows must be 2 and the
  *                        sequences must have already been set.  <tt>row(align, 0)</tt> is the horizontal sequence in the
  *                        alignment matrix, <tt>row(align, 1)</tt> is the vertical sequence.
@@ -471,6 +477,164 @@ bandedChainAlignment(String<Fragment<TSize, TFragmentSpec>, TStringSpec> & fragm
                                 bandExtension);
 }
 
+// ----------------------------------------------------------------------------
+// Function bandedChainAlignment()                            [Align; Parallel]
+// ----------------------------------------------------------------------------
+
+template <typename TVectorSpec, typename TSequence, typename TAlignSpec, typename TSeeds, typename TScoreValue,
+          typename TScoreSpecAnchor, typename TScoreSpecGap, bool TFirstRow, bool TFirstColumn, bool TLastColumn,
+          bool TLastRow, typename TACSpec>
+inline TScoreValue
+bandedChainAlignment(ExecutionPolicy<Parallel, TVectorSpec> const & execPolicy,
+                     Align<TSequence, TAlignSpec> & align,
+                     TSeeds const & seedSet,
+                     Score<TScoreValue, TScoreSpecAnchor> const & scoreSchemeAnchor,
+                     Score<TScoreValue, TScoreSpecGap> const & scoreSchemeGap,
+                     AlignConfig<TFirstRow, TFirstColumn, TLastColumn, TLastRow, TACSpec> const & alignConfig,
+                     unsigned bandExtension = 15)
+{
+    typedef typename Position<TSequence>::Type TPosition;
+    typedef typename Size<TSequence>::Type TSize;
+    typedef StringSet<String<TraceSegment_<TPosition, TSize> > > TTraceSegmentSet;
+
+    TTraceSegmentSet traceSet;
+    TScoreValue score =
+        _setupAndRunBandedChainAlignment(traceSet, seedSet, source(row(align, 0)), source(row(align, 1)),
+                                         scoreSchemeAnchor, scoreSchemeGap, alignConfig, bandExtension, GapsLeft(),
+                                         execPolicy);
+
+    if (empty(traceSet))
+        return score;
+
+    _adaptTraceSegmentsTo(row(align,0), row(align,1), value(traceSet, 0));
+    return score;
+}
+
+// With only one scoring scheme.
+template <typename TVectorSpec, typename TSequence, typename TAlignSpec, typename TSeeds, typename TScoreValue,
+          typename TScoreSpec, bool TFirstRow, bool TFirstColumn, bool TLastColumn, bool TLastRow, typename TACSpec>
+inline TScoreValue
+bandedChainAlignment(ExecutionPolicy<Parallel, TVectorSpec> const & execPolicy,
+                     Align<TSequence, TAlignSpec> & align,
+                     TSeeds const & seedSet,
+                     Score<TScoreValue, TScoreSpec> const & scoreScheme,
+                     AlignConfig<TFirstRow, TFirstColumn, TLastColumn, TLastRow, TACSpec> const & alignConfig,
+                     unsigned bandExtension = 15)
+{
+    return bandedChainAlignment(execPolicy, align, seedSet, scoreScheme, scoreScheme, alignConfig, bandExtension);
+}
+
+// Without AlignConfig.
+template <typename TVectorSpec, typename TSequence, typename TAlignSpec, typename TSeeds, typename TScoreValue,
+          typename TScoreSpecAnchor, typename TScoreSpecGap>
+inline TScoreValue
+bandedChainAlignment(ExecutionPolicy<Parallel, TVectorSpec> const & execPolicy,
+                     Align<TSequence, TAlignSpec> & align,
+                     TSeeds const & seedSet,
+                     Score<TScoreValue, TScoreSpecAnchor> const & scoreSchemeAnchor,
+                     Score<TScoreValue, TScoreSpecGap> const & scoreSchemeGap,
+                     unsigned bandExtension = 15)
+{
+    return bandedChainAlignment(execPolicy, align, seedSet, scoreSchemeAnchor, scoreSchemeGap, AlignConfig<>(),
+                                bandExtension);
+}
+
+// Without AlignConfig and with only one scoring scheme.
+template <typename TVectorSpec, typename TSequence, typename TAlignSpec, typename TSeeds, typename TScoreValue,
+          typename TScoreSpec>
+inline TScoreValue
+bandedChainAlignment(ExecutionPolicy<Parallel, TVectorSpec> const & execPolicy,
+                     Align<TSequence, TAlignSpec> & align,
+                     TSeeds const & seedSet,
+                     Score<TScoreValue, TScoreSpec> const & scoreScheme,
+                     unsigned bandExtension = 15)
+{
+    return bandedChainAlignment(execPolicy, align, seedSet, scoreScheme, scoreScheme, AlignConfig<>(),
+                                bandExtension);
+}
+
+// ----------------------------------------------------------------------------
+// Function bandedChainAlignment()                             [Gaps; Parallel]
+// ----------------------------------------------------------------------------
+
+template <typename TVectorSpec, typename TSequenceH, typename TGapSpecH, typename TSequenceV, typename TGapSpecV,
+          typename TSeeds, typename TScoreValue, typename TScoreSpecAnchor, typename TScoreSpecGap, bool TFirstRow,
+          bool TFirstColumn, bool TLastColumn, bool TLastRow, typename TACSpec>
+inline TScoreValue
+bandedChainAlignment(ExecutionPolicy<Parallel, TVectorSpec> const & execPolicy,
+                     Gaps<TSequenceH, TGapSpecH> & gapsHorizontal,
+                     Gaps<TSequenceV, TGapSpecV> & gapsVertical,
+                     TSeeds const & seedSet,
+                     Score<TScoreValue, TScoreSpecAnchor> const & scoreSchemeAnchors,
+                     Score<TScoreValue, TScoreSpecGap> const & scoreSchemeGaps,
+                     AlignConfig<TFirstRow, TFirstColumn, TLastColumn, TLastRow, TACSpec> const & alignConfig,
+                     unsigned bandExtension = 15)
+{
+    typedef typename Position<TSequenceH>::Type TPosition;
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef StringSet<String<TraceSegment_<TPosition, TSize> > > TTraceSegmentSet;
+
+    TTraceSegmentSet traceSet;
+    TScoreValue score =
+        _setupAndRunBandedChainAlignment(traceSet, seedSet, source(gapsHorizontal), source(gapsVertical),
+                                         scoreSchemeAnchors, scoreSchemeGaps, alignConfig, bandExtension, GapsLeft(),
+                                         execPolicy);
+
+    if (empty(traceSet))
+        return score;
+
+    _adaptTraceSegmentsTo(gapsHorizontal, gapsVertical, value(traceSet, 0));
+    return score;
+}
+
+// With only one scoring scheme.
+template <typename TVectorSpec, typename TSequenceH, typename TGapSpecH, typename TSequenceV, typename TGapSpecV,
+          typename TSeeds, typename TScoreValue, typename TScoreSpec, bool TFirstRow, bool TFirstColumn,
+          bool TLastColumn, bool TLastRow, typename TACSpec>
+inline TScoreValue
+bandedChainAlignment(ExecutionPolicy<Parallel, TVectorSpec> const & execPolicy,
+                     Gaps<TSequenceH, TGapSpecH> & gapsHorizontal,
+                     Gaps<TSequenceV, TGapSpecV> & gapsVertical,
+                     TSeeds const & seedSet,
+                     Score<TScoreValue, TScoreSpec> const & scoreScheme,
+                     AlignConfig<TFirstRow, TFirstColumn, TLastColumn, TLastRow, TACSpec> const & alignConfig,
+                     unsigned bandExtension = 15)
+{
+    return bandedChainAlignment(execPolicy, gapsHorizontal, gapsVertical, seedSet, scoreScheme, scoreScheme,
+                                alignConfig, bandExtension);
+}
+
+// Without AlignConfig.
+template <typename TVectorSpec, typename TSequenceH, typename TGapSpecH, typename TSequenceV, typename TGapSpecV,
+          typename TSeeds, typename TScoreValue, typename TScoreSpecAnchor, typename TScoreSpecGap>
+inline TScoreValue
+bandedChainAlignment(ExecutionPolicy<Parallel, TVectorSpec> const & execPolicy,
+                     Gaps<TSequenceH, TGapSpecH> & gapsHorizontal,
+                     Gaps<TSequenceV, TGapSpecV> & gapsVertical,
+                     TSeeds const & seedSet,
+                     Score<TScoreValue, TScoreSpecAnchor> const & scoreSchemeAnchor,
+                     Score<TScoreValue, TScoreSpecGap> const & scoreSchemeGap,
+                     unsigned bandExtension = 15)
+{
+    return bandedChainAlignment(execPolicy, gapsHorizontal, gapsVertical, seedSet, scoreSchemeAnchor, scoreSchemeGap,
+                                AlignConfig<>(), bandExtension);
+}
+
+// Without AlignConfig and with only one scoring scheme.
+template <typename TVectorSpec, typename TSequenceH, typename TGapSpecH, typename TSequenceV, typename TGapSpecV,
+          typename TSeeds, typename TScoreValue, typename TScoreSpec>
+inline TScoreValue
+bandedChainAlignment(ExecutionPolicy<Parallel, TVectorSpec> const & execPolicy,
+                     Gaps<TSequenceH, TGapSpecH> & gapsHorizontal,
+                     Gaps<TSequenceV, TGapSpecV> & gapsVertical,
+                     TSeeds const & seedSet,
+                     Score<TScoreValue, TScoreSpec> const & scoreScheme,
+                     unsigned bandExtension = 15)
+{
+    return bandedChainAlignment(execPolicy, gapsHorizontal, gapsVertical, seedSet, scoreScheme, scoreScheme,
+                                AlignConfig<>(), bandExtension);
+}
+
 }  // namespace seqan2
 
 #endif  // #ifndef INCLUDE_SEQAN_SEEDS_BANDED_CHAIN_ALIGNMENT_H_
@@ -762,7 +762,7 @@ _initiaizeBeginningOfBandedChain(TScoutState & scoutState,
     _computeScore(dpInitCellHorizontal, dummy, dummy, dummy,
                   Nothing(), Nothing(), Nothing(),
                   RecursionDirectionZero(), TDPProfile());
-    scoutState._nextInitializationCells.insert(TInitCell(0,0, dpInitCellHorizontal));
+    appendValue(scoutState._nextInitializationCells, TInitCell(0,0, dpInitCellHorizontal));
 
     for (TSizeH activeColumn = 1; activeColumn < sizeH; ++activeColumn)
     {
@@ -775,7 +775,7 @@ _initiaizeBeginningOfBandedChain(TScoutState & scoutState,
             _computeScore(dpInitCellHorizontal, dummy, prevCell, dummy,
                   Nothing(), Nothing(), scoreScheme,
                   RecursionDirectionHorizontal(), TDPProfile());
-        scoutState._nextInitializationCells.insert(TInitCell(activeColumn, 0, dpInitCellHorizontal));
+        appendValue(scoutState._nextInitializationCells, TInitCell(activeColumn, 0, dpInitCellHorizontal));
     }
 
     TDPCell dpInitCellVertical;
@@ -793,7 +793,7 @@ _initiaizeBeginningOfBandedChain(TScoutState & scoutState,
             _computeScore(dummy, dummy, dummy, dpInitCellVertical,
                           Nothing(), Nothing(), scoreScheme,
                           RecursionDirectionVertical(), TDPProfile());
-        scoutState._nextInitializationCells.insert(TInitCell(0, activeRow, dpInitCellVertical));
+        appendValue(scoutState._nextInitializationCells, TInitCell(0, activeRow, dpInitCellVertical));
     }
 
 }
@@ -266,6 +266,201 @@ _setupAndRunBandedChainAlignment(StringSet<String<TTraceSegment>, TStringSetSpec
     }
 }
 
+// ----------------------------------------------------------------------------
+// Function _localBandedChainAnchor()
+// ----------------------------------------------------------------------------
+
+// Returns the part [beginH, endH) x [beginV, endV) of the given anchor relative to the origin (offsetH, offsetV) of a
+// piece of the chain.  The diagonals of the anchor are kept such that extended anchors keep their band.
+template <typename TSeed, typename TPos>
+inline Seed<Simple>
+_localBandedChainAnchor(TSeed const & anchor, TPos beginH, TPos beginV, TPos endH, TPos endV, TPos offsetH,
+                        TPos offsetV)
+{
+    typedef typename Diagonal<Seed<Simple> >::Type TDiagonal;
+
+    Seed<Simple> localAnchor(beginH - offsetH, beginV - offsetV, endH - offsetH, endV - offsetV);
+    TDiagonal shift = static_cast<TDiagonal>(offsetH) - static_cast<TDiagonal>(offsetV);
+    setLowerDiagonal(localAnchor, std::min(lowerDiagonal(localAnchor),
+                                           static_cast<TDiagonal>(lowerDiagonal(anchor)) - shift));
+    setUpperDiagonal(localAnchor, std::max(upperDiagonal(localAnchor),
+                                           static_cast<TDiagonal>(upperDiagonal(anchor)) - shift));
+    return localAnchor;
+}
+
+// ----------------------------------------------------------------------------
+// Function _runBandedChainPiece()
+// ----------------------------------------------------------------------------
+
+// Runs one piece of a split chain.  Free end-gaps only apply to the begin of the first and the end of the last piece,
+// all cut points inside the chain are passed globally.
+template <typename TTraceSet, typename TSeeds, typename TSequenceH, typename TSequenceV, typename TScoreValue,
+          typename TScoreSpecAnchor, typename TScoreSpecGap, bool TFirstRow, bool TFirstColumn, bool TLastColumn,
+          bool TLastRow, typename TACSpec, typename TGapsPlacement>
+inline TScoreValue
+_runBandedChainPiece(TTraceSet & traceSet,
+                     TSeeds const & seeds,
+                     TSequenceH const & seqH,
+                     TSequenceV const & seqV,
+                     Score<TScoreValue, TScoreSpecAnchor> const & scoringSchemeAnchor,
+                     Score<TScoreValue, TScoreSpecGap> const & scoringSchemeGap,
+                     AlignConfig<TFirstRow, TFirstColumn, TLastColumn, TLastRow, TACSpec> const &,
+                     unsigned bandExtension,
+                     TGapsPlacement const & gapsPlacement,
+                     bool isFirst,
+                     bool isLast)
+{
+    if (isFirst)
+        return _setupAndRunBandedChainAlignment(traceSet, seeds, seqH, seqV, scoringSchemeAnchor, scoringSchemeGap,
+                                                AlignConfig<TFirstRow, TFirstColumn, false, false, TACSpec>(),
+                                                bandExtension, gapsPlacement);
+    if (isLast)
+        return _setupAndRunBandedChainAlignment(traceSet, seeds, seqH, seqV, scoringSchemeAnchor, scoringSchemeGap,
+                                                AlignConfig<false, false, TLastColumn, TLastRow, TACSpec>(),
+                                                bandExtension, gapsPlacement);
+    return _setupAndRunBandedChainAlignment(traceSet, seeds, seqH, seqV, scoringSchemeAnchor, scoringSchemeGap,
+                                            AlignConfig<false, false, false, false, TACSpec>(), bandExtension,
+                                            gapsPlacement);
+}
+
+// ----------------------------------------------------------------------------
+// Function _setupAndRunBandedChainAlignment()                       [Parallel]
+// ----------------------------------------------------------------------------
+
+// The chain is cut into independent pieces in the middle of some of its anchors.  The pieces are aligned in parallel
+// and their traces are concatenated afterwards.  The alignment is thus forced through the cut points, which for anchors
+// of exact matches does not change the score.
+template <typename TTraceSegment, typename TStringSetSpec, typename TSeeds, typename TSequenceH, typename TSequenceV,
+          typename TScoreValue, typename TScoreSpecAnchor, typename TScoreSpecGap, bool TFirstRow, bool TFirstColumn,
+          bool TLastColumn, bool TLastRow, typename TACSpec, typename TGapsPlacement, typename TVectorSpec>
+inline TScoreValue
+_setupAndRunBandedChainAlignment(StringSet<String<TTraceSegment>, TStringSetSpec> & globalTraceSet,
+                                 TSeeds const & seedSet,
+                                 TSequenceH const & seqH,
+                                 TSequenceV const & seqV,
+                                 Score<TScoreValue, TScoreSpecAnchor> const & scoringSchemeAnchor,
+                                 Score<TScoreValue, TScoreSpecGap> const & scoringSchemeGap,
+                                 AlignConfig<TFirstRow, TFirstColumn, TLastColumn, TLastRow, TACSpec> const & alignConfig,
+                                 unsigned bandExtension,
+                                 TGapsPlacement const & gapsPlacement,
+                                 ExecutionPolicy<Parallel, TVectorSpec> const & execPolicy)
+{
+    typedef typename Iterator<TSeeds const, Standard>::Type TSeedIterator;
+    typedef typename Value<TSeeds const>::Type TSeed;
+    typedef typename Position<Seed<Simple> >::Type TPos;
+    typedef typename Infix<TSequenceH const>::Type TInfixH;
+    typedef typename Infix<TSequenceV const>::Type TInfixV;
+    typedef StringSet<String<TTraceSegment> > TTraceSet;
+
+    String<TSeed> chain;
+    for (TSeedIterator it = begin(seedSet, Standard()); it != end(seedSet, Standard()); ++it)
+        appendValue(chain, *it);
+
+    // Choose the anchors to cut at, spread evenly over the horizontal sequence.  Every anchor needs to span at least
+    // two positions in both sequences to be cut into two non-empty halves.
+    unsigned threads = numThreads(execPolicy);
+    String<unsigned> cutAnchors;
+    if (threads > 1u && length(chain) > 2u)
+    {
+        unsigned numPieces = std::min(4u * threads, static_cast<unsigned>(length(chain)) - 1u);
+        unsigned next = 1;
+        for (unsigned i = 1; i + 1 < length(chain) && next < numPieces; ++i)
+        {
+            TSeed const & anchor = chain[i];
+            if (endPositionH(anchor) - beginPositionH(anchor) < 2u ||
+                endPositionV(anchor) - beginPositionV(anchor) < 2u)
+                continue;
+            if (static_cast<uint64_t>(beginPositionH(anchor)) * numPieces < static_cast<uint64_t>(length(seqH)) * next)
+                continue;
+            appendValue(cutAnchors, i);
+            ++next;
+        }
+    }
+
+    if (empty(cutAnchors))
+        return _setupAndRunBandedChainAlignment(globalTraceSet, seedSet, seqH, seqV, scoringSchemeAnchor,
+                                                scoringSchemeGap, alignConfig, bandExtension, gapsPlacement);
+
+    // The cut points, including the begin and the end of the matrix.
+    unsigned numPieces = length(cutAnchors) + 1;
+    String<Pair<TPos> > cutPoints;
+    appendValue(cutPoints, Pair<TPos>(0, 0));
+    for (unsigned i = 0; i < length(cutAnchors); ++i)
+    {
+        TSeed const & anchor = chain[cutAnchors[i]];
+        appendValue(cutPoints, Pair<TPos>(beginPositionH(anchor) + (endPositionH(anchor) - beginPositionH(anchor)) / 2,
+                                          beginPositionV(anchor) + (endPositionV(anchor) - beginPositionV(anchor)) / 2));
+    }
+    appendValue(cutPoints, Pair<TPos>(length(seqH), length(seqV)));
+
+    String<TTraceSet> pieceTraces;
+    resize(pieceTraces, numPieces);
+    String<TScoreValue> pieceScores;
+    resize(pieceScores, numPieces, 0);
+    std::vector<std::exception_ptr> errors(numPieces);
+
+    SEQAN_OMP_PRAGMA(parallel for num_threads(threads) schedule(dynamic, 1))
+    for (int j = 0; j < static_cast<int>(numPieces); ++j)
+    {
+        try
+        {
+            Pair<TPos> const & pieceBegin = cutPoints[j];
+            Pair<TPos> const & pieceEnd = cutPoints[j + 1];
+            unsigned first = (j == 0) ? 0u : cutAnchors[j - 1];
+            unsigned last = (j + 1 == static_cast<int>(numPieces)) ? length(chain) - 1 : cutAnchors[j];
+
+            String<Seed<Simple> > pieceSeeds;
+            reserve(pieceSeeds, last - first + 1, Exact());
+            for (unsigned i = first; i <= last; ++i)
+            {
+                TSeed const & anchor = chain[i];
+                TPos beginH = beginPositionH(anchor), beginV = beginPositionV(anchor);
+                TPos endH = endPositionH(anchor), endV = endPositionV(anchor);
+                if (j != 0 && i == first)  // Right half of the anchor cut at the begin.
+                {
+                    beginH = pieceBegin.i1;
+                    beginV = pieceBegin.i2;
+                }
+                if (j + 1 != static_cast<int>(numPieces) && i == last)  // Left half of the anchor cut at the end.
+                {
+                    endH = pieceEnd.i1;
+                    endV = pieceEnd.i2;
+                }
+                appendValue(pieceSeeds, _localBandedChainAnchor(anchor, beginH, beginV, endH, endV, pieceBegin.i1,
+                                                                pieceBegin.i2));
+            }
+
+            TInfixH infixH = infix(seqH, pieceBegin.i1, pieceEnd.i1);
+            TInfixV infixV = infix(seqV, pieceBegin.i2, pieceEnd.i2);
+            pieceScores[j] = _runBandedChainPiece(pieceTraces[j], pieceSeeds, infixH, infixV, scoringSchemeAnchor,
+                                                  scoringSchemeGap, alignConfig, bandExtension, gapsPlacement,
+                                                  j == 0, j + 1 == static_cast<int>(numPieces));
+            _adaptLocalTracesToGlobalGrid(pieceTraces[j], pieceBegin);
+        }
+        catch (...)
+        {
+            errors[j] = std::current_exception();
+        }
+    }
+
+    for (unsigned j = 0; j < numPieces; ++j)
+        if (errors[j])
+            std::rethrow_exception(errors[j]);
+
+    // Traces are stored from the end to the begin of the sequences, hence the last piece comes first.
+    TScoreValue score = 0;
+    String<TTraceSegment> trace;
+    for (unsigned j = numPieces; j-- > 0;)
+    {
+        score += pieceScores[j];
+        if (!empty(pieceTraces[j]))
+            append(trace, front(pieceTraces[j]));
+    }
+    clear(globalTraceSet);
+    appendValue(globalTraceSet, trace);
+    return score;
+}
+
 }  // namespace seqan2
 
 #endif  // #ifndef INCLUDE_SEQAN_SEEDS_BANDED_CHAIN_ALIGNMENT_META_INFO_H_
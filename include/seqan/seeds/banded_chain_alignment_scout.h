@@ -77,7 +77,7 @@ class DPScoutState_<BandedChainAlignmentScoutState<TDPCell> >
 {
 public:
     typedef Triple<unsigned, unsigned, TDPCell> TInitCell;
-    typedef std::set<TInitCell> TInitializationCellSet;
+    typedef String<TInitCell> TInitializationCellSet;     // unordered, without duplicates
 
     unsigned int _horizontalNextGridOrigin;
     unsigned int _verticalNextGridOrigin;
@@ -182,7 +182,7 @@ _reinitScoutState(DPScoutState_<BandedChainAlignmentScoutState<TDPCell> > & scou
 {
     typedef DPScoutState_<BandedChainAlignmentScoutState<TDPCell> > TDPScoutState;
     typedef typename TDPScoutState::TInitializationCellSet TInitCellSet;
-    typedef typename TInitCellSet::iterator TInitCellSetIterator;
+    typedef typename Iterator<TInitCellSet, Standard>::Type TInitCellSetIterator;
 
     scoutState._horizontalNextGridOrigin = originNextMatrixH;
     scoutState._verticalNextGridOrigin = originNextMatrixV;
@@ -204,9 +204,11 @@ _reinitScoutState(DPScoutState_<BandedChainAlignmentScoutState<TDPCell> > & scou
     if ((TSizeNextInit) length(scoutState._verticalInitNextMatrix) < sizeNextMatrixInitV)
         resize(scoutState._verticalInitNextMatrix, sizeNextMatrixInitV, TDPCell());
 
-    // Parsing the set to get the values.
-    for (TInitCellSetIterator it = scoutState._nextInitializationCells.begin();  // We need to plant the initialization values here. At the moment we only put the old values here.
-        it != scoutState._nextInitializationCells.end(); ++it)
+    // Parsing the set to get the values.  Sorting first keeps the order in which cells at the same position overwrite
+    // each other.
+    std::sort(begin(scoutState._nextInitializationCells, Standard()), end(scoutState._nextInitializationCells, Standard()));
+    for (TInitCellSetIterator it = begin(scoutState._nextInitializationCells, Standard());  // We need to plant the initialization values here. At the moment we only put the old values here.
+        it != end(scoutState._nextInitializationCells, Standard()); ++it)
     {
 //        std::cerr << "TInitCell == " << it->i1 << " " << it->i2 << " " << _scoreOfCell(it->i3) << std::endl;
         if (it->i1 == 0)
@@ -217,6 +219,28 @@ _reinitScoutState(DPScoutState_<BandedChainAlignmentScoutState<TDPCell> > & scou
     }
 }
 
+// ----------------------------------------------------------------------------
+// Function _insertInitCell()
+// ----------------------------------------------------------------------------
+
+// Adds an initialization cell for the next matrix and returns false if it was already present.  Only the few cells
+// found by the traceback are added this way, hence the linear search.
+template <typename TDPCell>
+inline bool
+_insertInitCell(DPScoutState_<BandedChainAlignmentScoutState<TDPCell> > & scoutState,
+                typename DPScoutState_<BandedChainAlignmentScoutState<TDPCell> >::TInitCell const & initCell)
+{
+    typedef typename DPScoutState_<BandedChainAlignmentScoutState<TDPCell> >::TInitializationCellSet TInitCellSet;
+    typedef typename Iterator<TInitCellSet, Standard>::Type TInitCellSetIterator;
+
+    for (TInitCellSetIterator it = begin(scoutState._nextInitializationCells, Standard());
+         it != end(scoutState._nextInitializationCells, Standard()); ++it)
+        if (!(*it < initCell) && !(initCell < *it))
+            return false;
+    appendValue(scoutState._nextInitializationCells, initCell);
+    return true;
+}
+
 // ----------------------------------------------------------------------------
 // Function _setScoutState()
 // ----------------------------------------------------------------------------
@@ -311,14 +311,14 @@ void _computeTraceback(TTarget & target,
     if (verticalInitPos <= 0)
     {
         _correctDPCellForAffineGaps(dpScout._dpScoutStatePtr->_horizontalInitNextMatrix[horizontalInitPos], lastTraceValue);
-        insertResult = dpScout._dpScoutStatePtr->_nextInitializationCells.insert(TInitCell(horizontalInitPos, 0,
-                                                dpScout._dpScoutStatePtr->_horizontalInitNextMatrix[horizontalInitPos])).second;
+        insertResult = _insertInitCell(*dpScout._dpScoutStatePtr, TInitCell(horizontalInitPos, 0,
+                                       dpScout._dpScoutStatePtr->_horizontalInitNextMatrix[horizontalInitPos]));
     }
     else
     {
         _correctDPCellForAffineGaps(dpScout._dpScoutStatePtr->_verticalInitNextMatrix[verticalInitPos], lastTraceValue);
-        insertResult = dpScout._dpScoutStatePtr->_nextInitializationCells.insert(TInitCell(0, verticalInitPos,
-                                                dpScout._dpScoutStatePtr->_verticalInitNextMatrix[verticalInitPos])).second;
+        insertResult = _insertInitCell(*dpScout._dpScoutStatePtr, TInitCell(0, verticalInitPos,
+                                       dpScout._dpScoutStatePtr->_verticalInitNextMatrix[verticalInitPos]));
     }
 
     // Now before we can continue at the current position, we might want to track a vertical/horizontal gap up to this position.
@@ -375,7 +375,7 @@ void _computeTraceback(StringSet<TTarget> & targetSet,
     typedef typename Iterator<TMaxHostPositions, Standard>::Type TMaxHostPositionsIterator;
 
     // We have to clear the nextInitalization cells here.
-    dpScout._dpScoutStatePtr->_nextInitializationCells.clear();
+    clear(dpScout._dpScoutStatePtr->_nextInitializationCells);
     TMaxHostPositions & tracebackCandidates = maxHostPositions(dpScout);
 
     TMaxHostPositionsIterator itTraceCandidates = begin(tracebackCandidates, Standard());
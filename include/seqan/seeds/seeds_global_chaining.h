@@ -35,7 +35,8 @@
 #ifndef SEQAN_SEEDS_SEEDS_GLOBAL_CHAINING_H_
 #define SEQAN_SEEDS_SEEDS_GLOBAL_CHAINING_H_
 
-#include <map>
+#include <algorithm>
+#include <limits>
 
 namespace seqan2 {
 
@@ -62,21 +63,57 @@ typedef Tag<SparseChaining_> SparseChaining;
 // Functions
 // ===========================================================================
 
-template <typename TIntermediate>
-inline bool _checkScoreInvariant(TIntermediate const & list)
+// ---------------------------------------------------------------------------
+// Class SparseChainingTree_
+// ---------------------------------------------------------------------------
+
+// Fenwick tree over the ranks of the vertical end positions that answers "best chain ending at a rank <= r" in
+// O(log n).  A chain is better if it has a higher quality or, on equal quality, was inserted earlier.  Chains are
+// never removed, dominated ones simply never win a query.
+
+template <typename TSize>
+struct SparseChainingTree_
 {
-    if (list.empty())
-        return true;
-    auto it = list.begin();
-    auto score = it->i2;
-    ++it;
-    for (; it != list.end(); ++it)
+    typedef Triple<TSize, unsigned, unsigned> TEntry;  // (quality, insertion order, seed id)
+
+    String<TEntry> entries;
+
+    static bool better(TEntry const & lhs, TEntry const & rhs)
     {
-        if (score > it->i2)
-            return false;
-        score = it->i2;
+        return lhs.i1 > rhs.i1 || (lhs.i1 == rhs.i1 && lhs.i2 < rhs.i2);
     }
-    return true;
+};
+
+template <typename TSize>
+inline void
+_init(SparseChainingTree_<TSize> & tree, unsigned n)
+{
+    typedef typename SparseChainingTree_<TSize>::TEntry TEntry;
+    unsigned const NONE = std::numeric_limits<unsigned>::max();
+    clear(tree.entries);
+    resize(tree.entries, n + 1, TEntry(0, NONE, NONE), Exact());
+}
+
+// Insert the chain at the 1-based rank.
+template <typename TSize>
+inline void
+_update(SparseChainingTree_<TSize> & tree, unsigned rank, typename SparseChainingTree_<TSize>::TEntry const & entry)
+{
+    for (; rank < length(tree.entries); rank += rank & -rank)
+        if (SparseChainingTree_<TSize>::better(entry, tree.entries[rank]))
+            tree.entries[rank] = entry;
+}
+
+// Best chain among the ranks 1..rank.
+template <typename TSize>
+inline typename SparseChainingTree_<TSize>::TEntry
+_query(SparseChainingTree_<TSize> const & tree, unsigned rank)
+{
+    typename SparseChainingTree_<TSize>::TEntry best = tree.entries[0];
+    for (; rank > 0; rank -= rank & -rank)
+        if (SparseChainingTree_<TSize>::better(tree.entries[rank], best))
+            best = tree.entries[rank];
+    return best;
 }
 
 /*!
@@ -119,8 +156,10 @@ inline bool _checkScoreInvariant(TIntermediate const & list)
 // be increasing integers (sequence positions). However, the algorithm assumes the coordinates of the
 // rectangles to be placed in the fourth quadrant of the cartesian coordinate system (negative y-coordinates).
 // To adapt the algorithm for the positive sequence space we sort the y-coordinates in *L* in ascending order.
-// We then can use lower_bound and upper_bound on the sorted set to find the corresponding seed j as described in
-// the algorithm.
+//
+// Instead of the balanced search tree for *L* the chains are kept in a Fenwick tree over the ranks of the
+// y-coordinates of the end points.  The best chain ending left of and above seed k is then a prefix maximum, which
+// gives O(n log n) time using only flat arrays.
 template <typename TTargetContainer, typename TSeed, typename TSeedSetSpec>
 void
 chainSeedsGlobally(
@@ -130,20 +169,29 @@ chainSeedsGlobally(
 {
     typedef typename Position<TSeed>::Type TPosition;
     typedef typename Size<TSeed>::Type TSize;
+    typedef typename Iterator<SeedSet<TSeed, TSeedSetSpec> const, Standard>::Type TSeedSetIter;
+    typedef SparseChainingTree_<TSize> TTree;
+    typedef typename TTree::TEntry TEntry;
+
+    unsigned const NONE = std::numeric_limits<unsigned>::max();
+
+    clear(target);
+    if (length(seedSet) == 0u)
+        return;
 
     // -----------------------------------------------------------------------
     // Preparation
     // -----------------------------------------------------------------------
 
     // We copy over the seeds from the seed set into an array of seeds.  We can then directly reference seed by their
-    // index in this array which is simpler than handling iterators into the std::set<> of the seed set.
+    // index in this array.
     String<TSeed> seeds;
-    reserve(seeds, length(seedSet));
-    for (auto const & seed : seedSet._seeds)
+    reserve(seeds, length(seedSet), Exact());
+    for (TSeedSetIter it = begin(seedSet, Standard()), itEnd = end(seedSet, Standard()); it != itEnd; ++it)
     {
-        SEQAN_ASSERT_LT(beginPositionH(seed), endPositionH(seed)); // [beginH, endH) must be at least of length 1
-        SEQAN_ASSERT_LT(beginPositionV(seed), endPositionV(seed)); // [beginV, endV) must be at least of length 1
-        appendValue(seeds, seed);
+        SEQAN_ASSERT_LT(beginPositionH(*it), endPositionH(*it)); // [beginH, endH) must be at least of length 1
+        SEQAN_ASSERT_LT(beginPositionV(*it), endPositionV(*it)); // [beginV, endV) must be at least of length 1
+        appendValue(seeds, *it);
     }
 
     // -----------------------------------------------------------------------
@@ -151,147 +199,78 @@ chainSeedsGlobally(
     // -----------------------------------------------------------------------
 
     // This list is I in Gusfield's description.  An interval point is a triple of (dimension 0 border value, is start
-    // point, pointer to seed it belongs to).
+    // point, pointer to seed it belongs to).  Since we use gap space, we have to use "false" for end points so the
+    // lexical ordering gives us what the sparse chaining algorithm expects.
     typedef Triple<TPosition, bool, unsigned> TIntervalPoint;
     typedef String<TIntervalPoint> TIntervalPoints;
     typedef typename Iterator<TIntervalPoints, Standard>::Type TIntervalPointsIterator;
 
     TIntervalPoints intervalPoints;
-    // std::cout << ",--- high quality seeds" << std::endl;
-    // TODO(holtgrew): Using something dense here for qualities and predecessors should be faster but requires seeds to be available by consecutive ids.
-    std::map<unsigned, TSize> qualityOfChainEndingIn;
-    std::map<unsigned, unsigned> predecessor;
+    String<TSize> qualityOfChainEndingIn;
+    String<unsigned> predecessor;
+    String<TPosition> endRanks;     // sorted vertical end positions
+    reserve(intervalPoints, 2 * length(seeds), Exact());
+    resize(qualityOfChainEndingIn, length(seeds), Exact());
+    resize(predecessor, length(seeds), NONE, Exact());
+    resize(endRanks, length(seeds), Exact());
     for (unsigned i = 0; i < length(seeds); ++i)
     {
-        // Since we use gap space, we have to use "false" for end points so the lexical ordering gives us what the
-        // sparse chaining algorithm expects.
-        // std::cout << "| " << **it << std::endl;
         qualityOfChainEndingIn[i] = seedSize(seeds[i]);
-        predecessor[i] = std::numeric_limits<unsigned>::max();
+        endRanks[i] = endPositionV(seeds[i]);
         appendValue(intervalPoints, TIntervalPoint(beginPositionH(seeds[i]), true, i));
         appendValue(intervalPoints, TIntervalPoint(endPositionH(seeds[i]), false, i));
     }
-    // std::cout << "`--" << std::endl;
     std::sort(begin(intervalPoints, Standard()), end(intervalPoints, Standard()));
-    // std::cout << ",--- interval points" << std::endl;
-    // for (unsigned i = 0; i < length(intervalPoints); ++i) {
-    //     std::cout << "| (" << intervalPoints[i].i1 << ", " << intervalPoints[i].i2 << ", " << intervalPoints[i].i3 << ")" << std::endl;
-    // }
-    // std::cout << "`---" << std::endl;
+    std::sort(begin(endRanks, Standard()), end(endRanks, Standard()));
 
     // -----------------------------------------------------------------------
     // Step 2: Build the chain.
     // -----------------------------------------------------------------------
-    // We build a list of "intermediate solutions" (referred to as *L* in the Gusfield book).
-    // Each such solution is represented by the triple (end position in dim1,
-    // value of best chain so far, last seed of the chain).
-    typedef Triple<TPosition, TSize, unsigned> TIntermediateSolution;
-    typedef std::multiset<TIntermediateSolution> TIntermediateSolutions;
-    typedef typename TIntermediateSolutions::iterator TIntermediateSolutionsIterator;
-
-    // For all interval points...
-    TIntermediateSolutions intermediateSolutions;
-    for (TIntervalPointsIterator it_k = begin(intervalPoints), itEnd = end(intervalPoints); it_k != itEnd; ++it_k) {
+    // The tree holds the intermediate solutions (referred to as *L* in the Gusfield book), i.e. the quality of the
+    // best chain ending in each seed whose end point has been processed.
+    TTree tree;
+    _init(tree, length(seeds));
+    unsigned order = 0;
+    TEntry best = tree.entries[0];
+
+    for (TIntervalPointsIterator it_k = begin(intervalPoints, Standard()), itEnd = end(intervalPoints, Standard());
+         it_k != itEnd; ++it_k)
+    {
         // The seed belonging ot the interval point is seed k.
         TSeed const & seed_k = seeds[it_k->i3];
 
-        // std::cout << "Processing interval point (" << it_k->i1 << ", " << it_k->i2 << ", " << it_k->i3 << ")" << std::endl;
-        if (it_k->i2) {  // Is is begin point.
-            // Find the closest seed j (in y-dimension) with an
-            // entry in L whose end coordinate is less or equal the begin position of k.
-            //
-            // STL gives us upper_bound which returns a pointer to the
-            // *first* one that compares greater than the reference
-            // one.  Searching for the this one and decrementing the
-            // result iterator gives the desired result.
-            TIntermediateSolution referenceSolution(beginPositionV(seed_k), std::numeric_limits<TSize>::max(), std::numeric_limits<unsigned>::max());
-            // std::cout << "    intermediateSolutions.upper_bound(" << beginPositionV(seed_k) << ")" << std::endl;
-            TIntermediateSolutionsIterator it_j = intermediateSolutions.upper_bound(referenceSolution);
-
-            // Special case not dealt with in the book: If L is empty or there is no chain
-            // that ends before k begins, simply continue with the next point in I.
-            if (intermediateSolutions.empty() || it_j == intermediateSolutions.begin())
-            {
+        if (it_k->i2)  // Is is begin point.
+        {
+            // Find the best chain j whose end coordinate is less or equal the begin position of k.
+            unsigned rank = std::upper_bound(begin(endRanks, Standard()), end(endRanks, Standard()),
+                                             beginPositionV(seed_k)) - begin(endRanks, Standard());
+            TEntry j = _query(tree, rank);
+            // If there is no chain that ends before k begins, simply continue with the next point in I.
+            if (j.i3 == NONE)
                 continue;
-            }
-            // Go to the last value in L, i.e. l_j <= h_k.
-            --it_j;
-            // std::cout << "     --> " << seeds[it_j->i3] << std::endl;
-            // Now, we have found such a seed j.
-            SEQAN_ASSERT_LEQ(endPositionV(seeds[it_j->i3]), beginPositionV(seed_k));
+            SEQAN_ASSERT_LEQ(endPositionV(seeds[j.i3]), beginPositionV(seed_k));
             // Update the intermediate solution value for k and set predecessor.
-            qualityOfChainEndingIn[it_k->i3] += it_j->i2;
-            // std::cout << "  UPDATE qualityOfChainEndingIn[" << it_k->i3 << "] == " << qualityOfChainEndingIn[it_k->i3] << std::endl;
-            predecessor[it_k->i3] = it_j->i3;
-            // std::cout << "         predecessor[" << it_k->i3 << "] == " << it_j->i3 << std::endl;
-        } else {  // Is end point.
-            // Search for the first triple j in L with l_j >= l_k.
-            // Or to put it in differently, find the first chain that ends
-            // left and below the chain that ends in k. These are other possible solutions,
-            // that either result in a better score or must be deleted as the score of the chain ending in k
-            // is bigger. Hence, every other seed that could connect to both j and k, prefers the one with the higher
-            // score.
-            //
-            // We can use the lower_bound, which gives the first triple j such that l_j >= l_k
+            qualityOfChainEndingIn[it_k->i3] += j.i1;
+            predecessor[it_k->i3] = j.i3;
+        }
+        else  // Is end point.
+        {
             SEQAN_ASSERT_GT(endPositionV(seed_k), 0u);
-            TIntermediateSolution referenceSolution(endPositionV(seed_k), 0, std::numeric_limits<unsigned>::max());
-            TIntermediateSolutionsIterator it_j = intermediateSolutions.lower_bound(referenceSolution);
-
-            if (!(it_j == intermediateSolutions.begin() || intermediateSolutions.empty())) // else, seed k is inserted anyway
-            {
-                --it_j;
-                SEQAN_ASSERT_LT(it_j->i1, endPositionV(seed_k));
-
-                // Found an intermediate solution.
-                // ... start a new chain at k if
-                // the score of the chain ending in k is bigger than the
-                // score of the chain ending in j. If not continue with for loop
-                if (qualityOfChainEndingIn[it_k->i3] <= it_j->i2)
-                    continue;
-            }
-
-            TIntermediateSolution sol(endPositionV(seed_k), qualityOfChainEndingIn[it_k->i3], it_k->i3);
-            // std::cout << "  INSERT (" << sol.i1 << ", " << sol.i2 << ", " << sol.i3 << ")" << __LINE__  << std::endl;
-            TIntermediateSolutionsIterator itDel = intermediateSolutions.insert(sol);
-
-            itDel++; // go to first entry in L after currently inserted triple
-            // Delete all intermediate solutions where end1 >= end1 of k and have a lower score than k
-            // to ensure that the invariant of V(j) >= V(j'), with j' <= j holds.
-            // Roughly then, there is no chain ending in a seed below the seed_k, that has a lower score
-            // than the chain ending in seed_k. Thus the last value in `intermediateSolutions` will
-            // always point to the optimal chain.
-            TIntermediateSolutionsIterator itDelEnd = intermediateSolutions.end();
-            while (itDel != itDelEnd)
-            {
-                TIntermediateSolutionsIterator ptr = itDel;
-                ++itDel;
-                if (qualityOfChainEndingIn[it_k->i3] > ptr->i2)
-                {
-                    // std::cout << "  ERASE (" << ptr->i1 << ", " << ptr->i2 << ", " << ptr->i3 << ")" << std::endl;
-                    intermediateSolutions.erase(ptr);
-                }
-                else
-                {
-                    // since intermediateSolutions are sorted ascending by
-                    // ptr->i2 (score) we can break on the first entry
-                    // which is >= qualityOfChainEndingIn[it_k->i3]
-                    break;
-                }
-            }
-            // Check if the invariant holds, that the scores in L are in a non-decreasing order.
-            SEQAN_ASSERT(_checkScoreInvariant(intermediateSolutions));
+            unsigned rank = std::lower_bound(begin(endRanks, Standard()), end(endRanks, Standard()),
+                                             endPositionV(seed_k)) - begin(endRanks, Standard()) + 1;
+            TEntry sol(qualityOfChainEndingIn[it_k->i3], order++, it_k->i3);
+            _update(tree, rank, sol);
+            if (TTree::better(sol, best))
+                best = sol;
         }
     }
 
-    // std::cout << "Maximal quality: " << intermediateSolutions.rbegin()->i2 << std::endl;
-
     // -----------------------------------------------------------------------
     // Step 3: Write out the resulting chain.
     // -----------------------------------------------------------------------
     // TODO(holtgrew): We could use two different algorithms for target containers that are strings and those that are lists.
-    clear(target);
-    unsigned next = intermediateSolutions.rbegin()->i3;
-    while (next != std::numeric_limits<unsigned>::max())
+    unsigned next = best.i3;
+    while (next != NONE)
     {
         appendValue(target, seeds[next]);
         next = predecessor[next];
@@ -32,12 +32,15 @@
 // Author: Manuel Holtgrewe <manuel.holtgrewe@fu-berlin.de>
 // ==========================================================================
 // The Unordered specialization of the class SeedSet.  Seeds are stored
-// in a string and not kept in a particular order.
+// in a flat string sorted by their begin diagonal.  Seeds added with Single
+// are appended to an unsorted tail that is merged into the sorted prefix on
+// the next access, so adding n seeds costs O(n log n) overall.
 // ==========================================================================
 
 #ifndef SEQAN_SEEDS_SEEDS_SEED_SET_UNORDERED_H_
 #define SEQAN_SEEDS_SEEDS_SEED_SET_UNORDERED_H_
 
+#include <algorithm>
 #include <cmath>
 
 namespace seqan2 {
@@ -62,14 +65,17 @@ public:
     typedef typename SeedScore<TSeed>::Type TScoreValue_;
     typedef typename Size<TSeed>::Type TSize_;
     typedef LessBeginDiagonal<TSeed> TSeedCmp_;
-    typedef std::multiset<TSeed, TSeedCmp_> TSet_;
+    typedef String<TSeed> TSet_;
+    typedef typename Size<TSet_>::Type TSetSize_;
 
-    TSet_ _seeds;
+    // Sorting is deferred to the first access, hence both members are mutable.
+    mutable TSet_ _seeds;
+    mutable TSetSize_ _sortedLength;    // length of the sorted prefix of _seeds
 
     TScoreValue_ _minScore;
     TSize_ _minSeedSize;
 
-    SeedSet() : _minScore(0), _minSeedSize(0)
+    SeedSet() : _sortedLength(0), _minScore(0), _minSeedSize(0)
     {}
 };
 
@@ -142,23 +148,47 @@ struct Reference<SeedSet<TSeed, Unordered> >
 template <typename TSeed>
 struct Iterator<SeedSet<TSeed, Unordered>, Standard>
 {
-    typedef SeedSet<TSeed, Unordered> TSeedSet_;
-    typedef typename TSeedSet_::TSet_ TMultiSet_;
-    typedef Iter<TMultiSet_, StdIteratorAdaptor> Type;
+    typedef typename SeedSet<TSeed, Unordered>::TSet_ TSet_;
+    typedef typename Iterator<TSet_, Standard>::Type Type;
 };
 
 template <typename TSeed>
 struct Iterator<SeedSet<TSeed, Unordered> const, Standard>
 {
-    typedef SeedSet<TSeed, Unordered> const TSeedSet_;
-    typedef typename TSeedSet_::TSet_ const TMultiSet_;
-    typedef Iter<TMultiSet_, StdIteratorAdaptor> Type;
+    typedef typename SeedSet<TSeed, Unordered>::TSet_ const TSet_;
+    typedef typename Iterator<TSet_, Standard>::Type Type;
 };
 
 // ===========================================================================
 // Functions
 // ===========================================================================
 
+// ---------------------------------------------------------------------------
+// Function _sortSeeds()
+// ---------------------------------------------------------------------------
+
+// Merge the unsorted tail into the sorted prefix.  Both steps are stable, so seeds with the same begin diagonal keep
+// their insertion order.
+
+template <typename TSeed>
+inline void
+_sortSeeds(SeedSet<TSeed, Unordered> const & seedSet)
+{
+    typedef typename SeedSet<TSeed, Unordered>::TSet_ TSet;
+    typedef typename Iterator<TSet, Standard>::Type TIter;
+
+    if (seedSet._sortedLength == length(seedSet._seeds))
+        return;
+
+    typename SeedSet<TSeed, Unordered>::TSeedCmp_ cmp;
+    TIter itBegin = begin(seedSet._seeds, Standard());
+    TIter itMid = itBegin + seedSet._sortedLength;
+    TIter itEnd = end(seedSet._seeds, Standard());
+    std::stable_sort(itMid, itEnd, cmp);
+    std::inplace_merge(itBegin, itMid, itEnd, cmp);
+    seedSet._sortedLength = length(seedSet._seeds);
+}
+
 // ---------------------------------------------------------------------------
 // Function length()
 // ---------------------------------------------------------------------------
@@ -169,14 +199,14 @@ template <typename TSeed>
 inline typename Size<SeedSet<TSeed, Unordered> >::Type
 length(SeedSet<TSeed, Unordered> & seedSet)
 {
-    return seedSet._seeds.size();
+    return length(seedSet._seeds);
 }
 
 template <typename TSeed>
 inline typename Size<SeedSet<TSeed, Unordered> const>::Type
 length(SeedSet<TSeed, Unordered> const & seedSet)
 {
-    return seedSet._seeds.size();
+    return length(seedSet._seeds);
 }
 
 // ---------------------------------------------------------------------------
@@ -187,14 +217,16 @@ template <typename TSeed>
 inline typename Iterator<SeedSet<TSeed, Unordered> >::Type
 begin(SeedSet<TSeed, Unordered> & seedSet, Standard const &)
 {
-    return seedSet._seeds.begin();
+    _sortSeeds(seedSet);
+    return begin(seedSet._seeds, Standard());
 }
 
 template <typename TSeed>
 inline typename Iterator<SeedSet<TSeed, Unordered> const>::Type
 begin(SeedSet<TSeed, Unordered> const & seedSet, Standard const &)
 {
-    return seedSet._seeds.begin();
+    _sortSeeds(seedSet);
+    return begin(seedSet._seeds, Standard());
 }
 
 // ---------------------------------------------------------------------------
@@ -205,14 +237,16 @@ template <typename TSeed>
 inline typename Iterator<SeedSet<TSeed, Unordered> >::Type
 end(SeedSet<TSeed, Unordered> & seedSet, Standard const &)
 {
-    return seedSet._seeds.end();
+    _sortSeeds(seedSet);
+    return end(seedSet._seeds, Standard());
 }
 
 template <typename TSeed>
 inline typename Iterator<SeedSet<TSeed, Unordered> const>::Type
 end(SeedSet<TSeed, Unordered> const & seedSet, Standard const &)
 {
-    return seedSet._seeds.end();
+    _sortSeeds(seedSet);
+    return end(seedSet._seeds, Standard());
 }
 
 // ---------------------------------------------------------------------------
@@ -223,14 +257,16 @@ template <typename TSeed>
 inline typename Reference<typename Iterator<SeedSet<TSeed, Unordered>, Standard>::Type >::Type
 front(SeedSet<TSeed, Unordered> & seedSet)
 {
-    return *seedSet._seeds.begin();
+    _sortSeeds(seedSet);
+    return front(seedSet._seeds);
 }
 
 template <typename TSeed>
 inline typename Reference<typename Iterator<SeedSet<TSeed, Unordered> const, Standard>::Type >::Type
 front(SeedSet<TSeed, Unordered> const & seedSet)
 {
-    return *seedSet._seeds.begin();
+    _sortSeeds(seedSet);
+    return front(seedSet._seeds);
 }
 
 // ---------------------------------------------------------------------------
@@ -241,14 +277,16 @@ template <typename TSeed>
 inline typename Reference<typename Iterator<SeedSet<TSeed, Unordered> , Standard>::Type >::Type
 back(SeedSet<TSeed, Unordered> & seedSet)
 {
-    return *seedSet._seeds.rbegin();
+    _sortSeeds(seedSet);
+    return back(seedSet._seeds);
 }
 
 template <typename TSeed>
 inline typename Reference<typename Iterator<SeedSet<TSeed, Unordered> const, Standard>::Type >::Type
 back(SeedSet<TSeed, Unordered> const & seedSet)
 {
-    return *seedSet._seeds.rbegin();
+    _sortSeeds(seedSet);
+    return back(seedSet._seeds);
 }
 
 // SeedSet Functions
@@ -276,7 +314,8 @@ _findSeedForCombination(
     // to be the left one.
     //
     // TODO(holtgrew): Search for *closest* overlapping one instead!
-    for (TSeedIter it = seedSet._seeds.begin(); it != seedSet._seeds.end(); ++it)
+    _sortSeeds(seedSet);
+    for (TSeedIter it = begin(seedSet._seeds, Standard()); it != end(seedSet._seeds, Standard()); ++it)
     {
         if (_seedsCombineable(*it, seed, maxDistance, bandwidth, tag))
         {
@@ -318,7 +357,7 @@ addSeed(SeedSet<TSeed, Unordered> & seedSet,
 
     typedef SeedSet<TSeed, Unordered> TSeedSet;
     typedef typename TSeedSet::TSet_ TSet;
-    typedef typename TSet::iterator TSeedIterator;
+    typedef typename Iterator<TSet, Standard>::Type TSeedIterator;
 
     // Try to find a seed for recombination.
     TSeedIterator it;
@@ -340,8 +379,12 @@ addSeed(SeedSet<TSeed, Unordered> & seedSet,
             _combineSeeds(left, *it, scoringScheme, sequence0, sequence1, tag);
         }
 
-        seedSet._seeds.erase(it);
-        seedSet._seeds.insert(left);
+        // The set is sorted after _findSeedForCombination(), reinsert behind the seeds with the same begin diagonal.
+        erase(seedSet._seeds, it - begin(seedSet._seeds, Standard()));
+        TSeedIterator itInsert = std::upper_bound(begin(seedSet._seeds, Standard()), end(seedSet._seeds, Standard()),
+                                                  left, typename TSeedSet::TSeedCmp_());
+        insertValue(seedSet._seeds, itInsert - begin(seedSet._seeds, Standard()), left);
+        seedSet._sortedLength = length(seedSet._seeds);
         return true;
     }
     return false;
@@ -375,10 +418,23 @@ addSeed(SeedSet<TSeed, Unordered> & seedSet,
         TSeed const & seed,
         Single const &)
 {
-    seedSet._seeds.insert(seed);
+    appendValue(seedSet._seeds, seed);
     return true;    // Always returns true.
 }
 
+// ---------------------------------------------------------------------------
+// Function clear()
+// ---------------------------------------------------------------------------
+
+template <typename TSeed>
+inline void clear(SeedSet<TSeed, Unordered> & seedSet)
+{
+    clear(seedSet._seeds);
+    seedSet._sortedLength = 0;
+    seedSet._minScore = 0;
+    seedSet._minSeedSize = 0;
+}
+
 }  // namespace seqan2
 
 #endif  // SEQAN_SEEDS_SEEDS_SEED_SET_UNORDERED_H_
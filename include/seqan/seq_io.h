@@ -71,5 +71,12 @@
 // ===========================================================================
 
 #include <seqan/seq_io/fai_index.h>
+#include <seqan/seq_io/fai_reference_cache.h>
+
+// ===========================================================================
+// Packed Reference
+// ===========================================================================
+
+#include <seqan/seq_io/packed_reference.h>
 
 #endif  // INCLUDE_SEQAN_SEQ_IO_H_
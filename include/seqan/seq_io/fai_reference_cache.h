@@ -0,0 +1,481 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Thread-safe random access to the regions of a FAI indexed FASTA file.
+//
+// The FASTA file is memory-mapped.  Regions that lie within one line are
+// served as views on the mapped file, all other requests are answered from
+// 2-bit packed blocks that are kept in a least-recently-used cache.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_SEQ_IO_FAI_REFERENCE_CACHE_H_
+#define INCLUDE_SEQAN_SEQ_IO_FAI_REFERENCE_CACHE_H_
+
+#include <exception>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Helper Class FaiReferenceBlock_
+// ----------------------------------------------------------------------------
+
+// A decoded block of a sequence, characters other than A, C, G, T are stored
+// as runs of N.
+
+struct FaiReferenceBlock_
+{
+    String<Dna, Packed<> >              seq;
+    String<Pair<uint32_t, uint32_t> >   nRuns;  // [begin, end) within the block
+};
+
+// ----------------------------------------------------------------------------
+// Class FaiReferenceCache
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class FaiReferenceCache
+ * @headerfile <seqan/seq_io.h>
+ * @brief Thread-safe cached access to the regions of a FASTA file with a @link FaiIndex @endlink.
+ *
+ * @signature class FaiReferenceCache;
+ *
+ * The FASTA file is memory-mapped.  Regions are decoded in blocks of <tt>blockSize</tt> bases which are stored 2-bit
+ * packed, the <tt>capacity</tt> most recently used blocks are kept.  All functions except <tt>open</tt> can be called
+ * concurrently from multiple threads on the same cache.  Sequence names are looked up in a table of the cache, not in
+ * the name store cache of the @link FaiIndex @endlink.  The @link FaiIndex @endlink must outlive the cache.
+ *
+ * @fn FaiReferenceCache::FaiReferenceCache
+ * @brief Constructor.
+ *
+ * @signature FaiReferenceCache::FaiReferenceCache();
+ */
+
+class FaiReferenceCache
+{
+public:
+    typedef String<char, MMap<> >                                               TFastaString;
+    typedef Infix<TFastaString const>::Type                                     TFastaInfix;
+    typedef ModifiedString<TFastaInfix, ModView<FunctorConvert<char, Dna5> > >  TRegionView;
+    typedef std::shared_ptr<FaiReferenceBlock_ const>                           TBlockPtr;
+    typedef std::list<std::pair<uint64_t, TBlockPtr> >                          TLruList;
+
+    FaiIndex const *    index;
+    TFastaString        fasta;
+
+    // Number of bases per block and maximal number of cached blocks.
+    uint32_t            blockSize;
+    uint32_t            capacity;
+
+    // Statistics, only for information.
+    uint64_t            hits;
+    uint64_t            misses;
+
+    std::mutex                                              _mutex;
+    TLruList                                                _lru;       // most recently used first
+    std::unordered_map<uint64_t, TLruList::iterator>        _blocks;
+    std::unordered_map<std::string, unsigned>               _ids;       // sequence ids by name, read-only after open()
+
+    FaiReferenceCache() :
+        index(NULL), blockSize(1u << 16), capacity(1024), hits(0), misses(0)
+    {}
+
+    FaiReferenceCache(FaiReferenceCache const &) = delete;
+    FaiReferenceCache & operator=(FaiReferenceCache const &) = delete;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FaiReferenceCache#open
+ * @brief Memory-map the FASTA file of a FaiIndex.
+ *
+ * @signature bool open(cache, faiIndex[, capacity[, blockSize]]);
+ *
+ * @param[out] cache     The FaiReferenceCache to open.
+ * @param[in]  faiIndex  The opened @link FaiIndex @endlink.
+ * @param[in]  capacity  The maximal number of cached blocks, defaults to 1024.
+ * @param[in]  blockSize The number of bases per block, defaults to 65536.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise.
+ */
+
+inline bool
+open(FaiReferenceCache & cache, FaiIndex const & index, uint32_t capacity = 1024, uint32_t blockSize = 1u << 16)
+{
+    std::lock_guard<std::mutex> lock(cache._mutex);
+    cache._lru.clear();
+    cache._blocks.clear();
+    cache.hits = cache.misses = 0;
+    cache.index = &index;
+    cache.capacity = std::max(capacity, 1u);
+    cache.blockSize = std::max(blockSize, 1u);
+    cache._ids.clear();
+    for (unsigned rID = 0; rID < length(index.seqNameStore); ++rID)
+        cache._ids.emplace(std::string(begin(index.seqNameStore[rID], Standard()),
+                                       end(index.seqNameStore[rID], Standard())), rID);
+    close(cache.fasta);
+    return open(cache.fasta, toCString(index.fastaFilename), OPEN_RDONLY);
+}
+
+// ----------------------------------------------------------------------------
+// Function _faiIdByName()
+// ----------------------------------------------------------------------------
+
+// Looks up the id of a sequence by its name.  Unlike getIdByName() for the
+// FaiIndex, this does not modify anything and is safe to call concurrently.
+
+template <typename TName>
+inline bool
+_faiIdByName(int & rID, FaiReferenceCache const & cache, TName const & name)
+{
+    auto it = cache._ids.find(std::string(begin(name, Standard()), end(name, Standard())));
+    if (it == cache._ids.end())
+        return false;
+    rID = it->second;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _faiFileOffset()
+// ----------------------------------------------------------------------------
+
+// Position of the pos-th character of a sequence in the FASTA file.
+
+inline uint64_t
+_faiFileOffset(FaiIndexEntry_ const & entry, uint64_t pos)
+{
+    return entry.offset + (pos / entry.lineLength) * entry.overallLineLength + pos % entry.lineLength;
+}
+
+// ----------------------------------------------------------------------------
+// Function _faiDecodeBlock()
+// ----------------------------------------------------------------------------
+
+inline void
+_faiDecodeBlock(FaiReferenceBlock_ & block, FaiReferenceCache const & cache, unsigned rID, uint64_t blockId)
+{
+    typedef Iterator<FaiReferenceCache::TFastaString const, Standard>::Type TIter;
+
+    FaiIndexEntry_ const & entry = cache.index->indexEntryStore[rID];
+    uint64_t beginPos = blockId * cache.blockSize;
+    uint64_t endPos = std::min(beginPos + cache.blockSize, (uint64_t)entry.sequenceLength);
+    uint32_t n = endPos - beginPos;
+
+    resize(block.seq, n, Exact());
+    clear(block.nRuns);
+
+    TIter fastaBegin = begin(cache.fasta, Standard());
+    uint64_t fastaLength = length(cache.fasta);
+    uint32_t i = 0;
+    while (i < n)
+    {
+        // Copy the rest of the current line.
+        uint64_t pos = beginPos + i;
+        uint64_t offset = _faiFileOffset(entry, pos);
+        uint32_t lineRest = std::min((uint64_t)(entry.lineLength - pos % entry.lineLength), (uint64_t)(n - i));
+        if (offset + lineRest > fastaLength)
+            SEQAN_THROW(UnexpectedEnd());
+
+        TIter it = fastaBegin + offset;
+        for (uint32_t k = 0; k < lineRest; ++k, ++i, ++it)
+        {
+            Dna5 c = *it;
+            if (ordValue(c) < 4)
+            {
+                assignValue(block.seq, i, Dna(c));
+                continue;
+            }
+            assignValue(block.seq, i, Dna('A'));
+            if (!empty(block.nRuns) && back(block.nRuns).i2 == i)
+                ++back(block.nRuns).i2;
+            else
+                appendValue(block.nRuns, Pair<uint32_t, uint32_t>(i, i + 1));
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _faiGetBlock()
+// ----------------------------------------------------------------------------
+
+// Returns a cached block or decodes it.  The lock is not held while decoding,
+// so that different blocks are decoded in parallel.
+
+inline FaiReferenceCache::TBlockPtr
+_faiGetBlock(FaiReferenceCache & cache, unsigned rID, uint64_t blockId)
+{
+    uint64_t key = ((uint64_t)rID << 40) | blockId;
+    {
+        std::lock_guard<std::mutex> lock(cache._mutex);
+        auto it = cache._blocks.find(key);
+        if (it != cache._blocks.end())
+        {
+            ++cache.hits;
+            cache._lru.splice(cache._lru.begin(), cache._lru, it->second);
+            return it->second->second;
+        }
+        ++cache.misses;
+    }
+
+    std::shared_ptr<FaiReferenceBlock_> block = std::make_shared<FaiReferenceBlock_>();
+    _faiDecodeBlock(*block, cache, rID, blockId);
+
+    std::lock_guard<std::mutex> lock(cache._mutex);
+    auto it = cache._blocks.find(key);
+    if (it != cache._blocks.end())  // decoded concurrently by another thread
+        return it->second->second;
+    cache._lru.emplace_front(key, block);
+    cache._blocks[key] = cache._lru.begin();
+    while (cache._lru.size() > cache.capacity)
+    {
+        cache._blocks.erase(cache._lru.back().first);
+        cache._lru.pop_back();
+    }
+    return block;
+}
+
+// ----------------------------------------------------------------------------
+// Function readRegion()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FaiReferenceCache#readRegion
+ * @brief Read a region through a FaiReferenceCache.
+ *
+ * @signature void readRegion(str, cache, rID, beginPos, endPos);
+ * @signature bool readRegion(str, cache, region);
+ *
+ * @param[out]    str      The @link String @endlink to read the sequence into.  Characters other than A, C, G, T
+ *                         are read as N.
+ * @param[in,out] cache    The FaiReferenceCache to read from.
+ * @param[in]     rID      The id of the sequence to read (Type: <tt>unsigned</tt>).
+ * @param[in]     beginPos The begin position of the region to read (Type: <tt>uint64_t</tt>).
+ * @param[in]     endPos   The end position of the region to read, it is clipped to the sequence length.
+ * @param[in]     region   The @link GenomicRegion @endlink to read.
+ *
+ * @return bool <tt>false</tt> if the sequence of the region is unknown, <tt>true</tt> otherwise.
+ */
+
+template <typename TValue, typename TSpec>
+inline void
+readRegion(String<TValue, TSpec> & str,
+           FaiReferenceCache & cache,
+           unsigned rID,
+           uint64_t beginPos,
+           uint64_t endPos)
+{
+    typedef typename Iterator<String<TValue, TSpec>, Standard>::Type TTargetIter;
+    typedef Iterator<String<Dna, Packed<> > const, Standard>::Type   TBlockIter;
+
+    uint64_t seqLen = cache.index->indexEntryStore[rID].sequenceLength;
+    beginPos = std::min(beginPos, seqLen);
+    endPos = std::min(std::max(beginPos, endPos), seqLen);
+
+    clear(str);
+    resize(str, endPos - beginPos, Exact());
+    TTargetIter target = begin(str, Standard());
+
+    for (uint64_t pos = beginPos; pos < endPos;)
+    {
+        uint64_t blockId = pos / cache.blockSize;
+        FaiReferenceCache::TBlockPtr block = _faiGetBlock(cache, rID, blockId);
+        uint32_t blockBegin = pos - blockId * cache.blockSize;
+        uint32_t blockEnd = std::min((uint64_t)length(block->seq), endPos - blockId * cache.blockSize);
+
+        TBlockIter it = begin(block->seq, Standard()) + blockBegin;
+        TBlockIter itEnd = begin(block->seq, Standard()) + blockEnd;
+        TTargetIter blockTarget = target;
+        for (; it != itEnd; ++it, ++target)
+            *target = *it;
+
+        for (unsigned i = 0; i < length(block->nRuns); ++i)
+        {
+            Pair<uint32_t, uint32_t> const & run = block->nRuns[i];
+            for (uint32_t j = std::max(run.i1, blockBegin); j < std::min(run.i2, blockEnd); ++j)
+                *(blockTarget + (j - blockBegin)) = Dna5('N');
+        }
+        pos += blockEnd - blockBegin;
+    }
+}
+
+template <typename TValue, typename TSpec>
+inline bool
+readRegion(String<TValue, TSpec> & str,
+           FaiReferenceCache & cache,
+           GenomicRegion const & region)
+{
+    int rID = region.rID;
+    if (rID == GenomicRegion::INVALID_ID)
+        if (!_faiIdByName(rID, cache, region.seqName))
+            return false;  // Sequence with this name could not be found.
+
+    uint64_t beginPos = (region.beginPos != GenomicRegion::INVALID_POS) ? region.beginPos : 0;
+    uint64_t endPos = (region.endPos != GenomicRegion::INVALID_POS) ? region.endPos : sequenceLength(*cache.index, rID);
+    readRegion(str, cache, rID, beginPos, endPos);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function readRegions()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FaiReferenceCache#readRegions
+ * @brief Read many regions through a FaiReferenceCache in parallel.
+ *
+ * @signature bool readRegions(strs, cache, regions);
+ *
+ * @param[out]    strs    A @link StringSet @endlink, the i-th string is the sequence of the i-th region.
+ * @param[in,out] cache   The FaiReferenceCache to read from.
+ * @param[in]     regions A @link String @endlink of @link GenomicRegion @endlink objects.
+ *
+ * @return bool <tt>false</tt> if the sequence of any region is unknown, its string is empty then.
+ *
+ * The regions are processed in the order of their positions so that overlapping and neighbouring regions share the
+ * decoded blocks.  OpenMP is used if it is available.  If a region cannot be read, e.g. because the FASTA file is
+ * truncated, the exception of the first such region in the input order is rethrown after all regions were processed.
+ */
+
+template <typename TString, typename TSetSpec, typename TRegions>
+inline bool
+readRegions(StringSet<TString, TSetSpec> & strs,
+            FaiReferenceCache & cache,
+            TRegions const & regions)
+{
+    typedef Pair<Pair<int64_t, int64_t>, int64_t> TOrderKey;  // ((rID, beginPos), idx)
+
+    int64_t n = length(regions);
+    clear(strs);
+    resize(strs, n);
+
+    bool success = true;
+    String<TOrderKey> order;
+    resize(order, n, Exact());
+    for (int64_t i = 0; i < n; ++i)
+    {
+        int rID = regions[i].rID;
+        if (rID == GenomicRegion::INVALID_ID && !_faiIdByName(rID, cache, regions[i].seqName))
+        {
+            rID = -1;
+            success = false;
+        }
+        order[i] = TOrderKey(Pair<int64_t, int64_t>(rID, std::max(regions[i].beginPos, 0)), i);
+    }
+    std::sort(begin(order, Standard()), end(order, Standard()));
+
+    // Read in parallel, exceptions are passed to the calling thread.
+    std::vector<std::exception_ptr> errors(n);
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 16))
+    for (int64_t i = 0; i < n; ++i)
+    {
+        if (order[i].i1.i1 < 0)
+            continue;
+        GenomicRegion const & region = regions[order[i].i2];
+        uint64_t endPos = (region.endPos != GenomicRegion::INVALID_POS) ? region.endPos
+                                                                         : sequenceLength(*cache.index, order[i].i1.i1);
+        try
+        {
+            readRegion(strs[order[i].i2], cache, order[i].i1.i1, order[i].i1.i2, endPos);
+        }
+        catch (...)
+        {
+            errors[order[i].i2] = std::current_exception();
+        }
+    }
+    for (int64_t i = 0; i < n; ++i)
+        if (errors[i])
+            std::rethrow_exception(errors[i]);
+    return success;
+}
+
+// ----------------------------------------------------------------------------
+// Function regionView()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FaiReferenceCache#regionView
+ * @brief Get a region as a view on the memory-mapped FASTA file, without copying.
+ *
+ * @signature bool regionView(view, cache, rID, beginPos, endPos);
+ *
+ * @param[out] view     A <tt>FaiReferenceCache::TRegionView</tt>, a @link ModifiedString @endlink that converts the
+ *                      characters of the file to @link Dna5 @endlink on access.
+ * @param[in]  cache    The FaiReferenceCache to read from.
+ * @param[in]  rID      The id of the sequence (Type: <tt>unsigned</tt>).
+ * @param[in]  beginPos The begin position of the region (Type: <tt>uint64_t</tt>).
+ * @param[in]  endPos   The end position of the region, it is clipped to the sequence length.
+ *
+ * @return bool <tt>true</tt> if the region lies within one line of the file, e.g. always for single-line FASTA
+ *              files.  Otherwise, the view is not set and @link FaiReferenceCache#readRegion @endlink must be used.
+ *
+ * The view is valid as long as the cache is open.
+ */
+
+inline bool
+regionView(FaiReferenceCache::TRegionView & view,
+           FaiReferenceCache const & cache,
+           unsigned rID,
+           uint64_t beginPos,
+           uint64_t endPos)
+{
+    FaiIndexEntry_ const & entry = cache.index->indexEntryStore[rID];
+    beginPos = std::min(beginPos, (uint64_t)entry.sequenceLength);
+    endPos = std::min(std::max(beginPos, endPos), (uint64_t)entry.sequenceLength);
+    if (beginPos != endPos && beginPos / entry.lineLength != (endPos - 1) / entry.lineLength)
+        return false;
+
+    uint64_t offset = _faiFileOffset(entry, beginPos);
+    if (offset + (endPos - beginPos) > length(cache.fasta))
+        return false;
+    view = FaiReferenceCache::TRegionView(infix(cache.fasta, offset, offset + (endPos - beginPos)));
+    return true;
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_SEQ_IO_FAI_REFERENCE_CACHE_H_
@@ -0,0 +1,582 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// A 2-bit packed container of reference sequences that can be stored on disk
+// and memory-mapped.
+//
+// The sequences are kept in one concatenated 2-bit packed string.  Characters
+// other than A, C, G, T are stored as A and recorded as runs of N in the
+// coordinates of the concatenation.  A reference with the prefix "ref" is
+// stored in the files
+//
+//   ref.seq   host words of the concatenation, as String<Dna, Packed<> >
+//   ref.lim   begin positions of the sequences and the total length (uint64_t)
+//   ref.nrn   [begin, end) pairs of the N runs (uint64_t)
+//   ref.rid   one sequence name per line
+//
+// The binary files are in the byte order of the machine.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_SEQ_IO_PACKED_REFERENCE_H_
+#define INCLUDE_SEQAN_SEQ_IO_PACKED_REFERENCE_H_
+
+#include <fstream>
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class PackedReference
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class PackedReference
+ * @headerfile <seqan/seq_io.h>
+ * @brief A 2-bit packed container of reference sequences with a fast-loading file format.
+ *
+ * @signature template <[typename TSpec]>
+ *            class PackedReference;
+ *
+ * @tparam TSpec The specialization of the host of the packed sequences, defaults to <tt>Alloc&lt;&gt;</tt>.  Use
+ *               <tt>MMap&lt;&gt;</tt> to map the sequences of a saved reference into memory instead of reading them.
+ *
+ * The sequences are stored in <tt>seqs</tt>, a @link ConcatDirectStringSet @endlink of 2-bit packed @link Dna @endlink
+ * strings, so <tt>seqs[rID]</tt> gives constant-time random access to the bases.  Characters other than A, C, G, T
+ * appear as A in <tt>seqs</tt> and are recorded as runs of N; use @link PackedReference#readRegion @endlink to get
+ * the @link Dna5 @endlink sequence.
+ *
+ * @code{.cpp}
+ * PackedReference<> ref;
+ * build(ref, "genome.fa");
+ * save(ref, "genome");
+ *
+ * PackedReference<MMap<> > mapped;
+ * open(mapped, "genome");
+ * Dna5String str;
+ * readRegion(str, mapped, 0, 1000, 2000);
+ * @endcode
+ *
+ * @var TSeqs PackedReference::seqs;
+ * @brief The 2-bit packed sequences.
+ *
+ * @var TNames PackedReference::names;
+ * @brief The sequence names.
+ *
+ * @var TNRuns PackedReference::nRuns;
+ * @brief The sorted, disjoint <tt>[begin, end)</tt> runs of N in the coordinates of <tt>concat(seqs)</tt>.
+ */
+
+template <typename TSpec = Alloc<> >
+class PackedReference
+{
+public:
+    typedef String<Dna, Packed<TSpec> >                     TSeq;
+    typedef StringSet<TSeq, Owner<ConcatDirect<> > >        TSeqs;
+    typedef StringSet<CharString, Owner<ConcatDirect<> > >  TNames;
+    typedef String<Pair<uint64_t, uint64_t> >               TNRuns;
+
+    TSeqs   seqs;
+    TNames  names;
+    TNRuns  nRuns;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _packedReferenceRelease()
+// ----------------------------------------------------------------------------
+
+// Memory-mapped sequences are closed instead of cleared, clear() would
+// truncate the file.
+
+template <typename TValue, typename TStrSpec>
+inline void
+_packedReferenceRelease(String<TValue, TStrSpec> & str)
+{
+    clear(str);
+}
+
+template <typename TValue, typename TConfig>
+inline void
+_packedReferenceRelease(String<TValue, MMap<TConfig> > & str)
+{
+    close(str);
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+template <typename TSpec>
+inline void
+clear(PackedReference<TSpec> & ref)
+{
+    _packedReferenceRelease(host(ref.seqs.concat));
+    resize(ref.seqs.limits, 1, Exact());
+    front(ref.seqs.limits) = 0;
+    clear(ref.names);
+    clear(ref.nRuns);
+}
+
+// ----------------------------------------------------------------------------
+// Function numSeqs()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn PackedReference#numSeqs
+ * @brief Return the number of sequences.
+ *
+ * @signature uint64_t numSeqs(ref);
+ *
+ * @param[in] ref The PackedReference to query.
+ *
+ * @return uint64_t The number of sequences.
+ */
+
+template <typename TSpec>
+inline uint64_t
+numSeqs(PackedReference<TSpec> const & ref)
+{
+    return length(ref.seqs);
+}
+
+// ----------------------------------------------------------------------------
+// Function sequenceLength()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn PackedReference#sequenceLength
+ * @brief Return the length of a sequence.
+ *
+ * @signature uint64_t sequenceLength(ref, rID);
+ *
+ * @param[in] ref The PackedReference to query.
+ * @param[in] rID The id of the sequence (Type: <tt>unsigned</tt>).
+ *
+ * @return uint64_t The length of the sequence.
+ */
+
+template <typename TSpec, typename TSeqId>
+inline uint64_t
+sequenceLength(PackedReference<TSpec> const & ref, TSeqId rID)
+{
+    return ref.seqs.limits[rID + 1] - ref.seqs.limits[rID];
+}
+
+// The non-const overload is needed to disambiguate from sequenceLength(seqNo, text) in string_set_base.h.
+
+template <typename TSpec, typename TSeqId>
+inline uint64_t
+sequenceLength(PackedReference<TSpec> & ref, TSeqId rID)
+{
+    return ref.seqs.limits[rID + 1] - ref.seqs.limits[rID];
+}
+
+// ----------------------------------------------------------------------------
+// Function sequenceName()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn PackedReference#sequenceName
+ * @brief Return the name of a sequence.
+ *
+ * @signature TName sequenceName(ref, rID);
+ *
+ * @param[in] ref The PackedReference to query.
+ * @param[in] rID The id of the sequence (Type: <tt>unsigned</tt>).
+ *
+ * @return TName An infix of <tt>ref.names</tt> with the name of the sequence.
+ */
+
+template <typename TSpec>
+inline typename Value<typename PackedReference<TSpec>::TNames const>::Type
+sequenceName(PackedReference<TSpec> const & ref, unsigned rID)
+{
+    return ref.names[rID];
+}
+
+// ----------------------------------------------------------------------------
+// Function getIdByName()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn PackedReference#getIdByName
+ * @brief Return the id of a sequence by its name.
+ *
+ * @signature bool getIdByName(rID, ref, name);
+ *
+ * @param[out] rID  The id of the sequence.
+ * @param[in]  ref  The PackedReference to query.
+ * @param[in]  name The name of the sequence.
+ *
+ * @return bool <tt>true</tt> if a sequence with this name exists, <tt>false</tt> otherwise.
+ *
+ * The names are searched linearly, use a @link NameStoreCache @endlink on <tt>ref.names</tt> for many queries.
+ */
+
+template <typename TId, typename TSpec, typename TName>
+inline bool
+getIdByName(TId & rID, PackedReference<TSpec> const & ref, TName const & name)
+{
+    for (uint64_t i = 0; i < length(ref.names); ++i)
+        if (ref.names[i] == name)
+        {
+            rID = i;
+            return true;
+        }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Function appendSequence()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn PackedReference#appendSequence
+ * @brief Append a sequence to a PackedReference.
+ *
+ * @signature void appendSequence(ref, name, seq);
+ *
+ * @param[in,out] ref  The PackedReference to append to.
+ * @param[in]     name The name of the sequence.
+ * @param[in]     seq  The sequence.  Characters that do not convert to A, C, G, or T are stored as N.
+ */
+
+template <typename TSpec, typename TName, typename TSequence>
+inline void
+appendSequence(PackedReference<TSpec> & ref, TName const & name, TSequence const & seq)
+{
+    typedef typename PackedReference<TSpec>::TSeq               TSeq;
+    typedef typename Iterator<TSeq, Standard>::Type             TTargetIter;
+    typedef typename Iterator<TSequence const, Standard>::Type  TSourceIter;
+
+    uint64_t offset = length(ref.seqs.concat);
+    resize(ref.seqs.concat, offset + length(seq));
+    TTargetIter target = begin(ref.seqs.concat, Standard()) + offset;
+
+    uint64_t pos = offset;
+    for (TSourceIter it = begin(seq, Standard()); it != end(seq, Standard()); ++it, ++target, ++pos)
+    {
+        Dna5 c = *it;
+        if (ordValue(c) < 4)
+        {
+            *target = Dna(c);
+            continue;
+        }
+        *target = Dna('A');
+        if (!empty(ref.nRuns) && back(ref.nRuns).i2 == pos)
+            ++back(ref.nRuns).i2;
+        else
+            appendValue(ref.nRuns, Pair<uint64_t, uint64_t>(pos, pos + 1));
+    }
+    appendValue(ref.seqs.limits, length(ref.seqs.concat));
+    appendValue(ref.names, name);
+}
+
+// ----------------------------------------------------------------------------
+// Function build()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn PackedReference#build
+ * @brief Build a PackedReference from a sequence file.
+ *
+ * @signature bool build(ref, fileName);
+ *
+ * @param[out] ref      The PackedReference to build.
+ * @param[in]  fileName The path to a file that can be read with a @link SeqFileIn @endlink, e.g. a FASTA file
+ *                      (Type: <tt>char const *</tt>).
+ *
+ * @return bool <tt>false</tt> if the file could not be opened, <tt>true</tt> otherwise.
+ *
+ * The names are cropped at the first whitespace.  The records are read one at a time, so only the packed reference
+ * and the current sequence are held in memory.
+ *
+ * @throw ParseError if the file could not be parsed.
+ */
+
+template <typename TSpec>
+inline bool
+build(PackedReference<TSpec> & ref, char const * fileName)
+{
+    SeqFileIn file;
+    if (!open(file, fileName))
+        return false;
+
+    clear(ref);
+    CharString id, seq;
+    while (!atEnd(file))
+    {
+        readRecord(id, seq, file);
+        cropAfterFirst(id, IsWhitespace());
+        appendSequence(ref, id, seq);
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function readRegion()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn PackedReference#readRegion
+ * @brief Read a region of a PackedReference, including its runs of N.
+ *
+ * @signature void readRegion(str, ref, rID, beginPos, endPos);
+ * @signature bool readRegion(str, ref, region);
+ *
+ * @param[out] str      The @link String @endlink to read the sequence into.
+ * @param[in]  ref      The PackedReference to read from.
+ * @param[in]  rID      The id of the sequence to read (Type: <tt>unsigned</tt>).
+ * @param[in]  beginPos The begin position of the region to read (Type: <tt>uint64_t</tt>).
+ * @param[in]  endPos   The end position of the region to read, it is clipped to the sequence length.
+ * @param[in]  region   The @link GenomicRegion @endlink to read.
+ *
+ * @return bool <tt>false</tt> if the sequence of the region is unknown, <tt>true</tt> otherwise.
+ */
+
+template <typename TValue, typename TStrSpec, typename TSpec>
+inline void
+readRegion(String<TValue, TStrSpec> & str,
+           PackedReference<TSpec> const & ref,
+           unsigned rID,
+           uint64_t beginPos,
+           uint64_t endPos)
+{
+    typedef typename PackedReference<TSpec>::TNRuns                 TNRuns;
+    typedef typename Iterator<TNRuns const, Standard>::Type         TRunIter;
+    typedef typename Iterator<String<TValue, TStrSpec>, Standard>::Type TTargetIter;
+
+    uint64_t seqLen = sequenceLength(ref, rID);
+    beginPos = std::min(beginPos, seqLen);
+    endPos = std::min(std::max(beginPos, endPos), seqLen);
+
+    uint64_t offset = ref.seqs.limits[rID];
+    assign(str, infix(ref.seqs.concat, offset + beginPos, offset + endPos));
+
+    // Overwrite the runs of N that overlap [beginPos, endPos).
+    beginPos += offset;
+    endPos += offset;
+    TRunIter it = std::upper_bound(begin(ref.nRuns, Standard()), end(ref.nRuns, Standard()), beginPos,
+                                   [](uint64_t pos, Pair<uint64_t, uint64_t> const & run) { return pos < run.i2; });
+    TTargetIter target = begin(str, Standard());
+    for (; it != end(ref.nRuns, Standard()) && it->i1 < endPos; ++it)
+        for (uint64_t pos = std::max(it->i1, beginPos); pos < std::min(it->i2, endPos); ++pos)
+            *(target + (pos - beginPos)) = Dna5('N');
+}
+
+template <typename TValue, typename TStrSpec, typename TSpec>
+inline bool
+readRegion(String<TValue, TStrSpec> & str,
+           PackedReference<TSpec> const & ref,
+           GenomicRegion const & region)
+{
+    int rID = region.rID;
+    if (rID == GenomicRegion::INVALID_ID)
+        if (!getIdByName(rID, ref, region.seqName))
+            return false;  // Sequence with this name could not be found.
+
+    uint64_t beginPos = (region.beginPos != GenomicRegion::INVALID_POS) ? region.beginPos : 0;
+    uint64_t endPos = (region.endPos != GenomicRegion::INVALID_POS) ? region.endPos : sequenceLength(ref, rID);
+    readRegion(str, ref, rID, beginPos, endPos);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _packedReferenceSave()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TStrSpec>
+inline bool
+_packedReferenceSave(String<TValue, TStrSpec> const & str, CharString const & fileName)
+{
+    File<> file;
+    if (!open(file, toCString(fileName), OPEN_WRONLY | OPEN_CREATE))
+        return false;
+    bool success = empty(str) || write(file, begin(str, Standard()), length(str));
+    close(file);
+    return success;
+}
+
+// ----------------------------------------------------------------------------
+// Function _packedReferenceLoad()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TStrSpec>
+inline bool
+_packedReferenceLoad(String<TValue, TStrSpec> & str, CharString const & fileName, int /*openMode*/)
+{
+    File<> file;
+    if (!open(file, toCString(fileName), OPEN_RDONLY | OPEN_QUIET))
+        return false;
+    resize(str, (uint64_t)length(file) / sizeof(TValue), Exact());
+    bool success = empty(str) || read(file, begin(str, Standard()), length(str));
+    close(file);
+    return success;
+}
+
+template <typename TValue, typename TConfig>
+inline bool
+_packedReferenceLoad(String<TValue, MMap<TConfig> > & str, CharString const & fileName, int openMode)
+{
+    return open(str, toCString(fileName), openMode | OPEN_QUIET);
+}
+
+// ----------------------------------------------------------------------------
+// Function save()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn PackedReference#save
+ * @brief Save a PackedReference to disk.
+ *
+ * @signature bool save(ref, prefix);
+ *
+ * @param[in] ref    The PackedReference to save.
+ * @param[in] prefix The common prefix of the files to write (Type: <tt>char const *</tt>).
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise.
+ *
+ * The files <tt>prefix.seq</tt>, <tt>prefix.lim</tt>, <tt>prefix.nrn</tt>, and <tt>prefix.rid</tt> are written.
+ */
+
+template <typename TSpec>
+inline bool
+save(PackedReference<TSpec> const & ref, char const * prefix)
+{
+    typedef typename PackedReference<TSpec>::TSeq TSeq;
+
+    CharString name = prefix;
+    append(name, ".seq");
+    _clearUnusedBits(const_cast<TSeq &>(ref.seqs.concat));
+    if (!_packedReferenceSave(host(ref.seqs.concat), name))
+        return false;
+
+    String<uint64_t> limits;
+    assign(limits, ref.seqs.limits);
+    name = prefix;
+    append(name, ".lim");
+    if (!_packedReferenceSave(limits, name))
+        return false;
+
+    name = prefix;
+    append(name, ".nrn");
+    if (!_packedReferenceSave(ref.nRuns, name))
+        return false;
+
+    name = prefix;
+    append(name, ".rid");
+    std::ofstream ridFile(toCString(name), std::ios::binary);
+    for (uint64_t i = 0; i < length(ref.names); ++i)
+        ridFile << ref.names[i] << '\n';
+    return ridFile.good();
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn PackedReference#open
+ * @brief Open a PackedReference that was saved with @link PackedReference#save @endlink.
+ *
+ * @signature bool open(ref, prefix[, openMode]);
+ *
+ * @param[out] ref      The PackedReference to open.
+ * @param[in]  prefix   The common prefix of the files to read (Type: <tt>char const *</tt>).
+ * @param[in]  openMode The open mode of the memory-mapped sequences, defaults to <tt>OPEN_RDONLY</tt>.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> if a file could not be read or the files are inconsistent.
+ *
+ * With <tt>TSpec</tt> <tt>MMap&lt;&gt;</tt>, the packed sequences are mapped into memory instead of being read, the
+ * other files are small and always read.
+ */
+
+template <typename TSpec>
+inline bool
+open(PackedReference<TSpec> & ref, char const * prefix, int openMode)
+{
+    typedef typename PackedReference<TSpec>::TNRuns TNRuns;
+
+    clear(ref);
+    CharString name = prefix;
+    append(name, ".seq");
+    bool success = _packedReferenceLoad(host(ref.seqs.concat), name, openMode);
+
+    String<uint64_t> limits;
+    name = prefix;
+    append(name, ".lim");
+    success = success && _packedReferenceLoad(limits, name, OPEN_RDONLY);
+    name = prefix;
+    append(name, ".nrn");
+    success = success && _packedReferenceLoad(ref.nRuns, name, OPEN_RDONLY);
+
+    name = prefix;
+    append(name, ".rid");
+    std::ifstream ridFile(toCString(name), std::ios::binary);
+    std::string line;
+    while (success && std::getline(ridFile, line))
+        appendValue(ref.names, line);
+
+    // Check that the files belong together.
+    uint64_t totalLength = empty(host(ref.seqs.concat)) ? 0 : length(ref.seqs.concat);
+    success = success && ridFile.eof() && !empty(limits) && front(limits) == 0 && back(limits) == totalLength &&
+              length(ref.names) + 1 == length(limits);
+    for (uint64_t i = 1; success && i < length(limits); ++i)
+        success = limits[i - 1] <= limits[i];
+    for (typename Iterator<TNRuns, Standard>::Type it = begin(ref.nRuns, Standard());
+         success && it != end(ref.nRuns, Standard()); ++it)
+        success = it->i1 < it->i2 && it->i2 <= totalLength &&
+                  (it == begin(ref.nRuns, Standard()) || (it - 1)->i2 <= it->i1);
+    if (!success)
+    {
+        clear(ref);
+        return false;
+    }
+    assign(ref.seqs.limits, limits);
+    return true;
+}
+
+template <typename TSpec>
+inline bool
+open(PackedReference<TSpec> & ref, char const * prefix)
+{
+    return open(ref, prefix, OPEN_RDONLY);
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_SEQ_IO_PACKED_REFERENCE_H_
@@ -425,6 +425,19 @@ inline
 void
 _initJournaledStringIteratorEnd(Iter<TJournaledString, JournaledStringIterSpec<TJournalSpec> > & iterator)
 {
+    // An empty string has no segment, begin and end both point behind the journal.
+    if (empty(iterator._journalStringPtr->_journalEntries))
+    {
+        iterator._journalEntriesIterator = begin(iterator._journalStringPtr->_journalEntries, Standard());
+        iterator._hostSegmentBegin = begin(host(*iterator._journalStringPtr), Standard());
+        iterator._hostSegmentEnd = iterator._hostSegmentBegin;
+        iterator._currentHostIt = iterator._hostSegmentBegin;
+        iterator._insertionBufferSegmentBegin = begin(iterator._journalStringPtr->_insertionBuffer, Standard());
+        iterator._insertionBufferSegmentEnd = iterator._insertionBufferSegmentBegin;
+        iterator._currentInsertionBufferIt = iterator._insertionBufferSegmentBegin;
+        return;
+    }
+
     iterator._journalEntriesIterator = end(iterator._journalStringPtr->_journalEntries, Standard()) - 1;
     _updateSegmentIteratorsLeft(iterator);
     if (value(iterator._journalEntriesIterator).segmentSource == SOURCE_PATCH)
@@ -1120,6 +1133,8 @@ operator==(Iter<TJournaledString, JournaledStringIterSpec<TJournalSpec> > const
 {
     if (a._journalEntriesIterator != b._journalEntriesIterator)
         return false;
+    if (atEnd(a._journalEntriesIterator, _journalEntries(container(a))))  // Only for empty strings.
+        return true;
     if (value(a._journalEntriesIterator).segmentSource == SOURCE_ORIGINAL) {
         if (a._currentHostIt != b._currentHostIt)
             return false;
@@ -117,6 +117,16 @@ inline
 void
 _initJournaledStringIteratorEnd(Iter<TJournaledString, JournaledStringIterSpec<CommonSegmentIterator> > & iterator)
 {
+    // An empty string has no segment, begin and end both point behind the journal.
+    if (empty(iterator._journalStringPtr->_journalEntries))
+    {
+        iterator._journalEntriesIterator = begin(iterator._journalStringPtr->_journalEntries, Standard());
+        iterator._segmentBegin = begin(host(*iterator._journalStringPtr), Standard());
+        iterator._segmentEnd = iterator._segmentBegin;
+        iterator._currentSegmentIt = iterator._segmentBegin;
+        return;
+    }
+
     iterator._journalEntriesIterator = end(iterator._journalStringPtr->_journalEntries, Standard()) - 1;
     _updateSegmentIteratorsLeft(iterator);
     ++iterator._currentSegmentIt;
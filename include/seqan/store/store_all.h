@@ -70,6 +70,19 @@ struct FragmentStoreConfig
     typedef Owner<ConcatDirect<> >    TReadNameStoreSpec;
 };
 
+// A memory-lean configuration for stores that hold read mapping results.  Read sequences are kept without qualities
+// with 3 bits per base in a packed concatenated string and contigs are stored without qualities.
+struct CompactStore_;
+typedef Tag<CompactStore_> CompactStore;
+
+template <>
+struct FragmentStoreConfig<CompactStore> :
+    public FragmentStoreConfig<>
+{
+    typedef String<Dna5, Packed<> >    TReadSeq;
+    typedef String<Dna5>            TContigSeq;
+};
+
 //////////////////////////////////////////////////////////////////////////////
 // Fragment Store
 //////////////////////////////////////////////////////////////////////////////
@@ -943,7 +943,7 @@ bool writeContigs(FormattedFile<Fastq, Output, TSpec> & file, FragmentStore<TFSS
  * @fn FragmentStore#readRecords
  * @brief Read all records from a file.
  *
- * @signature void readRecords(store, bamFileIn[, importFlags]);
+ * @signature void readRecords(store, bamFileIn[, importFlags][, parallelTag]);
  * @signature void readRecords(store, gffFileIn);
  * @signature void readRecords(store, ucscFileIn);
  *
@@ -952,6 +952,9 @@ bool writeContigs(FormattedFile<Fastq, Output, TSpec> & file, FragmentStore<TFSS
  * @param[in,out] gffFileIn   The @link GffFileIn @endlink object to read from.
  * @param[in,out] ucscFileIn  The @link UcscFileIn @endlink object to read from.
  * @param[in]     importFlags The import flags.
+ * @param[in]     parallelTag <tt>Serial</tt> (default) or <tt>Parallel</tt>.  With <tt>Parallel</tt> the SAM/BAM
+ *                            records are read in batches whose sequences, CIGAR strings and tags are converted in
+ *                            parallel.  The resulting store is identical.
  *
  * @throw IOError On low-level I/O errors.
  * @throw ParseError On high-level file format errors.
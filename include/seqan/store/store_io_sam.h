@@ -78,11 +78,19 @@ struct FragStoreSAMContext
     typedef typename TAlignedElement::TGapAnchors                               TReadGapAnchors;
     typedef String<typename TFragmentStore::TContigGapAnchor>                   TContigAnchorGaps;
     typedef typename TFragmentStore::TReadSeq                                   TReadSeq;
+    typedef typename TFragmentStore::TContigPos                                 TContigPos;
+    typedef typename Value<typename TFragmentStore::TAlignQualityStore>::Type   TAlignQuality;
 
     TId                 readId;
     TReadGapAnchors     readGapAnchors;
     TContigAnchorGaps   contigGapAnchors;
 
+    // Alignment of the current record as computed by _prepareAlignment().
+    TContigPos          beginPos;
+    TContigPos          endPos;
+    TAlignQuality       mapQ;
+    bool                readGapsPrepared;
+
     // Buffer for the read sequence.
     TReadSeq readSeq;
 
@@ -299,13 +307,14 @@ _generatePairMatchIds (
 // --------------------------------------------------------------------------
 
 template <typename TSpec, typename TConfig, typename TNameStore, typename TNameStoreCache,
-          typename TStorageSpec, typename TForwardIter, typename TFormat>
+          typename TStorageSpec, typename TForwardIter, typename TFormat, typename TParallelTag>
 inline void
 readRecords(FragmentStore<TSpec, TConfig> & store,
             BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & ctx,
             TForwardIter & iter,
             TFormat const & format,
-            FragStoreImportFlags const & importFlags)
+            FragStoreImportFlags const & importFlags,
+            Tag<TParallelTag> const & parallelTag)
 {
     typedef FragmentStore<TSpec, TConfig> TFragmentStore;
     typedef typename Id<TFragmentStore>::Type TId;
@@ -328,7 +337,7 @@ readRecords(FragmentStore<TSpec, TConfig> & store,
     resize(store.contigStore, length(store.contigNameStore));
 
     // Read in alignments section
-    _readAlignments(store, contigAnchorGaps, matchMateInfos, ctx, iter, format, importFlags);
+    _readAlignments(store, contigAnchorGaps, matchMateInfos, ctx, iter, format, importFlags, parallelTag);
 
     if (importFlags.importReadAlignment)
     {
@@ -338,11 +347,24 @@ readRecords(FragmentStore<TSpec, TConfig> & store,
     }
 }
 
-template <typename TFSSpec, typename TConfig, typename TDirection, typename TSpec>
+template <typename TSpec, typename TConfig, typename TNameStore, typename TNameStoreCache,
+          typename TStorageSpec, typename TForwardIter, typename TFormat>
+inline void
+readRecords(FragmentStore<TSpec, TConfig> & store,
+            BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & ctx,
+            TForwardIter & iter,
+            TFormat const & format,
+            FragStoreImportFlags const & importFlags)
+{
+    readRecords(store, ctx, iter, format, importFlags, Serial());
+}
+
+template <typename TFSSpec, typename TConfig, typename TDirection, typename TSpec, typename TParallelTag>
 inline void
 readRecords(FragmentStore<TFSSpec, TConfig> & store,
             FormattedFile<Bam, TDirection, TSpec> & bamFile,
-            FragStoreImportFlags const & importFlags)
+            FragStoreImportFlags const & importFlags,
+            Tag<TParallelTag> const & parallelTag)
 {
     typedef FragmentStore<TFSSpec, TConfig>                 TFragmentStore;
     typedef typename TFragmentStore::TContigNameStore       TContigNameStore;
@@ -358,19 +380,37 @@ readRecords(FragmentStore<TFSSpec, TConfig> & store,
     std::swap(ctx.translateFile2GlobalRefId, context(bamFile).translateFile2GlobalRefId);
 
     refresh(contigNamesCache(ctx));
-    readRecords(store, ctx, directionIterator(bamFile, Input()), format(bamFile), importFlags);
+    readRecords(store, ctx, directionIterator(bamFile, Input()), format(bamFile), importFlags, parallelTag);
 //for(size_t i=0;i<length(contigNames(ctx));++i)
 //std::cout<<contigNames(ctx)[i]<<std::endl;
     std::swap(ctx.buffer, context(bamFile).buffer);
     std::swap(ctx.translateFile2GlobalRefId, context(bamFile).translateFile2GlobalRefId);
 }
 
+template <typename TFSSpec, typename TConfig, typename TDirection, typename TSpec>
+inline void
+readRecords(FragmentStore<TFSSpec, TConfig> & store,
+            FormattedFile<Bam, TDirection, TSpec> & bamFile,
+            FragStoreImportFlags const & importFlags)
+{
+    readRecords(store, bamFile, importFlags, Serial());
+}
+
+template <typename TFSSpec, typename TConfig, typename TDirection, typename TSpec, typename TParallelTag>
+inline void
+readRecords(FragmentStore<TFSSpec, TConfig> & store,
+            FormattedFile<Bam, TDirection, TSpec> & bamFile,
+            Tag<TParallelTag> const & parallelTag)
+{
+    readRecords(store, bamFile, FragStoreImportFlags(), parallelTag);
+}
+
 template <typename TFSSpec, typename TConfig, typename TDirection, typename TSpec>
 inline void
 readRecords(FragmentStore<TFSSpec, TConfig> & store,
             FormattedFile<Bam, TDirection, TSpec> & bamFile)
 {
-    readRecords(store, bamFile, FragStoreImportFlags());
+    readRecords(store, bamFile, FragStoreImportFlags(), Serial());
 }
 
 //template <typename TSpec, typename TConfig>
@@ -393,7 +433,7 @@ readRecords(FragmentStore<TFSSpec, TConfig> & store,
 
 template <typename TSpec, typename TConfig, typename TContigAnchorGaps, typename TMatchMateInfos,
           typename TNameStore, typename TNameStoreCache,
-          typename TStorageSpec, typename TForwardIter, typename TFormat>
+          typename TStorageSpec, typename TForwardIter, typename TFormat, typename TParallelTag>
 inline void
 _readAlignments(
     FragmentStore<TSpec, TConfig> & fragStore,
@@ -402,7 +442,8 @@ _readAlignments(
     BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & ctx,
     TForwardIter & iter,
     TFormat const & format,
-    FragStoreImportFlags const & importFlags)
+    FragStoreImportFlags const & importFlags,
+    Tag<TParallelTag> const & parallelTag)
 {
 //IOREV _nodoc_ docusmentation in code, but unclear
     // create dummy entries in Sam specific aligned read quality store and aligned read tag store
@@ -421,9 +462,44 @@ _readAlignments(
     resize(fragStore.alignedReadTagStore, length(fragStore.alignedReadStore));
 
     // read in alignments
-    FragStoreSAMContext<TFragmentStore> contextSAM;
 //        refresh(fragStore.contigNameStoreCache);  // was done for the BamIOContext already
     refresh(fragStore.readNameStoreCache);
+    _readAlignmentRecords(fragStore, contigAnchorGaps, matchMateInfos, ctx, iter, format, importFlags, parallelTag);
+
+    if (importFlags.importReadSeq)
+    {
+        TReadSeqStoreSize emptyReads = 0;
+        for(TReadSeqStoreSize i = 0; i < length(fragStore.alignedReadStore); ++i)
+            if (empty(fragStore.readSeqStore[fragStore.alignedReadStore[i].readId]))
+            {
+                ++emptyReads;
+//                std::cerr << "Read sequence empty for " << fragStore.readNameStore[fragStore.alignedReadStore[i].readId] << std::endl;
+            }
+        if (emptyReads != 0)
+            std::cerr << "Warning: " << emptyReads << " read sequences are empty." << std::endl;
+    }
+}
+
+// --------------------------------------------------------------------------
+// Function _readAlignmentRecords()
+// --------------------------------------------------------------------------
+// reads the alignment records one by one
+
+template <typename TSpec, typename TConfig, typename TContigAnchorGaps, typename TMatchMateInfos,
+          typename TNameStore, typename TNameStoreCache,
+          typename TStorageSpec, typename TForwardIter, typename TFormat>
+inline void
+_readAlignmentRecords(
+    FragmentStore<TSpec, TConfig> & fragStore,
+    TContigAnchorGaps & contigAnchorGaps,
+    TMatchMateInfos & matchMateInfos,
+    BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & ctx,
+    TForwardIter & iter,
+    TFormat const & format,
+    FragStoreImportFlags const & importFlags,
+    Serial)
+{
+    FragStoreSAMContext<FragmentStore<TSpec, TConfig> > contextSAM;
 
     uint64_t recNo = 0;
     while (!atEnd(iter))
@@ -440,35 +516,67 @@ _readAlignments(
             SEQAN_THROW(IOError(sstr.str()));
         }
     }
+}
 
-    if (importFlags.importReadSeq)
+// reads the alignment records in batches; records of a batch are parsed and appended to the store sequentially,
+// converting sequences, CIGAR strings and tags in between is done in parallel
+
+template <typename TSpec, typename TConfig, typename TContigAnchorGaps, typename TMatchMateInfos,
+          typename TNameStore, typename TNameStoreCache,
+          typename TStorageSpec, typename TForwardIter, typename TFormat>
+inline void
+_readAlignmentRecords(
+    FragmentStore<TSpec, TConfig> & fragStore,
+    TContigAnchorGaps & contigAnchorGaps,
+    TMatchMateInfos & matchMateInfos,
+    BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & ctx,
+    TForwardIter & iter,
+    TFormat const & format,
+    FragStoreImportFlags const & importFlags,
+    Parallel)
+{
+    typedef FragStoreSAMContext<FragmentStore<TSpec, TConfig> >  TSAMContext;
+
+    const int64_t BATCH_SIZE = 1024;
+    String<TSAMContext> batch;
+    resize(batch, BATCH_SIZE);
+
+    uint64_t recNo = 0;
+    while (!atEnd(iter))
     {
-        TReadSeqStoreSize emptyReads = 0;
-        for(TReadSeqStoreSize i = 0; i < length(fragStore.alignedReadStore); ++i)
-            if (empty(fragStore.readSeqStore[fragStore.alignedReadStore[i].readId]))
+        int64_t batchSize = 0;
+        for (; batchSize < BATCH_SIZE && !atEnd(iter); ++batchSize)
+        {
+            try
             {
-                ++emptyReads;
-//                std::cerr << "Read sequence empty for " << fragStore.readNameStore[fragStore.alignedReadStore[i].readId] << std::endl;
+                ++recNo;
+                readRecord(batch[batchSize].bamRecord, ctx, iter, format);
             }
-        if (emptyReads != 0)
-            std::cerr << "Warning: " << emptyReads << " read sequences are empty." << std::endl;
+            catch (IOError &e)
+            {
+                std::stringstream sstr;
+                sstr << "Error in SAM/BAM record #" << recNo << ": " << e.what();
+                SEQAN_THROW(IOError(sstr.str()));
+            }
+        }
+
+        SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 16))
+        for (int64_t i = 0; i < batchSize; ++i)
+            _prepareAlignment(batch[i], importFlags);
+
+        for (int64_t i = 0; i < batchSize; ++i)
+            _storeAlignment(fragStore, contigAnchorGaps, matchMateInfos, batch[i], importFlags);
     }
 }
 
 // --------------------------------------------------------------------------
-// Function _bamAppendAlignment()
+// Function _bamPrepareReadGaps()
 // --------------------------------------------------------------------------
+// converts the CIGAR string of the current record into read gap anchors
 
-template <typename TReadSeq, typename TCigar, typename TPos, typename TContigId, typename TId, typename TFragmentStore>
+template <typename TReadSeq, typename TFragmentStore>
 inline void
-_bamAppendAlignment(
-    TFragmentStore &fragStore,
-    TReadSeq const &readSeq,
-    TCigar &cigar,
-    TPos &beginPos, TPos &endPos,
-    TContigId contigId,
-    TId &pairMatchId,
-    FragStoreSAMContext<TFragmentStore> & contextSAM)
+_bamPrepareReadGaps(FragStoreSAMContext<TFragmentStore> & contextSAM, TReadSeq const & readSeq)
 {
     typedef typename TFragmentStore::TAlignedReadStore                      TAlignedReadStore;
     typedef typename Value<TAlignedReadStore>::Type                         TAlignedRead;
@@ -477,112 +585,64 @@ _bamAppendAlignment(
     // insert alignment gaps
     clear(contextSAM.readGapAnchors);
     TReadGaps readGaps(readSeq, contextSAM.readGapAnchors);
-    unsigned beginGaps = cigarToGapAnchorRead(readGaps, cigar);
+    unsigned beginGaps = cigarToGapAnchorRead(readGaps, contextSAM.bamRecord.cigar);
 
     // adapt start or end (on reverse strand) position if alignment begins with gaps
-    if (beginPos > endPos)
-        endPos += beginGaps;
+    if (contextSAM.beginPos > contextSAM.endPos)
+        contextSAM.endPos += beginGaps;
     else
-        beginPos += beginGaps;
-
-    // create a new entry in the aligned read store
-    pairMatchId = appendAlignment(fragStore, contextSAM.readId, contigId, beginPos, endPos, contextSAM.readGapAnchors);
+        contextSAM.beginPos += beginGaps;
+    contextSAM.readGapsPrepared = true;
 }
 
-// --------------------------------------------------------------------------
-// Function _bamAppendAlignmentWithoutSeq()
-// --------------------------------------------------------------------------
-
-template <typename TCigar, typename TPos, typename TContigId, typename TId, typename TFragmentStore>
+template <typename TFragmentStore>
 inline void
-_bamAppendAlignmentWithoutSeq(
-    TFragmentStore &fragStore,
-    TCigar &cigar,
-    TPos &beginPos, TPos &endPos,
-    TContigId contigId,
-    TId &pairMatchId,
-    FragStoreSAMContext<TFragmentStore> & contextSAM)
+_bamPrepareReadGaps(FragStoreSAMContext<TFragmentStore> & contextSAM, Nothing const &)
 {
     typedef typename TFragmentStore::TAlignedReadStore                      TAlignedReadStore;
     typedef typename Value<TAlignedReadStore>::Type                         TAlignedRead;
     typedef Gaps<Nothing, AnchorGaps<typename TAlignedRead::TGapAnchors> >  TReadGaps;
     Nothing nothing;
 
-    // insert alignment gaps
     clear(contextSAM.readGapAnchors);
     TReadGaps readGaps(nothing, contextSAM.readGapAnchors);
-    unsigned beginGaps = cigarToGapAnchorRead(readGaps, cigar);
+    unsigned beginGaps = cigarToGapAnchorRead(readGaps, contextSAM.bamRecord.cigar);
 
-    // adapt start or end (on reverse strand) position if alignment begins with gaps
-    if (beginPos > endPos)
-        endPos += beginGaps;
+    if (contextSAM.beginPos > contextSAM.endPos)
+        contextSAM.endPos += beginGaps;
     else
-        beginPos += beginGaps;
-
-    // create a new entry in the aligned read store
-    pairMatchId = appendAlignment(fragStore, contextSAM.readId, contigId, beginPos, endPos, contextSAM.readGapAnchors);
+        contextSAM.beginPos += beginGaps;
+    contextSAM.readGapsPrepared = true;
 }
 
 // --------------------------------------------------------------------------
-// Function _readAlignments()
+// Function _prepareAlignment()
 // --------------------------------------------------------------------------
-// read one alignment record from SAM/BAM file into FragmentStore
+// converts the record in contextSAM.bamRecord into read sequence, positions and gap anchors;
+// touches only contextSAM and can therefore be called for several records in parallel
 
-template <
-    typename TSpec,
-    typename TConfig,
-    typename TContigAnchorGaps,
-    typename TMatchMateInfos,
-    typename TNameStore, typename TNameStoreCache,
-    typename TStorageSpec, typename TForwardIter, typename TFormat>
+template <typename TFragmentStore>
 inline void
-_readOneAlignment(
-    FragmentStore<TSpec, TConfig> & fragStore,
-    TContigAnchorGaps & contigAnchorGaps,
-    TMatchMateInfos & matchMateInfos,
-    BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & ctx,
-    TForwardIter & iter,
-    TFormat const & format,
-    FragStoreSAMContext<FragmentStore<TSpec, TConfig> > & contextSAM,
-    FragStoreImportFlags const & importFlags)
+_prepareAlignment(FragStoreSAMContext<TFragmentStore> & contextSAM, FragStoreImportFlags const & importFlags)
 {
-    // Basic types
-    typedef FragmentStore<TSpec, TConfig>                                       TFragmentStore;
     typedef FragStoreSAMContext<TFragmentStore>                                 TSAMContext;
-    typedef typename Id<TFragmentStore>::Type                                   TId;
-    //typedef typename Size<TFragmentStore>::Type                                 TSize;
-
-    // All fragment store element types
-    //typedef typename Value<typename TFragmentStore::TContigStore>::Type         TContigElement;
-    //typedef typename Value<typename TFragmentStore::TLibraryStore>::Type        TLibraryStoreElement;
-    //typedef typename Value<typename TFragmentStore::TReadStore>::Type           TReadStoreElement;
-    typedef typename Value<typename TFragmentStore::TAlignQualityStore>::Type   TAlignQualityElement;
-
-    // Type for sequence in readstore
+    typedef typename TSAMContext::TAlignQuality                                 TAlignQualityElement;
     typedef typename TFragmentStore::TReadSeq                                   TReadSeq;
-
-    // Type for gap anchor
-    typedef typename TFragmentStore::TContigPos                                 TContigPos;
     typedef Gaps<Nothing, AnchorGaps<typename TSAMContext::TContigAnchorGaps> > TContigGapsPW;
 
-    // Type to temporarily store information about match mates
-    typedef typename Value<TMatchMateInfos>::Type                               TMatchMateInfo;
-
-    // Read next BamAlignmentRecord and get shortcut.
     BamAlignmentRecord & record = contextSAM.bamRecord;
-    readRecord(record, ctx, iter, format);
 
     // Get element of align quality store.
-    TAlignQualityElement mapQ;
-    mapQ.score = record.mapQ;
+    contextSAM.mapQ = TAlignQualityElement();
+    contextSAM.mapQ.score = record.mapQ;
 
     // Get begin and end position.
-    TContigPos beginPos = record.beginPos;
-    TContigPos endPos = 0;
-    _getLengthInRef(endPos, record.cigar);
-    endPos = beginPos + endPos;
+    contextSAM.beginPos = record.beginPos;
+    contextSAM.endPos = 0;
+    _getLengthInRef(contextSAM.endPos, record.cigar);
+    contextSAM.endPos = contextSAM.beginPos + contextSAM.endPos;
     if (hasFlagRC(record))
-        std::swap(beginPos, endPos);
+        std::swap(contextSAM.beginPos, contextSAM.endPos);
 
     // Put read sequence and qualities into readSeq and reverseComplement if necessary.
     TReadSeq & readSeq = contextSAM.readSeq;
@@ -591,6 +651,57 @@ _readOneAlignment(
     if (hasFlagRC(record))
         reverseComplement(readSeq);
 
+    contextSAM.readGapsPrepared = false;
+    if (!importFlags.importReadAlignment || empty(record.cigar) ||
+        record.rID == BamAlignmentRecord::INVALID_REFID || record.beginPos == BamAlignmentRecord::INVALID_POS)
+        return;
+
+    // Generate gap anchor strings for contig and read.  If the record comes without a sequence the read gaps
+    // are computed against the sequence in the store by _storeAlignment().
+    clear(contextSAM.contigGapAnchors);
+    TContigGapsPW contigGaps(contextSAM.contigGapAnchors);
+    cigarToGapAnchorContig(contigGaps, record.cigar);
+
+    if (!importFlags.importReadSeq)
+        _bamPrepareReadGaps(contextSAM, Nothing());
+    else if (!empty(readSeq))
+        _bamPrepareReadGaps(contextSAM, readSeq);
+
+    // Import tags and remove some tags.
+    if ((importFlags.importReadAlignmentTags || importFlags.importReadAlignmentQuality) && !empty(record.tags))
+    {
+        // extract and delete some tags
+        BamTagsDict tags(record.tags);
+        int tagId = -1;
+        if (findTagKey(tagId, tags, "MD"))
+            eraseTag(tags, tagId);
+        if (findTagKey(tagId, tags, "NM") && extractTagValue(contextSAM.mapQ.errors, tags, tagId))
+            eraseTag(tags, tagId);
+    }
+}
+
+// --------------------------------------------------------------------------
+// Function _storeAlignment()
+// --------------------------------------------------------------------------
+// appends a record prepared by _prepareAlignment() to the FragmentStore
+
+template <typename TSpec, typename TConfig, typename TContigAnchorGaps, typename TMatchMateInfos>
+inline void
+_storeAlignment(
+    FragmentStore<TSpec, TConfig> & fragStore,
+    TContigAnchorGaps & contigAnchorGaps,
+    TMatchMateInfos & matchMateInfos,
+    FragStoreSAMContext<FragmentStore<TSpec, TConfig> > & contextSAM,
+    FragStoreImportFlags const & importFlags)
+{
+    typedef FragmentStore<TSpec, TConfig>                                       TFragmentStore;
+    typedef typename Id<TFragmentStore>::Type                                   TId;
+
+    // Type to temporarily store information about match mates
+    typedef typename Value<TMatchMateInfos>::Type                               TMatchMateInfo;
+
+    BamAlignmentRecord & record = contextSAM.bamRecord;
+
     // Check if read sequence is already in the store.  If so get the ID, otherwise create new entries in the read
     // then read name and mate pair store.
     contextSAM.readId = -1;
@@ -599,10 +710,10 @@ _readOneAlignment(
         if (!importFlags.importReadName)
             clear(record.qName);
 
-        bool newRead = _storeAppendRead(fragStore, contextSAM.readId, record.qName, readSeq, record.flag,
+        bool newRead = _storeAppendRead(fragStore, contextSAM.readId, record.qName, contextSAM.readSeq, record.flag,
                                         contextSAM);
         (void)newRead;
-        SEQAN_ASSERT_NOT(newRead && empty(readSeq));
+        SEQAN_ASSERT_NOT(newRead && empty(contextSAM.readSeq));
     }
 
     // Stop here if read is unaligned.
@@ -620,38 +731,19 @@ _readOneAlignment(
     TId pairMatchId = 0;
     if (importFlags.importReadAlignment)
     {
-        // generate gap anchor string for the read
-        if (importFlags.importReadSeq)
-            _bamAppendAlignment(fragStore, fragStore.readSeqStore[contextSAM.readId], record.cigar, beginPos, endPos,
-                                record.rID, pairMatchId, contextSAM);
-        else
-            _bamAppendAlignmentWithoutSeq(fragStore, record.cigar, beginPos, endPos, record.rID, pairMatchId,
-                                          contextSAM);
+        // generate gap anchor string for the read if it was not possible without the store
+        if (!contextSAM.readGapsPrepared)
+            _bamPrepareReadGaps(contextSAM, fragStore.readSeqStore[contextSAM.readId]);
 
-        clear(contextSAM.contigGapAnchors);
-        TContigGapsPW contigGaps(contextSAM.contigGapAnchors);
-        cigarToGapAnchorContig(contigGaps, record.cigar);
+        // create a new entry in the aligned read store
+        pairMatchId = appendAlignment(fragStore, contextSAM.readId, record.rID, contextSAM.beginPos,
+                                      contextSAM.endPos, contextSAM.readGapAnchors);
         appendValue(contigAnchorGaps, contextSAM.contigGapAnchors);
     }
 
-    // Import tags and remove some tags.
-    if (importFlags.importReadAlignmentTags || importFlags.importReadAlignmentQuality)
-    {
-        // extract and delete some tags
-        if (!empty(record.tags))
-        {
-            BamTagsDict tags(record.tags);
-            int tagId = -1;
-            if (findTagKey(tagId, tags, "MD"))
-                eraseTag(tags, tagId);
-            if (findTagKey(tagId, tags, "NM") && extractTagValue(mapQ.errors, tags, tagId))
-                eraseTag(tags, tagId);
-        }
-    }
-
     // Create entries in Sam specific stores.
     if (importFlags.importReadAlignmentQuality)
-        appendValue(fragStore.alignQualityStore, mapQ, Generous());
+        appendValue(fragStore.alignQualityStore, contextSAM.mapQ, Generous());
 
     if (importFlags.importReadAlignmentTags)
         appendValue(fragStore.alignedReadTagStore, record.tags, Generous());
@@ -678,6 +770,34 @@ _readOneAlignment(
     }
 }
 
+// --------------------------------------------------------------------------
+// Function _readOneAlignment()
+// --------------------------------------------------------------------------
+// read one alignment record from SAM/BAM file into FragmentStore
+
+template <
+    typename TSpec,
+    typename TConfig,
+    typename TContigAnchorGaps,
+    typename TMatchMateInfos,
+    typename TNameStore, typename TNameStoreCache,
+    typename TStorageSpec, typename TForwardIter, typename TFormat>
+inline void
+_readOneAlignment(
+    FragmentStore<TSpec, TConfig> & fragStore,
+    TContigAnchorGaps & contigAnchorGaps,
+    TMatchMateInfos & matchMateInfos,
+    BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & ctx,
+    TForwardIter & iter,
+    TFormat const & format,
+    FragStoreSAMContext<FragmentStore<TSpec, TConfig> > & contextSAM,
+    FragStoreImportFlags const & importFlags)
+{
+    readRecord(contextSAM.bamRecord, ctx, iter, format);
+    _prepareAlignment(contextSAM, importFlags);
+    _storeAlignment(fragStore, contigAnchorGaps, matchMateInfos, contextSAM, importFlags);
+}
+
 // ============================================================================
 // Write Functions
 // ============================================================================
@@ -800,19 +920,27 @@ inline void writeHeader(FormattedFile<Bam, Output, TSpec> & bamFile,
 // Function _fillBamSeqAndQual()
 // --------------------------------------------------------------------------
 
+// Read alphabets without qualities, e.g. of packed read sequences, are written with an empty quality string.
 template <typename TSeq, typename TQual, typename TRead>
 inline void
 _fillBamSeqAndQual(TSeq &bamSeq, TQual &bamQual, TRead const &read)
 {
-    bamSeq = read;
+    typedef typename Value<TRead const>::Type TReadValue;
 
-    resize(bamQual, length(read));
-    typename Iterator<TQual, Standard>::Type       tIt    = begin(bamQual, Standard());
+    resize(bamSeq, length(read));
+    resize(bamQual, HasQualities<TReadValue>::VALUE ? length(read) : 0);
+    typename Iterator<TSeq, Standard>::Type        tIt    = begin(bamSeq, Standard());
+    typename Iterator<TQual, Standard>::Type       qIt    = begin(bamQual, Standard());
     typename Iterator<TRead const, Standard>::Type sIt    = begin(read, Standard());
     typename Iterator<TRead const, Standard>::Type sItEnd = end(read, Standard());
 
     for (; sIt != sItEnd; ++sIt, ++tIt)
-        *tIt = (char)(getQualityValue(*sIt) + '!');
+    {
+        TReadValue c = *sIt;  // convert proxies of packed strings before changing the alphabet
+        *tIt = c;
+        if (HasQualities<TReadValue>::VALUE)
+            *qIt++ = (char)(getQualityValue(c) + '!');
+    }
 }
 
 // --------------------------------------------------------------------------
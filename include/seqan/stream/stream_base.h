@@ -134,17 +134,19 @@ char const * FileExtensions<GZFile, T>::VALUE[1] =
 template <typename T>
 struct FileExtensions<BgzfFile, T>
 {
-    static char const * VALUE[5];
+    static char const * VALUE[7];
 };
 
 template <typename T>
-char const * FileExtensions<BgzfFile, T>::VALUE[5] =
+char const * FileExtensions<BgzfFile, T>::VALUE[7] =
 {
     ".bgzf",      // default output extension
     ".bam",       // BAM files are bgzf compressed
+    ".bcf",       // BCF files are bgzf compressed
     ".vcf.gz",    // Compressed and indexed VCF files are bgzf compressed
     ".bed.gz",    // Compressed and indexed BED files are bgzf compressed
-    ".tbi"        // Tabix index files are bgzf compressed
+    ".tbi",       // Tabix index files are bgzf compressed
+    ".csi"        // CSI index files are bgzf compressed
 };
 
 
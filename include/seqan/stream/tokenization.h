@@ -667,7 +667,7 @@ strSplit(TResult & result,
                         ++it;
 
                     if (it != itEnd)
-                        appendValue(result, static_cast<TResultValue>(infix(sequence, itFrom - itBeg, it - itBeg)));
+                        appendValue(result, static_cast<TResultValue>(infix(sequence, it - itBeg, itEnd - itBeg)));
 
                     return;
                 }
@@ -53,6 +53,7 @@
 
 // Tabix indices are only available when ZLIB is available.
 #if SEQAN_HAS_ZLIB
+#include <seqan/tabix_io/binning_index.h>
 #include <seqan/tabix_io/tabix_index_tbi.h>
 #endif  // #if SEQAN_HAS_ZLIB
 
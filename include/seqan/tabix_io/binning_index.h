@@ -0,0 +1,360 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Binning index shared by BAI, TBI, and CSI.
+//
+// Records are assigned to the smallest bin of a hierarchical binning scheme
+// that contains them.  BAI and TBI use 6 levels with a minimum bin size of
+// 16 kbp, CSI stores the minimum bin size (1 << minShift) and the number of
+// levels (depth) in the index.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_TABIX_IO_BINNING_INDEX_H_
+#define INCLUDE_SEQAN_TABIX_IO_BINNING_INDEX_H_
+
+#include <map>
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Helper Class BinningIndexBuilder_
+// ----------------------------------------------------------------------------
+
+// Collects the binning and linear index of a coordinate-sorted BGZF file for
+// BAI, TBI and CSI, following hts_idx_push() and hts_idx_finish() of htslib.
+// Offsets are BGZF virtual offsets, positions are 0-based.
+
+struct BinningIndexBin_
+{
+    uint64_t                          loffset;
+    String<Pair<uint64_t, uint64_t> > chunkBegEnds;
+
+    BinningIndexBin_() : loffset(0)
+    {}
+};
+
+struct BinningIndexBuilder_
+{
+    typedef std::map<uint32_t, BinningIndexBin_> TBins;
+
+    int                     minShift;
+    int                     depth;
+    String<TBins>           bins;           // per reference
+    String<String<uint64_t> > linear;       // per reference, 1 << minShift windows
+    String<bool>            hasData;
+    uint64_t                nNoCoor;
+
+    // State of the current chunk.
+    int32_t                 lastTid;
+    int32_t                 saveTid;
+    uint32_t                lastBin;
+    uint32_t                saveBin;
+    int64_t                 lastCoor;
+    uint64_t                lastOff;
+    uint64_t                saveOff;
+    uint64_t                offBeg;
+    uint64_t                nMapped;
+    uint64_t                nUnmapped;
+
+    BinningIndexBuilder_(unsigned numRefs, uint64_t offset, int minShift_ = 14, int depth_ = 5) :
+        minShift(minShift_), depth(depth_), nNoCoor(0), lastTid(std::numeric_limits<int32_t>::min()),
+        saveTid(-1), lastBin(std::numeric_limits<uint32_t>::max()), saveBin(std::numeric_limits<uint32_t>::max()),
+        lastCoor(-1), lastOff(offset), saveOff(offset), offBeg(offset), nMapped(0), nUnmapped(0)
+    {
+        resize(bins, numRefs);
+        resize(linear, numRefs);
+        resize(hasData, numRefs, false);
+    }
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexBinFirst(), _binningIndexBinParent(), ...
+// ----------------------------------------------------------------------------
+
+// First bin on a given level of the binning scheme.
+inline uint32_t
+_binningIndexBinFirst(int level)
+{
+    return ((1u << (3 * level)) - 1) / 7;
+}
+
+inline uint32_t
+_binningIndexBinParent(uint32_t bin)
+{
+    return (bin - 1) >> 3;
+}
+
+// Number of bins, the pseudo-bin holding meta data has id numBins + 1.
+inline uint32_t
+_binningIndexNumBins(int depth)
+{
+    return ((1ull << (3 * depth + 3)) - 1) / 7;
+}
+
+// Bin of the smallest interval [beg, end) covering the given region.
+inline uint32_t
+_binningIndexReg2Bin(int64_t beg, int64_t end, int minShift, int depth)
+{
+    int s = minShift;
+    uint32_t t = _binningIndexBinFirst(depth);
+    --end;
+    for (int l = depth; l > 0; --l, s += 3, t -= 1u << (3 * l))
+        if (beg >> s == end >> s)
+            return t + (beg >> s);
+    return 0;
+}
+
+// All bins that may contain records overlapping the 0-based region [beg, end).
+inline void
+_binningIndexReg2Bins(String<uint32_t> & list, int64_t beg, int64_t end, int minShift, int depth)
+{
+    clear(list);
+    int s = minShift + 3 * depth;
+    if (beg >= end)
+        return;
+    if (end >= (int64_t)1 << s)
+        end = (int64_t)1 << s;
+    --end;
+    uint32_t t = 0;
+    for (int l = 0; l <= depth; s -= 3, t += 1u << (3 * l), ++l)
+        for (int64_t b = t + (beg >> s), e = t + (end >> s); b <= e; ++b)
+            appendValue(list, (uint32_t)b);
+}
+
+// Leftmost bin on the lowest level that is covered by the given bin.
+inline uint32_t
+_binningIndexBinBottom(uint32_t bin, int depth)
+{
+    int level = 0;
+    for (uint32_t b = bin; b; ++level, b = _binningIndexBinParent(b)) {}
+    return (bin - _binningIndexBinFirst(level)) << (3 * (depth - level));
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexAddChunk()
+// ----------------------------------------------------------------------------
+
+inline void
+_binningIndexAddChunk(BinningIndexBuilder_::TBins & bins, uint32_t bin, uint64_t beg, uint64_t end)
+{
+    appendValue(bins[bin].chunkBegEnds, Pair<uint64_t, uint64_t>(beg, end));
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexPush()
+// ----------------------------------------------------------------------------
+
+// Adds the record spanning [beg, end) on tid whose data ends at offset.
+// Returns false if the records are not sorted by coordinate.
+
+inline bool
+_binningIndexPush(BinningIndexBuilder_ & builder, int32_t tid, int64_t beg, int64_t end, uint64_t offset, bool isMapped)
+{
+    if (tid < 0)
+    {
+        beg = -1;
+        end = 0;
+    }
+    if (tid >= (int32_t)length(builder.bins))
+        return false;
+
+    if (builder.lastTid != tid)
+    {
+        // Records without coordinate must be at the end, references must be continuous.
+        if (tid >= 0 && (builder.nNoCoor != 0 || builder.hasData[tid]))
+            return false;
+        builder.lastTid = tid;
+        builder.lastBin = std::numeric_limits<uint32_t>::max();
+    }
+    else if (tid >= 0 && builder.lastCoor > beg)
+    {
+        return false;
+    }
+
+    if (tid >= 0)
+    {
+        builder.hasData[tid] = true;
+
+        // Update the linear index with the offset of the record start.
+        String<uint64_t> & linear = builder.linear[tid];
+        int64_t first = beg >> builder.minShift;
+        int64_t last = (end - 1) >> builder.minShift;
+        if ((int64_t)length(linear) < last + 1)
+            resize(linear, last + 1, std::numeric_limits<uint64_t>::max());
+        for (int64_t i = first; i <= last; ++i)
+            if (linear[i] == std::numeric_limits<uint64_t>::max())
+                linear[i] = builder.lastOff;
+    }
+    else
+    {
+        ++builder.nNoCoor;
+    }
+
+    uint32_t bin = _binningIndexReg2Bin(beg, end, builder.minShift, builder.depth);
+    if (builder.lastBin != bin)
+    {
+        if (builder.saveBin != std::numeric_limits<uint32_t>::max())
+            _binningIndexAddChunk(builder.bins[builder.saveTid], builder.saveBin, builder.saveOff, builder.lastOff);
+
+        // The reference changed, store the meta data of the previous one.
+        if (builder.lastBin == std::numeric_limits<uint32_t>::max() &&
+            builder.saveBin != std::numeric_limits<uint32_t>::max())
+        {
+            uint32_t metaBin = _binningIndexNumBins(builder.depth) + 1;
+            _binningIndexAddChunk(builder.bins[builder.saveTid], metaBin, builder.offBeg, builder.lastOff);
+            _binningIndexAddChunk(builder.bins[builder.saveTid], metaBin, builder.nMapped, builder.nUnmapped);
+            builder.nMapped = builder.nUnmapped = 0;
+            builder.offBeg = builder.lastOff;
+        }
+        builder.saveOff = builder.lastOff;
+        builder.saveBin = builder.lastBin = bin;
+        builder.saveTid = tid;
+    }
+    if (isMapped)
+        ++builder.nMapped;
+    else
+        ++builder.nUnmapped;
+    builder.lastOff = offset;
+    builder.lastCoor = beg;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexFinish()
+// ----------------------------------------------------------------------------
+
+// Closes the last chunk, fills the gaps of the linear index, sets the bin
+// offsets used by CSI, and merges small bins into their parents.
+
+inline void
+_binningIndexFinish(BinningIndexBuilder_ & builder, uint64_t finalOffset)
+{
+    typedef BinningIndexBuilder_::TBins TBins;
+    uint32_t numBins = _binningIndexNumBins(builder.depth);
+
+    if (builder.saveTid >= 0)
+    {
+        TBins & bins = builder.bins[builder.saveTid];
+        _binningIndexAddChunk(bins, builder.saveBin, builder.saveOff, finalOffset);
+        _binningIndexAddChunk(bins, numBins + 1, builder.offBeg, finalOffset);
+        _binningIndexAddChunk(bins, numBins + 1, builder.nMapped, builder.nUnmapped);
+    }
+
+    for (unsigned i = 0; i < length(builder.bins); ++i)
+    {
+        TBins & bins = builder.bins[i];
+        String<uint64_t> & linear = builder.linear[i];
+
+        // Fill missing values of the linear index.
+        unsigned l = 0;
+        if (!bins.empty())
+        {
+            uint64_t offset0 = 0;
+            TBins::const_iterator meta = bins.find(numBins + 1);
+            if (meta != bins.end())
+                offset0 = meta->second.chunkBegEnds[0].i1;
+            for (; l < length(linear) && linear[l] == std::numeric_limits<uint64_t>::max(); ++l)
+                linear[l] = offset0;
+        }
+        else
+        {
+            l = 1;
+        }
+        for (; l < length(linear); ++l)
+            if (linear[l] == std::numeric_limits<uint64_t>::max())
+                linear[l] = linear[l - 1];
+
+        for (TBins::iterator it = bins.begin(); it != bins.end(); ++it)
+        {
+            uint32_t bottom = _binningIndexBinBottom(it->first, builder.depth);
+            it->second.loffset = (it->first < numBins && bottom < length(linear)) ? linear[bottom] : 0;
+        }
+
+        // Merge bins spanning less than 64kb of compressed data into their parents.
+        for (int level = builder.depth; level > 0; --level)
+        {
+            uint32_t start = _binningIndexBinFirst(level);
+            for (TBins::iterator it = bins.begin(); it != bins.end();)
+            {
+                if (it->first >= numBins || it->first < start)
+                {
+                    ++it;
+                    continue;
+                }
+                String<Pair<uint64_t, uint64_t> > & chunks = it->second.chunkBegEnds;
+                if (level < builder.depth)
+                    std::sort(begin(chunks, Standard()), end(chunks, Standard()));
+                TBins::iterator parent = bins.find(_binningIndexBinParent(it->first));
+                if ((back(chunks).i2 >> 16) - (front(chunks).i1 >> 16) < 0x10000 && parent != bins.end())
+                {
+                    append(parent->second.chunkBegEnds, chunks);
+                    bins.erase(it++);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        TBins::iterator root = bins.find(0);
+        if (root != bins.end())
+            std::sort(begin(root->second.chunkBegEnds, Standard()), end(root->second.chunkBegEnds, Standard()));
+
+        // Merge adjacent chunks that start in the same BGZF block.
+        for (TBins::iterator it = bins.begin(); it != bins.end(); ++it)
+        {
+            if (it->first >= numBins)
+                continue;
+            String<Pair<uint64_t, uint64_t> > & chunks = it->second.chunkBegEnds;
+            unsigned m = 0;
+            for (unsigned k = 1; k < length(chunks); ++k)
+            {
+                if (chunks[m].i2 >> 16 >= chunks[k].i1 >> 16)
+                    chunks[m].i2 = std::max(chunks[m].i2, chunks[k].i2);
+                else
+                    chunks[++m] = chunks[k];
+            }
+            resize(chunks, std::min((unsigned)length(chunks), m + 1));
+        }
+    }
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_TABIX_IO_BINNING_INDEX_H_
@@ -31,16 +31,16 @@
 // ==========================================================================
 // Author: David Weese <david.weese@fu-berlin.de>
 // ==========================================================================
-// (Read-only) Tabix index support.
+// Tabix index support.
 //
 // A Tabix index (Heng Li) allows one to randomly seek in a tab-seperated genome
 // related file, e.g. VCF, GFF, SAM, BED, etc. The corresponding file only
 // needs to be sorted by chromosomal position in advance and optionally
 // compressed with 'bgzip'. The resulting file must be indexed with 'tabix'.
+// Both the TBI and the CSI variant of the index can be read and written.
 //
 // TODOs:
 //  - clean jumpToRegion(), I simply adapted the one from bam_index.h
-//  - implement Tabix index creation (and BAM index creation as well)
 // ==========================================================================
 
 #ifndef INCLUDE_SEQAN_TABIX_IO_TABIX_INDEX_TBI_H_
@@ -67,7 +67,11 @@ bool open(TabixIndex & index, char const * filename);
 
 struct TabixIndexBinData_
 {
+    uint64_t loffset;   // CSI only: smallest offset of records overlapping the bin's first window
     String<Pair<uint64_t, uint64_t> > chunkBegEnds;
+
+    TabixIndexBinData_() : loffset(0)
+    {}
 };
 
 // ----------------------------------------------------------------------------
@@ -118,6 +122,9 @@ public:
     int32_t meta;               // Leading character for comment lines
     int32_t skip;               // # lines to skip at the beginning
     uint64_t unalignedCount;    // # unmapped reads without coordinates set
+    int32_t minShift;           // 1<<minShift is the size of the minimum bin
+    int32_t depth;              // Number of levels of the binning scheme
+    bool isCsi;                 // CSI index without linear index
 
     // 1<<14 is the size of the minimum bin.
     static const int32_t BAM_LIDX_SHIFT = 14;
@@ -135,6 +142,9 @@ public:
         meta('#'),
         skip(0),
         unalignedCount(std::numeric_limits<uint64_t>::max()),
+        minShift(BAM_LIDX_SHIFT),
+        depth(5),
+        isCsi(false),
         _nameStoreCache(_nameStore)
     {}
 
@@ -146,6 +156,9 @@ public:
         meta('#'),
         skip(0),
         unalignedCount(std::numeric_limits<uint64_t>::max()),
+        minShift(BAM_LIDX_SHIFT),
+        depth(5),
+        isCsi(false),
         _nameStoreCache(_nameStore)
     {
         if (!open(*this, fileName))
@@ -158,22 +171,88 @@ public:
 // ============================================================================
 
 // ----------------------------------------------------------------------------
-// Function _tbiReg2bins()
+// Function _tabixMinOffset()
+// ----------------------------------------------------------------------------
+
+// Smallest offset of a record that may overlap the 0-based position pos.
+
+inline uint64_t
+_tabixMinOffset(TabixIndex const & index, unsigned refId, int64_t pos)
+{
+    if (pos < 0)
+        pos = 0;
+
+    if (!index.isCsi)
+    {
+        String<uint64_t> const & linear = index._linearIndices[refId];
+        if (empty(linear))
+            return 0;
+        uint64_t window = pos >> index.minShift;
+        return (window < length(linear)) ? linear[window] : back(linear);
+    }
+
+    // CSI stores the offset in the bins, take the one of the lowest existing bin.
+    TabixIndex::TBinIndex_ const & bins = index._binIndices[refId];
+    uint32_t bin = _binningIndexBinFirst(index.depth) + (pos >> index.minShift);
+    while (true)
+    {
+        TabixIndex::TBinIndex_::const_iterator it = bins.find(bin);
+        if (it != bins.end())
+            return it->second.loffset;
+        if (bin == 0)
+            return 0;
+        bin = _binningIndexBinParent(bin);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _tabixChunks()
 // ----------------------------------------------------------------------------
 
-static inline void
-_tbiReg2bins(String<uint16_t> & list, uint32_t beg, uint32_t end)
+// Sorted and merged chunks of the file that contain all records overlapping
+// the 0-based region [posBeg, posEnd) on refId.
+
+inline void
+_tabixChunks(String<Pair<uint64_t, uint64_t> > & chunks,
+             TabixIndex const & index,
+             unsigned refId,
+             int64_t posBeg,
+             int64_t posEnd)
 {
-    unsigned k;
-    if (beg >= end) return;
-    if (end >= 1u<<29) end = 1u<<29;
-    --end;
-    appendValue(list, 0);
-    for (k =    1 + (beg>>26); k <=    1 + (end>>26); ++k) appendValue(list, k);
-    for (k =    9 + (beg>>23); k <=    9 + (end>>23); ++k) appendValue(list, k);
-    for (k =   73 + (beg>>20); k <=   73 + (end>>20); ++k) appendValue(list, k);
-    for (k =  585 + (beg>>17); k <=  585 + (end>>17); ++k) appendValue(list, k);
-    for (k = 4681 + (beg>>14); k <= 4681 + (end>>14); ++k) appendValue(list, k);
+    typedef Pair<uint64_t, uint64_t> TChunk;
+
+    clear(chunks);
+    if (refId >= length(index._binIndices))
+        return;
+
+    String<uint32_t> candidateBins;
+    _binningIndexReg2Bins(candidateBins, std::max((int64_t)0, posBeg), posEnd, index.minShift, index.depth);
+    uint64_t minOffset = _tabixMinOffset(index, refId, posBeg);
+
+    TabixIndex::TBinIndex_ const & bins = index._binIndices[refId];
+    for (unsigned i = 0; i < length(candidateBins); ++i)
+    {
+        TabixIndex::TBinIndex_::const_iterator it = bins.find(candidateBins[i]);
+        if (it == bins.end())
+            continue;
+        for (unsigned j = 0; j < length(it->second.chunkBegEnds); ++j)
+            if (it->second.chunkBegEnds[j].i2 > minOffset)
+                appendValue(chunks, TChunk(std::max(it->second.chunkBegEnds[j].i1, minOffset),
+                                           it->second.chunkBegEnds[j].i2));
+    }
+
+    // Merge overlapping chunks, so that every record is visited once.
+    std::sort(begin(chunks, Standard()), end(chunks, Standard()));
+    unsigned m = 0;
+    for (unsigned k = 1; k < length(chunks); ++k)
+    {
+        if (chunks[m].i2 >= chunks[k].i1)
+            chunks[m].i2 = std::max(chunks[m].i2, chunks[k].i2);
+        else
+            chunks[++m] = chunks[k];
+    }
+    if (!empty(chunks))
+        resize(chunks, m + 1);
 }
 
 // ----------------------------------------------------------------------------
@@ -284,13 +363,17 @@ jumpToRegion(FormattedFile<TFileFormat, Input, TSpec> & fileIn,
     uint64_t offset = std::numeric_limits<uint64_t>::max();
 
     // Retrieve the candidate bin identifiers for [posBeg, posEnd).
-    String<uint16_t> candidateBins;
-    _tbiReg2bins(candidateBins, posBeg, posEnd);
+    String<uint32_t> candidateBins;
+    _binningIndexReg2Bins(candidateBins, posBeg, posEnd, index.minShift, index.depth);
 
     // Retrieve the smallest required offset from the linear index.
     unsigned windowIdx = posBeg >> 14;  // Linear index consists of 16kb windows.
     uint64_t linearMinOffset = 0;
-    if (windowIdx >= length(index._linearIndices[refId]))
+    if (index.isCsi)
+    {
+        linearMinOffset = _tabixMinOffset(index, refId, posBeg);
+    }
+    else if (windowIdx >= length(index._linearIndices[refId]))
     {
         // TODO(holtgrew): Can we simply always take case 1?
 
@@ -333,7 +416,7 @@ jumpToRegion(FormattedFile<TFileFormat, Input, TSpec> & fileIn,
     // Combine candidate bins and smallest required offset from linear index into candidate offset.
     typedef std::set<uint64_t> TOffsetCandidates;
     TOffsetCandidates offsetCandidates;
-    typedef typename Iterator<String<uint16_t>, Rooted>::Type TCandidateIter;
+    typedef typename Iterator<String<uint32_t>, Rooted>::Type TCandidateIter;
     for (TCandidateIter it = begin(candidateBins, Rooted()); !atEnd(it); goNext(it))
     {
         typedef typename std::map<uint32_t, TabixIndexBinData_>::const_iterator TMapIter;
@@ -422,6 +505,40 @@ getUnalignedCount(TabixIndex const & index)
     return index.unalignedCount;
 }
 
+// ----------------------------------------------------------------------------
+// Function _readTabixConfig()
+// ----------------------------------------------------------------------------
+
+// Reads the column configuration and the concatenated reference names.  In
+// TBI they follow the number of references, CSI stores them as auxiliary data.
+
+template <typename TIter>
+inline void
+_readTabixConfig(TabixIndex & index, TIter & iter, int32_t nRef)
+{
+    readRawPod(index.format, iter);
+    readRawPod(index.colSeq, iter);
+    readRawPod(index.colBeg, iter);
+    readRawPod(index.colEnd, iter);
+    readRawPod(index.meta, iter);
+    readRawPod(index.skip, iter);
+
+    // Read concatenated names.
+    int32_t lNm = 0;
+    CharString tmp;
+    readRawPod(lNm, iter);
+    read(tmp, iter, lNm);
+    // Trim last terminating '\0's as they confuse strSplit() below
+    while (!empty(tmp) && back(tmp) == '\0')
+        resize(tmp, length(tmp) - 1);
+
+    // Split concatenated names at \0's.
+    clear(index._nameStore);
+    if (nRef > 0)
+        strSplit(index._nameStore, tmp, EqualsChar<'\0'>(), true, nRef - 1);
+    refresh(index._nameStoreCache);
+}
+
 // ----------------------------------------------------------------------------
 // Function open()
 // ----------------------------------------------------------------------------
@@ -432,9 +549,11 @@ getUnalignedCount(TabixIndex const & index)
  * @signature bool open(index, filename);
 
  * @param[in,out] index    Target data structure.
- * @param[in]     filename Path to file to load. Types: char const *
+ * @param[in]     filename Path to file to load, a TBI or CSI index. Types: char const *
  *
  * @return        bool     Returns <tt>true</tt> on success, false otherwise.
+ *
+ * CSI indices of BCF files do not contain reference names, the names of the indexed file are used instead.
  */
 
 inline bool
@@ -442,41 +561,51 @@ open(TabixIndex & index, char const * filename)
 {
     typedef VirtualStream<char, Input> TInStream;
 
-    TInStream tbi;
-    if (!open(tbi, filename))
+    std::ifstream file(filename, std::ios::binary | std::ios::in);
+    if (!file.good())
         return false;  // Could not open file.
+    TInStream tbi;
+    if (!open(tbi, file))    // The compression is detected, CSI files may have any extension.
+        return false;
 
     DirectionIterator<TInStream, Input>::Type iter = directionIterator(tbi, Input());
 
     // Read magic header.
     String<char, Array<4> > magic;
     read(magic, iter, 4);
-    if (magic != "TBI\1")
-        SEQAN_THROW(ParseError("Not in TBI format."));
+    if (magic != "TBI\1" && magic != "CSI\1")
+        SEQAN_THROW(ParseError("Not in TBI or CSI format."));
+    index.isCsi = (magic == "CSI\1");
 
     // Read parameters.
     int32_t nRef = 0;
-    readRawPod(nRef, iter);
-    readRawPod(index.format, iter);
-    readRawPod(index.colSeq, iter);
-    readRawPod(index.colBeg, iter);
-    readRawPod(index.colEnd, iter);
-    readRawPod(index.meta, iter);
-    readRawPod(index.skip, iter);
-
-    // Read concatenated names.
-    int32_t lNm = 0;
-    CharString tmp;
-    readRawPod(lNm, iter);
-    read(tmp, iter, lNm);
-    // Trim last terminating '\0's as they confuse strSplit() below
-    while (!empty(tmp) && back(tmp) == '\0')
-        resize(tmp, length(tmp) - 1);
-
-    // Split concatenated names at \0's.
-    clear(index._nameStore);
-    strSplit(index._nameStore, tmp, EqualsChar<'\0'>(), true, nRef - 1);
-    refresh(index._nameStoreCache);
+    if (index.isCsi)
+    {
+        int32_t lAux = 0;
+        readRawPod(index.minShift, iter);
+        readRawPod(index.depth, iter);
+        readRawPod(lAux, iter);
+        if (index.minShift < 0 || index.depth < 0 || index.minShift + 3 * index.depth > 63 || lAux < 0)
+            SEQAN_THROW(ParseError("Invalid CSI binning parameters."));
+        CharString aux;
+        read(aux, iter, lAux);
+        readRawPod(nRef, iter);
+
+        clear(index._nameStore);
+        refresh(index._nameStoreCache);
+        if (lAux >= 28)
+        {
+            DirectionIterator<CharString, Input>::Type auxIter = directionIterator(aux, Input());
+            _readTabixConfig(index, auxIter, nRef);
+        }
+    }
+    else
+    {
+        index.minShift = TabixIndex::BAM_LIDX_SHIFT;
+        index.depth = 5;
+        readRawPod(nRef, iter);
+        _readTabixConfig(index, iter, nRef);
+    }
 
     clear(index._linearIndices);
     clear(index._binIndices);
@@ -495,6 +624,8 @@ open(TabixIndex & index, char const * filename)
             uint32_t bin = 0;
             int32_t nChunk = 0;
             readRawPod(bin, iter);
+            if (index.isCsi)
+                readRawPod(data.loffset, iter);
             readRawPod(nChunk, iter);
 
             resize(data.chunkBegEnds, nChunk);
@@ -508,6 +639,9 @@ open(TabixIndex & index, char const * filename)
             index._binIndices[i][bin] = data;
         }
 
+        if (index.isCsi)
+            continue;
+
         // Read linear index.
         int32_t nIntv = 0;
         readRawPod(nIntv, iter);
@@ -527,6 +661,111 @@ open(TabixIndex & index, char const * filename)
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// Function save()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixIndex#save
+ * @brief Write a Tabix index to a file.
+ * @signature bool save(index, filename);
+ *
+ * @param[in] index    The index to write, in CSI format if <tt>index.isCsi</tt> is set and in TBI format otherwise.
+ * @param[in] filename Path of the index file. Types: char const *
+ *
+ * @return    bool     Returns <tt>true</tt> on success, false otherwise.
+ */
+
+template <typename TTarget>
+inline void
+_writeTabixConfig(TTarget & target, TabixIndex const & index)
+{
+    appendRawPod(target, index.format);
+    appendRawPod(target, index.colSeq);
+    appendRawPod(target, index.colBeg);
+    appendRawPod(target, index.colEnd);
+    appendRawPod(target, index.meta);
+    appendRawPod(target, index.skip);
+
+    int32_t lNm = 0;
+    for (unsigned i = 0; i < length(index._nameStore); ++i)
+        lNm += length(index._nameStore[i]) + 1;
+    appendRawPod(target, lNm);
+    for (unsigned i = 0; i < length(index._nameStore); ++i)
+    {
+        write(target, index._nameStore[i]);
+        writeValue(target, '\0');
+    }
+}
+
+inline bool
+save(TabixIndex const & index, char const * filename)
+{
+    typedef VirtualStream<char, Output> TOutStream;
+
+    std::ofstream file(filename, std::ios::binary | std::ios::out);
+    if (!file.good())
+        return false;
+    {
+        TOutStream out;
+        if (!open(out, file, BgzfFile()))
+            return false;
+        DirectionIterator<TOutStream, Output>::Type iter = directionIterator(out, Output());
+
+        int32_t nRef = length(index._binIndices);
+        if (index.isCsi)
+        {
+            // Reference names are only stored if the index was built for a text file.
+            CharString aux;
+            if (!empty(index._nameStore))
+                _writeTabixConfig(aux, index);
+
+            write(iter, "CSI\1");
+            appendRawPod(iter, index.minShift);
+            appendRawPod(iter, index.depth);
+            appendRawPod(iter, (int32_t)length(aux));
+            write(iter, aux);
+            appendRawPod(iter, nRef);
+        }
+        else
+        {
+            write(iter, "TBI\1");
+            appendRawPod(iter, nRef);
+            _writeTabixConfig(iter, index);
+        }
+
+        for (int32_t i = 0; i < nRef; ++i)
+        {
+            TabixIndex::TBinIndex_ const & bins = index._binIndices[i];
+            appendRawPod(iter, (int32_t)bins.size());
+            for (TabixIndex::TBinIndex_::const_iterator it = bins.begin(); it != bins.end(); ++it)
+            {
+                appendRawPod(iter, it->first);
+                if (index.isCsi)
+                    appendRawPod(iter, it->second.loffset);
+                appendRawPod(iter, (int32_t)length(it->second.chunkBegEnds));
+                for (unsigned k = 0; k < length(it->second.chunkBegEnds); ++k)
+                {
+                    appendRawPod(iter, it->second.chunkBegEnds[k].i1);
+                    appendRawPod(iter, it->second.chunkBegEnds[k].i2);
+                }
+            }
+
+            if (index.isCsi)
+                continue;
+
+            String<uint64_t> const & linear = index._linearIndices[i];
+            appendRawPod(iter, (int32_t)length(linear));
+            for (unsigned k = 0; k < length(linear); ++k)
+                appendRawPod(iter, linear[k]);
+        }
+
+        if (index.unalignedCount != std::numeric_limits<uint64_t>::max())
+            appendRawPod(iter, index.unalignedCount);
+    }
+    return file.good();
+}
+
 }  // namespace seqan2
 
 #endif  // #ifndef INCLUDE_SEQAN_TABIX_IO_TABIX_INDEX_TBI_H_
@@ -55,10 +55,23 @@
 #include <seqan/vcf_io/vcf_header.h>
 #include <seqan/vcf_io/vcf_record.h>
 
+#include <seqan/vcf_io/bcf_io_context.h>
 #include <seqan/vcf_io/vcf_io_context.h>
 #include <seqan/vcf_io/read_vcf.h>
+#include <seqan/vcf_io/read_bcf.h>
+#include <seqan/vcf_io/vcf_record_util.h>
 #include <seqan/vcf_io/write_vcf.h>
+#include <seqan/vcf_io/write_bcf.h>
 
 #include <seqan/vcf_io/vcf_file.h>
 
+// ===========================================================================
+// Tabix and CSI indices.
+// ===========================================================================
+
+#if SEQAN_HAS_ZLIB
+#include <seqan/tabix_io.h>
+#include <seqan/vcf_io/vcf_index.h>
+#endif
+
 #endif  // SEQAN_INCLUDE_SEQAN_VCF_IO_H_
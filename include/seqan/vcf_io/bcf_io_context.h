@@ -0,0 +1,220 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// State shared by the BCF2 reader and writer.
+//
+// BCF refers to FILTER, INFO, and FORMAT keys by their index in a dictionary
+// that is built from the header.  PASS is always 0, the other ids are
+// numbered in the order of their first occurrence unless the header line
+// carries an explicit IDX field.
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_BCF_IO_CONTEXT_H_
+#define SEQAN_INCLUDE_SEQAN_VCF_IO_BCF_IO_CONTEXT_H_
+
+#include <map>
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Enum BcfTypes_
+// ----------------------------------------------------------------------------
+
+// Type codes of typed values.
+
+enum BcfTypes_
+{
+    BCF_TYPE_NULL  = 0,
+    BCF_TYPE_INT8  = 1,
+    BCF_TYPE_INT16 = 2,
+    BCF_TYPE_INT32 = 3,
+    BCF_TYPE_FLOAT = 5,
+    BCF_TYPE_CHAR  = 7,
+    BCF_TYPE_UNDEFINED = 0xff   // key without header definition
+};
+
+// ----------------------------------------------------------------------------
+// Class BcfIOContext_
+// ----------------------------------------------------------------------------
+
+struct BcfIOContext_
+{
+    // Dictionary of FILTER, INFO, and FORMAT ids.
+    StringSet<CharString>           ids;
+    std::map<CharString, int32_t>   idMap;
+    // Value types of the INFO and FORMAT ids as declared in the header, Flag is BCF_TYPE_NULL.
+    String<uint8_t>                 infoTypes;
+    String<uint8_t>                 formatTypes;
+
+    // Buffers of the record.
+    CharString                      shared;
+    CharString                      indiv;
+    CharString                      buffer;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _vcfHeaderField()
+// ----------------------------------------------------------------------------
+
+// Extracts the value of key from a structured header value like
+// <ID=DP,Number=1,Type=Integer,Description="Total Depth">.
+
+template <typename TValue, typename TString>
+inline bool
+_vcfHeaderField(TValue & value, TString const & headerValue, char const * key)
+{
+    typedef typename Iterator<TString const, Standard>::Type TIter;
+
+    TIter it = begin(headerValue, Standard());
+    TIter itEnd = end(headerValue, Standard());
+    if (it != itEnd && *it == '<')
+        ++it;
+
+    CharString currentKey;
+    while (it != itEnd && *it != '>')
+    {
+        clear(currentKey);
+        for (; it != itEnd && *it != '=' && *it != ',' && *it != '>'; ++it)
+            appendValue(currentKey, *it);
+        bool isKey = (currentKey == key);
+        if (isKey)
+            clear(value);
+
+        if (it != itEnd && *it == '=')
+        {
+            ++it;
+            if (it != itEnd && *it == '"')
+            {
+                for (++it; it != itEnd && *it != '"'; ++it)
+                {
+                    if (*it == '\\' && it + 1 != itEnd)
+                        ++it;
+                    if (isKey)
+                        appendValue(value, *it);
+                }
+                if (it != itEnd)
+                    ++it;
+            }
+            for (; it != itEnd && *it != ',' && *it != '>'; ++it)
+                if (isKey)
+                    appendValue(value, *it);
+        }
+        if (isKey)
+            return true;
+        if (it != itEnd && *it == ',')
+            ++it;
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfTypeFromHeader()
+// ----------------------------------------------------------------------------
+
+template <typename TString>
+inline uint8_t
+_bcfTypeFromHeader(TString const & headerValue)
+{
+    CharString type;
+    if (!_vcfHeaderField(type, headerValue, "Type"))
+        return BCF_TYPE_UNDEFINED;
+    if (type == "Integer")
+        return BCF_TYPE_INT32;
+    if (type == "Float")
+        return BCF_TYPE_FLOAT;
+    if (type == "Flag")
+        return BCF_TYPE_NULL;
+    return BCF_TYPE_CHAR;   // String and Character
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfBuildDictionary()
+// ----------------------------------------------------------------------------
+
+inline void
+_bcfBuildDictionary(BcfIOContext_ & bcf, VcfHeader const & header)
+{
+    clear(bcf.ids);
+    bcf.idMap.clear();
+    clear(bcf.infoTypes);
+    clear(bcf.formatTypes);
+
+    appendValue(bcf.ids, "PASS");
+    bcf.idMap["PASS"] = 0;
+
+    CharString id, idx;
+    for (unsigned i = 0; i < length(header); ++i)
+    {
+        VcfHeaderRecord const & record = header[i];
+        bool isInfo = (record.key == "INFO");
+        bool isFormat = (record.key == "FORMAT");
+        if (!isInfo && !isFormat && record.key != "FILTER")
+            continue;
+        if (!_vcfHeaderField(id, record.value, "ID") || empty(id))
+            SEQAN_THROW(ParseError("Header line without ID."));
+
+        int32_t pos;
+        std::map<CharString, int32_t>::const_iterator it = bcf.idMap.find(id);
+        if (_vcfHeaderField(idx, record.value, "IDX"))
+            pos = lexicalCast<int32_t>(idx);
+        else if (it != bcf.idMap.end())
+            pos = it->second;
+        else
+            pos = length(bcf.ids);
+        if (pos < 0)
+            SEQAN_THROW(ParseError("Invalid IDX in header."));
+
+        if ((int32_t)length(bcf.ids) <= pos)
+            resize(bcf.ids, pos + 1);
+        bcf.ids[pos] = id;
+        bcf.idMap[id] = pos;
+
+        if (isInfo || isFormat)
+        {
+            String<uint8_t> & types = isInfo ? bcf.infoTypes : bcf.formatTypes;
+            if ((int32_t)length(types) <= pos)
+                resize(types, pos + 1, (uint8_t)BCF_TYPE_UNDEFINED);
+            types[pos] = _bcfTypeFromHeader(record.value);
+        }
+    }
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_BCF_IO_CONTEXT_H_
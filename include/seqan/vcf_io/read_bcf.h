@@ -0,0 +1,523 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Reading of BCF2 files.
+//
+// The binary fields are converted into the textual representation of the
+// VcfRecord, so that records read from VCF and BCF files compare equal.
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_READ_BCF_H_
+#define SEQAN_INCLUDE_SEQAN_VCF_IO_READ_BCF_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tag Bcf
+// ----------------------------------------------------------------------------
+
+/*!
+ * @tag FileFormats#Bcf
+ * @headerfile <seqan/vcf_io.h>
+ * @brief Binary variant call format file (BCF2).
+ *
+ * @signature typedef Tag<Bcf_> Bcf;
+ */
+struct Bcf_;
+typedef Tag<Bcf_> Bcf;
+
+// Integer values are widened to int32_t, these are the sentinels after widening.
+inline constexpr int32_t BCF_INT32_MISSING = std::numeric_limits<int32_t>::min();
+inline constexpr int32_t BCF_INT32_VECTOR_END = std::numeric_limits<int32_t>::min() + 1;
+inline constexpr uint32_t BCF_FLOAT_MISSING = 0x7F800001;
+inline constexpr uint32_t BCF_FLOAT_VECTOR_END = 0x7F800002;
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _bcfTypeSize()
+// ----------------------------------------------------------------------------
+
+inline int32_t
+_bcfTypeSize(uint8_t type)
+{
+    switch (type)
+    {
+        case BCF_TYPE_INT8:
+        case BCF_TYPE_CHAR:
+            return 1;
+        case BCF_TYPE_INT16:
+            return 2;
+        case BCF_TYPE_INT32:
+        case BCF_TYPE_FLOAT:
+            return 4;
+        case BCF_TYPE_NULL:
+            return 0;
+        default:
+            SEQAN_THROW(ParseError("BCF: invalid type of typed value."));
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfCheckAvailable()
+// ----------------------------------------------------------------------------
+
+inline void
+_bcfCheckAvailable(char const * it, char const * itEnd, int64_t numBytes)
+{
+    if (numBytes < 0 || itEnd - it < numBytes)
+        SEQAN_THROW(ParseError("BCF: record is truncated."));
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfInt()
+// ----------------------------------------------------------------------------
+
+// Value i of an integer vector, widened to int32_t.
+
+inline int32_t
+_bcfInt(char const * ptr, uint8_t type, int32_t i)
+{
+    switch (type)
+    {
+        case BCF_TYPE_INT8:
+        {
+            int8_t x = ptr[i];
+            return (x == -128) ? BCF_INT32_MISSING : (x == -127) ? BCF_INT32_VECTOR_END : x;
+        }
+        case BCF_TYPE_INT16:
+        {
+            int16_t x;
+            std::memcpy(&x, ptr + 2 * i, 2);
+            enforceLittleEndian(x);
+            return (x == -32768) ? BCF_INT32_MISSING : (x == -32767) ? BCF_INT32_VECTOR_END : x;
+        }
+        case BCF_TYPE_INT32:
+        {
+            int32_t x;
+            std::memcpy(&x, ptr + 4 * i, 4);
+            enforceLittleEndian(x);
+            return x;
+        }
+        default:
+            SEQAN_THROW(ParseError("BCF: integer expected."));
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfReadTypeDescriptor()
+// ----------------------------------------------------------------------------
+
+inline void
+_bcfReadTypeDescriptor(uint8_t & type, int32_t & size, char const * & it, char const * itEnd)
+{
+    _bcfCheckAvailable(it, itEnd, 1);
+    uint8_t descriptor = *it++;
+    type = descriptor & 15;
+    size = descriptor >> 4;
+    if (size == 15)
+    {
+        // The size follows as a typed integer.
+        uint8_t sizeType;
+        int32_t sizeSize;
+        _bcfReadTypeDescriptor(sizeType, sizeSize, it, itEnd);
+        if (sizeSize != 1 || sizeType == BCF_TYPE_FLOAT || sizeType == BCF_TYPE_CHAR)
+            SEQAN_THROW(ParseError("BCF: invalid size of typed value."));
+        _bcfCheckAvailable(it, itEnd, _bcfTypeSize(sizeType));
+        size = _bcfInt(it, sizeType, 0);
+        it += _bcfTypeSize(sizeType);
+        if (size < 0)
+            SEQAN_THROW(ParseError("BCF: invalid size of typed value."));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfReadPod()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline void
+_bcfReadPod(TValue & value, char const * & it)
+{
+    std::memcpy(&value, it, sizeof(TValue));
+    enforceLittleEndian(value);
+    it += sizeof(TValue);
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfReadTypedInt()
+// ----------------------------------------------------------------------------
+
+// Reads a typed integer vector of length one, e.g. a dictionary key.
+
+inline int32_t
+_bcfReadTypedInt(char const * & it, char const * itEnd)
+{
+    uint8_t type;
+    int32_t size;
+    _bcfReadTypeDescriptor(type, size, it, itEnd);
+    if (size != 1)
+        SEQAN_THROW(ParseError("BCF: single integer expected."));
+    _bcfCheckAvailable(it, itEnd, _bcfTypeSize(type));
+    int32_t value = _bcfInt(it, type, 0);
+    it += _bcfTypeSize(type);
+    return value;
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfAppendValues()
+// ----------------------------------------------------------------------------
+
+// Appends a typed vector in VCF notation.  Returns false if the vector holds
+// no value at all (empty, or starting with the end-of-vector marker).
+
+template <typename TTarget>
+inline bool
+_bcfAppendValues(TTarget & target, char const * ptr, uint8_t type, int32_t size)
+{
+    int32_t i = 0;
+    if (type == BCF_TYPE_CHAR)
+    {
+        for (; i < size && ptr[i] != '\0'; ++i)
+            appendValue(target, ptr[i]);
+    }
+    else if (type == BCF_TYPE_FLOAT)
+    {
+        for (; i < size; ++i)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, ptr + 4 * i, 4);
+            enforceLittleEndian(bits);
+            if (bits == BCF_FLOAT_VECTOR_END)
+                break;
+            if (i != 0)
+                appendValue(target, ',');
+            if (bits == BCF_FLOAT_MISSING)
+            {
+                appendValue(target, '.');
+            }
+            else
+            {
+                float x;
+                std::memcpy(&x, &bits, 4);
+                appendNumber(target, x);
+            }
+        }
+    }
+    else if (type != BCF_TYPE_NULL)
+    {
+        for (; i < size; ++i)
+        {
+            int32_t x = _bcfInt(ptr, type, i);
+            if (x == BCF_INT32_VECTOR_END)
+                break;
+            if (i != 0)
+                appendValue(target, ',');
+            if (x == BCF_INT32_MISSING)
+                appendValue(target, '.');
+            else
+                appendNumber(target, x);
+        }
+    }
+    return i != 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfAppendGenotype()
+// ----------------------------------------------------------------------------
+
+// Alleles are encoded as (allele + 1) << 1 | phased, 0 is a missing allele.
+
+template <typename TTarget>
+inline bool
+_bcfAppendGenotype(TTarget & target, char const * ptr, uint8_t type, int32_t size)
+{
+    if (type == BCF_TYPE_CHAR || type == BCF_TYPE_FLOAT)
+        return _bcfAppendValues(target, ptr, type, size);
+
+    int32_t i = 0;
+    for (; i < size; ++i)
+    {
+        int32_t x = _bcfInt(ptr, type, i);
+        if (x == BCF_INT32_VECTOR_END)
+            break;
+        if (i != 0)
+            appendValue(target, (x & 1) ? '|' : '/');
+        if (x == BCF_INT32_MISSING || (x >> 1) == 0)
+            appendValue(target, '.');
+        else
+            appendNumber(target, (x >> 1) - 1);
+    }
+    return i != 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfGenotypeInfo()
+// ----------------------------------------------------------------------------
+
+// Decodes the sample column sampleIdx from the FORMAT block [it, itEnd).
+// Fields without values are written as '.', trailing ones are dropped.
+
+template <typename TTarget>
+inline void
+_bcfGenotypeInfo(TTarget & info,
+                 char const * it,
+                 char const * itEnd,
+                 uint32_t numFields,
+                 uint32_t numSamples,
+                 CharString const & format,
+                 unsigned sampleIdx)
+{
+    typedef Iterator<CharString const, Standard>::Type TFormatIter;
+
+    clear(info);
+    size_t keep = 0;
+    TFormatIter formatIt = begin(format, Standard());
+    TFormatIter formatEnd = end(format, Standard());
+    for (uint32_t f = 0; f < numFields; ++f)
+    {
+        // Check whether the field is GT.
+        TFormatIter keyBegin = formatIt;
+        while (formatIt != formatEnd && *formatIt != ':')
+            ++formatIt;
+        bool isGenotype = (formatIt - keyBegin == 2 && keyBegin[0] == 'G' && keyBegin[1] == 'T');
+        if (formatIt != formatEnd)
+            ++formatIt;
+
+        _bcfReadTypedInt(it, itEnd);    // key
+        uint8_t type;
+        int32_t size;
+        _bcfReadTypeDescriptor(type, size, it, itEnd);
+        int64_t width = (int64_t)size * _bcfTypeSize(type);
+        _bcfCheckAvailable(it, itEnd, width * numSamples);
+
+        if (f != 0)
+            appendValue(info, ':');
+        char const * ptr = it + width * sampleIdx;
+        bool present = isGenotype ? _bcfAppendGenotype(info, ptr, type, size) : _bcfAppendValues(info, ptr, type, size);
+        if (present)
+            keep = length(info);
+        else
+            appendValue(info, '.');
+        it += width * numSamples;
+    }
+    resize(info, keep);
+}
+
+// ----------------------------------------------------------------------------
+// Function readHeader()                                            [VcfHeader]
+// ----------------------------------------------------------------------------
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readHeader(VcfHeader & header,
+           VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           Bcf const & /*tag*/)
+{
+    CharString & buffer = context.bcf.buffer;
+
+    clear(buffer);
+    read(buffer, iter, 5);
+    if (length(buffer) != 5 || !startsWith(buffer, "BCF\2") || (buffer[4] != '\1' && buffer[4] != '\2'))
+        SEQAN_THROW(ParseError("Not in BCF2 format."));
+
+    uint32_t textLength = 0;
+    readRawPod(textLength, iter);
+    CharString text;
+    read(text, iter, textLength);
+    if (length(text) != textLength)
+        SEQAN_THROW(ParseError("BCF: header is truncated."));
+
+    // The header is plain VCF text, terminated by '\0'.
+    typename DirectionIterator<CharString, Input>::Type textIter = directionIterator(text, Input());
+    readHeader(header, context, textIter, Vcf());
+    _bcfBuildDictionary(context.bcf, header);
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecord()                                            [VcfRecord]
+// ----------------------------------------------------------------------------
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readRecord(VcfRecord & record,
+           VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           Bcf const & /*tag*/)
+{
+    BcfIOContext_ & bcf = context.bcf;
+    clear(record);
+
+    uint32_t sharedLength = 0, indivLength = 0;
+    readRawPod(sharedLength, iter);
+    readRawPod(indivLength, iter);
+    clear(bcf.buffer);
+    read(bcf.buffer, iter, (size_t)sharedLength + indivLength);
+    if (length(bcf.buffer) != (size_t)sharedLength + indivLength)
+        SEQAN_THROW(ParseError("BCF: record is truncated."));
+
+    char const * it = begin(bcf.buffer, Standard());
+    char const * itEnd = it + sharedLength;
+
+    // Fixed fields.
+    _bcfCheckAvailable(it, itEnd, 24);
+    int32_t rlen;
+    uint32_t qualBits, numAlleleInfo, numFormatSample;
+    _bcfReadPod(record.rID, it);
+    _bcfReadPod(record.beginPos, it);
+    _bcfReadPod(rlen, it);
+    _bcfReadPod(qualBits, it);
+    _bcfReadPod(numAlleleInfo, it);
+    _bcfReadPod(numFormatSample, it);
+    if (qualBits == BCF_FLOAT_MISSING)
+        record.qual = VcfRecord::MISSING_QUAL();
+    else
+        std::memcpy(&record.qual, &qualBits, 4);
+
+    if (record.rID < 0 || record.rID >= (int32_t)length(contigNames(context)))
+        SEQAN_THROW(ParseError("BCF: unknown contig."));
+
+    uint8_t type;
+    int32_t size;
+
+    // ID
+    _bcfReadTypeDescriptor(type, size, it, itEnd);
+    _bcfCheckAvailable(it, itEnd, (int64_t)size * _bcfTypeSize(type));
+    if (!_bcfAppendValues(record.id, it, type, size))
+        appendValue(record.id, '.');
+    it += size * _bcfTypeSize(type);
+
+    // REF and ALT
+    unsigned numAlleles = numAlleleInfo >> 16;
+    for (unsigned i = 0; i < numAlleles; ++i)
+    {
+        _bcfReadTypeDescriptor(type, size, it, itEnd);
+        _bcfCheckAvailable(it, itEnd, (int64_t)size * _bcfTypeSize(type));
+        if (i > 1)
+            appendValue(record.alt, ',');
+        _bcfAppendValues((i == 0) ? record.ref : record.alt, it, type, size);
+        it += size * _bcfTypeSize(type);
+    }
+    if (numAlleles < 2)
+        appendValue(record.alt, '.');
+
+    // FILTER
+    _bcfReadTypeDescriptor(type, size, it, itEnd);
+    _bcfCheckAvailable(it, itEnd, (int64_t)size * _bcfTypeSize(type));
+    for (int32_t i = 0; i < size; ++i)
+    {
+        int32_t id = _bcfInt(it, type, i);
+        if (id == BCF_INT32_VECTOR_END)
+            break;
+        if (id < 0 || id >= (int32_t)length(bcf.ids))
+            SEQAN_THROW(ParseError("BCF: unknown FILTER."));
+        if (i != 0)
+            appendValue(record.filter, ';');
+        append(record.filter, bcf.ids[id]);
+    }
+    if (empty(record.filter))
+        appendValue(record.filter, '.');
+    it += size * _bcfTypeSize(type);
+
+    // INFO
+    unsigned numInfos = numAlleleInfo & 0xffff;
+    for (unsigned i = 0; i < numInfos; ++i)
+    {
+        int32_t id = _bcfReadTypedInt(it, itEnd);
+        if (id < 0 || id >= (int32_t)length(bcf.ids))
+            SEQAN_THROW(ParseError("BCF: unknown INFO key."));
+        _bcfReadTypeDescriptor(type, size, it, itEnd);
+        _bcfCheckAvailable(it, itEnd, (int64_t)size * _bcfTypeSize(type));
+        if (i != 0)
+            appendValue(record.info, ';');
+        append(record.info, bcf.ids[id]);
+        if (size != 0 && type != BCF_TYPE_NULL)
+        {
+            appendValue(record.info, '=');
+            if (!_bcfAppendValues(record.info, it, type, size))
+                appendValue(record.info, '.');
+        }
+        it += size * _bcfTypeSize(type);
+    }
+    if (empty(record.info))
+        appendValue(record.info, '.');
+
+    // FORMAT keys and the per-sample values.
+    uint32_t numFields = numFormatSample >> 24;
+    uint32_t numSamples = numFormatSample & 0xffffff;
+    if (numFields == 0)
+        return;
+    if (numSamples != length(sampleNames(context)))
+        SEQAN_THROW(ParseError("BCF: number of samples does not match the header."));
+
+    it = begin(bcf.buffer, Standard()) + sharedLength;
+    itEnd = it + indivLength;
+    char const * indivBegin = it;
+    for (uint32_t f = 0; f < numFields; ++f)
+    {
+        int32_t id = _bcfReadTypedInt(it, itEnd);
+        if (id < 0 || id >= (int32_t)length(bcf.ids))
+            SEQAN_THROW(ParseError("BCF: unknown FORMAT key."));
+        if (f != 0)
+            appendValue(record.format, ':');
+        append(record.format, bcf.ids[id]);
+        _bcfReadTypeDescriptor(type, size, it, itEnd);
+        int64_t blockSize = (int64_t)size * _bcfTypeSize(type) * numSamples;
+        _bcfCheckAvailable(it, itEnd, blockSize);
+        it += blockSize;
+    }
+
+    if (context.lazyGenotypes)
+    {
+        record._rawGenotypes.buffer = infix(bcf.buffer, sharedLength, length(bcf.buffer));
+        record._rawGenotypes.numSamples = numSamples;
+        record._rawGenotypes.numFields = numFields;
+        record._rawGenotypes.isBcf = true;
+        return;
+    }
+
+    resize(record.genotypeInfos, numSamples);
+    for (uint32_t s = 0; s < numSamples; ++s)
+        _bcfGenotypeInfo(record.genotypeInfos[s], indivBegin, itEnd, numFields, numSamples, record.format, s);
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_READ_BCF_H_
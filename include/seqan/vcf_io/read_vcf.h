@@ -181,11 +181,16 @@ readRecord(VcfRecord & record,
     // The first 8(9) columns are fields and the rest are values for samples
     //"#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT")
     StringSet<CharString> field_values;
-    strSplit(field_values, buffer, IsTab(), false);
-
     unsigned numSamples = length(sampleNames(context));
+    bool lazy = context.lazyGenotypes && numSamples != 0;
+
+    // Keep the sample columns together if they are decoded on demand.
+    if (lazy)
+        strSplit(field_values, buffer, IsTab(), false, 9u);
+    else
+        strSplit(field_values, buffer, IsTab(), false);
 
-    if (length(field_values) < 8u + numSamples)
+    if (length(field_values) < (lazy ? 10u : 8u + numSamples))
         SEQAN_THROW(ParseError("Not enough values in a line."));
 
     record.rID      = nameToId(contigNamesCache(context), field_values[0]);
@@ -202,6 +207,15 @@ readRecord(VcfRecord & record,
     record.filter   = field_values[6];
     record.info     = field_values[7];
 
+    if (lazy)
+    {
+        record.format = field_values[8];
+        record._rawGenotypes.buffer = field_values[9];
+        record._rawGenotypes.numSamples = numSamples;
+        record._rawGenotypes.isBcf = false;
+        return;
+    }
+
     //check if we have a spare column for FORMAT
     unsigned samplesColStart = 8;
     if (length(field_values) > 8u + numSamples) // we have extara column for FORMAT
@@ -33,7 +33,6 @@
 // ==========================================================================
 // Class for reading/writing files in Vcf format.
 // ==========================================================================
-// TODO(weese:) add Bcf I/O and integrate it
 
 #ifndef SEQAN_VCF_IO_VCF_FILE_H_
 #define SEQAN_VCF_IO_VCF_FILE_H_
@@ -63,7 +62,7 @@ typedef Tag<Bcf_> Bcf;
  * @signature typedef FormattedFile<Vcf, Input> VcfFileIn;
  * @extends FormattedFileIn
  * @headerfile <seqan/vcf_io.h>
- * @brief Class for reading VCF files.
+ * @brief Class for reading VCF and BCF files.
  *
  * @see VcfHeader
  * @see VcfRecord
@@ -80,7 +79,7 @@ typedef FormattedFile<Vcf, Input>   VcfFileIn;
  * @signature typedef FormattedFile<Vcf, Output> VcfFileOut;
  * @extends FormattedFileOut
  * @headerfile <seqan/vcf_io.h>
- * @brief Class for writing VCF files.
+ * @brief Class for writing VCF and BCF files.
  *
  * @see VcfHeader
  * @see VcfRecord
@@ -111,11 +110,11 @@ unsigned char const MagicHeader<Vcf, T>::VALUE[16] =
 template <typename T>
 struct MagicHeader<Bcf, T>
 {
-    static unsigned char const VALUE[5];
+    static unsigned char const VALUE[4];
 };
 
 template <typename T>
-unsigned char const MagicHeader<Bcf, T>::VALUE[5] = { 'B', 'C', 'F', '\2', '\1' };  // BCF2's magic header
+unsigned char const MagicHeader<Bcf, T>::VALUE[4] = { 'B', 'C', 'F', '\2' };  // BCF2's magic header, any minor version
 
 // ----------------------------------------------------------------------------
 // Class FileExtensions
@@ -164,17 +163,15 @@ struct FormattedFileContext<FormattedFile<Vcf, TDirection, TSpec>, TStorageSpec>
 template <typename TDirection, typename TSpec>
 struct FileFormat<FormattedFile<Vcf, TDirection, TSpec> >
 {
-// TODO(weese:) Enable this, as soon as someone implements BCF
-
-//#if SEQAN_HAS_ZLIB
-//    typedef TagSelector<
-//                TagList<Bcf,
-//                TagList<Vcf
-//                > >
-//            > Type;
-//#else
+#if SEQAN_HAS_ZLIB
+    typedef TagSelector<
+                TagList<Vcf,
+                TagList<Bcf
+                > >
+            > Type;
+#else
     typedef Vcf Type;
-//#endif
+#endif
 };
 
 // --------------------------------------------------------------------------
@@ -191,6 +188,32 @@ _mapFileFormatToCompressionFormat(Bcf)
 // Function readHeader(); VcfHeader
 // ----------------------------------------------------------------------------
 
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readHeader(VcfHeader & /* header */,
+           VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & /* context */,
+           TForwardIter & /* iter */,
+           TagSelector<> const & /* format */)
+{
+    SEQAN_FAIL("VcfFileIn: File format not specified.");
+}
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TTagList>
+inline void
+readHeader(VcfHeader & header,
+           VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           TagSelector<TTagList> const & format)
+{
+    typedef typename TTagList::Type TFormat;
+
+    if (isEqual(format, TFormat()))
+        readHeader(header, context, iter, TFormat());
+    else
+        readHeader(header, context, iter, static_cast<typename TagSelector<TTagList>::Base const &>(format));
+}
+
+// convenient VcfFile variant
 template <typename TSpec>
 inline void
 readHeader(VcfHeader & header, FormattedFile<Vcf, Input, TSpec> & file)
@@ -202,6 +225,32 @@ readHeader(VcfHeader & header, FormattedFile<Vcf, Input, TSpec> & file)
 // Function readRecord(); VcfRecord
 // ----------------------------------------------------------------------------
 
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readRecord(VcfRecord & /* record */,
+           VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & /* context */,
+           TForwardIter & /* iter */,
+           TagSelector<> const & /* format */)
+{
+    SEQAN_FAIL("VcfFileIn: File format not specified.");
+}
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TTagList>
+inline void
+readRecord(VcfRecord & record,
+           VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           TagSelector<TTagList> const & format)
+{
+    typedef typename TTagList::Type TFormat;
+
+    if (isEqual(format, TFormat()))
+        readRecord(record, context, iter, TFormat());
+    else
+        readRecord(record, context, iter, static_cast<typename TagSelector<TTagList>::Base const &>(format));
+}
+
+// convenient VcfFile variant
 template <typename TSpec>
 inline void
 readRecord(VcfRecord & record, FormattedFile<Vcf, Input, TSpec> & file)
@@ -213,6 +262,32 @@ readRecord(VcfRecord & record, FormattedFile<Vcf, Input, TSpec> & file)
 // Function writeHeader(); VcfHeader
 // ----------------------------------------------------------------------------
 
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+writeHeader(TTarget & /* target */,
+            VcfHeader const & /* header */,
+            VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & /* context */,
+            TagSelector<> const & /* format */)
+{
+    SEQAN_FAIL("VcfFileOut: File format not specified.");
+}
+
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TTagList>
+inline void
+writeHeader(TTarget & target,
+            VcfHeader const & header,
+            VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+            TagSelector<TTagList> const & format)
+{
+    typedef typename TTagList::Type TFormat;
+
+    if (isEqual(format, TFormat()))
+        writeHeader(target, header, context, TFormat());
+    else
+        writeHeader(target, header, context, static_cast<typename TagSelector<TTagList>::Base const &>(format));
+}
+
+// convenient VcfFile variant
 template <typename TSpec>
 inline void
 writeHeader(FormattedFile<Vcf, Output, TSpec> & file, VcfHeader & header)
@@ -224,6 +299,32 @@ writeHeader(FormattedFile<Vcf, Output, TSpec> & file, VcfHeader & header)
 // Function writeRecord(); VcfRecord
 // ----------------------------------------------------------------------------
 
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+writeRecord(TTarget & /* target */,
+            VcfRecord const & /* record */,
+            VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & /* context */,
+            TagSelector<> const & /* format */)
+{
+    SEQAN_FAIL("VcfFileOut: File format not specified.");
+}
+
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TTagList>
+inline void
+writeRecord(TTarget & target,
+            VcfRecord const & record,
+            VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+            TagSelector<TTagList> const & format)
+{
+    typedef typename TTagList::Type TFormat;
+
+    if (isEqual(format, TFormat()))
+        writeRecord(target, record, context, TFormat());
+    else
+        writeRecord(target, record, context, static_cast<typename TagSelector<TTagList>::Base const &>(format));
+}
+
+// convenient VcfFile variant
 template <typename TSpec>
 inline void
 writeRecord(FormattedFile<Vcf, Output, TSpec> & file, VcfRecord & record)
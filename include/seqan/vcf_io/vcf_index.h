@@ -0,0 +1,227 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Construction of tabix and CSI indices for VCF and BCF files and region
+// queries through them.
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_VCF_INDEX_H_
+#define SEQAN_INCLUDE_SEQAN_VCF_IO_VCF_INDEX_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function build()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixIndex#build
+ * @brief Build the index of a bgzip compressed VCF or a BCF file.
+ *
+ * @signature bool build(index, fileName[, minShift]);
+ *
+ * @param[out] index    The @link TabixIndex @endlink to build.
+ * @param[in]  fileName Path to the coordinate-sorted file, <tt>char const *</tt>.
+ * @param[in]  minShift The size of the smallest bin is <tt>1 &lt;&lt; minShift</tt>.  The default of 0 builds a
+ *                      TBI index for VCF and a CSI index with 16kb bins for BCF files.  Any other value builds a CSI
+ *                      index, which is required for contigs longer than 512 Mbp.
+ * @return bool <tt>true</tt> on success, <tt>false</tt> if the file could not be opened, is not compressed with
+ *              BGZF, or is not sorted by coordinate.
+ *
+ * The index is built in a single pass over the file.  The genotype infos are not decoded.  Use
+ * @link TabixIndex#save @endlink to write the index.
+ */
+
+inline bool
+build(TabixIndex & index, char const * fileName, int minShift = 0)
+{
+    typedef BinningIndexBuilder_::TBins     TBins;
+
+    VcfFileIn vcfFile;
+    if (!open(vcfFile, fileName) || !isEqual(format(vcfFile.stream), BgzfFile()))
+        return false;
+    context(vcfFile).lazyGenotypes = true;
+    bool isBcf = isEqual(format(vcfFile), Bcf());
+
+    VcfHeader header;
+    readHeader(header, vcfFile);
+
+    clear(index._binIndices);
+    clear(index._linearIndices);
+    clear(index._nameStore);
+    refresh(index._nameStoreCache);
+    index.isCsi = isBcf || minShift > 0;
+    index.minShift = (minShift > 0) ? minShift : TabixIndex::BAM_LIDX_SHIFT;
+    index.depth = (index.isCsi) ? (31 - index.minShift + 2) / 3 : 5;
+    index.format = 2;   // VCF
+    index.colSeq = 1;
+    index.colBeg = 2;
+    index.colEnd = 0;
+    index.meta = '#';
+    index.skip = 0;
+
+    // BCF refers to the contigs of the header, their lengths determine the depth.
+    if (isBcf)
+    {
+        CharString id;
+        int64_t maxLen = 0;
+        for (unsigned i = 0; i < length(header); ++i)
+            if (header[i].key == "contig" && _vcfHeaderField(id, header[i].value, "length"))
+                maxLen = std::max(maxLen, (int64_t)lexicalCast<uint64_t>(id));
+        if (maxLen > 0)
+        {
+            maxLen += 256;
+            index.depth = 0;
+            for (int64_t s = (int64_t)1 << index.minShift; maxLen > s; ++index.depth, s <<= 3) {}
+        }
+    }
+    if (index.minShift + 3 * index.depth > 63)
+        return false;
+
+    // Text files are indexed by the contigs in order of their first occurrence.
+    unsigned numRefs = isBcf ? length(contigNames(context(vcfFile))) : 0;
+    String<int32_t> refIds;
+    BinningIndexBuilder_ builder(numRefs, position(vcfFile), index.minShift, index.depth);
+
+    VcfRecord record;
+    while (!atEnd(vcfFile))
+    {
+        readRecord(record, vcfFile);
+
+        int32_t tid = record.rID;
+        if (!isBcf)
+        {
+            if ((int32_t)length(refIds) <= record.rID)
+                resize(refIds, record.rID + 1, -1);
+            if (refIds[record.rID] == -1)
+            {
+                refIds[record.rID] = length(index._nameStore);
+                appendName(index._nameStoreCache, contigNames(context(vcfFile))[record.rID]);
+                resize(builder.bins, length(index._nameStore));
+                resize(builder.linear, length(index._nameStore));
+                resize(builder.hasData, length(index._nameStore), false);
+            }
+            tid = refIds[record.rID];
+        }
+
+        int64_t beg = record.beginPos;
+        if (!_binningIndexPush(builder, tid, beg, beg + _vcfRecordLength(record), position(vcfFile), true))
+            return false;
+    }
+    _binningIndexFinish(builder, builder.lastOff);
+
+    resize(index._binIndices, length(builder.bins));
+    for (unsigned i = 0; i < length(builder.bins); ++i)
+        for (TBins::const_iterator it = builder.bins[i].begin(); it != builder.bins[i].end(); ++it)
+        {
+            TabixIndexBinData_ & bin = index._binIndices[i][it->first];
+            bin.loffset = it->second.loffset;
+            bin.chunkBegEnds = it->second.chunkBegEnds;
+        }
+    if (!index.isCsi)
+        index._linearIndices = builder.linear;
+    else
+        resize(index._linearIndices, length(builder.bins));
+    index.unalignedCount = builder.nNoCoor;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function viewRecords()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixIndex#viewRecords
+ * @brief Read all records of a VCF or BCF file overlapping a region.
+ *
+ * @signature void viewRecords(records, vcfFile, index, refName, posBeg, posEnd);
+ *
+ * @param[out]    records The @link VcfRecord @endlink objects overlapping the region are appended to this container.
+ * @param[in,out] vcfFile The @link VcfFileIn @endlink to read from, the header must have been read.
+ * @param[in]     index   The @link TabixIndex @endlink of the file.
+ * @param[in]     refName The name of the contig.
+ * @param[in]     posBeg  The 0-based begin position of the region.
+ * @param[in]     posEnd  The 0-based end position of the region, exclusive.
+ *
+ * A record overlaps the region if the reference bases of REF, or up to the END given in the INFO field, overlap it.
+ * The records are read with the settings of the file's context, e.g. @link VcfIOContext::lazyGenotypes @endlink.
+ */
+
+template <typename TContainer, typename TSpec, typename TName>
+inline void
+viewRecords(TContainer & records,
+            FormattedFile<Vcf, Input, TSpec> & vcfFile,
+            TabixIndex const & index,
+            TName const & refName,
+            int32_t posBeg,
+            int32_t posEnd)
+{
+    typedef String<Pair<uint64_t, uint64_t> > TChunks;
+
+    // Indices of BCF files refer to the contigs of the header.
+    unsigned refId = 0;
+    if (empty(index._nameStore))
+    {
+        if (!getIdByName(refId, contigNamesCache(context(vcfFile)), refName))
+            return;
+    }
+    else if (!getIdByName(refId, index._nameStoreCache, refName))
+    {
+        return;
+    }
+
+    TChunks chunks;
+    _tabixChunks(chunks, index, refId, posBeg, posEnd);
+
+    VcfRecord record;
+    for (unsigned c = 0; c < length(chunks); ++c)
+    {
+        setPosition(vcfFile, chunks[c].i1);
+        while (static_cast<uint64_t>(position(vcfFile)) < chunks[c].i2 && !atEnd(vcfFile))
+        {
+            readRecord(record, vcfFile);
+            if (contigNames(context(vcfFile))[record.rID] != refName)
+                continue;
+            if (record.beginPos >= posEnd)
+                return;
+            if (record.beginPos + _vcfRecordLength(record) > posBeg)
+                appendValue(records, record, Generous());
+        }
+    }
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_VCF_INDEX_H_
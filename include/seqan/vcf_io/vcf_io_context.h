@@ -67,6 +67,15 @@ namespace seqan2 {
  * Default constructor or construction with references to contig and sample names.
  */
 
+/*!
+ * @var bool VcfIOContext::lazyGenotypes
+ * @brief If <tt>true</tt>, the sample columns are not decoded when reading records, default <tt>false</tt>.
+ *
+ * The genotype infos of a record are then decoded on demand with @link VcfRecord#getGenotypeInfo @endlink or
+ * @link VcfRecord#loadGenotypeInfos @endlink.  This makes streaming over files with many samples much faster if
+ * only some of the samples or only the site information is needed.
+ */
+
 template <typename TNameStore_        = StringSet<CharString>,
           typename TNameStoreCache_   = NameStoreCache<TNameStore_>,
           typename TStorageSpec       = Owner<> >
@@ -89,6 +98,12 @@ public:
 
     CharString              buffer;
 
+    // Decode sample columns on demand.
+    bool                    lazyGenotypes;
+
+    // BCF dictionary and buffers.
+    BcfIOContext_           bcf;
+
     VcfIOContext() :
         _contigNames(TNameStoreMember()),
         _contigNamesCache(ifSwitch(typename IsPointer<TNameStoreCacheMember>::Type(),
@@ -97,7 +112,8 @@ public:
         _sampleNames(TNameStoreMember()),
         _sampleNamesCache(ifSwitch(typename IsPointer<TNameStoreCacheMember>::Type(),
                                  (TNameStoreCache*)NULL,
-                                 _sampleNames))
+                                 _sampleNames)),
+        lazyGenotypes(false)
     {}
 
     VcfIOContext(TNameStore & nameStore_, TNameStoreCache & nameStoreCache_) :
@@ -108,7 +124,8 @@ public:
         _sampleNames(TNameStoreMember()),
         _sampleNamesCache(ifSwitch(typename IsPointer<TNameStoreCacheMember>::Type(),
                                  (TNameStoreCache*)NULL,
-                                 _sampleNames))
+                                 _sampleNames)),
+        lazyGenotypes(false)
     {}
 
     template <typename TOtherStorageSpec>
@@ -120,7 +137,8 @@ public:
         _sampleNames(_referenceCast<typename Parameter_<TNameStoreMember>::Type>(sampleNames(other))),
         _sampleNamesCache(ifSwitch(typename IsPointer<TNameStoreCacheMember>::Type(),
                                  &sampleNamesCache(other),
-                                 _sampleNames))
+                                 _sampleNames)),
+        lazyGenotypes(other.lazyGenotypes)
     {}
 };
 
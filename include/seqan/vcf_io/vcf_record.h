@@ -43,6 +43,25 @@ namespace seqan2 {
 // Tags, Classes, Enums
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Helper Class VcfRawGenotypes_
+// ----------------------------------------------------------------------------
+
+// Sample columns that are decoded on demand, see VcfIOContext::lazyGenotypes.
+// For VCF, buffer holds the tab-separated sample columns of the line, for BCF
+// the FORMAT block of the record.
+
+struct VcfRawGenotypes_
+{
+    CharString buffer;
+    uint32_t numSamples;    // 0 if there are no raw genotypes
+    uint32_t numFields;     // BCF only, number of FORMAT fields
+    bool isBcf;
+
+    VcfRawGenotypes_() : numSamples(0), numFields(0), isBcf(false)
+    {}
+};
+
 // ----------------------------------------------------------------------------
 // Class VcfRecord
 // ----------------------------------------------------------------------------
@@ -93,6 +112,9 @@ namespace seqan2 {
  * @var VariableType VcfRecord::genotypeInfos
  * @brief Genotype information, as in VCF file (@link StringSet @endlink<@link CharString @endlink>).
  *
+ * Empty if the record was read with @link VcfIOContext::lazyGenotypes @endlink set, use
+ * @link VcfRecord#getGenotypeInfo @endlink or @link VcfRecord#loadGenotypeInfos @endlink then.
+ *
  * @var VariableType VcfRecord::info
  * @brief Value of the INFO field, empty if "." in VCF file (@link CharString @endlink).
  *
@@ -152,6 +174,8 @@ public:
     CharString format;
     // The genotype infos.
     StringSet<CharString> genotypeInfos;
+    // Genotype infos that are not decoded yet.
+    VcfRawGenotypes_ _rawGenotypes;
 
     // Default constructor.
     VcfRecord() : rID(INVALID_REFID), beginPos(INVALID_POS), qual(MISSING_QUAL())
@@ -195,6 +219,9 @@ inline void clear(VcfRecord & record)
     clear(record.info);
     clear(record.format);
     clear(record.genotypeInfos);
+    clear(record._rawGenotypes.buffer);
+    record._rawGenotypes.numSamples = 0;
+    record._rawGenotypes.numFields = 0;
 }
 
 }  // namespace seqan2
@@ -0,0 +1,182 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Accessors for VcfRecord that need the I/O code, e.g. on demand decoding of
+// the genotype infos.
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_VCF_RECORD_UTIL_H_
+#define SEQAN_INCLUDE_SEQAN_VCF_IO_VCF_RECORD_UTIL_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _vcfNumGenotypeInfos()
+// ----------------------------------------------------------------------------
+
+inline unsigned
+_vcfNumGenotypeInfos(VcfRecord const & record)
+{
+    if (record._rawGenotypes.numSamples != 0)
+        return record._rawGenotypes.numSamples;
+    return length(record.genotypeInfos);
+}
+
+// ----------------------------------------------------------------------------
+// Function getGenotypeInfo()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn VcfRecord#getGenotypeInfo
+ * @brief Get the genotype info of one sample, decoding it if necessary.
+ *
+ * @signature void getGenotypeInfo(info, record, sampleIdx);
+ *
+ * @param[out] info      The genotype info in VCF notation, e.g. <tt>0|1:48:8</tt> (@link CharString @endlink).
+ * @param[in]  record    The @link VcfRecord @endlink to query.
+ * @param[in]  sampleIdx The index of the sample.
+ *
+ * Only the requested sample is decoded if the record was read with @link VcfIOContext::lazyGenotypes @endlink set.
+ */
+
+template <typename TTarget>
+inline void
+getGenotypeInfo(TTarget & info, VcfRecord const & record, unsigned sampleIdx)
+{
+    typedef Iterator<CharString const, Standard>::Type TIter;
+
+    VcfRawGenotypes_ const & raw = record._rawGenotypes;
+    if (raw.numSamples == 0)
+    {
+        if (sampleIdx >= length(record.genotypeInfos))
+            SEQAN_THROW(std::out_of_range("Invalid sample index."));
+        info = record.genotypeInfos[sampleIdx];
+        return;
+    }
+    if (sampleIdx >= raw.numSamples)
+        SEQAN_THROW(std::out_of_range("Invalid sample index."));
+
+    if (raw.isBcf)
+    {
+        _bcfGenotypeInfo(info, begin(raw.buffer, Standard()), end(raw.buffer, Standard()),
+                         raw.numFields, raw.numSamples, record.format, sampleIdx);
+        return;
+    }
+
+    // Skip to the column of the sample.
+    clear(info);
+    TIter it = begin(raw.buffer, Standard());
+    TIter itEnd = end(raw.buffer, Standard());
+    for (unsigned i = 0; i < sampleIdx && it != itEnd; ++it)
+        if (*it == '\t')
+            ++i;
+    for (; it != itEnd && *it != '\t'; ++it)
+        appendValue(info, *it);
+}
+
+// ----------------------------------------------------------------------------
+// Function loadGenotypeInfos()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn VcfRecord#loadGenotypeInfos
+ * @brief Decode the genotype infos of all samples into @link VcfRecord::genotypeInfos @endlink.
+ *
+ * @signature void loadGenotypeInfos(record);
+ *
+ * @param[in,out] record The @link VcfRecord @endlink, read with @link VcfIOContext::lazyGenotypes @endlink set.
+ *                       Nothing happens if the genotype infos are already decoded.
+ */
+
+inline void
+loadGenotypeInfos(VcfRecord & record)
+{
+    VcfRawGenotypes_ & raw = record._rawGenotypes;
+    if (raw.numSamples == 0)
+        return;
+
+    clear(record.genotypeInfos);
+    if (raw.isBcf)
+    {
+        resize(record.genotypeInfos, raw.numSamples);
+        for (unsigned i = 0; i < raw.numSamples; ++i)
+            getGenotypeInfo(record.genotypeInfos[i], record, i);
+    }
+    else
+    {
+        strSplit(record.genotypeInfos, raw.buffer, IsTab(), false);
+    }
+    clear(raw.buffer);
+    raw.numSamples = 0;
+    raw.numFields = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _vcfRecordLength()
+// ----------------------------------------------------------------------------
+
+// Number of reference bases covered by the record, the END field of the INFO
+// column takes precedence over the length of REF.
+
+inline int32_t
+_vcfRecordLength(VcfRecord const & record)
+{
+    typedef Iterator<CharString const, Standard>::Type TIter;
+
+    TIter it = begin(record.info, Standard());
+    TIter itEnd = end(record.info, Standard());
+    while (it != itEnd)
+    {
+        if (itEnd - it > 4 && it[0] == 'E' && it[1] == 'N' && it[2] == 'D' && it[3] == '=')
+        {
+            int32_t endPos = 0;
+            CharString buffer;
+            for (it += 4; it != itEnd && *it != ';'; ++it)
+                appendValue(buffer, *it);
+            if (lexicalCast(endPos, buffer) && endPos > record.beginPos)
+                return endPos - record.beginPos;
+            break;
+        }
+        while (it != itEnd && *it != ';')
+            ++it;
+        if (it != itEnd)
+            ++it;
+    }
+    return std::max((int32_t)length(record.ref), (int32_t)1);
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_VCF_RECORD_UTIL_H_
@@ -0,0 +1,579 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Writing of BCF2 files.
+//
+// The textual fields of the VcfRecord are encoded with the value types that
+// are declared for the INFO and FORMAT keys in the header.  Integers use the
+// smallest type that holds all values of a field.
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_WRITE_BCF_H_
+#define SEQAN_INCLUDE_SEQAN_VCF_IO_WRITE_BCF_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _bcfIntType()
+// ----------------------------------------------------------------------------
+
+// Smallest type that holds all values apart from the sentinels, whose
+// smallest values are reserved.
+
+inline uint8_t
+_bcfIntType(int32_t const * values, size_t n)
+{
+    int32_t minValue = 0, maxValue = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (values[i] == BCF_INT32_MISSING || values[i] == BCF_INT32_VECTOR_END)
+            continue;
+        minValue = std::min(minValue, values[i]);
+        maxValue = std::max(maxValue, values[i]);
+    }
+    if (minValue > -121 && maxValue < 128)
+        return BCF_TYPE_INT8;
+    if (minValue > -32761 && maxValue < 32768)
+        return BCF_TYPE_INT16;
+    return BCF_TYPE_INT32;
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfAppendInts()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget>
+inline void
+_bcfAppendInts(TTarget & target, int32_t const * values, size_t n, uint8_t type)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        int32_t x = values[i];
+        if (type == BCF_TYPE_INT8)
+            appendValue(target, (char)((x == BCF_INT32_MISSING) ? -128 : (x == BCF_INT32_VECTOR_END) ? -127 : x));
+        else if (type == BCF_TYPE_INT16)
+            appendRawPod(target, (int16_t)((x == BCF_INT32_MISSING) ? -32768 : (x == BCF_INT32_VECTOR_END) ? -32767 : x));
+        else
+            appendRawPod(target, x);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfAppendTypeDescriptor()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget>
+inline void
+_bcfAppendTypeDescriptor(TTarget & target, uint8_t type, int32_t size)
+{
+    if (size < 15)
+    {
+        appendValue(target, (char)((size << 4) | type));
+        return;
+    }
+    appendValue(target, (char)((15 << 4) | type));
+    uint8_t sizeType = _bcfIntType(&size, 1);
+    _bcfAppendTypeDescriptor(target, sizeType, 1);
+    _bcfAppendInts(target, &size, 1, sizeType);
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfAppendTypedInts()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget>
+inline void
+_bcfAppendTypedInts(TTarget & target, int32_t const * values, size_t n, int32_t size)
+{
+    uint8_t type = _bcfIntType(values, n);
+    _bcfAppendTypeDescriptor(target, type, size);
+    _bcfAppendInts(target, values, n, type);
+}
+
+template <typename TTarget>
+inline void
+_bcfAppendTypedInt(TTarget & target, int32_t value)
+{
+    _bcfAppendTypedInts(target, &value, 1, 1);
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfAppendTypedString()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget, typename TString>
+inline void
+_bcfAppendTypedString(TTarget & target, TString const & str)
+{
+    _bcfAppendTypeDescriptor(target, BCF_TYPE_CHAR, length(str));
+    write(target, str);
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfParseValues()
+// ----------------------------------------------------------------------------
+
+// Parses comma-separated integers or floats in VCF notation, '.' is missing.
+
+template <typename TString>
+inline void
+_bcfParseValues(String<int32_t> & values, TString const & text, uint8_t type)
+{
+    typedef typename Iterator<TString const, Standard>::Type TIter;
+
+    CharString buffer;
+    TIter it = begin(text, Standard());
+    TIter itEnd = end(text, Standard());
+    while (true)
+    {
+        clear(buffer);
+        for (; it != itEnd && *it != ','; ++it)
+            appendValue(buffer, *it);
+
+        if (buffer == "." || empty(buffer))
+        {
+            appendValue(values, (type == BCF_TYPE_FLOAT) ? (int32_t)BCF_FLOAT_MISSING : BCF_INT32_MISSING);
+        }
+        else if (type == BCF_TYPE_FLOAT)
+        {
+            float x = 0;
+            int32_t bits;
+            if (!lexicalCast(x, buffer))
+                SEQAN_THROW(ParseError("BCF: invalid float value."));
+            std::memcpy(&bits, &x, 4);
+            appendValue(values, bits);
+        }
+        else
+        {
+            int32_t x = 0;
+            if (!lexicalCast(x, buffer) || x == BCF_INT32_MISSING || x == BCF_INT32_VECTOR_END)
+                SEQAN_THROW(ParseError("BCF: invalid integer value."));
+            appendValue(values, x);
+        }
+
+        if (it == itEnd)
+            break;
+        ++it;
+    }
+}
+
+// Parses a genotype like 0|1 or ./. into the BCF allele encoding.
+
+template <typename TString>
+inline void
+_bcfParseGenotype(String<int32_t> & values, TString const & text)
+{
+    typedef typename Iterator<TString const, Standard>::Type TIter;
+
+    TIter it = begin(text, Standard());
+    TIter itEnd = end(text, Standard());
+    bool phased = false;
+    while (it != itEnd)
+    {
+        int32_t allele = -1;
+        if (*it == '.')
+        {
+            ++it;
+        }
+        else
+        {
+            if (!IsDigit()(*it))
+                SEQAN_THROW(ParseError("BCF: invalid genotype."));
+            for (allele = 0; it != itEnd && IsDigit()(*it); ++it)
+                allele = allele * 10 + (*it - '0');
+        }
+        appendValue(values, ((allele + 1) << 1) | (phased ? 1 : 0));
+
+        if (it == itEnd)
+            break;
+        if (*it != '|' && *it != '/')
+            SEQAN_THROW(ParseError("BCF: invalid genotype."));
+        phased = (*it == '|');
+        ++it;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfSplitField()
+// ----------------------------------------------------------------------------
+
+// Returns the field-th colon-separated part of a sample column, false if the
+// column has less fields.
+
+template <typename TString>
+inline bool
+_bcfSplitField(typename Infix<TString const>::Type & part, TString const & text, unsigned field)
+{
+    typedef typename Iterator<TString const, Standard>::Type TIter;
+
+    TIter itBegin = begin(text, Standard());
+    TIter it = itBegin;
+    TIter itEnd = end(text, Standard());
+    for (unsigned i = 0; i < field; ++it)
+    {
+        if (it == itEnd)
+            return false;
+        if (*it == ':')
+            ++i;
+    }
+    TIter fieldEnd = it;
+    while (fieldEnd != itEnd && *fieldEnd != ':')
+        ++fieldEnd;
+    part = infix(text, it - itBegin, fieldEnd - itBegin);
+    return it != itEnd || (field == 0 && !empty(text));
+}
+
+// ----------------------------------------------------------------------------
+// Function writeHeader()                                           [VcfHeader]
+// ----------------------------------------------------------------------------
+
+// Adds a PASS filter, contig lines for all contigs, and explicit IDX fields,
+// so that other tools map the dictionary ids like this writer.
+
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+writeHeader(TTarget & target,
+            VcfHeader const & header,
+            VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+            Bcf const & /*tag*/)
+{
+    CharString id;
+
+    // Contigs of the header that are not known yet.
+    for (unsigned i = 0; i < length(header); ++i)
+        if (header[i].key == "contig" && _vcfHeaderField(id, header[i].value, "ID"))
+        {
+            unsigned contigId = 0;
+            if (!getIdByName(contigId, contigNamesCache(context), id))
+                appendName(contigNamesCache(context), id);
+        }
+
+    VcfHeader bcfHeader;
+    bool hasPass = false;
+    for (unsigned i = 0; i < length(header); ++i)
+        if (header[i].key == "FILTER" && _vcfHeaderField(id, header[i].value, "ID") && id == "PASS")
+            hasPass = true;
+
+    // Keep the order of the lines, all contigs are written at the first contig line.
+    bool contigsWritten = false;
+    for (unsigned i = 0; i <= length(header); ++i)
+    {
+        if (i == length(header) || header[i].key == "contig")
+        {
+            if (contigsWritten)
+                continue;
+            contigsWritten = true;
+            for (unsigned c = 0; c < length(contigNames(context)); ++c)
+            {
+                VcfHeaderRecord contig("contig", "");
+                for (unsigned j = 0; j < length(header); ++j)
+                    if (header[j].key == "contig" && _vcfHeaderField(id, header[j].value, "ID") &&
+                        id == contigNames(context)[c])
+                        contig.value = header[j].value;
+                if (empty(contig.value))
+                {
+                    append(contig.value, "<ID=");
+                    append(contig.value, contigNames(context)[c]);
+                    appendValue(contig.value, '>');
+                }
+                appendValue(bcfHeader, contig);
+            }
+            continue;
+        }
+        appendValue(bcfHeader, header[i]);
+        if (i == 0 && !hasPass)
+            appendValue(bcfHeader, VcfHeaderRecord("FILTER", "<ID=PASS,Description=\"All filters passed\">"));
+    }
+    if (empty(header) && !hasPass)
+        appendValue(bcfHeader, VcfHeaderRecord("FILTER", "<ID=PASS,Description=\"All filters passed\">"));
+
+    _bcfBuildDictionary(context.bcf, bcfHeader);
+
+    // Annotate the dictionary ids.
+    unsigned contigId = 0;
+    for (unsigned i = 0; i < length(bcfHeader); ++i)
+    {
+        VcfHeaderRecord & record = bcfHeader[i];
+        bool isContig = (record.key == "contig");
+        if (!isContig && record.key != "FILTER" && record.key != "INFO" && record.key != "FORMAT")
+            continue;
+        if (empty(record.value) || back(record.value) != '>' || _vcfHeaderField(id, record.value, "IDX"))
+            continue;
+        _vcfHeaderField(id, record.value, "ID");
+        resize(record.value, length(record.value) - 1);
+        append(record.value, ",IDX=");
+        appendNumber(record.value, isContig ? contigId++ : context.bcf.idMap[id]);
+        appendValue(record.value, '>');
+    }
+
+    CharString & text = context.bcf.buffer;
+    clear(text);
+    writeHeader(text, bcfHeader, context, Vcf());
+    appendValue(text, '\0');
+
+    write(target, "BCF\2\2");
+    appendRawPod(target, (uint32_t)length(text));
+    write(target, text);
+}
+
+// ----------------------------------------------------------------------------
+// Function _bcfWriteFormatField()
+// ----------------------------------------------------------------------------
+
+// Appends the values of one FORMAT field of all samples.  Samples without the
+// field get a vector that starts with the end-of-vector marker.
+
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+_bcfWriteFormatField(CharString & indiv,
+                     VcfRecord const & record,
+                     VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                     unsigned field,
+                     uint8_t type,
+                     bool isGenotype)
+{
+    typedef Infix<CharString const>::Type TInfix;
+
+    unsigned numSamples = length(sampleNames(context));
+    CharString sample;
+    TInfix part;
+
+    if (type == BCF_TYPE_CHAR && !isGenotype)
+    {
+        StringSet<CharString> values;
+        resize(values, numSamples);
+        int32_t width = 0;
+        for (unsigned s = 0; s < numSamples && s < _vcfNumGenotypeInfos(record); ++s)
+        {
+            getGenotypeInfo(sample, record, s);
+            if (_bcfSplitField(part, sample, field))
+                values[s] = part;
+            width = std::max(width, (int32_t)length(values[s]));
+        }
+        _bcfAppendTypeDescriptor(indiv, BCF_TYPE_CHAR, width);
+        for (unsigned s = 0; s < numSamples; ++s)
+        {
+            write(indiv, values[s]);
+            for (int32_t i = length(values[s]); i < width; ++i)
+                appendValue(indiv, '\0');
+        }
+        return;
+    }
+
+    String<String<int32_t> > values;
+    resize(values, numSamples);
+    int32_t width = 0;
+    for (unsigned s = 0; s < numSamples && s < _vcfNumGenotypeInfos(record); ++s)
+    {
+        getGenotypeInfo(sample, record, s);
+        if (!_bcfSplitField(part, sample, field))
+            continue;
+        if (isGenotype)
+            _bcfParseGenotype(values[s], part);
+        else
+            _bcfParseValues(values[s], part, type);
+        width = std::max(width, (int32_t)length(values[s]));
+    }
+
+    String<int32_t> flat;
+    int32_t end = (type == BCF_TYPE_FLOAT) ? (int32_t)BCF_FLOAT_VECTOR_END : BCF_INT32_VECTOR_END;
+    for (unsigned s = 0; s < numSamples; ++s)
+    {
+        append(flat, values[s]);
+        for (int32_t i = length(values[s]); i < width; ++i)
+            appendValue(flat, end);
+    }
+
+    if (type == BCF_TYPE_FLOAT)
+    {
+        _bcfAppendTypeDescriptor(indiv, BCF_TYPE_FLOAT, width);
+        for (unsigned i = 0; i < length(flat); ++i)
+            appendRawPod(indiv, flat[i]);
+    }
+    else
+    {
+        _bcfAppendTypedInts(indiv, begin(flat, Standard()), length(flat), width);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function writeRecord()                                           [VcfRecord]
+// ----------------------------------------------------------------------------
+
+template <typename TTarget, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+writeRecord(TTarget & target,
+            VcfRecord const & record,
+            VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+            Bcf const & /*tag*/)
+{
+    typedef Infix<CharString const>::Type TInfix;
+
+    BcfIOContext_ & bcf = context.bcf;
+    CharString & shared = bcf.shared;
+    CharString & indiv = bcf.indiv;
+    CharString & buffer = bcf.buffer;
+    clear(shared);
+    clear(indiv);
+
+    if (record.rID < 0 || record.rID >= (int32_t)length(contigNames(context)))
+        SEQAN_THROW(IOError("BCF: unknown contig."));
+
+    // ID
+    clear(buffer);
+    if (record.id == ".")
+        _bcfAppendTypedString(buffer, "");
+    else
+        _bcfAppendTypedString(buffer, record.id);
+
+    // REF and ALT
+    uint32_t numAlleles = 1;
+    _bcfAppendTypedString(buffer, record.ref);
+    if (!empty(record.alt) && record.alt != ".")
+    {
+        StringSet<TInfix> alts;
+        strSplit(alts, record.alt, EqualsChar<','>());
+        for (unsigned i = 0; i < length(alts); ++i)
+            _bcfAppendTypedString(buffer, alts[i]);
+        numAlleles += length(alts);
+    }
+
+    // FILTER
+    String<int32_t> values;
+    if (!empty(record.filter) && record.filter != ".")
+    {
+        StringSet<TInfix> filters;
+        strSplit(filters, record.filter, EqualsChar<';'>());
+        for (unsigned i = 0; i < length(filters); ++i)
+        {
+            std::map<CharString, int32_t>::const_iterator it = bcf.idMap.find(CharString(filters[i]));
+            if (it == bcf.idMap.end())
+                SEQAN_THROW(IOError("BCF: FILTER is not defined in the header."));
+            appendValue(values, it->second);
+        }
+    }
+    _bcfAppendTypedInts(buffer, begin(values, Standard()), length(values), length(values));
+
+    // INFO
+    uint32_t numInfos = 0;
+    if (!empty(record.info) && record.info != ".")
+    {
+        StringSet<TInfix> infos;
+        strSplit(infos, record.info, EqualsChar<';'>());
+        CharString key;
+        for (unsigned i = 0; i < length(infos); ++i)
+        {
+            TInfix info = infos[i];
+            size_t eq = 0;
+            while (eq < length(info) && info[eq] != '=')
+                ++eq;
+            key = prefix(info, eq);
+            std::map<CharString, int32_t>::const_iterator it = bcf.idMap.find(key);
+            if (it == bcf.idMap.end() || it->second >= (int32_t)length(bcf.infoTypes) ||
+                bcf.infoTypes[it->second] == BCF_TYPE_UNDEFINED)
+                SEQAN_THROW(IOError("BCF: INFO key is not defined in the header."));
+            TInfix value = suffix(info, std::min(eq + 1, (size_t)length(info)));
+
+            _bcfAppendTypedInt(buffer, it->second);
+            uint8_t type = bcf.infoTypes[it->second];
+            if (type == BCF_TYPE_NULL)
+            {
+                _bcfAppendTypeDescriptor(buffer, BCF_TYPE_NULL, 0);
+            }
+            else if (type == BCF_TYPE_CHAR)
+            {
+                _bcfAppendTypedString(buffer, value);
+            }
+            else
+            {
+                clear(values);
+                _bcfParseValues(values, value, type);
+                if (type == BCF_TYPE_FLOAT)
+                {
+                    _bcfAppendTypeDescriptor(buffer, BCF_TYPE_FLOAT, length(values));
+                    for (unsigned j = 0; j < length(values); ++j)
+                        appendRawPod(buffer, values[j]);
+                }
+                else
+                {
+                    _bcfAppendTypedInts(buffer, begin(values, Standard()), length(values), length(values));
+                }
+            }
+            ++numInfos;
+        }
+    }
+
+    // FORMAT
+    uint32_t numFields = 0;
+    uint32_t numSamples = length(sampleNames(context));
+    if (numSamples != 0 && !empty(record.format) && record.format != ".")
+    {
+        StringSet<TInfix> keys;
+        strSplit(keys, record.format, EqualsChar<':'>());
+        CharString key;
+        for (unsigned f = 0; f < length(keys); ++f)
+        {
+            key = keys[f];
+            std::map<CharString, int32_t>::const_iterator it = bcf.idMap.find(key);
+            if (it == bcf.idMap.end() || it->second >= (int32_t)length(bcf.formatTypes) ||
+                bcf.formatTypes[it->second] == BCF_TYPE_UNDEFINED || bcf.formatTypes[it->second] == BCF_TYPE_NULL)
+                SEQAN_THROW(IOError("BCF: FORMAT key is not defined in the header."));
+            _bcfAppendTypedInt(indiv, it->second);
+            _bcfWriteFormatField(indiv, record, context, f, bcf.formatTypes[it->second], key == "GT");
+        }
+        numFields = length(keys);
+    }
+
+    // Fixed fields.
+    uint32_t qualBits = BCF_FLOAT_MISSING;
+    if (record.qual == record.qual)
+        std::memcpy(&qualBits, &record.qual, 4);
+    appendRawPod(shared, record.rID);
+    appendRawPod(shared, record.beginPos);
+    appendRawPod(shared, _vcfRecordLength(record));
+    appendRawPod(shared, qualBits);
+    appendRawPod(shared, (numAlleles << 16) | numInfos);
+    appendRawPod(shared, (numFields << 24) | numSamples);
+    append(shared, buffer);
+
+    appendRawPod(target, (uint32_t)length(shared));
+    appendRawPod(target, (uint32_t)length(indiv));
+    write(target, shared);
+    write(target, indiv);
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef SEQAN_INCLUDE_SEQAN_VCF_IO_WRITE_BCF_H_
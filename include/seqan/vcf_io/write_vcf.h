@@ -138,6 +138,24 @@ writeRecord(TTarget & target,
         write(target, record.format);
 
     // The samples.
+    if (record._rawGenotypes.numSamples != 0 && !record._rawGenotypes.isBcf)
+    {
+        // Undecoded sample columns of a VCF file.
+        writeValue(target, '\t');
+        write(target, record._rawGenotypes.buffer);
+    }
+    else if (record._rawGenotypes.numSamples != 0)
+    {
+        for (unsigned i = 0; i < record._rawGenotypes.numSamples; ++i)
+        {
+            writeValue(target, '\t');
+            getGenotypeInfo(context.buffer, record, i);
+            if (empty(context.buffer))
+                writeValue(target, '.');
+            else
+                write(target, context.buffer);
+        }
+    }
     for (unsigned i = 0; i < length(record.genotypeInfos); ++i)
     {
         writeValue(target, '\t');
@@ -58,6 +58,56 @@ SEQAN_DEFINE_TEST(test_bam_io_bam_index_build)
     SEQAN_ASSERT(_compareBinaryFiles(toCString(tmpOutPath), toCString(expectedBaiFilename)));
 }
 
+// Sort records so that the results of different indices can be compared.
+inline void _sortRecordsForIndexTest(std::vector<BamAlignmentRecord> & records)
+{
+    std::sort(records.begin(), records.end(),
+              [](BamAlignmentRecord const & a, BamAlignmentRecord const & b)
+              {
+                  return std::make_pair(a.beginPos, a.qName) < std::make_pair(b.beginPos, b.qName);
+              });
+}
+
+template <typename TIndex1, typename TIndex2>
+inline void _compareIndexQueries(BamFileIn & bamFile, TIndex1 const & index1, TIndex2 const & index2)
+{
+    int32_t const regions[][3] = {{0, 1, 1}, {0, 1, 100}, {0, 100, 1575}, {0, 101, 1575}, {0, 1000, 1000},
+                                  {1, 1, 1584}, {1, 300, 400}, {1, 98, 98}};
+    for (auto const & r : regions)
+    {
+        std::vector<BamAlignmentRecord> records1, records2;
+        viewRecords(records1, bamFile, index1, r[0], r[1], r[2]);
+        viewRecords(records2, bamFile, index2, r[0], r[1], r[2]);
+        _sortRecordsForIndexTest(records1);
+        _sortRecordsForIndexTest(records2);
+        SEQAN_ASSERT_EQ(records1.size(), records2.size());
+        for (unsigned i = 0; i < records1.size() && i < records2.size(); ++i)
+        {
+            SEQAN_ASSERT_EQ(records1[i].beginPos, records2[i].beginPos);
+            SEQAN_ASSERT_EQ(records1[i].qName, records2[i].qName);
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_build_query)
+{
+    CharString bamFilename = getAbsolutePath("/tests/bam_io/ex1.bam");
+    CharString baiFilename = getAbsolutePath("/tests/bam_io/ex1.bam.bai");
+
+    BamIndex<Bai> builtIndex;
+    SEQAN_ASSERT(build(builtIndex, toCString(bamFilename)));
+
+    BamIndex<Bai> expectedIndex;
+    SEQAN_ASSERT(open(expectedIndex, toCString(baiFilename)));
+    SEQAN_ASSERT_EQ(length(builtIndex._binIndices), length(expectedIndex._binIndices));
+    SEQAN_ASSERT(builtIndex._linearIndices == expectedIndex._linearIndices);
+
+    BamFileIn bamFile;
+    SEQAN_ASSERT(open(bamFile, toCString(bamFilename)));
+    BamHeader header;
+    readHeader(header, bamFile);
+    _compareIndexQueries(bamFile, builtIndex, expectedIndex);
+}
 
 SEQAN_DEFINE_TEST(test_bam_io_bam_index_open)
 {
@@ -230,4 +280,110 @@ SEQAN_DEFINE_TEST(test_bam_io_bam_index_view_records)
     clear(records);
 }
 
+SEQAN_DEFINE_TEST(test_bam_io_csi_index_build_save_open)
+{
+    CharString bamFilename = getAbsolutePath("/tests/bam_io/ex1.bam");
+    CharString tmpOutPath = SEQAN_TEMP_FILENAME();
+    append(tmpOutPath, ".csi");
+
+    BamIndex<Csi> csiIndex;
+    SEQAN_ASSERT(build(csiIndex, toCString(bamFilename)));
+    SEQAN_ASSERT_EQ(csiIndex._minShift, 14);
+    SEQAN_ASSERT_EQ(csiIndex._depth, 0);  // Both contigs fit into a single 16 kbp bin.
+    SEQAN_ASSERT_EQ(length(csiIndex._binIndices), 2u);
+    SEQAN_ASSERT_EQ(getUnalignedCount(csiIndex), 0u);
+    SEQAN_ASSERT(save(csiIndex, toCString(tmpOutPath)));
+
+    BamIndex<Csi> reopened;
+    SEQAN_ASSERT(open(reopened, toCString(tmpOutPath)));
+    SEQAN_ASSERT_EQ(reopened._minShift, csiIndex._minShift);
+    SEQAN_ASSERT_EQ(reopened._depth, csiIndex._depth);
+    SEQAN_ASSERT_EQ(getUnalignedCount(reopened), getUnalignedCount(csiIndex));
+    SEQAN_ASSERT_EQ(length(reopened._binIndices), length(csiIndex._binIndices));
+    for (unsigned i = 0; i < length(csiIndex._binIndices); ++i)
+    {
+        SEQAN_ASSERT_EQ(reopened._binIndices[i].size(), csiIndex._binIndices[i].size());
+        auto it = reopened._binIndices[i].begin();
+        for (auto const & bin : csiIndex._binIndices[i])
+        {
+            SEQAN_ASSERT_EQ(it->first, bin.first);
+            SEQAN_ASSERT_EQ(it->second.loffset, bin.second.loffset);
+            SEQAN_ASSERT(it->second.chunkBegEnds == bin.second.chunkBegEnds);
+            ++it;
+        }
+    }
+
+    // A custom depth and min shift are stored in the index.
+    BamIndex<Csi> deepIndex;
+    SEQAN_ASSERT(build(deepIndex, toCString(bamFilename), 12, 6));
+    SEQAN_ASSERT_EQ(deepIndex._minShift, 12);
+    SEQAN_ASSERT_EQ(deepIndex._depth, 6);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_csi_index_view_records)
+{
+    CharString bamFilename = getAbsolutePath("/tests/bam_io/ex1.bam");
+    CharString baiFilename = getAbsolutePath("/tests/bam_io/ex1.bam.bai");
+
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT(open(baiIndex, toCString(baiFilename)));
+    BamIndex<Csi> csiIndex;
+    SEQAN_ASSERT(build(csiIndex, toCString(bamFilename)));
+    BamIndex<Csi> deepIndex;
+    SEQAN_ASSERT(build(deepIndex, toCString(bamFilename), 10, 7));
+
+    BamFileIn bamFile;
+    SEQAN_ASSERT(open(bamFile, toCString(bamFilename)));
+    BamHeader header;
+    readHeader(header, bamFile);
+
+    std::vector<BamAlignmentRecord> records;
+    SEQAN_TEST_EXCEPTION(std::logic_error, viewRecords(records, bamFile, csiIndex, 0, 0, 12));
+    SEQAN_TEST_EXCEPTION(std::logic_error, viewRecords(records, bamFile, csiIndex, 0, 5, 4));
+    SEQAN_TEST_EXCEPTION(std::logic_error, viewRecords(records, bamFile, csiIndex, 2, 1, 2000));
+    SEQAN_ASSERT_EQ(length(records), 0u);
+
+    viewRecords(records, bamFile, csiIndex, 0, 1, 100);
+    SEQAN_ASSERT_EQ_MSG(length(records), 39u, "39 reads expected in region seq1:1-100");
+
+    _compareIndexQueries(bamFile, baiIndex, csiIndex);
+    _compareIndexQueries(bamFile, baiIndex, deepIndex);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_csi_index_jump_to_region)
+{
+    CharString bamFilename = getAbsolutePath("/tests/bam_io/ex1.bam");
+
+    BamIndex<Csi> csiIndex;
+    SEQAN_ASSERT(build(csiIndex, toCString(bamFilename)));
+
+    BamFileIn bamFile;
+    SEQAN_ASSERT(open(bamFile, toCString(bamFilename)));
+    BamHeader header;
+    readHeader(header, bamFile);
+
+    bool hasAlignments = true;
+    BamAlignmentRecord record;
+    SEQAN_TEST_EXCEPTION(std::logic_error, jumpToRegion(bamFile, hasAlignments, 0, 0, 12, csiIndex));
+    SEQAN_ASSERT_NOT(hasAlignments);
+
+    SEQAN_ASSERT(jumpToRegion(bamFile, hasAlignments, 0, 1, 10, csiIndex));
+    SEQAN_ASSERT(hasAlignments);
+    readRecord(record, bamFile);
+    SEQAN_ASSERT_EQ(record.beginPos, 0);
+
+    SEQAN_ASSERT(jumpToRegion(bamFile, hasAlignments, 0, 3, 100, csiIndex));
+    SEQAN_ASSERT(hasAlignments);
+    readRecord(record, bamFile);
+    SEQAN_ASSERT_EQ(record.beginPos, 2);
+
+    SEQAN_ASSERT(jumpToRegion(bamFile, hasAlignments, 1, 98, 98, csiIndex));
+    SEQAN_ASSERT(hasAlignments);
+    readRecord(record, bamFile);
+    SEQAN_ASSERT_EQ(record.beginPos, 97);
+
+    SEQAN_ASSERT(jumpToRegion(bamFile, hasAlignments, 1, 99, 103, csiIndex));
+    SEQAN_ASSERT_NOT(hasAlignments);
+}
+
 #endif  // TESTS_BAM_IO_TEST_BAM_INDEX_H_
@@ -49,6 +49,9 @@
 
 #if SEQAN_HAS_ZLIB
 #include "test_bam_index.h"
+#include "test_cram.h"
+#include "test_bam_sort.h"
+#include "test_bam_pileup.h"
 #endif
 
 SEQAN_BEGIN_TESTSUITE(test_bam_io)
@@ -182,11 +185,38 @@ SEQAN_BEGIN_TESTSUITE(test_bam_io)
 
     // Test BAM indices.
     SEQAN_CALL_TEST(test_bam_io_bam_index_save);
-//  TODO(dadi): uncomment when BamIndex.build index is fixed
+//  small.bam.bai does not match small.bam byte by byte (its chunk ends point into the
+//  BGZF EOF block), test_bam_io_bam_index_build_query checks build() against ex1.bam.bai.
 //    SEQAN_CALL_TEST(test_bam_io_bam_index_build);
+    SEQAN_CALL_TEST(test_bam_io_bam_index_build_query);
     SEQAN_CALL_TEST(test_bam_io_bam_index_open);
     SEQAN_CALL_TEST(test_bam_io_bam_index_jump_to_region);
     SEQAN_CALL_TEST(test_bam_io_bam_index_view_records);
+    SEQAN_CALL_TEST(test_bam_io_csi_index_build_save_open);
+    SEQAN_CALL_TEST(test_bam_io_csi_index_view_records);
+    SEQAN_CALL_TEST(test_bam_io_csi_index_jump_to_region);
+
+    // Test CRAM I/O.
+    SEQAN_CALL_TEST(test_bam_io_cram_itf8);
+    SEQAN_CALL_TEST(test_bam_io_cram_rans);
+    SEQAN_CALL_TEST(test_bam_io_cram_md5);
+    SEQAN_CALL_TEST(test_bam_io_cram_small_sam);
+    SEQAN_CALL_TEST(test_bam_io_cram_without_reference);
+    SEQAN_CALL_TEST(test_bam_io_cram_with_reference);
+    SEQAN_CALL_TEST(test_bam_io_cram_index);
+
+    // Test sorting and merging.
+    SEQAN_CALL_TEST(test_bam_io_bam_sort_coordinate_in_memory);
+    SEQAN_CALL_TEST(test_bam_io_bam_sort_queryname_in_memory);
+    SEQAN_CALL_TEST(test_bam_io_bam_sort_queryname_external);
+    SEQAN_CALL_TEST(test_bam_io_bam_sort_merge);
+    SEQAN_CALL_TEST(test_bam_io_bam_sort_merge_unsorted);
+
+    // Test pileup.
+    SEQAN_CALL_TEST(test_bam_io_bam_pileup_read);
+    SEQAN_CALL_TEST(test_bam_io_bam_pileup_filters);
+    SEQAN_CALL_TEST(test_bam_io_bam_pileup_jump_to_region);
+    SEQAN_CALL_TEST(test_bam_io_bam_pileup_parallel_regions);
 #endif
 }
 SEQAN_END_TESTSUITE
@@ -0,0 +1,252 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+
+#ifndef TESTS_BAM_IO_TEST_BAM_PILEUP_H_
+#define TESTS_BAM_IO_TEST_BAM_PILEUP_H_
+
+#include <cstring>
+#include <map>
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+
+#include <seqan/bam_io.h>
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+// Computes the pileup columns of a file naively, record by record.
+void _testBamPileupNaive(seqan2::String<seqan2::BamPileupColumn> & columns,
+                         char const * fileName,
+                         seqan2::BamPileupOptions const & options)
+{
+    typedef std::map<std::pair<int32_t, int32_t>, seqan2::BamPileupColumn> TMap;
+    TMap map;
+
+    seqan2::BamFileIn bamIn(fileName);
+    seqan2::BamHeader header;
+    readHeader(header, bamIn);
+    seqan2::BamAlignmentRecord record;
+    while (!atEnd(bamIn))
+    {
+        readRecord(record, bamIn);
+        if (record.rID < 0 || (record.flag & options.skipFlags) != 0 || record.mapQ < options.minMappingQuality)
+            continue;
+
+        unsigned strand = hasFlagRC(record) ? 1 : 0;
+        int32_t refPos = record.beginPos;
+        unsigned readPos = 0;
+        for (unsigned i = 0; i < length(record.cigar); ++i)
+        {
+            char op = record.cigar[i].operation;
+            for (unsigned k = 0; k < record.cigar[i].count; ++k)
+            {
+                if (op == 'M' || op == '=' || op == 'X')
+                {
+                    unsigned qual = record.qual[readPos] - '!';
+                    if (qual >= options.minBaseQuality)
+                    {
+                        seqan2::BamPileupColumn & column = map[std::make_pair(record.rID, refPos)];
+                        unsigned base = ordValue(seqan2::Dna5(record.seq[readPos]));
+                        ++column.depth;
+                        ++column.counts[strand][base];
+                        column.qualSums[strand][base] += qual;
+                    }
+                }
+                else if (op == 'D')
+                {
+                    seqan2::BamPileupColumn & column = map[std::make_pair(record.rID, refPos)];
+                    ++column.depth;
+                    ++column.deletions;
+                }
+                else if (op == 'I' && k == 0 && refPos > record.beginPos)
+                {
+                    ++map[std::make_pair(record.rID, refPos - 1)].insertions;
+                }
+                if (op == 'M' || op == '=' || op == 'X' || op == 'D' || op == 'N')
+                    ++refPos;
+                if (op == 'M' || op == '=' || op == 'X' || op == 'I' || op == 'S')
+                    ++readPos;
+            }
+        }
+    }
+
+    clear(columns);
+    for (TMap::iterator it = map.begin(); it != map.end(); ++it)
+    {
+        it->second.rID = it->first.first;
+        it->second.pos = it->first.second;
+        if (it->second.depth != 0 || it->second.insertions != 0)
+            appendValue(columns, it->second);
+    }
+}
+
+void _testBamPileupReadAll(seqan2::String<seqan2::BamPileupColumn> & columns, seqan2::BamPileup & pileup)
+{
+    seqan2::BamPileupColumn column;
+    while (!atEnd(pileup))
+    {
+        readColumn(column, pileup);
+        appendValue(columns, column);
+    }
+}
+
+void _testBamPileupCompare(seqan2::String<seqan2::BamPileupColumn> const & columns,
+                           seqan2::String<seqan2::BamPileupColumn> const & expected)
+{
+    SEQAN_ASSERT_EQ(length(columns), length(expected));
+    for (unsigned i = 0; i < length(columns); ++i)
+    {
+        SEQAN_ASSERT_EQ(columns[i].rID, expected[i].rID);
+        SEQAN_ASSERT_EQ(columns[i].pos, expected[i].pos);
+        SEQAN_ASSERT_EQ(columns[i].depth, expected[i].depth);
+        SEQAN_ASSERT_EQ(columns[i].deletions, expected[i].deletions);
+        SEQAN_ASSERT_EQ(columns[i].insertions, expected[i].insertions);
+        SEQAN_ASSERT(std::memcmp(columns[i].counts, expected[i].counts, sizeof(expected[i].counts)) == 0);
+        SEQAN_ASSERT(std::memcmp(columns[i].qualSums, expected[i].qualSums, sizeof(expected[i].qualSums)) == 0);
+    }
+}
+
+void testBamPileupFile(seqan2::BamPileupOptions const & options)
+{
+    seqan2::CharString inPath = seqan2::getAbsolutePath("/tests/bam_io/ex1.bam");
+    seqan2::String<seqan2::BamPileupColumn> expected, columns;
+    _testBamPileupNaive(expected, toCString(inPath), options);
+    SEQAN_ASSERT_GT(length(expected), 0u);
+
+    seqan2::BamFileIn bamIn(toCString(inPath));
+    seqan2::BamHeader header;
+    readHeader(header, bamIn);
+    seqan2::BamPileup pileup(bamIn, options);
+    _testBamPileupReadAll(columns, pileup);
+    _testBamPileupCompare(columns, expected);
+}
+
+// ---------------------------------------------------------------------------
+// Pileup
+// ---------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_pileup_read)
+{
+    testBamPileupFile(seqan2::BamPileupOptions());
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_pileup_filters)
+{
+    seqan2::BamPileupOptions options;
+    options.minMappingQuality = 20;
+    options.minBaseQuality = 25;
+    options.skipFlags |= seqan2::BAM_FLAG_RC;
+    testBamPileupFile(options);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_pileup_jump_to_region)
+{
+    seqan2::CharString inPath = seqan2::getAbsolutePath("/tests/bam_io/ex1.bam");
+    seqan2::CharString baiPath = seqan2::getAbsolutePath("/tests/bam_io/ex1.bam.bai");
+    seqan2::String<seqan2::BamPileupColumn> all, columns;
+    _testBamPileupNaive(all, toCString(inPath), seqan2::BamPileupOptions());
+
+    seqan2::BamIndex<seqan2::Bai> baiIndex;
+    SEQAN_ASSERT(open(baiIndex, toCString(baiPath)));
+
+    seqan2::BamFileIn bamIn(toCString(inPath));
+    seqan2::BamHeader header;
+    readHeader(header, bamIn);
+    seqan2::BamPileup pileup(bamIn);
+
+    // regions at the contig begins, in the middle and behind the last record, repeated to test seeking back
+    int32_t const regions[][3] = {{0, 0, 100}, {0, 1000, 1100}, {1, 500, 20000}, {1, 0, 1}, {0, 1000, 1100},
+                                  {0, 100000, 100100}};
+    for (unsigned r = 0; r < sizeof(regions) / sizeof(regions[0]); ++r)
+    {
+        seqan2::String<seqan2::BamPileupColumn> expected;
+        for (unsigned i = 0; i < length(all); ++i)
+            if (all[i].rID == regions[r][0] && all[i].pos >= regions[r][1] && all[i].pos < regions[r][2])
+                appendValue(expected, all[i]);
+
+        clear(columns);
+        jumpToRegion(pileup, regions[r][0], regions[r][1], regions[r][2], baiIndex);
+        _testBamPileupReadAll(columns, pileup);
+        _testBamPileupCompare(columns, expected);
+    }
+}
+
+// The columns of a file are computed by several threads, each for its own regions.
+SEQAN_DEFINE_TEST(test_bam_io_bam_pileup_parallel_regions)
+{
+    seqan2::CharString inPath = seqan2::getAbsolutePath("/tests/bam_io/ex1.bam");
+    seqan2::CharString baiPath = seqan2::getAbsolutePath("/tests/bam_io/ex1.bam.bai");
+    seqan2::String<seqan2::BamPileupColumn> expected;
+    _testBamPileupNaive(expected, toCString(inPath), seqan2::BamPileupOptions());
+
+    seqan2::BamIndex<seqan2::Bai> baiIndex;
+    SEQAN_ASSERT(open(baiIndex, toCString(baiPath)));
+
+    seqan2::String<seqan2::Pair<int32_t> > regions;
+    {
+        seqan2::BamFileIn bamIn(toCString(inPath));
+        seqan2::BamHeader header;
+        readHeader(header, bamIn);
+        for (unsigned rID = 0; rID < length(contigLengths(context(bamIn))); ++rID)
+            for (int32_t pos = 0; pos < (int32_t)contigLengths(context(bamIn))[rID]; pos += 250)
+                appendValue(regions, seqan2::Pair<int32_t>(rID, pos));
+    }
+
+    seqan2::String<seqan2::String<seqan2::BamPileupColumn> > regionColumns;
+    resize(regionColumns, length(regions));
+
+    omp_set_num_threads(4);
+    SEQAN_OMP_PRAGMA(parallel)
+    {
+        seqan2::BamFileIn bamIn(toCString(inPath));
+        seqan2::BamHeader header;
+        readHeader(header, bamIn);
+        seqan2::BamPileup pileup(bamIn);
+
+        SEQAN_OMP_PRAGMA(for schedule(dynamic))
+        for (int r = 0; r < (int)length(regions); ++r)
+        {
+            jumpToRegion(pileup, regions[r].i1, regions[r].i2, regions[r].i2 + 250, baiIndex);
+            _testBamPileupReadAll(regionColumns[r], pileup);
+        }
+    }
+    omp_set_num_threads(1);
+
+    seqan2::String<seqan2::BamPileupColumn> columns;
+    for (unsigned r = 0; r < length(regionColumns); ++r)
+        append(columns, regionColumns[r]);
+    _testBamPileupCompare(columns, expected);
+}
+
+#endif  // TESTS_BAM_IO_TEST_BAM_PILEUP_H_
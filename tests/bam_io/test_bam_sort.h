@@ -0,0 +1,227 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+
+
+#ifndef TESTS_BAM_IO_TEST_BAM_SORT_H_
+#define TESTS_BAM_IO_TEST_BAM_SORT_H_
+
+#include <algorithm>
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+
+#include <seqan/bam_io.h>
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+void _testBamSortReadAll(seqan2::String<seqan2::BamAlignmentRecord> & records,
+                         seqan2::BamHeader & header,
+                         char const * fileName)
+{
+    seqan2::BamFileIn bamIO(fileName);
+    readHeader(header, bamIO);
+    clear(records);
+    while (!atEnd(bamIO))
+    {
+        resize(records, length(records) + 1);
+        readRecord(back(records), bamIO);
+    }
+}
+
+void _testBamSortReadAll(seqan2::String<seqan2::BamAlignmentRecord> & records, char const * fileName)
+{
+    seqan2::BamHeader header;
+    _testBamSortReadAll(records, header, fileName);
+}
+
+void _testBamSortCompare(seqan2::String<seqan2::BamAlignmentRecord> const & records,
+                         seqan2::String<seqan2::BamAlignmentRecord> const & expected)
+{
+    SEQAN_ASSERT_EQ(length(records), length(expected));
+    for (unsigned i = 0; i < length(records); ++i)
+    {
+        SEQAN_ASSERT_EQ(records[i].qName, expected[i].qName);
+        SEQAN_ASSERT_EQ(records[i].flag, expected[i].flag);
+        SEQAN_ASSERT_EQ(records[i].rID, expected[i].rID);
+        SEQAN_ASSERT_EQ(records[i].beginPos, expected[i].beginPos);
+        SEQAN_ASSERT_EQ(records[i].seq, expected[i].seq);
+        SEQAN_ASSERT_EQ(records[i].qual, expected[i].qual);
+    }
+}
+
+void testBamSortFile(seqan2::BamSortOrder sortOrder, uint64_t maxMemory, int threads)
+{
+    seqan2::CharString inPath = seqan2::getAbsolutePath("/tests/bam_io/ex1.bam");
+    seqan2::CharString outPath = SEQAN_TEMP_FILENAME();
+    append(outPath, ".sam");
+
+    omp_set_num_threads(threads);
+    {
+        seqan2::BamFileOut bamOut;
+        SEQAN_ASSERT(open(bamOut, toCString(outPath)));
+        seqan2::BamFileIn bamIn(bamOut);
+        SEQAN_ASSERT(open(bamIn, toCString(inPath)));
+
+        seqan2::BamHeader header;
+        readHeader(header, bamIn);
+
+        seqan2::BamSortOptions options;
+        options.sortOrder = sortOrder;
+        options.maxMemory = maxMemory;
+        sortBamFiles(bamOut, header, bamIn, options);
+    }
+    omp_set_num_threads(1);
+
+    seqan2::String<seqan2::BamAlignmentRecord> expected, records;
+    _testBamSortReadAll(expected, toCString(inPath));
+    if (sortOrder == seqan2::BAM_SORT_COORDINATE)
+        std::stable_sort(begin(expected, seqan2::Standard()), end(expected, seqan2::Standard()),
+                         seqan2::BamAlignmentRecordCoordinateLess());
+    else
+        std::stable_sort(begin(expected, seqan2::Standard()), end(expected, seqan2::Standard()),
+                         seqan2::BamAlignmentRecordNameLess());
+
+    seqan2::BamHeader header;
+    _testBamSortReadAll(records, header, toCString(outPath));
+    SEQAN_ASSERT_EQ(getSortOrder(header), sortOrder);
+    _testBamSortCompare(records, expected);
+}
+
+// ---------------------------------------------------------------------------
+// Sort
+// ---------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_sort_coordinate_in_memory)
+{
+    testBamSortFile(seqan2::BAM_SORT_COORDINATE, 1ull << 30, 1);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_sort_queryname_in_memory)
+{
+    testBamSortFile(seqan2::BAM_SORT_QUERYNAME, 1ull << 30, 4);
+}
+
+// A small memory limit splits ex1.bam into about 16 runs that are merged.
+SEQAN_DEFINE_TEST(test_bam_io_bam_sort_queryname_external)
+{
+    testBamSortFile(seqan2::BAM_SORT_QUERYNAME, 64 << 10, 1);
+    testBamSortFile(seqan2::BAM_SORT_QUERYNAME, 64 << 10, 4);
+}
+
+// ---------------------------------------------------------------------------
+// Merge
+// ---------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_sort_merge)
+{
+    seqan2::CharString inPath = seqan2::getAbsolutePath("/tests/bam_io/ex1.bam");
+    seqan2::String<seqan2::BamAlignmentRecord> expected, records;
+    _testBamSortReadAll(expected, toCString(inPath));
+
+    // distribute ex1.bam to three sorted files, the second one has no records
+    seqan2::StringSet<seqan2::CharString> partPaths;
+    {
+        seqan2::BamFileIn bamIn(toCString(inPath));
+        seqan2::BamHeader header;
+        readHeader(header, bamIn);
+
+        seqan2::String<seqan2::BamFileOut *> parts;
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            appendValue(partPaths, SEQAN_TEMP_FILENAME());
+            append(back(partPaths), (i == 0) ? ".sam" : ".bam");
+            appendValue(parts, new seqan2::BamFileOut(bamIn, toCString(back(partPaths))));
+            writeHeader(*parts[i], header);
+        }
+        for (unsigned i = 0; i < length(expected); ++i)
+            writeRecord(*parts[(i % 3 == 1) ? 0 : i % 3], expected[i]);
+        for (unsigned i = 0; i < 3; ++i)
+            delete parts[i];
+    }
+
+    // records of equal position are merged in the order of the inputs
+    seqan2::String<seqan2::BamAlignmentRecord> concatenated;
+    for (unsigned part = 0; part < 3; part += 2)
+        for (unsigned i = 0; i < length(expected); ++i)
+            if (((i % 3 == 1) ? 0 : i % 3) == part)
+                appendValue(concatenated, expected[i]);
+    std::stable_sort(begin(concatenated, seqan2::Standard()), end(concatenated, seqan2::Standard()),
+                     seqan2::BamAlignmentRecordCoordinateLess());
+
+    seqan2::CharString outPath = SEQAN_TEMP_FILENAME();
+    append(outPath, ".bam");
+    {
+        seqan2::String<seqan2::BamFileIn *> inFiles;
+        seqan2::BamHeader header;
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            appendValue(inFiles, new seqan2::BamFileIn(toCString(partPaths[i])));
+            readHeader(header, *inFiles[i]);
+        }
+        removeDuplicates(header);
+
+        seqan2::BamFileOut bamOut(toCString(outPath));
+        mergeSortedBamFiles(bamOut, header, inFiles, seqan2::BAM_SORT_COORDINATE);
+        for (unsigned i = 0; i < 3; ++i)
+            delete inFiles[i];
+    }
+
+    _testBamSortReadAll(records, toCString(outPath));
+    _testBamSortCompare(records, concatenated);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_sort_merge_unsorted)
+{
+    seqan2::BamFileIn bamIn(toCString(seqan2::getAbsolutePath("/tests/bam_io/ex1.bam")));
+    seqan2::BamHeader header;
+    readHeader(header, bamIn);
+
+    seqan2::String<seqan2::BamFileIn *> inFiles;
+    appendValue(inFiles, &bamIn);
+    std::ostringstream out;
+    seqan2::BamFileOut bamOut(out, seqan2::Sam());
+
+    bool thrown = false;
+    try
+    {
+        mergeSortedBamFiles(bamOut, header, inFiles, seqan2::BAM_SORT_QUERYNAME);
+    }
+    catch (seqan2::ParseError const &)
+    {
+        thrown = true;
+    }
+    SEQAN_ASSERT(thrown);
+}
+
+#endif  // TESTS_BAM_IO_TEST_BAM_SORT_H_
@@ -0,0 +1,473 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for reading and writing CRAM files.
+// ==========================================================================
+
+#ifndef TESTS_BAM_IO_TEST_CRAM_H_
+#define TESTS_BAM_IO_TEST_CRAM_H_
+
+#include <fstream>
+#include <random>
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+#include <seqan/bam_io.h>
+#include <seqan/seq_io.h>
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+// Writes a FASTA file with three random contigs and a SAM file with reads on
+// them, including mismatches, IUPAC bases, indels, clipping, reads without
+// sequence and unmapped reads.
+inline void
+_createCramTestFiles(seqan2::CharString & fastaPath, seqan2::CharString & samPath)
+{
+    std::mt19937 rng(42);
+    char const * ACGT = "ACGT";
+    unsigned const contigLengths[3] = {3000, 500, 500};
+    unsigned const readsPerContig[3] = {150, 5, 5};
+
+    seqan2::StringSet<seqan2::CharString> contigs;
+    resize(contigs, 3);
+    for (unsigned c = 0; c < 3; ++c)
+        for (unsigned i = 0; i < contigLengths[c]; ++i)
+            appendValue(contigs[c], ACGT[rng() % 4]);
+
+    fastaPath = SEQAN_TEMP_FILENAME();
+    append(fastaPath, ".fa");
+    {
+        std::ofstream fasta(toCString(fastaPath));
+        for (unsigned c = 0; c < 3; ++c)
+            fasta << ">chr" << (c + 1) << "\n" << contigs[c] << "\n";
+    }
+
+    samPath = SEQAN_TEMP_FILENAME();
+    append(samPath, ".sam");
+    std::ofstream sam(toCString(samPath));
+    sam << "@HD\tVN:1.4\tSO:coordinate\n";
+    for (unsigned c = 0; c < 3; ++c)
+        sam << "@SQ\tSN:chr" << (c + 1) << "\tLN:" << contigLengths[c] << "\n";
+    sam << "@RG\tID:rg1\tSM:sample\n";
+
+    unsigned readId = 0;
+    for (unsigned c = 0; c < 3; ++c)
+    {
+        unsigned pos = 0;
+        for (unsigned r = 0; r < readsPerContig[c]; ++r, ++readId)
+        {
+            pos += rng() % 15;
+            seqan2::CharString seq, qual, cigar;
+            unsigned kind = readId % 6;
+            if (kind == 0)              // perfect match
+            {
+                seq = infix(contigs[c], pos, pos + 50);
+                cigar = "50M";
+            }
+            else if (kind == 1)         // mismatches, N and IUPAC bases
+            {
+                seq = infix(contigs[c], pos, pos + 50);
+                seq[3] = (seq[3] == 'A') ? 'C' : 'A';
+                seq[10] = 'N';
+                seq[20] = 'R';
+                cigar = "50M";
+            }
+            else if (kind == 2)         // soft clip, insertion and deletion
+            {
+                seq = "GGAT";
+                append(seq, infix(contigs[c], pos, pos + 20));
+                append(seq, "TTA");
+                append(seq, infix(contigs[c], pos + 23, pos + 46));
+                cigar = "4S20M3I3D23M";
+            }
+            else if (kind == 3)         // no sequence, hard clip and skip
+            {
+                cigar = "5H20M100N30M";
+            }
+            else
+            {
+                seq = infix(contigs[c], pos, pos + 50);
+                cigar = "50M";
+            }
+            for (unsigned i = 0; i < length(seq); ++i)
+                appendValue(qual, (char)('!' + rng() % 40));
+
+            sam << "read" << readId << "\t" << ((kind == 4) ? 99 : 0) << "\tchr" << (c + 1) << "\t" << (pos + 1)
+                << "\t" << (readId % 60) << "\t" << cigar;
+            if (kind == 4)
+                sam << "\t=\t" << (pos + 101) << "\t" << (100 + 50);
+            else
+                sam << "\t*\t0\t0";
+            sam << "\t" << (empty(seq) ? seqan2::CharString("*") : seq)
+                << "\t" << (empty(qual) ? seqan2::CharString("*") : qual);
+            if (kind != 3)
+                sam << "\tNM:i:" << kind << "\tXA:Z:test";
+            if (kind == 1)
+                sam << "\tXB:B:s,-1,2,300";
+            if (kind != 0)
+                sam << "\tRG:Z:rg1";
+            sam << "\n";
+        }
+    }
+    // Unmapped reads.
+    for (unsigned r = 0; r < 3; ++r, ++readId)
+    {
+        sam << "read" << readId << "\t4\t*\t0\t0\t*\t*\t0\t0\t";
+        for (unsigned i = 0; i < 30; ++i)
+            sam << ACGT[rng() % 4];
+        sam << "\t";
+        for (unsigned i = 0; i < 30; ++i)
+            sam << (char)('!' + rng() % 40);
+        sam << "\n";
+    }
+}
+
+inline void
+_readAllRecords(seqan2::String<seqan2::BamAlignmentRecord> & records, seqan2::BamFileIn & bamFileIn)
+{
+    seqan2::BamAlignmentRecord record;
+    while (!atEnd(bamFileIn))
+    {
+        readRecord(record, bamFileIn);
+        appendValue(records, record);
+    }
+}
+
+inline void
+_compareCramRecords(seqan2::String<seqan2::BamAlignmentRecord> const & expected,
+                    seqan2::String<seqan2::BamAlignmentRecord> const & actual)
+{
+    SEQAN_ASSERT_EQ(length(expected), length(actual));
+    for (unsigned i = 0; i < length(expected); ++i)
+    {
+        SEQAN_ASSERT_EQ(expected[i].qName, actual[i].qName);
+        SEQAN_ASSERT_EQ(expected[i].flag, actual[i].flag);
+        SEQAN_ASSERT_EQ(expected[i].rID, actual[i].rID);
+        SEQAN_ASSERT_EQ(expected[i].beginPos, actual[i].beginPos);
+        SEQAN_ASSERT_EQ(expected[i].mapQ, actual[i].mapQ);
+        SEQAN_ASSERT_EQ(length(expected[i].cigar), length(actual[i].cigar));
+        for (unsigned j = 0; j < length(expected[i].cigar); ++j)
+        {
+            SEQAN_ASSERT_EQ(expected[i].cigar[j].operation, actual[i].cigar[j].operation);
+            SEQAN_ASSERT_EQ(expected[i].cigar[j].count, actual[i].cigar[j].count);
+        }
+        SEQAN_ASSERT_EQ(expected[i].rNextId, actual[i].rNextId);
+        SEQAN_ASSERT_EQ(expected[i].pNext, actual[i].pNext);
+        SEQAN_ASSERT_EQ(expected[i].tLen, actual[i].tLen);
+        SEQAN_ASSERT_EQ(expected[i].seq, actual[i].seq);
+        SEQAN_ASSERT_EQ(expected[i].qual, actual[i].qual);
+        SEQAN_ASSERT_EQ(expected[i].tags, actual[i].tags);
+    }
+}
+
+// Converts the SAM file into CRAM and compares the records read back.
+inline void
+_testCramRoundTrip(seqan2::CharString & cramPath, bool useReference, unsigned containerSize)
+{
+    seqan2::CharString fastaPath, samPath;
+    _createCramTestFiles(fastaPath, samPath);
+
+    seqan2::FaiIndex faiIndex;
+    SEQAN_ASSERT(build(faiIndex, toCString(fastaPath)));
+
+    cramPath = SEQAN_TEMP_FILENAME();
+    append(cramPath, ".cram");
+
+    seqan2::String<seqan2::BamAlignmentRecord> expected;
+    {
+        seqan2::BamFileIn samFileIn(toCString(samPath));
+        seqan2::BamHeader header;
+        readHeader(header, samFileIn);
+        _readAllRecords(expected, samFileIn);
+
+        seqan2::BamFileOut cramFileOut(samFileIn, toCString(cramPath));
+        SEQAN_ASSERT(isEqual(format(cramFileOut), seqan2::Cram()));
+        context(cramFileOut).cram.containerSize = containerSize;
+        if (useReference)
+            setCramReference(cramFileOut, faiIndex);
+        writeHeader(cramFileOut, header);
+        writeRecords(cramFileOut, expected);
+    }
+
+    seqan2::BamFileIn cramFileIn(toCString(cramPath));
+    SEQAN_ASSERT(isEqual(format(cramFileIn), seqan2::Cram()));
+    setCramReference(cramFileIn, faiIndex);
+    seqan2::BamHeader header;
+    readHeader(header, cramFileIn);
+    SEQAN_ASSERT_EQ(length(contigNames(context(cramFileIn))), 3u);
+    SEQAN_ASSERT_EQ(contigNames(context(cramFileIn))[1], "chr2");
+
+    seqan2::String<seqan2::BamAlignmentRecord> actual;
+    _readAllRecords(actual, cramFileIn);
+    _compareCramRecords(expected, actual);
+
+    // Batch reading yields the same records.
+    seqan2::BamFileIn cramFileIn2(toCString(cramPath));
+    setCramReference(cramFileIn2, faiIndex);
+    context(cramFileIn2).cram.batchSize = 2;
+    readHeader(header, cramFileIn2);
+    seqan2::String<seqan2::BamAlignmentRecord> batch;
+    SEQAN_ASSERT_EQ(readRecords(batch, cramFileIn2, 1000u), length(expected));
+    resize(batch, length(expected));
+    _compareCramRecords(expected, batch);
+}
+
+// ---------------------------------------------------------------------------
+// Codecs
+// ---------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_bam_io_cram_itf8)
+{
+    int32_t const values[] = {0, 1, 127, 128, 16383, 16384, 2097151, 2097152, 268435455, 268435456,
+                              2147483647, -1, -2, -2147483647 - 1};
+    for (int32_t value : values)
+    {
+        seqan2::CharString buffer;
+        seqan2::_cramWriteItf8(buffer, value);
+        SEQAN_ASSERT_LEQ(length(buffer), 5u);
+        char const * it = begin(buffer, seqan2::Standard());
+        int32_t result = 0;
+        seqan2::_cramReadItf8(result, it, end(buffer, seqan2::Standard()));
+        SEQAN_ASSERT_EQ(result, value);
+        SEQAN_ASSERT(it == end(buffer, seqan2::Standard()));
+    }
+
+    int64_t const values64[] = {0, 127, 128, 1ll << 40, (1ll << 56) - 1, 1ll << 62, -1};
+    for (int64_t value : values64)
+    {
+        seqan2::CharString buffer;
+        seqan2::_cramWriteLtf8(buffer, value);
+        char const * it = begin(buffer, seqan2::Standard());
+        int64_t result = 0;
+        seqan2::_cramReadLtf8(result, it, end(buffer, seqan2::Standard()));
+        SEQAN_ASSERT_EQ(result, value);
+        SEQAN_ASSERT(it == end(buffer, seqan2::Standard()));
+    }
+
+    // Truncated values are detected.
+    seqan2::CharString buffer;
+    seqan2::_cramWriteItf8(buffer, 268435456);
+    resize(buffer, 2);
+    char const * it = begin(buffer, seqan2::Standard());
+    int32_t result = 0;
+    bool caught = false;
+    try
+    {
+        seqan2::_cramReadItf8(result, it, end(buffer, seqan2::Standard()));
+    }
+    catch (seqan2::ParseError const &)
+    {
+        caught = true;
+    }
+    SEQAN_ASSERT(caught);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_cram_rans)
+{
+    std::mt19937 rng(7);
+    seqan2::CharString const texts[] = {"", "A", "ACGT", "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"};
+    for (seqan2::CharString const & text : texts)
+    {
+        seqan2::CharString compressed, uncompressed;
+        seqan2::_cramRansCompress(compressed, text);
+        seqan2::_cramRansUncompress(uncompressed, begin(compressed, seqan2::Standard()), length(compressed));
+        SEQAN_ASSERT_EQ(uncompressed, text);
+    }
+
+    seqan2::CharString qualities;
+    for (unsigned i = 0; i < 100000; ++i)
+        appendValue(qualities, (char)(std::min(rng() % 20, rng() % 45)));
+    seqan2::CharString compressed, uncompressed;
+    seqan2::_cramRansCompress(compressed, qualities);
+    SEQAN_ASSERT_LT(length(compressed), length(qualities));
+    seqan2::_cramRansUncompress(uncompressed, begin(compressed, seqan2::Standard()), length(compressed));
+    SEQAN_ASSERT_EQ(uncompressed, qualities);
+
+    // Blocks verify their CRC.
+    seqan2::CharString block;
+    seqan2::_cramWriteBlock(block, qualities, seqan2::CRAM_CONTENT_EXTERNAL, 12, seqan2::CRAM_METHOD_RANS4X8);
+    seqan2::CramBlock_ cramBlock;
+    char const * it = begin(block, seqan2::Standard());
+    seqan2::_cramReadBlock(cramBlock, it, end(block, seqan2::Standard()));
+    SEQAN_ASSERT_EQ(cramBlock.contentId, 12);
+    SEQAN_ASSERT_EQ(cramBlock.data, qualities);
+    block[length(block) / 2] ^= 1;
+    it = begin(block, seqan2::Standard());
+    bool caught = false;
+    try
+    {
+        seqan2::_cramReadBlock(cramBlock, it, end(block, seqan2::Standard()));
+    }
+    catch (seqan2::ParseError const &)
+    {
+        caught = true;
+    }
+    SEQAN_ASSERT(caught);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_cram_md5)
+{
+    unsigned char digest[16];
+    seqan2::_cramMd5(digest, "abc", 3);
+    unsigned char const expected[16] = {0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0,
+                                        0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72};
+    for (unsigned i = 0; i < 16; ++i)
+        SEQAN_ASSERT_EQ(digest[i], expected[i]);
+}
+
+// ---------------------------------------------------------------------------
+// Read/Write
+// ---------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_bam_io_cram_small_sam)
+{
+    seqan2::CharString samPath = seqan2::getAbsolutePath("/tests/bam_io/small.sam");
+    seqan2::CharString cramPath = SEQAN_TEMP_FILENAME();
+    append(cramPath, ".cram");
+
+    seqan2::String<seqan2::BamAlignmentRecord> expected;
+    {
+        seqan2::BamFileIn samFileIn(toCString(samPath));
+        seqan2::BamHeader header;
+        readHeader(header, samFileIn);
+        _readAllRecords(expected, samFileIn);
+
+        seqan2::BamFileOut cramFileOut(samFileIn, toCString(cramPath));
+        writeHeader(cramFileOut, header);
+        for (unsigned i = 0; i < length(expected); ++i)
+            writeRecord(cramFileOut, expected[i]);
+        close(cramFileOut);
+    }
+
+    seqan2::BamFileIn cramFileIn(toCString(cramPath));
+    seqan2::BamHeader header;
+    readHeader(header, cramFileIn);
+    SEQAN_ASSERT_EQ(length(header), 2u);
+    SEQAN_ASSERT_EQ(header[1].type, seqan2::BAM_HEADER_REFERENCE);
+    SEQAN_ASSERT_EQ(contigLengths(context(cramFileIn))[0], 10000);
+
+    seqan2::String<seqan2::BamAlignmentRecord> actual;
+    _readAllRecords(actual, cramFileIn);
+    _compareCramRecords(expected, actual);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_cram_without_reference)
+{
+    seqan2::CharString cramPath;
+    _testCramRoundTrip(cramPath, false, 10000);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_cram_with_reference)
+{
+    seqan2::CharString cramPath;
+    _testCramRoundTrip(cramPath, true, 64);
+
+    // The file cannot be decoded without the reference.
+    seqan2::BamFileIn cramFileIn(toCString(cramPath));
+    seqan2::BamHeader header;
+    readHeader(header, cramFileIn);
+    seqan2::BamAlignmentRecord record;
+    bool caught = false;
+    try
+    {
+        readRecord(record, cramFileIn);
+    }
+    catch (seqan2::IOError const &)
+    {
+        caught = true;
+    }
+    SEQAN_ASSERT(caught);
+}
+
+// ---------------------------------------------------------------------------
+// Index
+// ---------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_bam_io_cram_index)
+{
+    seqan2::CharString cramPath;
+    _testCramRoundTrip(cramPath, false, 64);
+
+    seqan2::BamIndex<seqan2::Crai> index;
+    SEQAN_ASSERT(build(index, toCString(cramPath)));
+    SEQAN_ASSERT_GT(length(index._entries), 3u);
+
+    seqan2::CharString craiPath = cramPath;
+    append(craiPath, ".crai");
+    SEQAN_ASSERT(save(index, toCString(craiPath)));
+    seqan2::BamIndex<seqan2::Crai> loaded;
+    SEQAN_ASSERT(open(loaded, toCString(craiPath)));
+    SEQAN_ASSERT_EQ(length(loaded._entries), length(index._entries));
+    for (unsigned i = 0; i < length(index._entries); ++i)
+    {
+        SEQAN_ASSERT_EQ(loaded._entries[i].refId, index._entries[i].refId);
+        SEQAN_ASSERT_EQ(loaded._entries[i].alnStart, index._entries[i].alnStart);
+        SEQAN_ASSERT_EQ(loaded._entries[i].alnSpan, index._entries[i].alnSpan);
+        SEQAN_ASSERT_EQ(loaded._entries[i].containerOffset, index._entries[i].containerOffset);
+        SEQAN_ASSERT_EQ(loaded._entries[i].sliceOffset, index._entries[i].sliceOffset);
+        SEQAN_ASSERT_EQ(loaded._entries[i].sliceSize, index._entries[i].sliceSize);
+    }
+
+    seqan2::BamFileIn cramFileIn(toCString(cramPath));
+    seqan2::BamHeader header;
+    readHeader(header, cramFileIn);
+    seqan2::String<seqan2::BamAlignmentRecord> all;
+    _readAllRecords(all, cramFileIn);
+
+    for (int32_t refId = 0; refId < 3; ++refId)
+    {
+        uint32_t regionStart = (refId == 0) ? 100 : 10;
+        uint32_t regionEnd = (refId == 0) ? 400 : 40;
+
+        seqan2::String<seqan2::BamAlignmentRecord> expected;
+        for (unsigned i = 0; i < length(all); ++i)
+            if (all[i].rID == refId && all[i].beginPos + (int32_t)getAlignmentLengthInRef(all[i]) >= (int32_t)regionStart &&
+                all[i].beginPos <= (int32_t)regionEnd - 1)
+                appendValue(expected, all[i]);
+
+        seqan2::String<seqan2::BamAlignmentRecord> viewed;
+        viewRecords(viewed, cramFileIn, loaded, refId, regionStart, regionEnd);
+        _compareCramRecords(expected, viewed);
+
+        bool hasAlignments = false;
+        SEQAN_ASSERT(jumpToRegion(cramFileIn, hasAlignments, refId, regionStart, regionEnd, loaded));
+        SEQAN_ASSERT(hasAlignments);
+        seqan2::BamAlignmentRecord record;
+        readRecord(record, cramFileIn);
+        SEQAN_ASSERT_EQ(record.rID, refId);
+        SEQAN_ASSERT_GEQ(record.beginPos, (int32_t)regionStart - 1);
+        SEQAN_ASSERT_LEQ(record.beginPos, (int32_t)regionEnd - 1);
+    }
+}
+
+#endif  // TESTS_BAM_IO_TEST_CRAM_H_
@@ -55,6 +55,7 @@
 
 #include "test_find_hamming.h"
 #include "test_find_myers_banded.h"
+#include "test_find_multiple_myers.h"
 
 using namespace std;
 using namespace seqan2;
@@ -1925,6 +1926,10 @@ SEQAN_BEGIN_TESTSUITE(test_find) {
     SEQAN_CALL_TEST(test_approx_edit_dist_pex_non_hierarchical_multi_bfam);
     // Test for hamming distance approximate matching.
     SEQAN_CALL_TEST(test_find_hamming_simple);
+    // Test for SIMD multi-pattern approximate matching.
+    SEQAN_CALL_TEST(test_find_multiple_myers_simple);
+    SEQAN_CALL_TEST(test_find_multiple_myers_random);
+    SEQAN_CALL_TEST(test_find_multiple_myers_char);
 
     SEQAN_CALL_TEST(test_pattern_copycon);
     SEQAN_CALL_TEST(test_pattern_assign);
@@ -0,0 +1,168 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the SIMD multi-pattern Myers search.  The results are compared
+// against one MyersUkkonen search per keyword.
+// ==========================================================================
+
+#ifndef TESTS_FIND_TEST_FIND_MULTIPLE_MYERS_H_
+#define TESTS_FIND_TEST_FIND_MULTIPLE_MYERS_H_
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace seqan2;
+
+typedef std::tuple<size_t, size_t, int> TMultipleMyersHit;  // end position, keyword, score
+
+template <typename THaystack, typename TNeedles>
+std::vector<TMultipleMyersHit>
+findMultipleMyersHits(THaystack & haystack, TNeedles const & needles, int limit)
+{
+    std::vector<TMultipleMyersHit> hits;
+    Finder<THaystack> finder(haystack);
+    Pattern<TNeedles, MultipleMyersUkkonen> pattern(needles, limit);
+    while (find(finder, pattern))
+        hits.push_back(TMultipleMyersHit(position(finder), position(pattern), getScore(pattern)));
+    return hits;
+}
+
+template <typename THaystack, typename TNeedles>
+std::vector<TMultipleMyersHit>
+findSingleMyersHits(THaystack & haystack, TNeedles const & needles, int limit)
+{
+    typedef typename Value<TNeedles>::Type TNeedle;
+    std::vector<TMultipleMyersHit> hits;
+    for (size_t i = 0; i < length(needles); ++i)
+    {
+        TNeedle needle = needles[i];
+        Finder<THaystack> finder(haystack);
+        Pattern<TNeedle, MyersUkkonen> pattern(needle, limit);
+        while (find(finder, pattern))
+            hits.push_back(TMultipleMyersHit(position(finder), i, getScore(pattern)));
+    }
+    std::sort(hits.begin(), hits.end());
+    return hits;
+}
+
+SEQAN_DEFINE_TEST(test_find_multiple_myers_simple)
+{
+    StringSet<DnaString> needles;
+    appendValue(needles, "ACGT");
+    appendValue(needles, "GGAC");
+    appendValue(needles, "TTTT");
+
+    DnaString haystack = "GGACGTAAACCT";
+
+    // exact search
+    std::vector<TMultipleMyersHit> hits = findMultipleMyersHits(haystack, needles, 0);
+    SEQAN_ASSERT_EQ(hits.size(), 2u);
+    SEQAN_ASSERT(hits[0] == TMultipleMyersHit(3u, 1u, 0));
+    SEQAN_ASSERT(hits[1] == TMultipleMyersHit(5u, 0u, 0));
+
+    // one error, several keywords end at the same position
+    hits = findMultipleMyersHits(haystack, needles, -1);
+    SEQAN_ASSERT(hits == findSingleMyersHits(haystack, needles, -1));
+    SEQAN_ASSERT(std::find(hits.begin(), hits.end(), TMultipleMyersHit(4u, 0u, -1)) != hits.end());
+    SEQAN_ASSERT(std::find(hits.begin(), hits.end(), TMultipleMyersHit(4u, 1u, -1)) != hits.end());
+
+    // the score limit is applied when the search restarts
+    Finder<DnaString> finder(haystack);
+    Pattern<StringSet<DnaString>, MultipleMyersUkkonen> pattern(needles);
+    SEQAN_ASSERT_EQ(scoreLimit(pattern), -1);
+    setScoreLimit(pattern, 0);
+    SEQAN_ASSERT_EQ(scoreLimit(pattern), 0);
+    SEQAN_ASSERT(find(finder, pattern));
+    SEQAN_ASSERT_EQ(position(finder), 3u);
+    SEQAN_ASSERT_EQ(position(pattern), 1u);
+    SEQAN_ASSERT_EQ(getScore(pattern), 0);
+    SEQAN_ASSERT(find(finder, pattern));
+    SEQAN_ASSERT(!find(finder, pattern));
+
+    // empty keyword set
+    StringSet<DnaString> noNeedles;
+    SEQAN_ASSERT(findMultipleMyersHits(haystack, noNeedles, -1).empty());
+}
+
+SEQAN_DEFINE_TEST(test_find_multiple_myers_random)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<unsigned> base(0, 3);
+    std::uniform_int_distribution<unsigned> len(1, 64);
+
+    DnaString haystack;
+    for (unsigned i = 0; i < 3000; ++i)
+        appendValue(haystack, Dna(base(rng)));
+
+    // more keywords than lanes, some of them sampled from the haystack
+    StringSet<DnaString> needles;
+    for (unsigned i = 0; i < 37; ++i)
+    {
+        unsigned l = len(rng);
+        DnaString needle;
+        if (i % 2 == 0)
+        {
+            unsigned pos = rng() % (length(haystack) - l);
+            needle = infix(haystack, pos, pos + l);
+            if (l > 2)
+                needle[l / 2] = Dna((ordValue(needle[l / 2]) + 1) % 4);
+        }
+        else
+        {
+            for (unsigned j = 0; j < l; ++j)
+                appendValue(needle, Dna(base(rng)));
+        }
+        appendValue(needles, needle);
+    }
+    appendValue(needles, infix(haystack, 100, 164));
+
+    for (int limit = 0; limit >= -4; --limit)
+    {
+        std::vector<TMultipleMyersHit> hits = findMultipleMyersHits(haystack, needles, limit);
+        SEQAN_ASSERT(hits == findSingleMyersHits(haystack, needles, limit));
+    }
+}
+
+SEQAN_DEFINE_TEST(test_find_multiple_myers_char)
+{
+    StringSet<CharString> needles;
+    appendValue(needles, "needle");
+    appendValue(needles, "haystack");
+    appendValue(needles, "stack");
+
+    CharString haystack = "a needle in a haystak, not a neadle in a stack";
+    for (int limit = 0; limit >= -2; --limit)
+        SEQAN_ASSERT(findMultipleMyersHits(haystack, needles, limit) == findSingleMyersHits(haystack, needles, limit));
+}
+
+#endif  // TESTS_FIND_TEST_FIND_MULTIPLE_MYERS_H_
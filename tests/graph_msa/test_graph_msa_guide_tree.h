@@ -38,6 +38,8 @@
 #ifndef TESTS_TEST_GRAPH_MSA_GUIDE_TREE_H_
 #define TESTS_TEST_GRAPH_MSA_GUIDE_TREE_H_
 
+#include <random>
+
 void Test_GuideTree_NeighbourJoining()
 {
     using namespace seqan2;
@@ -174,6 +176,81 @@ Test_UpgmaGuideTree(int seed) {
     }
 }
 
+// Returns the number of leaves below v and the families of these leaves as bit mask.
+template <typename TGraph, typename TVertexDescriptor>
+unsigned _mBedSubtreeFamilies(TGraph & tree, TVertexDescriptor v, unsigned familySize,
+                              seqan2::String<unsigned> & masks)
+{
+    using namespace seqan2;
+    typedef typename Iterator<TGraph, AdjacencyIterator>::Type TAdjacencyIterator;
+
+    if (isLeaf(tree, v))
+    {
+        masks[v] = 1u << (v / familySize);
+        return 1;
+    }
+    unsigned leaves = 0, children = 0;
+    for (TAdjacencyIterator adjIt(tree, v); !atEnd(adjIt); goNext(adjIt), ++children)
+    {
+        leaves += _mBedSubtreeFamilies(tree, *adjIt, familySize, masks);
+        masks[v] |= masks[*adjIt];
+    }
+    SEQAN_ASSERT_EQ(children, 2u);
+    if (masks[v] == (masks[v] & -masks[v]))
+        SEQAN_ASSERT_LEQ(leaves, familySize);
+    return leaves;
+}
+
+void Test_GuideTree_MBed()
+{
+    using namespace seqan2;
+
+    // Four families of 100 related sequences each.
+    unsigned const familySize = 100;
+    std::mt19937 rng(42);
+    StringSet<String<AminoAcid> > seqSet;
+    for (unsigned f = 0; f < 4; ++f)
+    {
+        String<AminoAcid> ancestor;
+        for (unsigned i = 0; i < 150; ++i)
+            appendValue(ancestor, AminoAcid(rng() % 20));
+        for (unsigned k = 0; k < familySize; ++k)
+        {
+            String<AminoAcid> seq;
+            for (unsigned i = 0; i < length(ancestor); ++i)
+                appendValue(seq, (rng() % 10 == 0) ? AminoAcid(rng() % 20) : ancestor[i]);
+            appendValue(seqSet, seq);
+        }
+    }
+
+    typedef Graph<Tree<double> > TGraph;
+    TGraph guideTree;
+    mBedTree(seqSet, guideTree);
+
+    // A binary tree whose leaves are the sequences and which keeps the families apart.
+    SEQAN_ASSERT_EQ(numVertices(guideTree), 2 * length(seqSet) - 1);
+    for (unsigned i = 0; i < length(seqSet); ++i)
+        SEQAN_ASSERT(isLeaf(guideTree, i));
+    String<unsigned> masks;
+    resize(masks, numVertices(guideTree), 0);
+    SEQAN_ASSERT_EQ(_mBedSubtreeFamilies(guideTree, getRoot(guideTree), familySize, masks), length(seqSet));
+    SEQAN_ASSERT_EQ(masks[getRoot(guideTree)], 15u);
+
+    // Small sets are joined by UPGMA only.
+    resize(seqSet, 3);
+    mBedTree(seqSet, guideTree);
+    SEQAN_ASSERT_EQ(numVertices(guideTree), 5u);
+    resize(seqSet, 1);
+    mBedTree(seqSet, guideTree);
+    SEQAN_ASSERT_EQ(numVertices(guideTree), 1u);
+    SEQAN_ASSERT_EQ(getRoot(guideTree), 0u);
+}
+
+SEQAN_DEFINE_TEST(test_graph_msa_guide_tree_mbed)
+{
+    Test_GuideTree_MBed();
+}
+
 SEQAN_DEFINE_TEST(test_graph_msa_guide_tree_neighbour_joining)
 {
     Test_GuideTree_NeighbourJoining();
@@ -439,6 +439,84 @@ void Test_Progressive() {
 }
 
 
+// Computes library, distances and progressive alignment with the given number of threads.
+template <typename TSequenceSet>
+void _parallelTCoffee(TSequenceSet & seqSet, int numThreads, String<Fragment<> > & matches, String<int> & scores,
+                      String<double> & distanceMatrix, String<char> & alignMat)
+{
+    typedef StringSet<String<AminoAcid>, Dependent<> > TDependentSequenceSet;
+    typedef Graph<Alignment<TDependentSequenceSet, unsigned int> > TGraph;
+
+    omp_set_num_threads(numThreads);
+    TGraph g(seqSet);
+    Blosum62 score_type(-1,-11);
+    String<unsigned int> pList;
+    selectPairs(seqSet, pList);
+    appendSegmentMatches(stringSet(g), pList, score_type, matches, scores, distanceMatrix, GlobalPairwiseLibrary() );
+    appendSegmentMatches(stringSet(g), pList, score_type, matches, scores, LocalPairwiseLibrary() );
+    appendSegmentMatches(stringSet(g), pList, matches, scores, LcsLibrary() );
+    buildAlignmentGraph(matches, scores, g, FractionalScore() );
+
+    String<double> kmerDistance;
+    getDistanceMatrix(g, kmerDistance, KmerDistance());
+    append(distanceMatrix, kmerDistance);
+    String<double> libraryDistance;
+    getDistanceMatrix(g, libraryDistance, LibraryDistance());
+    append(distanceMatrix, libraryDistance);
+
+    Graph<Tree<double> > guideTree;
+    upgmaTree(libraryDistance, guideTree);
+    TGraph gOut(seqSet);
+    progressiveAlignment(g, guideTree, gOut);
+    convertAlignment(gOut, alignMat);
+    omp_set_num_threads(1);
+}
+
+// The library, distances and alignment must not depend on the number of threads.
+void Test_ParallelTCoffee() {
+    typedef StringSet<String<AminoAcid>, Owner<> > TSequenceSet;
+
+    std::mt19937 rng(42);
+    TSequenceSet seqSet;
+    String<AminoAcid> ancestor;
+    for (unsigned i = 0; i < 80; ++i)
+        appendValue(ancestor, AminoAcid(rng() % 20));
+    for (unsigned k = 0; k < 40; ++k)
+    {
+        String<AminoAcid> seq;
+        for (unsigned i = 0; i < length(ancestor); ++i)
+        {
+            unsigned r = rng() % 10;
+            if (r == 0)
+                appendValue(seq, AminoAcid(rng() % 20));
+            else if (r != 1)
+                appendValue(seq, ancestor[i]);
+        }
+        appendValue(seqSet, seq);
+    }
+
+    String<Fragment<> > serialMatches, parallelMatches;
+    String<int> serialScores, parallelScores;
+    String<double> serialDistances, parallelDistances;
+    String<char> serialAlignment, parallelAlignment;
+    _parallelTCoffee(seqSet, 1, serialMatches, serialScores, serialDistances, serialAlignment);
+    _parallelTCoffee(seqSet, 4, parallelMatches, parallelScores, parallelDistances, parallelAlignment);
+
+    SEQAN_ASSERT_EQ(length(parallelMatches), length(serialMatches));
+    for (unsigned i = 0; i < length(serialMatches); ++i)
+    {
+        SEQAN_ASSERT_EQ(parallelMatches[i].seqId1, serialMatches[i].seqId1);
+        SEQAN_ASSERT_EQ(parallelMatches[i].begin1, serialMatches[i].begin1);
+        SEQAN_ASSERT_EQ(parallelMatches[i].seqId2, serialMatches[i].seqId2);
+        SEQAN_ASSERT_EQ(parallelMatches[i].begin2, serialMatches[i].begin2);
+        SEQAN_ASSERT_EQ(parallelMatches[i].len, serialMatches[i].len);
+    }
+    SEQAN_ASSERT(parallelScores == serialScores);
+    SEQAN_ASSERT(parallelDistances == serialDistances);
+    SEQAN_ASSERT(parallelAlignment == serialAlignment);
+}
+
+
 void Test_ReversableFragments() {
     typedef unsigned int TSize;
     typedef String<Dna> TSequence;
@@ -491,6 +569,10 @@ SEQAN_DEFINE_TEST(test_progressive)
 {
     Test_Progressive();
 }
+SEQAN_DEFINE_TEST(test_parallel_tcoffee)
+{
+    Test_ParallelTCoffee();
+}
 SEQAN_DEFINE_TEST(test_reversable_fragments)
 {
     Test_ReversableFragments();
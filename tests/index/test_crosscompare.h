@@ -35,6 +35,7 @@
 #ifndef TESTS_INDEX_TEST_CROSS_COMPARE_H
 #define TESTS_INDEX_TEST_CROSS_COMPARE_H
 
+#include <random>
 #include <typeinfo>
 
 #include <seqan/index.h>
@@ -229,6 +230,94 @@ SEQAN_DEFINE_TEST(testIndexCrossCompareDnaDfi)
     crossIndicesDna<IndexWotd<>, IndexWotd<Dfi<> > >();
 }
 
+// minimal frequency in the first dataset
+struct TestDfiPredMinFreq_
+{
+    unsigned minFreq;
+
+    TestDfiPredMinFreq_(unsigned minFreq) : minFreq(minFreq) {}
+
+    inline bool operator()(DfiEntry_ const &entry) const
+    {
+        return entry.freq[0] >= minFreq;
+    }
+};
+
+template <typename TIndex>
+void crossParallelWotd(TIndex &lazyIndex, TIndex &index)
+{
+    omp_set_num_threads(4);
+    indexCreate(index, WotdDir(), Parallel());
+    omp_set_num_threads(1);
+
+    // all nodes are evaluated, traversals don't change the directory
+    typename Size<typename Fibre<TIndex, WotdDir>::Type>::Type dirLength = length(indexDir(index));
+    crossBottomUp< TopDown<ParentLinks<PreorderEmptyEdges> > > (lazyIndex, index);
+    crossBottomUp< TopDown<ParentLinks<Postorder> > > (lazyIndex, index);
+    SEQAN_ASSERT_EQ(length(indexDir(index)), dirLength);
+}
+
+template <typename TText>
+void crossParallelWotd(TText &text)
+{
+    Index<TText, IndexWotd<> > lazyIndex(text);
+    Index<TText, IndexWotd<> > index(text);
+    crossParallelWotd(lazyIndex, index);
+}
+
+SEQAN_DEFINE_TEST(testIndexCrossCompareParallelWotd)
+{
+    std::mt19937 rng(42);
+    {
+        CharString text("mississippi");
+        crossParallelWotd(text);
+
+        CharString empty;
+        Index<CharString, IndexWotd<> > index(empty);
+        indexCreate(index, WotdDir(), Parallel());
+        SEQAN_ASSERT_EQ(length(indexDir(index)), 1u);
+    }
+    {
+        DnaString text;
+        for (unsigned i = 0; i < 5000; ++i)
+            appendValue(text, Dna(rng() % 4));
+        crossParallelWotd(text);
+    }
+    {
+        StringSet<String<AminoAcid> > t;
+        resize(t, 300);
+        for (unsigned i = 0; i < length(t); ++i)
+            for (unsigned j = rng() % 100; j != 0; --j)
+                appendValue(t[i], AminoAcid(rng() % 20));
+        crossParallelWotd(t);
+    }
+}
+
+SEQAN_DEFINE_TEST(testIndexCrossCompareParallelDfi)
+{
+    typedef StringSet<String<AminoAcid> >                                               TText;
+    typedef Index<TText, IndexWotd<Dfi<TestDfiPredMinFreq_, DfiPredDefault_<true> > > > TIndex;
+
+    // substrings of at least 3 sequences of the first dataset, it has a smaller alphabet
+    std::mt19937 rng(42);
+    TText t;
+    resize(t, 400);
+    for (unsigned i = 0; i < length(t); ++i)
+        for (unsigned j = 50 + rng() % 50; j != 0; --j)
+            appendValue(t[i], AminoAcid(rng() % ((i < 200) ? 4 : 20)));
+
+    String<unsigned> ds;
+    appendValue(ds, 0);
+    appendValue(ds, 200);
+    appendValue(ds, 400);
+
+    TIndex lazyIndex(t, TestDfiPredMinFreq_(3));
+    TIndex index(t, TestDfiPredMinFreq_(3));
+    lazyIndex.ds = ds;
+    index.ds = ds;
+    crossParallelWotd(lazyIndex, index);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 
@@ -52,5 +52,6 @@ SEQAN_BEGIN_TESTSUITE(test_index)
 	SEQAN_CALL_TEST(testIndexCrossCompareDna);
 	SEQAN_CALL_TEST(testIndexCrossCompareDnaStrings);
 //	SEQAN_CALL_TEST(testIndexCrossCompareDnaDfi);
+	SEQAN_CALL_TEST(testIndexCrossCompareParallelWotd);
 }
 SEQAN_END_TESTSUITE
@@ -51,5 +51,6 @@ SEQAN_BEGIN_TESTSUITE(test_index)
 	//SEQAN_CALL_TEST(testIndexCrossCompareChar);
 	// SEQAN_CALL_TEST(testIndexCrossCompareDna);
 	SEQAN_CALL_TEST(testIndexCrossCompareDnaDfi);
+	SEQAN_CALL_TEST(testIndexCrossCompareParallelDfi);
 }
 SEQAN_END_TESTSUITE
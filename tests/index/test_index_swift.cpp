@@ -2,6 +2,8 @@
 #include <seqan/index.h>
 #include <seqan/sequence.h>
 
+#include <random>
+
 // Test SWIFT finder with empty pattern.
 SEQAN_DEFINE_TEST(test_index_swift_find_empty_pattern)
 {
@@ -73,9 +75,106 @@ SEQAN_DEFINE_TEST(test_index_swift_edge_case_hash_collision)
     }
 }
 
+// Genome with mutated copies of the queries and a poly-A repeat, the queries are random sequences.
+template <typename TRng>
+void _swiftParallelTestData(seqan2::Dna5String & genome, seqan2::StringSet<seqan2::Dna5String> & queries,
+                            unsigned numQueries, unsigned queryLength, TRng & rng)
+{
+    using namespace seqan2;
+
+    clear(genome);
+    clear(queries);
+    for (unsigned i = 0; i < numQueries; ++i)
+    {
+        Dna5String query;
+        for (unsigned j = 0; j < queryLength + rng() % queryLength; ++j)
+            appendValue(query, Dna(rng() % 4));
+        appendValue(queries, query);
+    }
+    for (unsigned i = 0; i < 200000; ++i)
+        appendValue(genome, Dna(rng() % 4));
+    for (unsigned i = 0; i < 300; ++i)
+    {
+        Dna5String const & query = queries[rng() % numQueries];
+        unsigned pos = rng() % (length(genome) - length(query));
+        for (unsigned j = 0; j < length(query); ++j)
+            genome[pos + j] = (rng() % 25 == 0) ? Dna5(rng() % 4) : query[j];
+    }
+    for (unsigned i = 0; i < 500; ++i)
+        genome[100000 + i] = 'A';
+}
+
+template <typename TSwiftSpec, typename TSize>
+void _swiftParallelTestCompare(seqan2::Dna5String & genome, seqan2::StringSet<seqan2::Dna5String> & queries,
+                               double errorRate, TSize minLength)
+{
+    using namespace seqan2;
+
+    typedef Index<StringSet<Dna5String>, IndexQGram<UngappedShape<11>, OpenAddressing> > TQGramIndex;
+    typedef Finder<Dna5String, Swift<TSwiftSpec> > TFinder;
+    typedef typename TFinder::THitString THitString;
+
+    TQGramIndex index(queries);
+    Pattern<TQGramIndex, Swift<TSwiftSpec> > pattern(index);
+
+    THitString serialHits;
+    TFinder serialFinder(genome, 50u, 1u);
+    while (find(serialFinder, pattern, errorRate, minLength))
+    {
+        appendValue(serialHits, *serialFinder.curHit);
+        SEQAN_ASSERT_LT(pattern.curSeqNo, length(queries));
+    }
+    std::sort(begin(serialHits, Standard()), end(serialHits, Standard()), SwiftHitLess_());
+    SEQAN_ASSERT_GT(length(serialHits), 0u);
+
+    for (int numThreads = 1; numThreads <= 4; numThreads += 3)
+    {
+        omp_set_num_threads(numThreads);
+        THitString parallelHits;
+        TFinder parallelFinder(genome, 50u, 1u);
+        while (find(parallelFinder, pattern, errorRate, minLength, Parallel()))
+        {
+            appendValue(parallelHits, *parallelFinder.curHit);
+            SEQAN_ASSERT_EQ(pattern.curSeqNo, (*parallelFinder.curHit).ndlSeqNo);
+        }
+        SEQAN_ASSERT_EQ(length(parallelHits), length(serialHits));
+        for (unsigned i = 0; i < length(serialHits); ++i)
+        {
+            SEQAN_ASSERT_NOT(SwiftHitLess_()(serialHits[i], parallelHits[i]));
+            SEQAN_ASSERT_NOT(SwiftHitLess_()(parallelHits[i], serialHits[i]));
+        }
+    }
+    omp_set_num_threads(1);
+}
+
+// The parallel scan must report the same hits as the sequential one.
+SEQAN_DEFINE_TEST(test_index_swift_find_parallel_local)
+{
+    using namespace seqan2;
+
+    std::mt19937 rng(42);
+    Dna5String genome;
+    StringSet<Dna5String> queries;
+    _swiftParallelTestData(genome, queries, 20, 300, rng);
+    _swiftParallelTestCompare<SwiftLocal>(genome, queries, 0.05, 100);
+}
+
+SEQAN_DEFINE_TEST(test_index_swift_find_parallel_semi_global)
+{
+    using namespace seqan2;
+
+    std::mt19937 rng(7);
+    Dna5String genome;
+    StringSet<Dna5String> queries;
+    _swiftParallelTestData(genome, queries, 100, 80, rng);
+    _swiftParallelTestCompare<SwiftSemiGlobal>(genome, queries, 0.05, 0);
+}
+
 SEQAN_BEGIN_TESTSUITE(test_index_swift)
 {
 	SEQAN_CALL_TEST(test_index_swift_find_empty_pattern);
     SEQAN_CALL_TEST(test_index_swift_edge_case_hash_collision);
+    SEQAN_CALL_TEST(test_index_swift_find_parallel_local);
+    SEQAN_CALL_TEST(test_index_swift_find_parallel_semi_global);
 }
 SEQAN_END_TESTSUITE
@@ -75,5 +75,9 @@ SEQAN_BEGIN_TESTSUITE(test_delta_map)
     SEQAN_CALL_TEST(test_delta_map_entry_delta_coverage);
     SEQAN_CALL_TEST(test_delta_map_entry_delta_type);
     SEQAN_CALL_TEST(test_delta_map_entry_delta_position);
+
+    // Tests for compressed coverages.
+    SEQAN_CALL_TEST(test_delta_map_compressed_coverage);
+    SEQAN_CALL_TEST(test_delta_map_compressed_config);
 }
 SEQAN_END_TESTSUITE
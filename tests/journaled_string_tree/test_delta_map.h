@@ -37,6 +37,8 @@
 #ifndef TESTS_JOURNALED_STRING_TREE_TEST_DELTA_MAP_H_
 #define TESTS_JOURNALED_STRING_TREE_TEST_DELTA_MAP_H_
 
+#include <random>
+
 #include <seqan/basic.h>
 #include <seqan/sequence.h>
 #include <seqan/journaled_string_tree.h>
@@ -524,4 +526,108 @@ SEQAN_DEFINE_TEST(test_delta_map_entry_delta_coverage)
     SEQAN_ASSERT_EQ(getDeltaCoverage(*(it2+2)), cov3);
 }
 
+SEQAN_DEFINE_TEST(test_delta_map_compressed_coverage)
+{
+    typedef String<bool, Packed<> > TBitVector;
+
+    std::mt19937 rng(42);
+    // Sparse, dense, and run-like coverages of different lengths.
+    for (unsigned len : {0u, 1u, 5u, 63u, 64u, 65u, 130u, 1000u})
+    {
+        for (unsigned density : {0u, 1u, 50u, 99u, 100u})
+        {
+            for (unsigned runLength : {1u, 40u})
+            {
+                TBitVector bits;
+                resize(bits, len, false, Exact());
+                for (unsigned i = 0; i < len; i += runLength)
+                {
+                    bool val = rng() % 100 < density;
+                    for (unsigned j = i; j < std::min(i + runLength, len); ++j)
+                        bits[j] = val;
+                }
+
+                CompressedDeltaCoverage cov(bits);
+                SEQAN_ASSERT_EQ(length(cov), len);
+                SEQAN_ASSERT_EQ(testAllZeros(cov), len == 0 || testAllZeros(bits));
+                SEQAN_ASSERT_LEQ(length(cov._data), 2 * ((len + 63) / 64));
+                for (unsigned i = 0; i < len; ++i)
+                    SEQAN_ASSERT_EQ(cov[i], static_cast<bool>(bits[i]));
+
+                TBitVector decoded;
+                decompress(decoded, cov);
+                SEQAN_ASSERT(decoded == bits);
+                SEQAN_ASSERT(CompressedDeltaCoverage(decoded) == cov);
+
+                String<unsigned> ids;
+                impl::forEachCovered(cov, len / 3, len - len / 4, [&ids](uint32_t id) { appendValue(ids, id); });
+                String<unsigned> idsBits;
+                impl::forEachCovered(bits, len / 3, len - len / 4, [&idsBits](uint32_t id) { appendValue(idsBits, id); });
+                SEQAN_ASSERT(ids == idsBits);
+                for (unsigned i = 0; i < length(ids); ++i)
+                    SEQAN_ASSERT(bits[ids[i]]);
+
+                if (len == 0)
+                    continue;
+
+                // Word-wise combination with a random bit vector.
+                TBitVector lhs;
+                resize(lhs, len, false, Exact());
+                for (unsigned i = 0; i < len; ++i)
+                    lhs[i] = rng() % 2;
+                TBitVector expected, actual;
+                transform(expected, lhs, bits, FunctorBitwiseAnd());
+                transform(actual, lhs, cov, FunctorBitwiseAnd());
+                SEQAN_ASSERT(actual == expected);
+                transform(expected, lhs, bits, FunctorBitwiseOr());
+                transform(actual, lhs, cov, FunctorBitwiseOr());
+                SEQAN_ASSERT(actual == expected);
+                transform(expected, lhs, bits, FunctorNested<FunctorBitwiseAnd, FunctorIdentity, FunctorBitwiseNot>());
+                transform(lhs, lhs, cov, FunctorNested<FunctorBitwiseAnd, FunctorIdentity, FunctorBitwiseNot>());
+                SEQAN_ASSERT(lhs == expected);
+            }
+        }
+    }
+
+    // The smallest representation is selected.
+    TBitVector bits;
+    resize(bits, 640, false, Exact());
+    bits[3] = true;
+    SEQAN_ASSERT_EQ(CompressedDeltaCoverage(bits)._mode, static_cast<uint8_t>(CompressedDeltaCoverage::SPARSE));
+    for (unsigned i = 100; i < 400; ++i)
+        bits[i] = true;
+    SEQAN_ASSERT_EQ(CompressedDeltaCoverage(bits)._mode, static_cast<uint8_t>(CompressedDeltaCoverage::RUNS));
+    for (unsigned i = 0; i < 640; i += 2)
+        bits[i] = true;
+    SEQAN_ASSERT_EQ(CompressedDeltaCoverage(bits)._mode, static_cast<uint8_t>(CompressedDeltaCoverage::BITS));
+
+    // Resizing keeps the coverage.
+    CompressedDeltaCoverage cov(bits);
+    resize(cov, 700, false);
+    SEQAN_ASSERT_EQ(length(cov), 700u);
+    SEQAN_ASSERT_EQ(cov[2], true);
+    SEQAN_ASSERT_EQ(cov[699], false);
+}
+
+SEQAN_DEFINE_TEST(test_delta_map_compressed_config)
+{
+    typedef DeltaMap<CompressedJstConfig<DnaString>, Default> TDeltaMap;
+    typedef DeltaMap<DefaultJstConfig<DnaString>, Default> TDeltaMapBits;
+
+    static_assert(IsSameType<DeltaCoverage<TDeltaMap>::Type, CompressedDeltaCoverage>::VALUE, "");
+    static_assert(IsSameType<DeltaCoverage<TDeltaMapBits>::Type, String<bool, Packed<> > >::VALUE, "");
+
+    TDeltaMap deltaMap;
+    String<bool, Packed<> > cov;
+    _getCoverage(cov, 10u, 3u);
+    insert(deltaMap, 1u, 'C', cov, DeltaTypeSnp());
+    insert(deltaMap, 4u, 3u, cov, DeltaTypeDel());
+
+    SEQAN_ASSERT_EQ(size(deltaMap), 3u);
+    String<bool, Packed<> > decoded;
+    decompress(decoded, getDeltaCoverage(*begin(deltaMap, Standard())));
+    SEQAN_ASSERT(decoded == cov);
+    SEQAN_ASSERT(isRightEnd(*(begin(deltaMap, Standard()) + 2)));
+}
+
 #endif  // TESTS_JOURNALED_STRING_TREE_TEST_DELTA_MAP_H_
@@ -36,6 +36,7 @@
 #include <seqan/file.h>
 
 #include "test_journaled_string_tree.h"
+#include "test_journaled_string_tree_io.h"
 
 SEQAN_BEGIN_TESTSUITE(test_journaled_string_tree)
 {
@@ -51,5 +52,10 @@ SEQAN_BEGIN_TESTSUITE(test_journaled_string_tree)
     SEQAN_CALL_TEST(test_journaled_string_tree_resize);
     SEQAN_CALL_TEST(test_journaled_string_tree_max_size);
     SEQAN_CALL_TEST(test_journaled_string_tree_size);
+
+    // Tests for journaled string tree I/O
+    SEQAN_CALL_TEST(test_journaled_string_tree_build_from_vcf);
+    SEQAN_CALL_TEST(test_journaled_string_tree_build_from_vcf_errors);
+    SEQAN_CALL_TEST(test_journaled_string_tree_save_open);
 }
 SEQAN_END_TESTSUITE
@@ -47,5 +47,8 @@ SEQAN_BEGIN_TESTSUITE(test_journaled_string_tree_find)
     SEQAN_CALL_TEST(test_journaled_string_tree_find_shiftand);
     SEQAN_CALL_TEST(test_journaled_string_tree_find_shiftor);
     SEQAN_CALL_TEST(test_journaled_string_tree_find_myers);
+    SEQAN_CALL_TEST(test_journaled_string_tree_find_parallel);
+    SEQAN_CALL_TEST(test_journaled_string_tree_find_no_delta);
+    SEQAN_CALL_TEST(test_journaled_string_tree_find_sv_at_begin);
 }
 SEQAN_END_TESTSUITE
@@ -155,4 +155,110 @@ SEQAN_DEFINE_TEST(test_journaled_string_tree_find_myers)
 #endif
 }
 
+template <typename TNeedle, typename TSpec>
+inline void _testFindJstParallel(Pattern<TNeedle, TSpec> & p,
+                                 unsigned contextLength,
+                                 unsigned blockCount)
+{
+    typedef JournaledStringTree<DnaString> TJst;
+
+    auto jst = JstMockGenerator::_createComplexJst<TJst>();
+    auto seqs = JstMockGenerator::_createComplexTestSet();
+
+    typename Traverser<TJst>::Type trav(jst, contextLength, contextLength);
+    JstExtension<Pattern<TNeedle, TSpec> > ext(p);
+
+    StringSet<String<unsigned> > positions;
+    resize(positions, length(seqs), Exact());
+    auto delegate = [&positions](String<Pair<unsigned, unsigned> > const & pos)
+    {
+        for (auto p : pos)
+            appendValue(positions[p.i1], p.i2);
+    };
+
+    if (blockCount == 0)
+        find(trav, ext, delegate, Parallel());
+    else
+        impl::findParallel(trav, ext, delegate, blockCount);
+
+    for (unsigned pos = 0; pos < length(seqs); ++pos)
+    {
+        // The blocks report their hits in arbitrary order.
+        std::sort(begin(positions[pos], Standard()), end(positions[pos], Standard()));
+
+        Finder<DnaString> finder(seqs[pos]);
+        unsigned counter = 0;
+        while (find(finder, p))
+        {
+            SEQAN_ASSERT_LT(counter, length(positions[pos]));
+            SEQAN_ASSERT_EQ(positions[pos][counter], finder.data_endPos - 1);
+            ++counter;
+        }
+        SEQAN_ASSERT_EQ(counter, length(positions[pos]));
+    }
+}
+
+SEQAN_DEFINE_TEST(test_journaled_string_tree_find_parallel)
+{
+    for (auto ndl : JstMockGenerator::generateNeedles())
+    {
+        for (unsigned blockCount : {0u, 1u, 2u, 3u, 7u, 20u, 100u})
+        {
+            Pattern<DnaString, ShiftAnd> p(ndl);
+            _testFindJstParallel(p, length(ndl), blockCount);
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_journaled_string_tree_find_no_delta)
+{
+    typedef JournaledStringTree<DnaString> TJst;
+
+    DnaString src = "ACGTACGTTACGA";
+    TJst jst(src, 3);
+
+    typename Traverser<TJst>::Type trav(jst, 3, 3);
+    Pattern<DnaString, ShiftAnd> p(DnaString("ACG"));
+    JstExtension<Pattern<DnaString, ShiftAnd> > ext(p);
+
+    String<unsigned> hits;
+    find(trav, ext, [&]()
+    {
+        for (auto pos : position(trav))
+            if (pos.i1 == 1u)
+                appendValue(hits, pos.i2);
+    });
+
+    SEQAN_ASSERT_EQ(length(hits), 3u);
+    SEQAN_ASSERT_EQ(hits[0], 2u);
+    SEQAN_ASSERT_EQ(hits[1], 6u);
+    SEQAN_ASSERT_EQ(hits[2], 11u);
+}
+
+SEQAN_DEFINE_TEST(test_journaled_string_tree_find_sv_at_begin)
+{
+    typedef JournaledStringTree<DnaString> TJst;
+
+    // Seq 1 is AAACAGGTAGTT, the SNP directly behind the SV is the fourth character.
+    DnaString src = "GTAGGTAGTT";
+    TJst jst(src, 2);
+    String<unsigned> ids;
+    appendValue(ids, 1u);
+    insert(jst, 0, Pair<unsigned, DnaString>(2, "AAA"), ids, DeltaTypeSV());
+    appendValue(ids, 0u);
+    insert(jst, 2, Dna('C'), ids, DeltaTypeSnp());
+
+    typename Traverser<TJst>::Type trav(jst, 1, 1);
+    Pattern<DnaString, ShiftAnd> p(DnaString("C"));
+    JstExtension<Pattern<DnaString, ShiftAnd> > ext(p);
+
+    String<Pair<unsigned, unsigned> > hits;
+    find(trav, ext, [&]() { append(hits, position(trav)); });
+
+    std::sort(begin(hits, Standard()), end(hits, Standard()));
+    SEQAN_ASSERT_EQ(length(hits), 2u);
+    SEQAN_ASSERT_EQ(hits[0], (Pair<unsigned, unsigned>(0, 2)));
+    SEQAN_ASSERT_EQ(hits[1], (Pair<unsigned, unsigned>(1, 3)));
+}
+
 #endif // TESTS_JOURNALED_STRING_TREE_TEST_JOURNALED_STRING_TREE_FIND_H_
@@ -0,0 +1,214 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for building journaled string trees from VCF files and storing them.
+// ==========================================================================
+
+#ifndef TESTS_JOURNALED_STRING_TREE_TEST_JOURNALED_STRING_TREE_IO_H_
+#define TESTS_JOURNALED_STRING_TREE_TEST_JOURNALED_STRING_TREE_IO_H_
+
+#include <fstream>
+
+#include <seqan/basic.h>
+#include <seqan/journaled_string_tree.h>
+
+using namespace seqan2;
+
+// Writes a VCF file with two diploid samples.  The resulting haplotypes of chr1 are returned by
+// _testJstVcfHaplotypes().
+inline std::string
+_testJstWriteVcf(char const * records)
+{
+    std::string path = (std::string)SEQAN_TEMP_FILENAME() + ".vcf";
+    std::ofstream file(path.c_str());
+    file << "##fileformat=VCFv4.2\n"
+         << "##contig=<ID=chr1,length=20>\n"
+         << "##contig=<ID=chr2,length=20>\n"
+         << "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+         << "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tS1\tS2\n"
+         << records;
+    return path;
+}
+
+inline char const *
+_testJstVcfRecords()
+{
+    return "chr1\t2\t.\tC\tT\t.\tPASS\t.\tGT\t0|1\t1|1\n"              // SNP
+           "chr1\t4\t.\tTA\tT\t.\tPASS\t.\tGT\t1|0\t0|0\n"             // Deletion
+           "chr1\t6\t.\tC\tCGG,G\t.\tPASS\t.\tGT:DP\t1|2:3\t0|.:4\n"   // Insertion and SNP
+           "chr1\t9\t.\tACG\tTCA\t.\tPASS\t.\tGT\t0|0\t1|0\n"          // Two SNPs
+           "chr1\t10\t.\tC\t<DEL>\t.\tPASS\t.\tGT\t1|1\t1|1\n"         // Symbolic allele is skipped
+           "chr2\t3\t.\tG\tA\t.\tPASS\t.\tGT\t1|1\t1|1\n"              // Other contig
+           "chr1\t12\t.\tTACG\tTG\t.\tPASS\t.\tGT\t0|0\t0|1\n"         // Deletion
+           "chr1\t13\t.\tA\tG\t.\tPASS\t.\tGT\t0|0\t0|1\n"             // Overlaps the deletion of the last haplotype
+           "chr1\t17\t.\tACG\tAT\t.\tPASS\t.\tGT\t0|0\t1|1\n";         // Structural variant
+}
+
+inline StringSet<DnaString>
+_testJstVcfHaplotypes()
+{
+    StringSet<DnaString> haplotypes;
+    appendValue(haplotypes, "ACGTCGGGTACGTACGTACGT");
+    appendValue(haplotypes, "ATGTAGGTACGTACGTACGT");
+    appendValue(haplotypes, "ATGTACGTTCATACGTATT");
+    appendValue(haplotypes, "ATGTACGTACGTGTATT");
+    return haplotypes;
+}
+
+// Collects the sequences by traversing the tree.
+template <typename TJst>
+inline void
+_testJstCheckSequences(TJst & jst, StringSet<DnaString> const & expected)
+{
+    SEQAN_ASSERT_EQ(length(jst), length(expected));
+
+    StringSet<DnaString> seqs;
+    resize(seqs, length(jst));
+
+    typename Traverser<TJst>::Type sub(jst, 1, 1);
+    auto observer = makeObserverList();
+    init(sub, observer, SelectFirstProxy());
+    while (!atEnd(sub))
+    {
+        auto const & pos = position(sub);
+        for (auto it = begin(pos), itEnd = end(pos); it != itEnd; ++it)
+            appendValue(seqs[(*it).i1], *(impl::activeNode(sub).curEdgeIt));
+        advance(sub, 1, SelectFirstProxy());
+    }
+
+    for (unsigned i = 0; i < length(expected); ++i)
+        SEQAN_ASSERT_EQ(seqs[i], expected[i]);
+}
+
+template <typename TConfig>
+inline void
+_testJstBuildFromVcf()
+{
+    typedef JournaledStringTree<DnaString, TConfig> TJst;
+
+    DnaString ref = "ACGTACGTACGTACGTACGT";
+    TJst jst(ref, 0);
+
+    std::string path = _testJstWriteVcf(_testJstVcfRecords());
+    VcfFileIn vcfFile(path.c_str());
+    buildFromVcf(jst, vcfFile, "chr1");
+
+    SEQAN_ASSERT_EQ(length(jst), 4u);
+    // SNPs at 1, 5, 8, 10, deletions at 4 and 12 (two entries), insertion at 6, SV at 17 (two entries).
+    SEQAN_ASSERT_EQ(size(impl::member(jst, JstDeltaMapMember())), 10u);
+    _testJstCheckSequences(jst, _testJstVcfHaplotypes());
+}
+
+SEQAN_DEFINE_TEST(test_journaled_string_tree_build_from_vcf)
+{
+    _testJstBuildFromVcf<DefaultJstConfig<DnaString> >();
+    _testJstBuildFromVcf<CompressedJstConfig<DnaString> >();
+}
+
+SEQAN_DEFINE_TEST(test_journaled_string_tree_build_from_vcf_errors)
+{
+    typedef JournaledStringTree<DnaString, CompressedJstConfig<DnaString> > TJst;
+
+    DnaString ref = "ACGTACGTACGTACGTACGT";
+    {   // Unsorted records.
+        TJst jst(ref, 0);
+        std::string path = _testJstWriteVcf("chr1\t4\t.\tT\tA\t.\tPASS\t.\tGT\t0|1\t1|1\n"
+                                            "chr1\t2\t.\tC\tT\t.\tPASS\t.\tGT\t0|1\t1|1\n");
+        VcfFileIn vcfFile(path.c_str());
+        SEQAN_TEST_EXCEPTION(ParseError, buildFromVcf(jst, vcfFile, "chr1"));
+    }
+    {   // REF behind the end of the reference.
+        TJst jst(ref, 0);
+        std::string path = _testJstWriteVcf("chr1\t20\t.\tTA\tT\t.\tPASS\t.\tGT\t0|1\t1|1\n");
+        VcfFileIn vcfFile(path.c_str());
+        SEQAN_TEST_EXCEPTION(ParseError, buildFromVcf(jst, vcfFile, "chr1"));
+    }
+    {   // Missing ALT allele.
+        TJst jst(ref, 0);
+        std::string path = _testJstWriteVcf("chr1\t2\t.\tC\tT\t.\tPASS\t.\tGT\t0|2\t1|1\n");
+        VcfFileIn vcfFile(path.c_str());
+        SEQAN_TEST_EXCEPTION(ParseError, buildFromVcf(jst, vcfFile, "chr1"));
+    }
+    {   // No variants of the contig.
+        TJst jst(ref, 0);
+        std::string path = _testJstWriteVcf("chr2\t2\t.\tC\tT\t.\tPASS\t.\tGT\t0|1\t1|1\n");
+        VcfFileIn vcfFile(path.c_str());
+        buildFromVcf(jst, vcfFile, "chr1");
+        SEQAN_ASSERT_EQ(length(jst), 4u);
+        SEQAN_ASSERT(empty(impl::member(jst, JstDeltaMapMember())));
+    }
+}
+
+template <typename TConfigOut, typename TConfigIn>
+inline void
+_testJstSaveOpen()
+{
+    typedef JournaledStringTree<DnaString, TConfigOut> TJstOut;
+    typedef JournaledStringTree<DnaString, TConfigIn> TJstIn;
+
+    std::string jstPath = (std::string)SEQAN_TEMP_FILENAME() + ".jst";
+    {
+        DnaString ref = "ACGTACGTACGTACGTACGT";
+        TJstOut jst(ref, 0);
+        std::string path = _testJstWriteVcf(_testJstVcfRecords());
+        VcfFileIn vcfFile(path.c_str());
+        buildFromVcf(jst, vcfFile, "chr1");
+        SEQAN_ASSERT(save(jst, jstPath.c_str()));
+    }
+
+    DnaString source;
+    TJstIn jst;
+    SEQAN_ASSERT(open(jst, source, jstPath.c_str()));
+    SEQAN_ASSERT_EQ(source, "ACGTACGTACGTACGTACGT");
+    SEQAN_ASSERT_EQ(size(impl::member(jst, JstDeltaMapMember())), 10u);
+    _testJstCheckSequences(jst, _testJstVcfHaplotypes());
+}
+
+SEQAN_DEFINE_TEST(test_journaled_string_tree_save_open)
+{
+    _testJstSaveOpen<CompressedJstConfig<DnaString>, CompressedJstConfig<DnaString> >();
+    _testJstSaveOpen<DefaultJstConfig<DnaString>, CompressedJstConfig<DnaString> >();
+    _testJstSaveOpen<CompressedJstConfig<DnaString>, DefaultJstConfig<DnaString> >();
+
+    // Invalid files.
+    typedef JournaledStringTree<DnaString, CompressedJstConfig<DnaString> > TJst;
+    DnaString source;
+    TJst jst;
+    std::string path = (std::string)SEQAN_TEMP_FILENAME() + ".jst";
+    SEQAN_ASSERT_NOT(open(jst, source, path.c_str()));
+    {
+        std::ofstream file(path.c_str(), std::ios::binary);
+        file << "SQJST";
+    }
+    SEQAN_ASSERT_NOT(open(jst, source, path.c_str()));
+}
+
+#endif  // TESTS_JOURNALED_STRING_TREE_TEST_JOURNALED_STRING_TREE_IO_H_
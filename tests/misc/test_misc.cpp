@@ -53,6 +53,7 @@
 #include <seqan/misc/terminal.h>
 
 #include "test_misc_interval_tree.h"
+#include "test_misc_implicit_interval_tree.h"
 #include "test_misc_accumulators.h"
 #include "test_misc_edit_environment.h"
 #include "test_misc_bit_twiddling.h"
@@ -116,6 +117,11 @@ SEQAN_BEGIN_TESTSUITE(test_misc) {
     SEQAN_CALL_TEST(Interval_Tree__IntervalTreeTest_GraphMap__int_ComputeCenter_StoreIntervals);
     SEQAN_CALL_TEST(Interval_Tree__IntervalTreeTest_FindIntervalsIntervals__int_ComputeCenter);
 
+    // Test ImplicitIntervalTree class
+    SEQAN_CALL_TEST(test_misc_implicit_interval_tree_query_at_boundary);
+    SEQAN_CALL_TEST(test_misc_implicit_interval_tree_add_interval);
+    SEQAN_CALL_TEST(test_misc_implicit_interval_tree_random);
+
     SEQAN_CALL_TEST(test_misc_accumulators_average_accumulator_int_average);
     SEQAN_CALL_TEST(test_misc_accumulators_average_accumulator_int_count);
     SEQAN_CALL_TEST(test_misc_accumulators_average_accumulator_int_sum);
@@ -0,0 +1,175 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// ==========================================================================
+// Tests for misc/implicit_interval_tree.h.
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_TEST_MISC_IMPLICIT_INTERVAL_TREE_H
+#define SEQAN_HEADER_TEST_MISC_IMPLICIT_INTERVAL_TREE_H
+
+#include <algorithm>
+#include <random>
+
+#include <seqan/basic.h>
+#include <seqan/misc/implicit_interval_tree.h>  // Header under test.
+
+namespace seqan2 {
+
+SEQAN_DEFINE_TEST(test_misc_implicit_interval_tree_query_at_boundary)
+{
+    typedef IntervalAndCargo<int, double> TInterval;
+    typedef String<TInterval, Alloc<Exact> > TIntervalList;
+
+    TIntervalList intervals;
+    appendValue(intervals, TInterval(40, 60, 3.3));
+    appendValue(intervals, TInterval(0, 30, 1.4));
+    appendValue(intervals, TInterval(30, 40, 2.2));
+    ImplicitIntervalTree<int, double> tree(intervals);
+    SEQAN_ASSERT_EQ(length(tree), 3u);
+
+    String<double> result;
+    findIntervals(result, tree, 20, 30);
+    SEQAN_ASSERT_EQ(length(result), 1u);
+    SEQAN_ASSERT_EQ(result[0], 1.4);
+
+    findIntervals(result, tree, 30);
+    SEQAN_ASSERT_EQ(length(result), 1u);
+    SEQAN_ASSERT_EQ(result[0], 2.2);
+
+    findIntervals(result, tree, 29, 41);
+    SEQAN_ASSERT_EQ(length(result), 3u);
+    SEQAN_ASSERT_EQ(result[0], 1.4);
+    SEQAN_ASSERT_EQ(result[1], 2.2);
+    SEQAN_ASSERT_EQ(result[2], 3.3);
+
+    findIntervals(result, tree, 60);
+    SEQAN_ASSERT(empty(result));
+}
+
+SEQAN_DEFINE_TEST(test_misc_implicit_interval_tree_add_interval)
+{
+    ImplicitIntervalTree<int> tree;
+    String<unsigned> result;
+    findIntervals(result, tree, 5);
+    SEQAN_ASSERT(empty(result));
+
+    addInterval(tree, 10, 20);
+    addInterval(tree, 0, 12);
+    addInterval(tree, 15, 16, 7u);
+    findIntervals(result, tree, 11);
+    SEQAN_ASSERT_EQ(length(result), 2u);
+    SEQAN_ASSERT_EQ(result[0], 1u);
+    SEQAN_ASSERT_EQ(result[1], 0u);
+
+    // The index is rebuilt after adding another interval.
+    addInterval(tree, 11, 30);
+    findIntervals(result, tree, 15);
+    SEQAN_ASSERT_EQ(length(result), 3u);
+    SEQAN_ASSERT_EQ(result[0], 0u);
+    SEQAN_ASSERT_EQ(result[1], 3u);
+    SEQAN_ASSERT_EQ(result[2], 7u);
+
+    clear(tree);
+    SEQAN_ASSERT(empty(tree));
+    findIntervals(result, tree, 15);
+    SEQAN_ASSERT(empty(result));
+}
+
+// Compare single and batch queries against the naive algorithm for all tree sizes up to 300 and some larger ones.
+SEQAN_DEFINE_TEST(test_misc_implicit_interval_tree_random)
+{
+    typedef IntervalAndCargo<int, unsigned> TInterval;
+
+    std::mt19937 rng(42);
+    unsigned sizes[] = {1000, 4096, 10000};
+    for (unsigned round = 0; round < 303; ++round)
+    {
+        unsigned n = (round < 300) ? round : sizes[round - 300];
+        int maxPos = 10 * n + 10;
+
+        String<TInterval> intervals;
+        for (unsigned i = 0; i < n; ++i)
+        {
+            int b = rng() % maxPos;
+            int len = (rng() % 8 == 0) ? rng() % (maxPos / 2 + 1) : rng() % 30;
+            appendValue(intervals, TInterval(b, b + len + 1, i));
+        }
+        ImplicitIntervalTree<int, unsigned> tree;
+        if (round % 2)
+            createIntervalTree(tree, intervals, Parallel());
+        else
+            createIntervalTree(tree, intervals);
+
+        String<int> points;
+        String<Pair<int> > ranges;
+        for (unsigned i = 0; i < 100; ++i)
+        {
+            int b = static_cast<int>(rng() % (maxPos + 20)) - 10;
+            appendValue(points, b);
+            appendValue(ranges, Pair<int>(b, b + rng() % 50));
+        }
+
+        String<String<unsigned> > pointResults, rangeResults;
+        findIntervals(pointResults, tree, points, Parallel());
+        findIntervals(rangeResults, tree, ranges);
+        SEQAN_ASSERT_EQ(length(pointResults), length(points));
+        SEQAN_ASSERT_EQ(length(rangeResults), length(ranges));
+
+        String<unsigned> result, expected;
+        for (unsigned q = 0; q < length(points); ++q)
+        {
+            clear(expected);
+            for (unsigned i = 0; i < n; ++i)
+                if (intervals[i].i1 <= points[q] && points[q] < intervals[i].i2)
+                    appendValue(expected, i);
+            findIntervals(result, tree, points[q]);
+            std::sort(begin(result, Standard()), end(result, Standard()));
+            std::sort(begin(pointResults[q], Standard()), end(pointResults[q], Standard()));
+            SEQAN_ASSERT(result == expected);
+            SEQAN_ASSERT(pointResults[q] == expected);
+
+            clear(expected);
+            for (unsigned i = 0; i < n; ++i)
+                if (intervals[i].i1 < ranges[q].i2 && ranges[q].i1 < intervals[i].i2)
+                    appendValue(expected, i);
+            findIntervals(result, tree, ranges[q].i1, ranges[q].i2);
+            std::sort(begin(result, Standard()), end(result, Standard()));
+            std::sort(begin(rangeResults[q], Standard()), end(rangeResults[q], Standard()));
+            SEQAN_ASSERT(result == expected);
+            SEQAN_ASSERT(rangeResults[q] == expected);
+        }
+    }
+}
+
+}  // namespace seqan2
+
+#endif  // SEQAN_HEADER_TEST_MISC_IMPLICIT_INTERVAL_TREE_H
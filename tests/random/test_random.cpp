@@ -40,6 +40,7 @@
 
 #include "test_random_basic.h"
 #include "test_random_beta.h"
+#include "test_random_counter_based.h"
 #include "test_random_util.h"
 
 
@@ -58,6 +59,13 @@ SEQAN_BEGIN_TESTSUITE(test_random) {
     SEQAN_CALL_TEST(test_random_beta_read);
     SEQAN_CALL_TEST(test_random_beta_functor);
 
+    SEQAN_CALL_TEST(test_random_philox_known_answers);
+    SEQAN_CALL_TEST(test_random_threefry_known_answers);
+    SEQAN_CALL_TEST(test_random_counter_based_jump_ahead);
+    SEQAN_CALL_TEST(test_random_counter_based_fill);
+    SEQAN_CALL_TEST(test_random_counter_based_streams);
+    SEQAN_CALL_TEST(test_random_counter_based_distributions);
+
     SEQAN_CALL_TEST(test_random_shuffle);
     SEQAN_CALL_TEST(test_random_cvt_beta_param);
     SEQAN_CALL_TEST(test_random_cvt_lognormal_param);
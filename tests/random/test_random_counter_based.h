@@ -0,0 +1,221 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the counter-based Rngs Philox and Threefry.
+// ==========================================================================
+
+#ifndef TEST_RANDOM_TEST_RANDOM_COUNTER_BASED_H_
+#define TEST_RANDOM_TEST_RANDOM_COUNTER_BASED_H_
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+#include <seqan/random.h>
+
+// The known answers are taken from the reference implementation Random123.
+
+SEQAN_DEFINE_TEST(test_random_philox_known_answers)
+{
+    using namespace seqan2;
+
+    {
+        uint32_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+        _philox4x32Rounds<1>(&c0, &c1, &c2, &c3, 0u, 0u);
+        SEQAN_ASSERT_EQ(c0, 0x6627e8d5u);
+        SEQAN_ASSERT_EQ(c1, 0xe169c58du);
+        SEQAN_ASSERT_EQ(c2, 0xbc57ac4cu);
+        SEQAN_ASSERT_EQ(c3, 0x9b00dbd8u);
+    }
+    {
+        uint32_t c0 = 0xffffffff, c1 = 0xffffffff, c2 = 0xffffffff, c3 = 0xffffffff;
+        _philox4x32Rounds<1>(&c0, &c1, &c2, &c3, 0xffffffffu, 0xffffffffu);
+        SEQAN_ASSERT_EQ(c0, 0x408f276du);
+        SEQAN_ASSERT_EQ(c1, 0x41c83b0eu);
+        SEQAN_ASSERT_EQ(c2, 0xa20bc7c6u);
+        SEQAN_ASSERT_EQ(c3, 0x6d5451fdu);
+    }
+    {
+        uint32_t c0 = 0x243f6a88, c1 = 0x85a308d3, c2 = 0x13198a2e, c3 = 0x03707344;
+        _philox4x32Rounds<1>(&c0, &c1, &c2, &c3, 0xa4093822u, 0x299f31d0u);
+        SEQAN_ASSERT_EQ(c0, 0xd16cfe09u);
+        SEQAN_ASSERT_EQ(c1, 0x94fdccebu);
+        SEQAN_ASSERT_EQ(c2, 0x5001e420u);
+        SEQAN_ASSERT_EQ(c3, 0x24126ea1u);
+    }
+
+    // Seed 0, stream 0 and block 0 give the first known answer.
+    CounterBasedRng<Philox> rng;
+    SEQAN_ASSERT_EQ(rng(), 0x6627e8d5u);
+    SEQAN_ASSERT_EQ(rng(), 0xe169c58du);
+    SEQAN_ASSERT_EQ(rng(), 0xbc57ac4cu);
+    SEQAN_ASSERT_EQ(rng(), 0x9b00dbd8u);
+}
+
+SEQAN_DEFINE_TEST(test_random_threefry_known_answers)
+{
+    using namespace seqan2;
+
+    uint64_t c0 = 0, c1 = 0;
+    _threefry2x64Rounds<1>(&c0, &c1, 0ull, 0ull);
+    SEQAN_ASSERT_EQ(c0, 0xc2b6e3a8c2c69865ull);
+    SEQAN_ASSERT_EQ(c1, 0x6f81ed42f350084dull);
+
+    CounterBasedRng<Threefry> rng;
+    SEQAN_ASSERT_EQ(rng(), 0xc2b6e3a8c2c69865ull);
+    SEQAN_ASSERT_EQ(rng(), 0x6f81ed42f350084dull);
+}
+
+template <typename TSpec>
+void testRandomCounterBasedJumpAhead()
+{
+    using namespace seqan2;
+
+    for (unsigned start = 0; start < 6; ++start)
+    {
+        for (unsigned n = 0; n < 40; ++n)
+        {
+            CounterBasedRng<TSpec> stepped(42, 7);
+            CounterBasedRng<TSpec> jumped(42, 7);
+            for (unsigned i = 0; i < start; ++i)
+            {
+                stepped();
+                jumped();
+            }
+            for (unsigned i = 0; i < n; ++i)
+                stepped();
+            jumpAhead(jumped, n);
+            SEQAN_ASSERT_EQ(position(jumped), (uint64_t)(start + n));
+            SEQAN_ASSERT(stepped == jumped);
+            for (unsigned i = 0; i < 10; ++i)
+                SEQAN_ASSERT_EQ(stepped(), jumped());
+        }
+    }
+
+    CounterBasedRng<TSpec> discarded(42);
+    CounterBasedRng<TSpec> jumped(42);
+    discarded.discard(1000003);
+    jumpAhead(jumped, 1000003);
+    SEQAN_ASSERT_EQ(discarded(), jumped());
+}
+
+SEQAN_DEFINE_TEST(test_random_counter_based_jump_ahead)
+{
+    testRandomCounterBasedJumpAhead<seqan2::Philox>();
+    testRandomCounterBasedJumpAhead<seqan2::Threefry>();
+}
+
+template <typename TSpec>
+void testRandomCounterBasedFill()
+{
+    using namespace seqan2;
+    typedef typename CounterBasedRng<TSpec>::result_type TValue;
+
+    for (unsigned start = 0; start < 5; ++start)
+    {
+        for (unsigned len = 0; len < 100; len += 7)
+        {
+            CounterBasedRng<TSpec> single(3, 1);
+            CounterBasedRng<TSpec> bulk(3, 1);
+            jumpAhead(single, start);
+            jumpAhead(bulk, start);
+
+            String<TValue> values;
+            resize(values, len);
+            fillRandom(values, bulk);
+            for (unsigned i = 0; i < len; ++i)
+                SEQAN_ASSERT_EQ(values[i], single());
+            SEQAN_ASSERT(single == bulk);
+            SEQAN_ASSERT_EQ(single(), bulk());
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_random_counter_based_fill)
+{
+    testRandomCounterBasedFill<seqan2::Philox>();
+    testRandomCounterBasedFill<seqan2::Threefry>();
+}
+
+template <typename TSpec>
+void testRandomCounterBasedStreams()
+{
+    using namespace seqan2;
+
+    CounterBasedRng<TSpec> rng(5);
+    CounterBasedRng<TSpec> other(5, 1);
+    SEQAN_ASSERT_EQ(getStream(other), 1u);
+    SEQAN_ASSERT(rng != other);
+    SEQAN_ASSERT_NEQ(rng(), other());
+
+    // Selecting a stream restarts it.
+    setStream(rng, 1);
+    SEQAN_ASSERT_EQ(position(rng), 0u);
+    setStream(other, 1);
+    SEQAN_ASSERT(rng == other);
+    SEQAN_ASSERT_EQ(rng(), other());
+
+    // Reseeding changes the numbers but keeps the stream.
+    rng.seed(6);
+    other.seed(5);
+    SEQAN_ASSERT_EQ(getStream(rng), 1u);
+    SEQAN_ASSERT_NEQ(rng(), other());
+}
+
+SEQAN_DEFINE_TEST(test_random_counter_based_streams)
+{
+    testRandomCounterBasedStreams<seqan2::Philox>();
+    testRandomCounterBasedStreams<seqan2::Threefry>();
+}
+
+SEQAN_DEFINE_TEST(test_random_counter_based_distributions)
+{
+    using namespace seqan2;
+
+    CounterBasedRng<Philox> rng(0);
+    std::uniform_real_distribution<double> dist(0, 1);
+    double sum = 0;
+    for (unsigned i = 0; i < 10000; ++i)
+    {
+        double x = dist(rng);
+        SEQAN_ASSERT(x >= 0 && x < 1);
+        sum += x;
+    }
+    SEQAN_ASSERT_IN_DELTA(sum / 10000, 0.5, 0.02);
+
+    CounterBasedRng<Threefry> rng2(0);
+    std::uniform_int_distribution<int> dist2(1, 6);
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+        int x = dist2(rng2);
+        SEQAN_ASSERT(x >= 1 && x <= 6);
+    }
+}
+
+#endif  // TEST_RANDOM_TEST_RANDOM_COUNTER_BASED_H_
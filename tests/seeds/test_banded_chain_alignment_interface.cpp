@@ -36,6 +36,7 @@
 
 #include <vector>
 #include <sstream>
+#include <random>
 
 #include <seqan/basic.h>
 #include <seqan/stream.h>  // for printing seqan2::String<>
@@ -2481,6 +2482,97 @@ SEQAN_DEFINE_TEST(test_banded_chain_alignment_stl_vector_adaption)
     }
 }
 
+SEQAN_DEFINE_TEST(test_banded_chain_alignment_parallel)
+{
+    using namespace seqan2;
+
+    typedef Seed<Simple> TSeed;
+
+    // Mutate a random sequence and chain the 20-mers that survived unchanged.
+    std::mt19937 rng(42);
+    Dna5String sequenceH;
+    Dna5String sequenceV;
+    String<TSeed> seedChain;
+    unsigned runLength = 0;
+    for (unsigned i = 0; i < 20000u; ++i)
+    {
+        appendValue(sequenceH, Dna5(rng() % 4));
+        unsigned event = rng() % 200;
+        if (event < 6)       // substitution
+        {
+            appendValue(sequenceV, Dna5((ordValue(back(sequenceH)) + 1) % 4));
+            runLength = 0;
+        }
+        else if (event < 7)  // deletion
+        {
+            runLength = 0;
+        }
+        else if (event < 8)  // insertion
+        {
+            appendValue(sequenceV, back(sequenceH));
+            appendValue(sequenceV, Dna5(rng() % 4));
+            runLength = 0;
+        }
+        else
+        {
+            appendValue(sequenceV, back(sequenceH));
+            if (++runLength == 20u)
+            {
+                TSeed seed(i + 1 - 20, length(sequenceV) - 20, 20);
+                if (empty(seedChain) || beginPositionH(seed) >= endPositionH(back(seedChain)) + 60)
+                    appendValue(seedChain, seed);
+                runLength = 0;
+            }
+        }
+    }
+    SEQAN_ASSERT_GT(length(seedChain), 50u);
+
+    Score<int, Simple> scoringScheme(2, -1, -2);
+    for (unsigned config = 0; config < 2; ++config)
+    {
+        Gaps<Dna5String, ArrayGaps> gapsHSerial(sequenceH), gapsVSerial(sequenceV);
+        Gaps<Dna5String, ArrayGaps> gapsH(sequenceH), gapsV(sequenceV);
+        ExecutionPolicy<Parallel, Serial> execPolicy;
+        setNumThreads(execPolicy, 4);
+
+        int serialScore, parallelScore;
+        if (config == 0)
+        {
+            serialScore = bandedChainAlignment(gapsHSerial, gapsVSerial, seedChain, scoringScheme, 5);
+            parallelScore = bandedChainAlignment(execPolicy, gapsH, gapsV, seedChain, scoringScheme, 5);
+        }
+        else
+        {
+            serialScore = bandedChainAlignment(gapsHSerial, gapsVSerial, seedChain, scoringScheme,
+                                               AlignConfig<true, true, true, true>(), 5);
+            parallelScore = bandedChainAlignment(execPolicy, gapsH, gapsV, seedChain, scoringScheme,
+                                                 AlignConfig<true, true, true, true>(), 5);
+        }
+        SEQAN_ASSERT_EQ(parallelScore, serialScore);
+
+        // The computed alignment has to be consistent with the score.  With free end-gaps only the columns between
+        // the first and the last match or mismatch are scored.
+        SEQAN_ASSERT_EQ(length(gapsH), length(gapsV));
+        unsigned firstCol = 0, lastCol = length(gapsH);
+        if (config == 1)
+        {
+            while (isGap(gapsH, firstCol) || isGap(gapsV, firstCol))
+                ++firstCol;
+            while (isGap(gapsH, lastCol - 1) || isGap(gapsV, lastCol - 1))
+                --lastCol;
+        }
+        int alignmentScore = 0;
+        for (unsigned col = firstCol; col < lastCol; ++col)
+        {
+            if (isGap(gapsH, col) || isGap(gapsV, col))
+                alignmentScore += scoreGap(scoringScheme);
+            else
+                alignmentScore += score(scoringScheme, gapsH[col], gapsV[col]);
+        }
+        SEQAN_ASSERT_EQ(alignmentScore, parallelScore);
+    }
+}
+
 SEQAN_BEGIN_TESTSUITE(test_banded_chain_alignment_interface)
 {
     SEQAN_CALL_TEST(test_banded_chain_alignment_align_linear_global_one_score);
@@ -2535,5 +2627,6 @@ SEQAN_BEGIN_TESTSUITE(test_banded_chain_alignment_interface)
     SEQAN_CALL_TEST(test_banded_chain_alignment_fragments_affine_overlap_one_score);
     SEQAN_CALL_TEST(test_banded_chain_alignment_fragments_affine_overlap_two_scores);
     SEQAN_CALL_TEST(test_banded_chain_alignment_stl_vector_adaption);
+    SEQAN_CALL_TEST(test_banded_chain_alignment_parallel);
 }
 SEQAN_END_TESTSUITE
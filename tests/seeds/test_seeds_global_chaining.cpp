@@ -39,6 +39,9 @@
 
 #include <seqan/seeds.h>  // Include module under test.
 
+#include <algorithm>
+#include <random>
+
 // -----------------------------------------------------------------------------
 // Test global chaining weighting the seeds by their length only (Simple Seed)
 // -----------------------------------------------------------------------------
@@ -288,6 +291,63 @@ SEQAN_DEFINE_TEST(test_seeds_global_chaining_same_height)
     }
 }
 
+// Compare the quality of the chain against a quadratic dynamic program on random seeds.
+SEQAN_DEFINE_TEST(test_seeds_global_chaining_random)
+{
+    std::mt19937 rng(42);
+    for (unsigned round = 0; round < 200; ++round)
+    {
+        TSeedSet seedSet;
+        String<TSeed> seeds;
+        unsigned numSeeds = 1 + rng() % 40;
+        for (unsigned i = 0; i < numSeeds; ++i)
+        {
+            unsigned beginH = rng() % 100, beginV = rng() % 100;
+            TSeed seed(beginH, beginV, beginH + 1 + rng() % 8, beginV + 1 + rng() % 8);
+            addSeed(seedSet, seed, Single());
+            appendValue(seeds, seed);
+        }
+
+        String<unsigned> best;
+        resize(best, numSeeds);
+        unsigned expected = 0;
+        std::sort(begin(seeds, Standard()), end(seeds, Standard()), [](TSeed const & a, TSeed const & b)
+                  {
+                      return beginPositionH(a) < beginPositionH(b);
+                  });
+        for (unsigned k = 0; k < numSeeds; ++k)
+        {
+            best[k] = seedSize(seeds[k]);
+            for (unsigned j = 0; j < k; ++j)
+                if (endPositionH(seeds[j]) <= beginPositionH(seeds[k]) &&
+                    endPositionV(seeds[j]) <= beginPositionV(seeds[k]))
+                    best[k] = std::max(best[k], static_cast<unsigned>(best[j] + seedSize(seeds[k])));
+            expected = std::max(expected, best[k]);
+        }
+
+        TSeedChain result;
+        chainSeedsGlobally(result, seedSet, SparseChaining());
+        unsigned quality = 0;
+        for (unsigned i = 0; i < length(result); ++i)
+        {
+            quality += seedSize(result[i]);
+            if (i > 0)
+            {
+                SEQAN_ASSERT_LEQ(endPositionH(result[i - 1]), beginPositionH(result[i]));
+                SEQAN_ASSERT_LEQ(endPositionV(result[i - 1]), beginPositionV(result[i]));
+            }
+        }
+        SEQAN_ASSERT_EQ(quality, expected);
+    }
+
+    // empty seed set
+    TSeedSet seedSet;
+    TSeedChain result;
+    appendValue(result, TSeed(1, 2, 3));
+    chainSeedsGlobally(result, seedSet, SparseChaining());
+    SEQAN_ASSERT(empty(result));
+}
+
 SEQAN_BEGIN_TESTSUITE(test_seeds_global_chaining)
 {
     // Test global chaining of seeds.
@@ -303,6 +363,7 @@ SEQAN_BEGIN_TESTSUITE(test_seeds_global_chaining)
     SEQAN_CALL_TEST(test_seeds_global_chaining_deleting_intermediate_solution);
     SEQAN_CALL_TEST(test_seeds_global_chaining_bordering_rectangles);
     SEQAN_CALL_TEST(test_seeds_global_chaining_same_height);
+    SEQAN_CALL_TEST(test_seeds_global_chaining_random);
 }
 
 SEQAN_END_TESTSUITE
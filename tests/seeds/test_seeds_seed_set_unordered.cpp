@@ -79,8 +79,53 @@ SEQAN_DEFINE_TEST(test_seeds_seed_set_container_functions_unordered)
     }
 }
 
+// Seeds added with Single are iterated sorted by begin diagonal, seeds with the same diagonal in insertion order.
+SEQAN_DEFINE_TEST(test_seeds_seed_set_unordered_sorted)
+{
+    using namespace seqan2;
+
+    typedef Seed<Simple> TSeed;
+    typedef SeedSet<TSeed, Unordered> TSeedSet;
+    typedef Iterator<TSeedSet, Standard>::Type TIterator;
+
+    TSeedSet seedSet;
+    addSeed(seedSet, TSeed(10, 2, 3), Single());
+    addSeed(seedSet, TSeed(1, 4, 3), Single());
+    addSeed(seedSet, TSeed(20, 12, 2), Single());
+    SEQAN_ASSERT_EQ(TSeed(1, 4, 3), front(seedSet));
+    SEQAN_ASSERT_EQ(TSeed(20, 12, 2), back(seedSet));
+
+    // add to the sorted set and iterate again
+    addSeed(seedSet, TSeed(5, 5, 2), Single());
+    addSeed(seedSet, TSeed(0, 3, 1), Single());
+    SEQAN_ASSERT_EQ(length(seedSet), 5u);
+
+    TIterator it = begin(seedSet, Standard());
+    SEQAN_ASSERT_EQ(TSeed(1, 4, 3), *it++);
+    SEQAN_ASSERT_EQ(TSeed(0, 3, 1), *it++);
+    SEQAN_ASSERT_EQ(TSeed(5, 5, 2), *it++);
+    SEQAN_ASSERT_EQ(TSeed(10, 2, 3), *it++);
+    SEQAN_ASSERT_EQ(TSeed(20, 12, 2), *it++);
+    SEQAN_ASSERT(it == end(seedSet, Standard()));
+
+    // merging keeps the set sorted
+    SEQAN_ASSERT(addSeed(seedSet, TSeed(6, 6, 3), 1, Merge()));
+    SEQAN_ASSERT_EQ(length(seedSet), 5u);
+    it = begin(seedSet, Standard());
+    ++it;
+    ++it;
+    SEQAN_ASSERT_EQ(beginPositionH(*it), 5u);
+    SEQAN_ASSERT_EQ(endPositionH(*it), 9u);
+
+    clear(seedSet);
+    SEQAN_ASSERT_EQ(length(seedSet), 0u);
+    addSeed(seedSet, TSeed(3, 1, 2), Single());
+    SEQAN_ASSERT_EQ(TSeed(3, 1, 2), front(seedSet));
+}
+
 SEQAN_BEGIN_TESTSUITE(test_seeds_seed_set)
 {
     SEQAN_CALL_TEST(test_seeds_seed_set_container_functions_unordered);
+    SEQAN_CALL_TEST(test_seeds_seed_set_unordered_sorted);
 }
 SEQAN_END_TESTSUITE
@@ -0,0 +1,261 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the FaiReferenceCache.
+// ==========================================================================
+
+#ifndef TESTS_SEQ_IO_TEST_FAI_REFERENCE_CACHE_H_
+#define TESTS_SEQ_IO_TEST_FAI_REFERENCE_CACHE_H_
+
+#include <fstream>
+
+#include <seqan/seq_io.h>
+
+SEQAN_DEFINE_TEST(test_seq_io_fai_reference_cache_read_region)
+{
+    seqan2::CharString filePath = getAbsolutePath("/tests/seq_io/adeno_genome.fa");
+
+    seqan2::FaiIndex faiIndex;
+    SEQAN_ASSERT(open(faiIndex, toCString(filePath)));
+
+    // Small blocks and capacity to exercise the eviction.
+    seqan2::FaiReferenceCache cache;
+    SEQAN_ASSERT(open(cache, faiIndex, 4, 100));
+
+    seqan2::Dna5String str;
+    readRegion(str, cache, 0, 100, 110);
+    SEQAN_ASSERT_EQ(str, "GAGCGCGCAG");
+    readRegion(str, cache, 0, 4708, 10000);
+    SEQAN_ASSERT_EQ(str, "GAGTGGGCAA");
+
+    seqan2::Dna5String expected;
+    for (unsigned beginPos = 0; beginPos < 4718; beginPos += 97)
+        for (unsigned len = 0; len < 500; len += 63)
+        {
+            readRegion(str, cache, 0, beginPos, beginPos + len);
+            readRegion(expected, faiIndex, 0, beginPos, beginPos + len);
+            SEQAN_ASSERT_EQ(str, expected);
+        }
+    readRegion(str, cache, 1, 0, 8);
+    readRegion(expected, faiIndex, 1, 0, 8);
+    SEQAN_ASSERT_EQ(str, expected);
+
+    SEQAN_ASSERT_GT(cache.hits, 0u);
+    SEQAN_ASSERT_LEQ(cache._lru.size(), 4u);
+
+    seqan2::GenomicRegion region("gi|9632547|ref|NC_002077.1|:101-110");
+    SEQAN_ASSERT(readRegion(str, cache, region));
+    SEQAN_ASSERT_EQ(str, "GAGCGCGCAG");
+    SEQAN_ASSERT_NOT(readRegion(str, cache, seqan2::GenomicRegion("unknown:1-10")));
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_fai_reference_cache_n_runs)
+{
+    // IUPAC codes and N are stored as runs of N.
+    seqan2::CharString filePath = SEQAN_TEMP_FILENAME();
+    append(filePath, ".fa");
+    {
+        std::ofstream out(toCString(filePath));
+        out << ">seq1\nACGTNNN\nNacgtnR\nYACG\n>seq2\nNNNN\n";
+    }
+
+    seqan2::FaiIndex faiIndex;
+    SEQAN_ASSERT(build(faiIndex, toCString(filePath)));
+    seqan2::FaiReferenceCache cache;
+    SEQAN_ASSERT(open(cache, faiIndex, 2, 5));
+
+    seqan2::Dna5String str, expected;
+    for (unsigned beginPos = 0; beginPos < 18; ++beginPos)
+        for (unsigned endPos = beginPos; endPos < 19; ++endPos)
+        {
+            readRegion(str, cache, 0, beginPos, endPos);
+            readRegion(expected, faiIndex, 0, beginPos, endPos);
+            SEQAN_ASSERT_EQ(str, expected);
+        }
+    readRegion(str, cache, 0, 0, 18);
+    SEQAN_ASSERT_EQ(str, "ACGTNNNNACGTNNNACG");
+    readRegion(str, cache, 1, 0, 4);
+    SEQAN_ASSERT_EQ(str, "NNNN");
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_fai_reference_cache_read_regions)
+{
+    seqan2::CharString filePath = getAbsolutePath("/tests/seq_io/adeno_genome.fa");
+
+    seqan2::FaiIndex faiIndex;
+    SEQAN_ASSERT(open(faiIndex, toCString(filePath)));
+    seqan2::FaiReferenceCache cache;
+    SEQAN_ASSERT(open(cache, faiIndex, 8, 256));
+
+    seqan2::String<seqan2::GenomicRegion> regions;
+    for (unsigned i = 0; i < 200; ++i)
+    {
+        seqan2::GenomicRegion region;
+        region.rID = 0;
+        region.beginPos = (i * 7919) % 4700;
+        region.endPos = region.beginPos + 1 + (i * 31) % 300;
+        appendValue(regions, region);
+    }
+    appendValue(regions, seqan2::GenomicRegion("sequence"));
+
+    seqan2::StringSet<seqan2::Dna5String> strs;
+    SEQAN_ASSERT(readRegions(strs, cache, regions));
+    SEQAN_ASSERT_EQ(length(strs), length(regions));
+
+    seqan2::Dna5String expected;
+    for (unsigned i = 0; i < length(regions); ++i)
+    {
+        SEQAN_ASSERT(readRegion(expected, faiIndex, regions[i]));
+        SEQAN_ASSERT_EQ(strs[i], expected);
+    }
+
+    appendValue(regions, seqan2::GenomicRegion("unknown"));
+    SEQAN_ASSERT_NOT(readRegions(strs, cache, regions));
+    SEQAN_ASSERT(empty(back(strs)));
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_fai_reference_cache_read_region_names_parallel)
+{
+    seqan2::CharString filePath = getAbsolutePath("/tests/seq_io/adeno_genome.fa");
+
+    seqan2::FaiIndex faiIndex;
+    SEQAN_ASSERT(open(faiIndex, toCString(filePath)));
+    seqan2::FaiReferenceCache cache;
+    SEQAN_ASSERT(open(cache, faiIndex, 8, 256));
+
+    // Regions given by name only, every fifth name is unknown.
+    seqan2::String<seqan2::GenomicRegion> regions;
+    for (unsigned i = 0; i < 400; ++i)
+    {
+        seqan2::GenomicRegion region;
+        if (i % 5 == 4)
+            region.seqName = "unknown";
+        else
+            region.seqName = faiIndex.seqNameStore[i % 2];
+        region.beginPos = (i * 7919) % sequenceLength(faiIndex, i % 2);
+        region.endPos = region.beginPos + 1 + (i * 31) % 300;
+        appendValue(regions, region);
+    }
+
+    seqan2::StringSet<seqan2::Dna5String> strs;
+    resize(strs, length(regions));
+    seqan2::String<int> found;
+    resize(found, length(regions), 0);
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 1))
+    for (int i = 0; i < (int)length(regions); ++i)
+        found[i] = readRegion(strs[i], cache, regions[i]);
+
+    seqan2::Dna5String expected;
+    for (unsigned i = 0; i < length(regions); ++i)
+    {
+        SEQAN_ASSERT_EQ(found[i] != 0, i % 5 != 4);
+        if (!found[i])
+            continue;
+        SEQAN_ASSERT(readRegion(expected, faiIndex, regions[i]));
+        SEQAN_ASSERT_EQ(strs[i], expected);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_fai_reference_cache_truncated)
+{
+    seqan2::CharString filePath = SEQAN_TEMP_FILENAME();
+    append(filePath, ".fa");
+    {
+        std::ofstream out(toCString(filePath));
+        out << ">seq1\nACGTACGT\nACGTACGT\nACGT\n>seq2\nCCCCGGGG\nCCCCGGGG\n";
+    }
+
+    seqan2::FaiIndex faiIndex;
+    SEQAN_ASSERT(build(faiIndex, toCString(filePath)));
+
+    // Truncate the file within the second sequence after building the index.
+    {
+        std::ofstream out(toCString(filePath));
+        out << ">seq1\nACGTACGT\nACGTACGT\nACGT\n>seq2\nCCCCGG";
+    }
+
+    seqan2::FaiReferenceCache cache;
+    SEQAN_ASSERT(open(cache, faiIndex, 2, 4));
+
+    seqan2::String<seqan2::GenomicRegion> regions;
+    for (unsigned i = 0; i < 64; ++i)
+    {
+        seqan2::GenomicRegion region;
+        region.rID = i % 2;
+        region.beginPos = i % 8;
+        region.endPos = region.beginPos + 8;
+        appendValue(regions, region);
+    }
+
+    seqan2::StringSet<seqan2::Dna5String> strs;
+    bool thrown = false;
+    try
+    {
+        readRegions(strs, cache, regions);
+    }
+    catch (seqan2::UnexpectedEnd const &)
+    {
+        thrown = true;
+    }
+    SEQAN_ASSERT(thrown);
+
+    // The first sequence is still complete.
+    seqan2::Dna5String str;
+    readRegion(str, cache, 0, 8, 20);
+    SEQAN_ASSERT_EQ(str, "ACGTACGTACGT");
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_fai_reference_cache_region_view)
+{
+    seqan2::CharString filePath = getAbsolutePath("/tests/seq_io/adeno_genome.fa");
+
+    seqan2::FaiIndex faiIndex;
+    SEQAN_ASSERT(open(faiIndex, toCString(filePath)));
+    seqan2::FaiReferenceCache cache;
+    SEQAN_ASSERT(open(cache, faiIndex));
+
+    // Within the second line.
+    seqan2::FaiReferenceCache::TRegionView view;
+    SEQAN_ASSERT(regionView(view, cache, 0, 100, 110));
+    SEQAN_ASSERT_EQ(length(view), 10u);
+    SEQAN_ASSERT_EQ(seqan2::Dna5String(view), "GAGCGCGCAG");
+
+    // Spans the line break.
+    SEQAN_ASSERT_NOT(regionView(view, cache, 0, 65, 75));
+
+    SEQAN_ASSERT(regionView(view, cache, 1, 0, 8));
+    seqan2::Dna5String expected;
+    readRegion(expected, faiIndex, 1, 0, 8);
+    SEQAN_ASSERT_EQ(seqan2::Dna5String(view), expected);
+}
+
+#endif  // #ifndef TESTS_SEQ_IO_TEST_FAI_REFERENCE_CACHE_H_
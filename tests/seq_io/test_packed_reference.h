@@ -0,0 +1,175 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the PackedReference.
+// ==========================================================================
+
+#ifndef TESTS_SEQ_IO_TEST_PACKED_REFERENCE_H_
+#define TESTS_SEQ_IO_TEST_PACKED_REFERENCE_H_
+
+#include <fstream>
+
+#include <seqan/seq_io.h>
+
+SEQAN_DEFINE_TEST(test_seq_io_packed_reference_build)
+{
+    // IUPAC codes and N are stored as runs of N, also across sequence borders.
+    seqan2::CharString filePath = SEQAN_TEMP_FILENAME();
+    append(filePath, ".fa");
+    {
+        std::ofstream out(toCString(filePath));
+        out << ">seq1 description\nACGTNNN\nNacgtnR\nYACN\n>seq2\nNNNN\n>seq3\n\n>seq4\nGATTACA\n";
+    }
+
+    seqan2::PackedReference<> ref;
+    SEQAN_ASSERT(build(ref, toCString(filePath)));
+    SEQAN_ASSERT_EQ(numSeqs(ref), 4u);
+    SEQAN_ASSERT_EQ(sequenceName(ref, 0), "seq1");
+    SEQAN_ASSERT_EQ(sequenceName(ref, 3), "seq4");
+    SEQAN_ASSERT_EQ(sequenceLength(ref, 0), 18u);
+    SEQAN_ASSERT_EQ(sequenceLength(ref, 2), 0u);
+    SEQAN_ASSERT_EQ(length(ref.nRuns), 3u);
+    SEQAN_ASSERT_EQ(ref.nRuns[2], (seqan2::Pair<uint64_t, uint64_t>(17, 22)));
+
+    // The packed sequences have A for N.
+    SEQAN_ASSERT_EQ(ref.seqs[0], "ACGTAAAAACGTAAAACA");
+    SEQAN_ASSERT_EQ(ref.seqs[3], "GATTACA");
+
+    seqan2::Dna5String str;
+    readRegion(str, ref, 0, 0, 100);
+    SEQAN_ASSERT_EQ(str, "ACGTNNNNACGTNNNACN");
+    readRegion(str, ref, 0, 5, 9);
+    SEQAN_ASSERT_EQ(str, "NNNA");
+    readRegion(str, ref, 0, 16, 17);
+    SEQAN_ASSERT_EQ(str, "C");
+    readRegion(str, ref, 1, 1, 3);
+    SEQAN_ASSERT_EQ(str, "NN");
+    readRegion(str, ref, 2, 0, 10);
+    SEQAN_ASSERT_EQ(str, "");
+    readRegion(str, ref, 3, 2, 1);
+    SEQAN_ASSERT_EQ(str, "");
+
+    unsigned rID = 0;
+    SEQAN_ASSERT(getIdByName(rID, ref, "seq4"));
+    SEQAN_ASSERT_EQ(rID, 3u);
+    SEQAN_ASSERT_NOT(getIdByName(rID, ref, "seq5"));
+    SEQAN_ASSERT(readRegion(str, ref, seqan2::GenomicRegion("seq4:2-4")));
+    SEQAN_ASSERT_EQ(str, "ATT");
+    SEQAN_ASSERT_NOT(readRegion(str, ref, seqan2::GenomicRegion("seq5")));
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_packed_reference_save_open)
+{
+    seqan2::CharString filePath = getAbsolutePath("/tests/seq_io/adeno_genome.fa");
+    seqan2::StringSet<seqan2::CharString> ids;
+    seqan2::StringSet<seqan2::Dna5String> seqs;
+    {
+        seqan2::SeqFileIn seqFile(toCString(filePath));
+        readRecords(ids, seqs, seqFile);
+    }
+    for (unsigned i = 0; i < length(ids); ++i)
+        cropAfterFirst(ids[i], seqan2::IsWhitespace());
+
+    seqan2::PackedReference<> ref;
+    SEQAN_ASSERT(build(ref, toCString(filePath)));
+    appendSequence(ref, "iupac", "ACGTRYKMNNacgt");
+    appendValue(ids, "iupac");
+    appendValue(seqs, "ACGTNNNNNNACGT");
+
+    seqan2::CharString prefix = SEQAN_TEMP_FILENAME();
+    SEQAN_ASSERT(save(ref, toCString(prefix)));
+
+    // Read into memory.
+    seqan2::PackedReference<> loaded;
+    SEQAN_ASSERT(open(loaded, toCString(prefix)));
+    SEQAN_ASSERT_EQ(numSeqs(loaded), length(seqs));
+
+    // Map into memory.
+    seqan2::PackedReference<seqan2::MMap<> > mapped;
+    SEQAN_ASSERT(open(mapped, toCString(prefix)));
+    SEQAN_ASSERT_EQ(numSeqs(mapped), length(seqs));
+
+    seqan2::Dna5String str;
+    for (unsigned i = 0; i < length(seqs); ++i)
+    {
+        SEQAN_ASSERT_EQ(sequenceName(loaded, i), ids[i]);
+        SEQAN_ASSERT_EQ(sequenceName(mapped, i), ids[i]);
+        SEQAN_ASSERT_EQ(sequenceLength(mapped, i), length(seqs[i]));
+        readRegion(str, loaded, i, 0, length(seqs[i]));
+        SEQAN_ASSERT_EQ(str, seqs[i]);
+        readRegion(str, mapped, i, 0, length(seqs[i]));
+        SEQAN_ASSERT_EQ(str, seqs[i]);
+        for (unsigned beginPos = 0; beginPos < length(seqs[i]); beginPos += 211)
+        {
+            readRegion(str, mapped, i, beginPos, beginPos + 77);
+            SEQAN_ASSERT_EQ(str, infix(seqs[i], beginPos, std::min(beginPos + 77, (unsigned)length(seqs[i]))));
+        }
+    }
+    SEQAN_ASSERT_EQ(mapped.seqs[0][100], seqan2::Dna('G'));
+    clear(mapped);
+
+    // The mapped file is left untouched when the reference is cleared.
+    SEQAN_ASSERT(open(mapped, toCString(prefix)));
+    readRegion(str, mapped, 0, 100, 110);
+    SEQAN_ASSERT_EQ(str, "GAGCGCGCAG");
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_packed_reference_open_inconsistent)
+{
+    seqan2::PackedReference<> ref;
+    appendSequence(ref, "seq1", "ACGTNACGT");
+    appendSequence(ref, "seq2", "ACGT");
+    seqan2::CharString prefix = SEQAN_TEMP_FILENAME();
+    SEQAN_ASSERT(save(ref, toCString(prefix)));
+
+    seqan2::CharString otherPrefix = SEQAN_TEMP_FILENAME();
+    seqan2::PackedReference<> other;
+    appendSequence(other, "seq1", "ACGT");
+    SEQAN_ASSERT(save(other, toCString(otherPrefix)));
+
+    // Replace the names by the ones of a different reference.
+    seqan2::CharString ridPath = prefix;
+    append(ridPath, ".rid");
+    seqan2::CharString otherRidPath = otherPrefix;
+    append(otherRidPath, ".rid");
+    {
+        std::ifstream in(toCString(otherRidPath), std::ios::binary);
+        std::ofstream out(toCString(ridPath), std::ios::binary);
+        out << in.rdbuf();
+    }
+
+    seqan2::PackedReference<> loaded;
+    SEQAN_ASSERT_NOT(open(loaded, toCString(prefix)));
+    SEQAN_ASSERT_EQ(numSeqs(loaded), 0u);
+    SEQAN_ASSERT_NOT(open(loaded, "/nonexistent/reference"));
+}
+
+#endif  // TESTS_SEQ_IO_TEST_PACKED_REFERENCE_H_
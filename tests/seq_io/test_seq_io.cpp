@@ -42,6 +42,8 @@
 
 #include "test_genomic_region.h"
 #include "test_fai_index.h"
+#include "test_fai_reference_cache.h"
+#include "test_packed_reference.h"
 
 #include "test_sequence_file.h"
 #include "test_stream_read_embl.h"
@@ -98,6 +100,17 @@ SEQAN_BEGIN_TESTSUITE(test_seq_io)
     SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read_sequence);
     SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read_region);
 
+    // Test FaiReferenceCache.
+    SEQAN_CALL_TEST(test_seq_io_fai_reference_cache_read_region);
+    SEQAN_CALL_TEST(test_seq_io_fai_reference_cache_n_runs);
+    SEQAN_CALL_TEST(test_seq_io_fai_reference_cache_read_regions);
+    SEQAN_CALL_TEST(test_seq_io_fai_reference_cache_read_region_names_parallel);
+    SEQAN_CALL_TEST(test_seq_io_fai_reference_cache_truncated);
+    SEQAN_CALL_TEST(test_seq_io_fai_reference_cache_region_view);
+    SEQAN_CALL_TEST(test_seq_io_packed_reference_build);
+    SEQAN_CALL_TEST(test_seq_io_packed_reference_save_open);
+    SEQAN_CALL_TEST(test_seq_io_packed_reference_open_inconsistent);
+
     // Tests for EMBL
     SEQAN_CALL_TEST(test_stream_read_embl_single_char_array_stream);
     SEQAN_CALL_TEST(test_stream_read_embl_record_char_array_stream);
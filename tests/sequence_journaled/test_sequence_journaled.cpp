@@ -74,6 +74,7 @@ SEQAN_BEGIN_TESTSUITE(test_sequence_journaled) {
     SEQAN_CALL_TEST(test_sequence_journaled_sorted_array_iterator_decrement);
     SEQAN_CALL_TEST(test_sequence_journaled_sorted_array_iterator_set_position);
     SEQAN_CALL_TEST(test_sequence_journaled_sorted_array_iterator_position);
+    SEQAN_CALL_TEST(test_sequence_journaled_sorted_array_iterator_empty);
     SEQAN_CALL_TEST(test_sequence_journaled_sorted_array_iterator_rooted_at_begin);
     SEQAN_CALL_TEST(test_sequence_journaled_sorted_array_iterator_rooted_at_end);
     SEQAN_CALL_TEST(test_sequence_journaled_sorted_array_iterator_rooted_go_begin);
@@ -439,6 +439,34 @@ void testJournaledStringIteratorAtEnd(THostSpec const &, TStringJournalSpec cons
     }
 }
 
+template <typename THostSpec, typename TStringJournalSpec, typename TBuffSpec>
+void testJournaledStringIteratorEmpty(THostSpec const &, TStringJournalSpec const &, TBuffSpec const &)
+{
+    typedef String<char, Journaled<THostSpec, TStringJournalSpec, TBuffSpec> > TJournalString;
+    typedef typename Iterator<TJournalString, Standard>::Type TIterator;
+    typedef typename Iterator<TJournalString const, Standard>::Type TConstIterator;
+    typedef typename Host<TJournalString>::Type THost;
+
+    {
+        THost hostSeq = "aacac";
+        TJournalString journal(hostSeq);
+
+        erase(journal, 0, 5);  // Erasing everything removes all journal entries.
+        SEQAN_ASSERT(empty(journal));
+
+        TIterator journalIt = begin(journal, Standard());
+        SEQAN_ASSERT(journalIt == end(journal, Standard()));
+        SEQAN_ASSERT_EQ(end(journal, Standard()) - journalIt, 0);
+
+        TJournalString const & constJournal = journal;
+        TConstIterator constIt = begin(constJournal, Standard());
+        SEQAN_ASSERT(constIt == end(constJournal, Standard()));
+
+        insert(journal, 0, "tt");
+        SEQAN_ASSERT_EQ(end(journal, Standard()) - begin(journal, Standard()), 2);
+    }
+}
+
 template <typename THostSpec, typename TStringJournalSpec, typename TBuffSpec>
 void testJournaledStringIteratorGoBegin(THostSpec const &, TStringJournalSpec const &, TBuffSpec const &)
 {
@@ -553,6 +581,12 @@ SEQAN_DEFINE_TEST(test_sequence_journaled_sorted_array_iterator_rooted_at_end)
     testJournaledStringIteratorAtEnd(Alloc<Nothing>(), SortedArray(), Alloc<void>());
 }
 
+SEQAN_DEFINE_TEST(test_sequence_journaled_sorted_array_iterator_empty)
+{
+    testJournaledStringIteratorEmpty(Alloc<void>(), SortedArray(), Alloc<void>());
+    testJournaledStringIteratorEmpty(Alloc<Nothing>(), SortedArray(), Alloc<void>());
+}
+
 SEQAN_DEFINE_TEST(test_sequence_journaled_sorted_array_iterator_rooted_go_begin)
 {
     testJournaledStringIteratorGoBegin(Alloc<void>(), SortedArray(), Alloc<void>());
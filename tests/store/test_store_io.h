@@ -581,6 +581,64 @@ SEQAN_DEFINE_TEST(test_store_io_sam2)
     SEQAN_ASSERT(seqan2::_compareTextFilesAlt(toCString(goldPathSam), toCString(testPathSam)));
 }
 
+// Read in SAM file in parallel, write out SAM file.
+SEQAN_DEFINE_TEST(test_store_io_sam_parallel)
+{
+    FragmentStore<> store;
+
+    std::string goldPathRef = getAbsolutePath("/tests/store/ex1.fa");
+    loadContigs(store, toCString(goldPathRef));
+
+    std::string goldPathSam = getAbsolutePath("/tests/store/ex1.copy.sam");
+    BamFileIn inFile(toCString(goldPathSam));
+    readRecords(store, inFile, Parallel());
+
+    std::string testPathSam = (std::string)SEQAN_TEMP_FILENAME() + ".sam";
+    BamFileOut outFile(toCString(testPathSam));
+    writeRecords(outFile, store);
+    close(outFile);
+
+    SEQAN_ASSERT(seqan2::_compareTextFilesAlt(toCString(goldPathSam), toCString(testPathSam)));
+}
+
+// Read in SAM file into the default and the compact store, both must hold the same alignments.
+SEQAN_DEFINE_TEST(test_store_io_sam_compact)
+{
+    typedef FragmentStore<void, FragmentStoreConfig<CompactStore> > TCompactStore;
+
+    FragmentStore<> store;
+    TCompactStore compactStore;
+
+    std::string goldPathRef = getAbsolutePath("/tests/store/ex1.fa");
+    loadContigs(store, toCString(goldPathRef));
+    loadContigs(compactStore, toCString(goldPathRef));
+
+    std::string goldPathSam = getAbsolutePath("/tests/store/ex1.copy.sam");
+    BamFileIn inFile(toCString(goldPathSam));
+    readRecords(store, inFile);
+    BamFileIn compactInFile(toCString(goldPathSam));
+    readRecords(compactStore, compactInFile, Parallel());
+
+    SEQAN_ASSERT_EQ(length(compactStore.readSeqStore), length(store.readSeqStore));
+    for (unsigned i = 0; i < length(store.readSeqStore); ++i)
+    {
+        SEQAN_ASSERT_EQ(compactStore.readNameStore[i], store.readNameStore[i]);
+        SEQAN_ASSERT_EQ(Dna5String(compactStore.readSeqStore[i]), Dna5String(store.readSeqStore[i]));
+    }
+
+    SEQAN_ASSERT_EQ(length(compactStore.alignedReadStore), length(store.alignedReadStore));
+    for (unsigned i = 0; i < length(store.alignedReadStore); ++i)
+    {
+        SEQAN_ASSERT_EQ(compactStore.alignedReadStore[i].readId, store.alignedReadStore[i].readId);
+        SEQAN_ASSERT_EQ(compactStore.alignedReadStore[i].contigId, store.alignedReadStore[i].contigId);
+        SEQAN_ASSERT_EQ(compactStore.alignedReadStore[i].beginPos, store.alignedReadStore[i].beginPos);
+        SEQAN_ASSERT_EQ(compactStore.alignedReadStore[i].endPos, store.alignedReadStore[i].endPos);
+        SEQAN_ASSERT_EQ(compactStore.alignedReadStore[i].pairMatchId, store.alignedReadStore[i].pairMatchId);
+        SEQAN_ASSERT(compactStore.alignedReadStore[i].gaps == store.alignedReadStore[i].gaps);
+        SEQAN_ASSERT_EQ(compactStore.alignQualityStore[i].errors, store.alignQualityStore[i].errors);
+    }
+}
+
 template <typename TFragStore>
 void _appendReadAlignments(TFragStore &store, char const *fileName)
 {
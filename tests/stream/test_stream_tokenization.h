@@ -360,4 +360,25 @@ SEQAN_TYPED_TEST(TokenizationTest, SkipLine)
     SEQAN_ASSERT(atEnd(ctx.iter));
 }
 
+SEQAN_TYPED_TEST(TokenizationTest, StrSplitMaxSplit)
+{
+    StringSet<CharString> fields;
+    strSplit(fields, CharString("a\tb\t\tc\td"), IsTab(), false, 2u);
+    SEQAN_ASSERT_EQ(length(fields), 3u);
+    SEQAN_ASSERT_EQ(fields[0], "a");
+    SEQAN_ASSERT_EQ(fields[1], "b");
+    SEQAN_ASSERT_EQ(fields[2], "c\td");
+
+    CharString names = "chr1";
+    appendValue(names, '\0');
+    append(names, "chr7");
+    appendValue(names, '\0');
+    append(names, "chr21");
+    clear(fields);
+    strSplit(fields, names, EqualsChar<'\0'>(), true, 2u);
+    SEQAN_ASSERT_EQ(length(fields), 3u);
+    SEQAN_ASSERT_EQ(fields[1], "chr7");
+    SEQAN_ASSERT_EQ(fields[2], "chr21");
+}
+
 #endif // ifndef TEST_STREAM_TEST_STREAM_TOKENIZATION_H_
@@ -41,5 +41,9 @@
 SEQAN_BEGIN_TESTSUITE(test_tabix_io)
 {
     SEQAN_CALL_TEST(test_tabix_io_read_indexed_vcf);
+    SEQAN_CALL_TEST(test_tabix_io_build_tbi);
+    SEQAN_CALL_TEST(test_tabix_io_view_records);
+    SEQAN_CALL_TEST(test_tabix_io_build_csi);
+    SEQAN_CALL_TEST(test_tabix_io_build_bcf_csi);
 }
 SEQAN_END_TESTSUITE
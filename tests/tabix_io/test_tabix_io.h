@@ -116,11 +116,202 @@ SEQAN_DEFINE_TEST(test_tabix_io_read_indexed_vcf)
     SEQAN_ASSERT_NOT(atEnd(vcfFile));
 }
 
+SEQAN_DEFINE_TEST(test_tabix_io_build_tbi)
+{
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/tabix_io/test.vcf.gz");
+    seqan2::CharString tbiPath = vcfPath;
+    append(tbiPath, ".tbi");
+    seqan2::TabixIndex goldIndex(toCString(tbiPath));
+
+    seqan2::TabixIndex index;
+    SEQAN_ASSERT(build(index, toCString(vcfPath)));
+    SEQAN_ASSERT_NOT(index.isCsi);
+    SEQAN_ASSERT_EQ(index.format, goldIndex.format);
+    SEQAN_ASSERT_EQ(index.colSeq, goldIndex.colSeq);
+    SEQAN_ASSERT_EQ(index.colBeg, goldIndex.colBeg);
+    SEQAN_ASSERT_EQ(index.colEnd, goldIndex.colEnd);
+    SEQAN_ASSERT_EQ(length(index._nameStore), 3u);
+    SEQAN_ASSERT_EQ(index._nameStore[0], "chr1");
+    SEQAN_ASSERT_EQ(index._nameStore[1], "chr7");
+    SEQAN_ASSERT_EQ(index._nameStore[2], "chr21");
+    SEQAN_ASSERT(index._nameStore == goldIndex._nameStore);
+
+    // The index is identical to the one of tabix.
+    SEQAN_ASSERT_EQ(length(index._binIndices), length(goldIndex._binIndices));
+    for (unsigned i = 0; i < length(index._binIndices); ++i)
+    {
+        SEQAN_ASSERT(index._linearIndices[i] == goldIndex._linearIndices[i]);
+        SEQAN_ASSERT_EQ(index._binIndices[i].size(), goldIndex._binIndices[i].size());
+        seqan2::TabixIndex::TBinIndex_::const_iterator it = index._binIndices[i].begin();
+        seqan2::TabixIndex::TBinIndex_::const_iterator goldIt = goldIndex._binIndices[i].begin();
+        for (; it != index._binIndices[i].end(); ++it, ++goldIt)
+        {
+            SEQAN_ASSERT_EQ(it->first, goldIt->first);
+            SEQAN_ASSERT(it->second.chunkBegEnds == goldIt->second.chunkBegEnds);
+        }
+    }
+
+    // Save and open.
+    std::string tmpPath = (std::string)SEQAN_TEMP_FILENAME() + ".tbi";
+    SEQAN_ASSERT(save(index, tmpPath.c_str()));
+    seqan2::TabixIndex index2(tmpPath.c_str());
+    SEQAN_ASSERT_NOT(index2.isCsi);
+    SEQAN_ASSERT(index2._nameStore == goldIndex._nameStore);
+    SEQAN_ASSERT_EQ(length(index2._binIndices), length(goldIndex._binIndices));
+    for (unsigned i = 0; i < length(index2._binIndices); ++i)
+        SEQAN_ASSERT_EQ(index2._binIndices[i].size(), goldIndex._binIndices[i].size());
+}
+
+// Compares the records found through the index with a linear scan of the file.
+
+inline void
+_testTabixViewRecords(char const * fileName, seqan2::TabixIndex const & index)
+{
+    seqan2::VcfFileIn vcfFile(fileName);
+    seqan2::VcfHeader header;
+    readHeader(header, vcfFile);
+
+    seqan2::String<seqan2::VcfRecord> allRecords;
+    seqan2::VcfRecord record;
+    while (!atEnd(vcfFile))
+    {
+        readRecord(record, vcfFile);
+        appendValue(allRecords, record);
+    }
+
+    char const * contigs[] = {"chr1", "chr7", "chr21", "chr21"};
+    int32_t begins[] = {66441, 62368, 0, 9411000};
+    int32_t ends[] = {66480, 62370, 1000000000, 9450000};
+    for (unsigned q = 0; q < 4; ++q)
+    {
+        seqan2::String<seqan2::VcfRecord> records;
+        viewRecords(records, vcfFile, index, contigs[q], begins[q], ends[q]);
+
+        seqan2::String<seqan2::VcfRecord> expected;
+        for (unsigned i = 0; i < length(allRecords); ++i)
+            if (contigNames(context(vcfFile))[allRecords[i].rID] == contigs[q] &&
+                allRecords[i].beginPos < ends[q] &&
+                allRecords[i].beginPos + (int32_t)length(allRecords[i].ref) > begins[q])
+                appendValue(expected, allRecords[i]);
+
+        SEQAN_ASSERT_GT(length(expected), 0u);
+        SEQAN_ASSERT_EQ(length(records), length(expected));
+        for (unsigned i = 0; i < length(records); ++i)
+        {
+            SEQAN_ASSERT_EQ(records[i].rID, expected[i].rID);
+            SEQAN_ASSERT_EQ(records[i].beginPos, expected[i].beginPos);
+            SEQAN_ASSERT_EQ(records[i].ref, expected[i].ref);
+            SEQAN_ASSERT_EQ(records[i].alt, expected[i].alt);
+        }
+    }
+
+    seqan2::String<seqan2::VcfRecord> records;
+    viewRecords(records, vcfFile, index, "chr8", 0, 100000);
+    SEQAN_ASSERT(empty(records));
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_view_records)
+{
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/tabix_io/test.vcf.gz");
+    seqan2::CharString tbiPath = vcfPath;
+    append(tbiPath, ".tbi");
+    seqan2::TabixIndex index(toCString(tbiPath));
+    _testTabixViewRecords(toCString(vcfPath), index);
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_build_csi)
+{
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/tabix_io/test.vcf.gz");
+
+    seqan2::TabixIndex index;
+    SEQAN_ASSERT(build(index, toCString(vcfPath), 14));
+    SEQAN_ASSERT(index.isCsi);
+    SEQAN_ASSERT_EQ(index.minShift, 14);
+    SEQAN_ASSERT_EQ(index.depth, 6);
+
+    std::string tmpPath = (std::string)SEQAN_TEMP_FILENAME() + ".csi";
+    SEQAN_ASSERT(save(index, tmpPath.c_str()));
+    seqan2::TabixIndex index2(tmpPath.c_str());
+    SEQAN_ASSERT(index2.isCsi);
+    SEQAN_ASSERT_EQ(index2.depth, 6);
+    SEQAN_ASSERT_EQ(index2.format, 2);
+    SEQAN_ASSERT(index2._nameStore == index._nameStore);
+    _testTabixViewRecords(toCString(vcfPath), index2);
+
+    // The region jump works with CSI, too.
+    seqan2::VcfFileIn vcfFile(toCString(vcfPath));
+    seqan2::VcfHeader header;
+    readHeader(header, vcfFile);
+    bool hasEntries = false;
+    SEQAN_ASSERT(jumpToRegion(vcfFile, hasEntries, "chr7", 62368, 62370, index2));
+    SEQAN_ASSERT(hasEntries);
+    seqan2::VcfRecord record;
+    readRecord(record, vcfFile);
+    SEQAN_ASSERT_EQ(record.beginPos, 62369);
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_build_bcf_csi)
+{
+    // Convert the test file to BCF.
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/tabix_io/test.vcf.gz");
+    std::string bcfPath = (std::string)SEQAN_TEMP_FILENAME() + ".bcf";
+    {
+        seqan2::VcfFileIn vcfIn(toCString(vcfPath));
+        seqan2::VcfHeader header;
+        readHeader(header, vcfIn);
+        seqan2::String<seqan2::VcfRecord> records;
+        seqan2::VcfRecord record;
+        while (!atEnd(vcfIn))
+        {
+            readRecord(record, vcfIn);
+            appendValue(records, record);
+        }
+
+        seqan2::VcfFileOut bcfOut(context(vcfIn), bcfPath.c_str());
+        writeHeader(bcfOut, header);
+        for (unsigned i = 0; i < length(records); ++i)
+            writeRecord(bcfOut, records[i]);
+    }
+
+    seqan2::TabixIndex index;
+    SEQAN_ASSERT(build(index, bcfPath.c_str()));
+    SEQAN_ASSERT(index.isCsi);
+    SEQAN_ASSERT_EQ(index.minShift, 14);
+    SEQAN_ASSERT(empty(index._nameStore));
+
+    std::string csiPath = bcfPath + ".csi";
+    SEQAN_ASSERT(save(index, csiPath.c_str()));
+    seqan2::TabixIndex index2(csiPath.c_str());
+    SEQAN_ASSERT(index2.isCsi);
+    SEQAN_ASSERT_EQ(index2.depth, index.depth);
+    _testTabixViewRecords(bcfPath.c_str(), index2);
+}
+
 #else // SEQAN_HAS_ZLIB
 SEQAN_DEFINE_TEST(test_tabix_io_read_indexed_vcf)
 {
     SEQAN_SKIP_TEST;
 }
+
+SEQAN_DEFINE_TEST(test_tabix_io_build_tbi)
+{
+    SEQAN_SKIP_TEST;
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_view_records)
+{
+    SEQAN_SKIP_TEST;
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_build_csi)
+{
+    SEQAN_SKIP_TEST;
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_build_bcf_csi)
+{
+    SEQAN_SKIP_TEST;
+}
 #endif // SEQAN_HAS_ZLIB
 
 
@@ -51,5 +51,9 @@ SEQAN_BEGIN_TESTSUITE(test_vcf_io)
 
     SEQAN_CALL_TEST(test_vcf_io_isOpen_fileIn);
     SEQAN_CALL_TEST(test_vcf_io_isOpen_fileOut);
+
+    SEQAN_CALL_TEST(test_vcf_io_lazy_genotypes_vcf);
+    SEQAN_CALL_TEST(test_vcf_io_bcf_read_write);
+    SEQAN_CALL_TEST(test_vcf_io_lazy_genotypes_bcf);
 }
 SEQAN_END_TESTSUITE
@@ -544,4 +544,167 @@ SEQAN_DEFINE_TEST(test_vcf_io_isOpen_fileOut)
     SEQAN_ASSERT(!isOpen(vcfO));
 }
 
+SEQAN_DEFINE_TEST(test_vcf_io_lazy_genotypes_vcf)
+{
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/vcf_io/example.vcf");
+    seqan2::VcfFileIn vcfIn(toCString(vcfPath));
+    context(vcfIn).lazyGenotypes = true;
+
+    std::string tmpPath = (std::string)SEQAN_TEMP_FILENAME() + ".vcf";
+    seqan2::VcfFileOut vcfOut(context(vcfIn), tmpPath.c_str());
+
+    seqan2::VcfHeader header;
+    readHeader(header, vcfIn);
+    writeHeader(vcfOut, header);
+
+    seqan2::VcfRecord record;
+    seqan2::CharString info;
+
+    readRecord(record, vcfIn);
+    SEQAN_ASSERT(empty(record.genotypeInfos));
+    SEQAN_ASSERT_EQ(record.format, "GT:GQ:DP:HQ");
+    getGenotypeInfo(info, record, 2);
+    SEQAN_ASSERT_EQ(info, "1/1:43:5:.,.");
+    getGenotypeInfo(info, record, 0);
+    SEQAN_ASSERT_EQ(info, "0|0:48:1:51,51");
+    writeRecord(vcfOut, record);
+
+    // Decoding all samples.
+    readRecord(record, vcfIn);
+    loadGenotypeInfos(record);
+    SEQAN_ASSERT_EQ(length(record.genotypeInfos), 3u);
+    SEQAN_ASSERT_EQ(record.genotypeInfos[1], "0|1:3:5:65,3");
+    SEQAN_ASSERT_EQ(record.genotypeInfos[2], "0/0:41:3");
+    getGenotypeInfo(info, record, 1);
+    SEQAN_ASSERT_EQ(info, "0|1:3:5:65,3");
+    writeRecord(vcfOut, record);
+
+    readRecord(record, vcfIn);
+    writeRecord(vcfOut, record);
+    SEQAN_ASSERT(atEnd(vcfIn));
+    close(vcfOut);
+
+    SEQAN_ASSERT(seqan2::_compareTextFilesAlt(tmpPath.c_str(), toCString(vcfPath)));
+}
+
+#if SEQAN_HAS_ZLIB
+SEQAN_DEFINE_TEST(test_vcf_io_bcf_read_write)
+{
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/vcf_io/example.vcf");
+    seqan2::VcfFileIn vcfIn(toCString(vcfPath));
+    seqan2::VcfHeader header;
+    readHeader(header, vcfIn);
+    seqan2::String<seqan2::VcfRecord> records;
+    seqan2::VcfRecord record;
+    while (!atEnd(vcfIn))
+    {
+        readRecord(record, vcfIn);
+        appendValue(records, record);
+    }
+
+    // Write BCF.
+    std::string bcfPath = (std::string)SEQAN_TEMP_FILENAME() + ".bcf";
+    {
+        seqan2::VcfFileOut bcfOut(context(vcfIn), bcfPath.c_str());
+        SEQAN_ASSERT(isEqual(format(bcfOut), seqan2::Bcf()));
+        writeHeader(bcfOut, header);
+        for (unsigned i = 0; i < length(records); ++i)
+            writeRecord(bcfOut, records[i]);
+    }
+
+    // Read BCF and write VCF again.
+    std::string tmpPath = (std::string)SEQAN_TEMP_FILENAME() + ".vcf";
+    {
+        seqan2::VcfFileIn bcfIn(bcfPath.c_str());
+        SEQAN_ASSERT(isEqual(format(bcfIn), seqan2::Bcf()));
+        seqan2::VcfHeader bcfHeader;
+        readHeader(bcfHeader, bcfIn);
+        SEQAN_ASSERT_EQ(length(sampleNames(context(bcfIn))), 3u);
+        SEQAN_ASSERT_EQ(sampleNames(context(bcfIn))[2], "NA00003");
+        SEQAN_ASSERT_EQ(length(contigNames(context(bcfIn))), 1u);
+
+        seqan2::VcfFileOut vcfOut(context(bcfIn), tmpPath.c_str());
+        writeHeader(vcfOut, header);
+        for (unsigned i = 0; i < length(records); ++i)
+        {
+            SEQAN_ASSERT_NOT(atEnd(bcfIn));
+            readRecord(record, bcfIn);
+            SEQAN_ASSERT_EQ(record.rID, records[i].rID);
+            SEQAN_ASSERT_EQ(record.beginPos, records[i].beginPos);
+            SEQAN_ASSERT_EQ(record.id, records[i].id);
+            SEQAN_ASSERT_EQ(record.ref, records[i].ref);
+            SEQAN_ASSERT_EQ(record.alt, records[i].alt);
+            SEQAN_ASSERT_EQ(record.qual, records[i].qual);
+            SEQAN_ASSERT_EQ(record.filter, records[i].filter);
+            SEQAN_ASSERT_EQ(record.info, records[i].info);
+            SEQAN_ASSERT_EQ(record.format, records[i].format);
+            SEQAN_ASSERT_EQ(length(record.genotypeInfos), length(records[i].genotypeInfos));
+            for (unsigned j = 0; j < length(record.genotypeInfos); ++j)
+                SEQAN_ASSERT_EQ(record.genotypeInfos[j], records[i].genotypeInfos[j]);
+            writeRecord(vcfOut, record);
+        }
+        SEQAN_ASSERT(atEnd(bcfIn));
+    }
+    SEQAN_ASSERT(seqan2::_compareTextFilesAlt(tmpPath.c_str(), toCString(vcfPath)));
+}
+
+SEQAN_DEFINE_TEST(test_vcf_io_lazy_genotypes_bcf)
+{
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/vcf_io/example.vcf");
+    seqan2::VcfFileIn vcfIn(toCString(vcfPath));
+    seqan2::VcfHeader header;
+    readHeader(header, vcfIn);
+
+    // Write BCF from lazily read records.
+    std::string bcfPath = (std::string)SEQAN_TEMP_FILENAME() + ".bcf";
+    {
+        context(vcfIn).lazyGenotypes = true;
+        seqan2::VcfFileOut bcfOut(context(vcfIn), bcfPath.c_str());
+        writeHeader(bcfOut, header);
+        seqan2::VcfRecord record;
+        while (!atEnd(vcfIn))
+        {
+            readRecord(record, vcfIn);
+            writeRecord(bcfOut, record);
+        }
+    }
+
+    seqan2::VcfFileIn bcfIn(bcfPath.c_str());
+    context(bcfIn).lazyGenotypes = true;
+    readHeader(header, bcfIn);
+
+    seqan2::VcfRecord record;
+    seqan2::CharString info;
+    readRecord(record, bcfIn);
+    SEQAN_ASSERT(empty(record.genotypeInfos));
+    getGenotypeInfo(info, record, 1);
+    SEQAN_ASSERT_EQ(info, "1|0:48:8:51,51");
+    getGenotypeInfo(info, record, 2);
+    SEQAN_ASSERT_EQ(info, "1/1:43:5:.,.");
+
+    readRecord(record, bcfIn);
+    getGenotypeInfo(info, record, 2);
+    SEQAN_ASSERT_EQ(info, "0/0:41:3");
+
+    readRecord(record, bcfIn);
+    loadGenotypeInfos(record);
+    SEQAN_ASSERT_EQ(length(record.genotypeInfos), 3u);
+    SEQAN_ASSERT_EQ(record.genotypeInfos[0], "1|2:21:6:23,27");
+    SEQAN_ASSERT_EQ(record.genotypeInfos[1], "2|1:2:0:18,2");
+    SEQAN_ASSERT_EQ(record.genotypeInfos[2], "2/2:35:4");
+    SEQAN_ASSERT(atEnd(bcfIn));
+}
+
+#else  // SEQAN_HAS_ZLIB
+SEQAN_DEFINE_TEST(test_vcf_io_bcf_read_write)
+{
+    SEQAN_SKIP_TEST;
+}
+
+SEQAN_DEFINE_TEST(test_vcf_io_lazy_genotypes_bcf)
+{
+    SEQAN_SKIP_TEST;
+}
+#endif  // SEQAN_HAS_ZLIB
+
 #endif  // SEQAN_TESTS_VCF_TEST_VCF_IO_H_